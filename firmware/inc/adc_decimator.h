@@ -0,0 +1,76 @@
+#ifndef ADC_DECIMATOR_H
+#define ADC_DECIMATOR_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Averages an interleaved stream of conversions from several inputs
+ *  (input 0, 1, ..., 0, 1, ...) down to one value per input every
+ *  decimation rounds.
+ * \details A round is one conversion of every input. add() is called once
+ *  per conversion, so it is an add and a compare except at the end of
+ *  each decimation period. Conversions before the first input 0 after a
+ *  reset are dropped so that every value averages whole rounds.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class ADCDecimator
+{
+public:
+    static constexpr uint32_t MAX_INPUTS = 5;
+    static constexpr uint32_t MAX_DECIMATION = 65535; // Sums fit 32 bits.
+
+    ADCDecimator();
+    ~ADCDecimator();
+
+/**
+ * \brief set the number of inputs and rounds averaged per value, and
+ *  reset.
+ * \returns false (and leaves the configuration unchanged) if either is 0
+ *  or too large.
+ */
+    bool configure(uint32_t num_inputs, uint32_t decimation);
+
+/**
+ * \brief discard partial sums and wait for the next input 0.
+ */
+    void reset();
+
+/**
+ * \brief add one conversion.
+ * \param input which input, in [0, num_inputs()).
+ * \returns true if this conversion completed a new set of values.
+ */
+    inline bool add(uint32_t input, uint16_t conversion)
+    {
+        if (!synced_)
+        {
+            if (input != 0)
+                return false;
+            synced_ = true;
+        }
+        sums_[input] += conversion;
+        if (input != num_inputs_ - 1 || ++rounds_ < decimation_)
+            return false;
+        publish();
+        return true;
+    }
+
+    uint32_t num_inputs() const {return num_inputs_;}
+    uint32_t decimation() const {return decimation_;}
+
+/**
+ * \brief the most recent value of each input.
+ */
+    const uint16_t* values() const {return values_;}
+
+private:
+    void publish();
+
+    uint32_t sums_[MAX_INPUTS];
+    uint16_t values_[MAX_INPUTS];
+    uint32_t num_inputs_;
+    uint32_t decimation_;
+    uint32_t rounds_;
+    bool synced_;
+};
+#endif // ADC_DECIMATOR_H
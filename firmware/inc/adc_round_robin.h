@@ -0,0 +1,74 @@
+#ifndef ADC_ROUND_ROBIN_H
+#define ADC_ROUND_ROBIN_H
+#include <pico/stdlib.h>
+#include <hardware/adc.h>
+#include <hardware/dma.h>
+
+/**
+ * \brief The RP2040's on-chip ADC converting several inputs in turn,
+ *  free-running, with DMA streaming every conversion into a ring buffer.
+ * \details Inputs 0-3 are GPIO 26-29. Input 4 is the on-chip temperature
+ *  sensor. Conversions are written in increasing input order starting from
+ *  the first element of the buffer, so with a buffer size that is a
+ *  multiple of the number of inputs, the input of each element is fixed:
+ *  element i holds input number i % num_inputs() of the selected inputs.
+ *  One DMA channel writes the ring and a second one re-triggers it once its
+ *  transfer count runs out, so the stream runs indefinitely without CPU
+ *  intervention.
+ */
+class ADCRoundRobin
+{
+public:
+    static constexpr uint32_t ADC_CLOCK_HZ = 48'000'000;
+    static constexpr uint32_t MAX_CONVERSION_RATE_HZ = 500'000;
+    static constexpr uint32_t TEMPERATURE_SENSOR_INPUT = 4;
+
+/**
+ * \param input_mask bit n selects input n.
+ */
+    ADCRoundRobin(uint8_t input_mask);
+    ~ADCRoundRobin();
+
+    uint32_t num_inputs() const {return num_inputs_;}
+
+/**
+ * \brief set the total conversion rate, shared between all inputs.
+ * \returns the rate actually set, i.e: clamped to the ADC's range.
+ */
+    uint32_t set_conversion_rate_hz(uint32_t rate_hz);
+
+/**
+ * \brief stream every conversion into buffer, wrapping around.
+ * \param buffer must be aligned to its size in bytes.
+ * \param num_samples a power of two of at most 16384.
+ */
+    void setup_dma_stream_to_memory(volatile uint16_t* buffer,
+                                    size_t num_samples);
+
+/**
+ * \brief (re)start converting from the first input, with DMA writing from
+ *  the start of the buffer again.
+ */
+    void start();
+
+/**
+ * \brief stop converting. The DMA stream waits for conversions.
+ */
+    void stop();
+
+/**
+ * \brief address that DMA will write the next conversion to.
+ */
+    uintptr_t write_address() const
+    {return dma_hw->ch[data_chan_].write_addr;}
+
+private:
+    volatile uint16_t* buffer_;
+    uint32_t num_inputs_;
+    uint8_t first_input_;
+    uint8_t input_mask_;
+    int data_chan_;
+    int reload_chan_;
+    uint32_t transfer_count_reload_; // Read by the reload channel.
+};
+#endif // ADC_ROUND_ROBIN_H
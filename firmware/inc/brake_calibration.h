@@ -0,0 +1,122 @@
+#ifndef BRAKE_CALIBRATION_H
+#define BRAKE_CALIBRATION_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Lookup table mapping a desired brake torque to a brake setpoint
+ *  (DAC code).
+ * \details Points are brake setpoints at evenly-spaced torques from 0 to the
+ *  full-scale torque, inclusive, i.e: the host samples its fitted
+ *  torque-to-setpoint curve on a uniform grid. Spacing is stored as a
+ *  precomputed reciprocal so that evaluate() is a multiply, a shift, and a
+ *  linear interpolation with no division.
+ *  Torques are unsigned Q16.16 fixed-point N*m since the brake can only
+ *  resist motion. Torques beyond full scale hold the last point.
+ *  The table (and its checksum) can be stored as a flat record, e.g: in flash.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class BrakeCalibration
+{
+public:
+    static constexpr size_t MAX_POINTS = 256;
+    static constexpr uint32_t RECORD_MAGIC = 0x4C414342; // "BCAL"
+
+    // Flat little-endian storage format. Naturally aligned, so no padding.
+    struct record_t
+    {
+        uint32_t magic;
+        uint16_t num_points;
+        uint16_t reserved;
+        uint32_t full_scale_torque_q16;
+        uint16_t points[MAX_POINTS];
+        uint32_t checksum; // of num_points through points[num_points - 1].
+    };
+    static_assert(sizeof(record_t) == 12 + 2 * MAX_POINTS + 4,
+                  "BrakeCalibration record must not contain padding.");
+
+    BrakeCalibration();
+    ~BrakeCalibration();
+
+/**
+ * \brief copy points into the table starting at index. Points beyond the end
+ *  of the table are dropped.
+ * \returns the number of points copied.
+ */
+    size_t write(size_t index, const uint16_t* points, size_t count);
+
+    uint16_t point(size_t index) const {return points_[index];}
+
+/**
+ * \brief set the number of points in use and the torque of the last one.
+ * \returns false (and leaves the configuration unchanged) if there are
+ *  fewer than 2 points, more than MAX_POINTS, or the full-scale torque is 0.
+ */
+    bool configure(size_t num_points, uint32_t full_scale_torque_q16);
+
+/**
+ * \brief clear the table so that is_valid() is false.
+ */
+    void clear();
+
+    bool is_valid() const {return num_points_ != 0;}
+    size_t num_points() const {return num_points_;}
+    uint32_t full_scale_torque_q16() const {return full_scale_torque_q16_;}
+
+/**
+ * \brief CRC-32 (zlib.crc32) of the little-endian
+ *  [num_points (U16), 0 (U16), full_scale_torque_q16 (U32),
+ *   points[0:num_points] (U16)]. 0 if the table is not valid.
+ */
+    uint32_t checksum() const {return checksum_;}
+
+/**
+ * \brief brake setpoint for the specified torque. 0 if not valid.
+ */
+    uint16_t evaluate(uint32_t torque_q16) const
+    {
+        if (num_points_ == 0)
+            return 0;
+        if (torque_q16 >= full_scale_torque_q16_)
+            return points_[num_points_ - 1];
+        // Q16.16 position along the table.
+        const uint32_t position_q16 =
+            uint32_t((uint64_t(torque_q16) * index_per_torque_q16_) >> 16);
+        const uint32_t index = position_q16 >> 16;
+        if (index >= uint32_t(num_points_) - 1)
+            return points_[num_points_ - 1];
+        // Q15 fraction keeps (point difference * fraction) within 32 bits.
+        const int32_t fraction_q15 = int32_t((position_q16 & 0xFFFF) >> 1);
+        const int32_t value = points_[index];
+        const int32_t delta = int32_t(points_[index + 1]) - value;
+        return uint16_t(value + ((delta * fraction_q15) >> 15));
+    }
+
+/**
+ * \brief store the table in a record.
+ */
+    void save(record_t& record) const;
+
+/**
+ * \brief load the table from a record.
+ * \returns false (and leaves the table unchanged) if the record is not a
+ *  valid table, e.g: erased flash or a failed checksum.
+ */
+    bool load(const record_t& record);
+
+/**
+ * \brief make this table a copy of another one.
+ */
+    void copy(const BrakeCalibration& other);
+
+private:
+    static uint32_t compute_checksum(const uint16_t* points, size_t num_points,
+                                     uint32_t full_scale_torque_q16);
+
+    uint16_t points_[MAX_POINTS];
+    uint64_t index_per_torque_q16_; // ((num_points - 1) << 32) / full scale.
+    uint32_t full_scale_torque_q16_;
+    uint32_t checksum_;
+    uint16_t num_points_;
+};
+#endif // BRAKE_CALIBRATION_H
@@ -0,0 +1,60 @@
+#ifndef BRAKE_CURRENT_CONTROLLER_H
+#define BRAKE_CURRENT_CONTROLLER_H
+#include <stdint.h>
+
+/**
+ * \brief Fixed-point PI current controller for the brake coil.
+ * \details Error is computed in ADC counts of the brake current sensor.
+ *  Output is a 16-bit (full-scale) DAC code. Gains are Q8.8 and are applied
+ *  per update, so the effective integral gain scales with the update rate.
+ *  Anti-windup is done by conditional integration: the integrator only
+ *  accumulates if doing so does not push an already-saturated output further
+ *  into saturation.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class BrakeCurrentController
+{
+public:
+    static constexpr int32_t OUTPUT_MAX = UINT16_MAX;
+    static constexpr uint32_t GAIN_FRACTIONAL_BITS = 8;
+
+    BrakeCurrentController();
+    ~BrakeCurrentController();
+
+/**
+ * \brief set the proportional and integral gains in Q8.8 fixed-point.
+ */
+    void set_gains(uint16_t kp_q8, uint16_t ki_q8)
+    {kp_q8_ = kp_q8; ki_q8_ = ki_q8;}
+
+/**
+ * \brief set the target current in ADC counts.
+ */
+    void set_setpoint(int32_t setpoint_counts) {setpoint_ = setpoint_counts;}
+
+    int32_t setpoint() const {return setpoint_;}
+
+/**
+ * \brief compute a new output from the latest current measurement.
+ * \returns the new DAC output code.
+ */
+    uint16_t update(int32_t measurement_counts);
+
+/**
+ * \brief clear the integrator and output.
+ */
+    void reset();
+
+    int32_t error() const {return error_;}
+    int32_t integrator() const {return integrator_q8_ >> GAIN_FRACTIONAL_BITS;}
+    uint16_t output() const {return output_;}
+
+private:
+    int32_t setpoint_;
+    int32_t error_;
+    int32_t integrator_q8_;
+    uint16_t output_;
+    uint16_t kp_q8_;
+    uint16_t ki_q8_;
+};
+#endif // BRAKE_CURRENT_CONTROLLER_H
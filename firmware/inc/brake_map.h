@@ -0,0 +1,58 @@
+#ifndef BRAKE_MAP_H
+#define BRAKE_MAP_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Lookup table mapping encoder position to a brake setpoint.
+ * \details Points are evenly spaced every 2^spacing_log2 encoder ticks
+ *  starting at position 0. Between points, the output is either held at the
+ *  previous point or linearly interpolated in fixed point. Positions before
+ *  the first point or after the last point hold the value at that end.
+ *  If a wrap length is set, positions repeat every wrap length ticks and the
+ *  last point interpolates toward the first one.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class BrakeMap
+{
+public:
+    static constexpr size_t MAX_POINTS = 1024;
+    // Keeps (point difference * fraction) within 32 bits.
+    static constexpr uint32_t MAX_SPACING_LOG2 = 15;
+
+    BrakeMap();
+    ~BrakeMap();
+
+/**
+ * \brief copy points into the table starting at index. Points beyond the end
+ *  of the table are dropped.
+ * \returns the number of points copied.
+ */
+    size_t write(size_t index, const uint16_t* points, size_t count);
+
+    uint16_t point(size_t index) const {return points_[index];}
+
+/**
+ * \brief set how the table maps positions to points.
+ * \param wrap_length_ticks 0 --> no wrapping.
+ * \returns false (and leaves the configuration unchanged) if the length,
+ *  spacing, or wrap length is out of range.
+ */
+    bool configure(size_t length, uint32_t spacing_log2,
+                   uint32_t wrap_length_ticks, bool interpolate);
+
+    size_t length() const {return length_;}
+
+/**
+ * \brief brake setpoint at the specified encoder position. 0 if empty.
+ */
+    uint16_t evaluate(int32_t position_ticks) const;
+
+private:
+    uint16_t points_[MAX_POINTS];
+    size_t length_;
+    uint32_t spacing_log2_;
+    int32_t wrap_length_;
+    bool interpolate_;
+};
+#endif // BRAKE_MAP_H
@@ -0,0 +1,74 @@
+#ifndef BRAKE_TRAJECTORY_H
+#define BRAKE_TRAJECTORY_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Table of brake setpoints to be played out one point per sample
+ *  period.
+ * \details The table is uploaded in chunks while idle. Playback walks the
+ *  first length() points once, or repeatedly if looping. Timing is up to the
+ *  caller, which should call next() once per sample period.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class BrakeTrajectory
+{
+public:
+    static constexpr size_t MAX_POINTS = 2048;
+
+    BrakeTrajectory();
+    ~BrakeTrajectory();
+
+/**
+ * \brief copy points into the table starting at index. Points beyond the end
+ *  of the table are dropped.
+ * \returns the number of points copied.
+ */
+    size_t write(size_t index, const uint16_t* points, size_t count);
+
+    uint16_t point(size_t index) const {return points_[index];}
+
+/**
+ * \brief copy the points and length of another table. Playback state is
+ *  left unchanged.
+ */
+    void copy_table(const BrakeTrajectory& other);
+
+/**
+ * \brief set the number of points to play.
+ * \returns false (and leaves the length unchanged) if length exceeds
+ *  MAX_POINTS.
+ */
+    bool set_length(size_t length);
+
+    size_t length() const {return length_;}
+
+/**
+ * \brief start playback from the first point.
+ * \returns false if the table is empty.
+ */
+    bool start(bool loop);
+
+    void stop() {playing_ = false;}
+
+    bool is_playing() const {return playing_;}
+
+/**
+ * \brief get the next point to play.
+ * \returns false (and stops playback) if the last point was already played.
+ */
+    bool next(uint16_t& value);
+
+/**
+ * \brief index of the next point to play.
+ */
+    size_t position() const {return position_;}
+
+private:
+    uint16_t points_[MAX_POINTS];
+    size_t length_;
+    size_t position_;
+    bool loop_;
+    bool playing_;
+};
+#endif // BRAKE_TRAJECTORY_H
@@ -0,0 +1,61 @@
+#ifndef CHANGE_TRIGGER_H
+#define CHANGE_TRIGGER_H
+#include <stdint.h>
+
+/**
+ * \brief Decides whether a sensor sample differs enough from the last one
+ *  reported to be worth reporting.
+ * \details A sample triggers if the encoder moved by at least its threshold
+ *  or if torque or brake current changed by more than their deadband, all
+ *  relative to the last sample that triggered. A heartbeat forces a trigger
+ *  if nothing has triggered for the heartbeat interval so that the host can
+ *  tell a stationary treadmill from a dead link.
+ *  All thresholds at zero disables the trigger, i.e: every sample triggers.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class ChangeTrigger
+{
+public:
+    ChangeTrigger();
+    ~ChangeTrigger();
+
+/**
+ * \brief set the change thresholds. Analog deadbands are in raw ADC counts.
+ *  The next sample triggers.
+ */
+    void set_thresholds(uint32_t encoder_ticks, uint32_t torque_deadband,
+                        uint32_t brake_current_deadband);
+
+/**
+ * \brief set the longest interval without a trigger. 0 disables the
+ *  heartbeat.
+ */
+    void set_heartbeat_us(uint32_t heartbeat_us) {heartbeat_us_ = heartbeat_us;}
+
+    bool enabled() const
+    {return encoder_threshold_ || torque_deadband_ || brake_current_deadband_;}
+
+/**
+ * \brief make the next sample trigger, e.g: after the output was paused.
+ */
+    void reset() {has_reference_ = false;}
+
+/**
+ * \brief check a sample and, if it triggers, make it the new reference.
+ * \returns true if the sample should be reported.
+ */
+    bool update(uint64_t time_us, int32_t encoder_ticks,
+                int16_t reaction_torque, int16_t brake_current);
+
+private:
+    uint64_t reference_time_us_;
+    int32_t reference_encoder_ticks_;
+    int16_t reference_torque_;
+    int16_t reference_brake_current_;
+    uint32_t encoder_threshold_;
+    uint32_t torque_deadband_;
+    uint32_t brake_current_deadband_;
+    uint32_t heartbeat_us_;
+    bool has_reference_;
+};
+#endif // CHANGE_TRIGGER_H
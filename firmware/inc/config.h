@@ -15,6 +15,12 @@
 #define LED1 (25)
 
 #define ENCODER_BASE_PIN (16) // 16 = A, 17 = B
+// Additional encoders, e.g: a motorized belt or a rotating wheel, each on an
+// A/B pin pair. The treadmill encoder is always the first.
+#define NUM_ENCODERS (1) // Up to 4.
+#define ENCODER_BASE_PINS {ENCODER_BASE_PIN, 12, 14, 26}
+// Rate at which DMA requests the encoder count from the PIO program.
+#define ENCODER_COUNT_REQUEST_FREQUENCY_HZ (1'000'000)
 
 // Brake Current ADC
 #define BRAKE_CURRENT_CS_PIN (18)
@@ -30,13 +36,96 @@
 // Note: not all transducers can physcially reach 0 and 4095 extremes.
 #define RAW_TORQUE_SENSOR_MIN (100)
 #define RAW_TORQUE_SENSOR_MAX (3995) // 12-bit.
+#define RAW_TORQUE_SENSOR_FULL_SCALE (4095)
+
+// Fast torque limit monitor. Checks every torque conversion in an alarm IRQ.
+#define TORQUE_MONITOR_FREQUENCY_HZ (40000)
+#define TORQUE_MONITOR_INTERVAL_US (1'000'000 / TORQUE_MONITOR_FREQUENCY_HZ)
+#define DEFAULT_TORQUE_LIMIT_WINDOW (4) // [samples]. Power of two up to 32.
+#define DEFAULT_TORQUE_LIMIT_HYSTERESIS (50) // [raw ADC counts]
+
+// Number of ADC conversions buffered per sensor. Must be a power of two and
+// hold at least one torque limit check interval worth of conversions.
+#define ADC_RING_SIZE (1024)
+// Window over which each ADC stream's conversion period is measured.
+#define SENSOR_SKEW_WINDOW_US (100'000)
+// Sensor values reach memory up to this long after their stream's regular
+// pace says (DMA and bus latency). Also covers the host simulation, which
+// moves them on whole [us].
+#define SENSOR_STREAM_JITTER_NS (1000)
+// Sensor filters average this many conversions (log2) before their biquads,
+// which run at the decimated rate.
+#define SENSOR_FILTER_DECIMATION_LOG2 (4)
 
 // Brake Setpoint DAC
 #define BRAKE_SETPOINT_CS_PIN (23)
 #define BRAKE_SETPOINT_PICO_PIN (21)
 #define BRAKE_SETPOINT_SCK_PIN (22)
 
+// Brake current sensing: 0.08[ohm] shunt into an INA180A4 (200[V/V]) into a
+// 12-bit ADC with a 3.3[V] reference.
+#define BRAKE_CURRENT_ADC_FULL_SCALE_COUNTS (4096)
+#define BRAKE_CURRENT_ADC_FULL_SCALE_UA (206250) // 3.3[V] / (200 * 0.08[ohm])
+
+// Closed-loop brake current control.
+#define BRAKE_CURRENT_CONTROL_FREQUENCY_HZ (5000)
+#define BRAKE_CURRENT_CONTROL_INTERVAL_US (1'000'000 / BRAKE_CURRENT_CONTROL_FREQUENCY_HZ)
+#define DEFAULT_BRAKE_CURRENT_KP_Q8 (16 << 8)
+#define DEFAULT_BRAKE_CURRENT_KI_Q8 (1 << 8)
+
+// Core1 sensing, safety, and control loop. Runs once per sample alarm.
+#define CORE1_TICK_FREQUENCY_HZ (10000)
+#define CORE1_TICK_INTERVAL_US (1'000'000 / CORE1_TICK_FREQUENCY_HZ)
+#define SAMPLE_LATCH_QUEUE_SIZE (16)
+#define CORE1_CMD_QUEUE_SIZE (32)
+#define CORE1_EVENT_QUEUE_SIZE (256) // 25[ms] of samples at the tick rate.
+
 #define MAX_EVENT_FREQUENCY_HZ (1000)
+#define DEFAULT_SENSOR_DISPATCH_HEARTBEAT_MS (1000) // Change-driven dispatch.
+#define MAX_BATCH_SAMPLE_FREQUENCY_HZ (10000)
+
+// Brake setpoint trajectory playback.
+#define MAX_TRAJECTORY_FREQUENCY_HZ (10000)
+#define DEFAULT_TRAJECTORY_FREQUENCY_HZ (1000)
+#define MAX_TRAJECTORY_POINTS_PER_WRITE (120) // Fits a Harp message payload.
+#define MAX_BRAKE_MAP_POINTS_PER_WRITE (120) // Fits a Harp message payload.
+#define MAX_BRAKE_CALIBRATION_POINTS_PER_WRITE (120) // Fits a Harp message payload.
+
+// Full-rate capture around torque limit trips. Windows are in samples at the
+// core1 tick rate.
+#define DEFAULT_FLIGHT_RECORDER_PRE_SAMPLES (1024)
+#define DEFAULT_FLIGHT_RECORDER_POST_SAMPLES (1024)
+#define MAX_FLIGHT_RECORDS_PER_READ (15) // Fits a Harp message payload.
+
+// Brake step-response self-test. Setpoints are raw DAC codes.
+#define DEFAULT_BRAKE_STEP_LOW (0)
+#define DEFAULT_BRAKE_STEP_HIGH (2048)
+#define DEFAULT_BRAKE_STEP_HOLD_MS (20)
+#define DEFAULT_BRAKE_STEP_COUNT (10)
+// Brake current conversions captured before each step. At least the largest
+// decimation, and well within ADC_RING_SIZE.
+#define BRAKE_STEP_PRE_CONVERSIONS (256)
+#define BRAKE_STEP_SETTLING_BAND_PERMILLE (20) // +/-2% of the step.
+#define MAX_BRAKE_STEP_TRACE_SAMPLES_PER_READ (120) // Fits a Harp message payload.
+
+// Auxiliary analog inputs on the RP2040's own ADC, e.g: supply voltage, brake
+// coil temperature, or an extra load cell. Bit n selects ADC input n, i.e:
+// GPIO 26 + n, and bit 4 the on-chip temperature sensor. Must select a power
+// of two number of inputs. GPIOs 26 and 27 are also the fourth encoder's.
+#define AUX_ANALOG_INPUTS (0b10000)
+// Total rate that the selected inputs share before averaging.
+#define AUX_ADC_CONVERSION_RATE_HZ (100'000)
+// Conversions buffered. A power of two of at most 16384.
+#define AUX_ADC_RING_SIZE (4096) // 41[ms] at the conversion rate.
+
+// Flash storage. Sectors are reserved from the end of flash, away from the
+// program image.
+#define BRAKE_CALIBRATION_FLASH_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE)
+// Persistent configuration log. Wear-leveled over several sectors.
+#define PERSISTENT_CONFIG_FLASH_SECTORS (4)
+#define PERSISTENT_CONFIG_FLASH_OFFSET (BRAKE_CALIBRATION_FLASH_OFFSET \
+    - PERSISTENT_CONFIG_FLASH_SECTORS * FLASH_SECTOR_SIZE)
+#define PERSISTENT_CONFIG_VERSION (1) // Bump if persistent_config_t changes.
 
 
 #define TREADMILL_HARP_DEVICE_ID (0x057A)
@@ -0,0 +1,15 @@
+#ifndef CRC32_H
+#define CRC32_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief standard (IEEE 802.3, reflected) CRC-32 as computed by zlib.crc32,
+ *  so that the host can compute the same checksum in one line of Python.
+ * \param crc the result of a previous call to continue a checksum across
+ *  several buffers. 0 to start a new one.
+ * \note Nibble-wise to keep the lookup table small. Not for hot paths.
+ */
+uint32_t crc32(const uint8_t* data, size_t num_bytes, uint32_t crc = 0);
+
+#endif // CRC32_H
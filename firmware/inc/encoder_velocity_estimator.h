@@ -0,0 +1,81 @@
+#ifndef ENCODER_VELOCITY_ESTIMATOR_H
+#define ENCODER_VELOCITY_ESTIMATOR_H
+#include <stdint.h>
+
+/**
+ * \brief M/T-method encoder velocity and acceleration estimator.
+ * \details Each update, velocity is the number of counts covered by the
+ *  channel-A edges seen since the previous update divided by the time
+ *  between the last edge of the previous update and the last edge of this
+ *  one. Both ends of that interval are edge timestamps, so the estimate is
+ *  not quantized by the sample period at low speed. When there are no new
+ *  edges, the estimate decays no slower than one edge since the last edge
+ *  so that it reaches zero when the belt stops. Edges that arrive before
+ *  the count that goes with them are held over to the next update, since
+ *  their direction is not yet known. When edge timestamps may
+ *  have been lost, the estimate falls back to counts per sample period.
+ *  Acceleration is the first difference of velocity, smoothed with a
+ *  first-order IIR.
+ *  Outputs are Q24.8 fixed-point in [counts/s] and [counts/s^2].
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class EncoderVelocityEstimator
+{
+public:
+    static constexpr uint32_t FRACTIONAL_BITS = 8;
+    // Two quadrature counts per channel-A edge.
+    static constexpr int32_t COUNTS_PER_EDGE = 2;
+    // Acceleration IIR: y[n] = y[n-1] + (x[n] - y[n-1]) >> ACCEL_FILTER_SHIFT
+    static constexpr uint32_t ACCEL_FILTER_SHIFT = 3;
+
+    EncoderVelocityEstimator(uint32_t edge_tick_hz);
+    ~EncoderVelocityEstimator();
+
+/**
+ * \brief clear the estimate and start measuring from the specified count.
+ */
+    void reset(int32_t count, uint64_t now_us);
+
+/**
+ * \brief record a channel-A edge timestamp (in edge timer ticks).
+ */
+    void add_edge(uint32_t timestamp_ticks)
+    {
+        last_edge_ticks_ = timestamp_ticks;
+        ++new_edges_;
+    }
+
+/**
+ * \brief flag that one or more edges since the last update were dropped.
+ */
+    void mark_edges_lost() {edges_lost_ = true;}
+
+/**
+ * \brief compute a new estimate from the edges added since the last update
+ *  and the latest encoder count.
+ */
+    void update(int32_t count, uint64_t now_us);
+
+    int32_t velocity_q8() const {return velocity_q8_;}
+    int32_t acceleration_q8() const {return acceleration_q8_;}
+
+private:
+    int32_t count_per_sample_velocity_q8(int32_t delta_count,
+                                         uint32_t delta_time_us) const;
+
+    uint32_t edge_tick_hz_;
+
+    int32_t prev_count_;
+    uint64_t prev_time_us_;
+
+    uint32_t ref_edge_ticks_;   // Last edge as of the previous update.
+    uint32_t last_edge_ticks_;  // Last edge seen so far.
+    uint64_t last_edge_time_us_; // Update time at which the last edge was seen.
+    uint32_t new_edges_;
+    bool has_ref_edge_;
+    bool edges_lost_;
+
+    int32_t velocity_q8_;
+    int32_t acceleration_q8_;
+};
+#endif // ENCODER_VELOCITY_ESTIMATOR_H
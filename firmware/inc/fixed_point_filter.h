@@ -0,0 +1,155 @@
+#ifndef FIXED_POINT_FILTER_H
+#define FIXED_POINT_FILTER_H
+#include <stdint.h>
+#include <stddef.h>
+
+// Biquad coefficients are Q2.29, which holds the |a1| < 2 of any stable
+// section with room to spare.
+static constexpr uint32_t BIQUAD_COEFFICIENT_FRAC_BITS = 29;
+
+/**
+ * \brief coefficients of one second order section, normalized such that a0
+ *  is 1: y = b0*x + b1*x[-1] + b2*x[-2] - a1*y[-1] - a2*y[-2].
+ */
+struct biquad_coefficients_t
+{
+    int32_t b0;
+    int32_t b1;
+    int32_t b2;
+    int32_t a1;
+    int32_t a2;
+};
+
+/**
+ * \brief Fixed-point filter for one full-rate ADC stream: a moving average
+ *  of 2^DECIMATION_LOG2 conversions, evaluated once every 2^DECIMATION_LOG2
+ *  conversions, followed by a cascade of NUM_SECTIONS biquads at that
+ *  decimated rate.
+ * \details add() is called once per conversion, so it is an add and a
+ *  compare except at the end of each decimation period. Decimating first
+ *  keeps the biquads cheap and puts their cutoffs at a large enough
+ *  fraction of their rate that Q2.29 coefficients stay accurate.
+ *  Biquads are direct form I with 64-bit accumulation, so a section can
+ *  never overflow internally. Signals between sections are conversion
+ *  counts in Q(FRAC_BITS), which leaves 12-bit conversions 3 bits of
+ *  headroom for overshoot.
+ *  The biquads start settled at their first input, assuming a DC gain of 1,
+ *  such that enabling a filter does not kick off a step response from 0.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+template <uint32_t DECIMATION_LOG2, uint32_t NUM_SECTIONS>
+class FilterPipeline
+{
+static_assert(DECIMATION_LOG2 <= 8, "Decimation must be at most 256.");
+static_assert(NUM_SECTIONS > 0, "Use a null set of sections for the moving "
+              "average alone.");
+public:
+    static constexpr uint32_t DECIMATION = 1u << DECIMATION_LOG2;
+    static constexpr uint32_t FRAC_BITS = 16;
+
+    FilterPipeline(): sections_{nullptr} {reset();}
+
+/**
+ * \brief set the biquad coefficients and reset.
+ * \param sections NUM_SECTIONS sets of coefficients, which must outlive
+ *  the filter, or nullptr for the moving average alone.
+ */
+    void set_sections(const biquad_coefficients_t* sections)
+    {
+        sections_ = sections;
+        reset();
+    }
+
+/**
+ * \brief discard the partial average and the biquad history. The next
+ *  output is DECIMATION conversions away.
+ */
+    void reset()
+    {
+        sum_ = 0;
+        count_ = 0;
+        primed_ = false;
+        has_output_ = false;
+        output_ = 0;
+        for (auto& state: state_)
+            state = state_t{};
+    }
+
+/**
+ * \brief add one conversion.
+ * \returns true if this conversion produced a new output.
+ */
+    inline bool add(uint32_t conversion)
+    {
+        sum_ += conversion;
+        if (++count_ < DECIMATION)
+            return false;
+        const int32_t mean = int32_t(sum_ << (FRAC_BITS - DECIMATION_LOG2));
+        sum_ = 0;
+        count_ = 0;
+        output_ = (sections_ == nullptr) ? mean : filter(mean);
+        has_output_ = true;
+        return true;
+    }
+
+/**
+ * \brief whether there has been an output since the last reset.
+ */
+    bool has_output() const {return has_output_;}
+
+/**
+ * \brief the latest output in conversion counts in Q(FRAC_BITS).
+ */
+    int32_t output() const {return output_;}
+
+/**
+ * \brief the latest output rounded to whole conversion counts.
+ */
+    int32_t output_counts() const
+    {return (output_ + (1 << (FRAC_BITS - 1))) >> FRAC_BITS;}
+
+private:
+    struct state_t
+    {
+        int32_t x1;
+        int32_t x2;
+        int32_t y1;
+        int32_t y2;
+    };
+
+    inline int32_t filter(int32_t x)
+    {
+        if (!primed_)
+        {
+            for (auto& state: state_)
+                state = state_t{x, x, x, x};
+            primed_ = true;
+        }
+        for (uint32_t i = 0; i < NUM_SECTIONS; ++i)
+        {
+            const biquad_coefficients_t& c = sections_[i];
+            state_t& s = state_[i];
+            const int64_t acc = int64_t(c.b0) * x + int64_t(c.b1) * s.x1
+                                + int64_t(c.b2) * s.x2 - int64_t(c.a1) * s.y1
+                                - int64_t(c.a2) * s.y2;
+            const int32_t y = int32_t(
+                (acc + (int64_t(1) << (BIQUAD_COEFFICIENT_FRAC_BITS - 1)))
+                >> BIQUAD_COEFFICIENT_FRAC_BITS);
+            s.x2 = s.x1;
+            s.x1 = x;
+            s.y2 = s.y1;
+            s.y1 = y;
+            x = y;
+        }
+        return x;
+    }
+
+    const biquad_coefficients_t* sections_;
+    state_t state_[NUM_SECTIONS];
+    uint32_t sum_;
+    uint32_t count_;
+    int32_t output_;
+    bool primed_;
+    bool has_output_;
+};
+#endif // FIXED_POINT_FILTER_H
@@ -0,0 +1,130 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Circular capture of full-rate samples that freezes a window of
+ *  samples before and after a trigger, e.g: a torque limit trip.
+ * \details While armed, every sample overwrites the oldest one in the ring.
+ *  A trigger marks the next sample as the trigger sample; once the post
+ *  window has been recorded the ring freezes and holds the pre window, the
+ *  trigger sample, and the rest of the post window in time order until it
+ *  is rearmed. add() is called once per sample on the hot path, so it is a
+ *  record copy, an index increment, and a couple of compares.
+ *  Frozen records are never written, so they may be read from another core
+ *  once it has been told (through a queue with release/acquire ordering)
+ *  that the recorder froze.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class FlightRecorder
+{
+public:
+    static constexpr uint32_t CAPACITY = 2048; // 204.8[ms] at 10[kHz].
+    static constexpr uint32_t MASK = CAPACITY - 1;
+    static_assert((CAPACITY & MASK) == 0,
+                  "FlightRecorder capacity must be a power of two.");
+
+    enum state_t: uint8_t
+    {
+        IDLE = 0,   // Not recording.
+        ARMED = 1,  // Recording and waiting for a trigger.
+        TRIGGERED = 2, // Recording the post window.
+        FROZEN = 3, // Capture complete. Holding until rearmed.
+    };
+
+    // Naturally aligned, so no padding.
+    struct record_t
+    {
+        uint32_t time_us; // Low 32 bits of the system time of acquisition.
+        int32_t encoder_ticks;
+        int16_t reaction_torque;
+        int16_t brake_current;
+        uint16_t brake_setpoint; // DAC value applied as of this sample.
+        uint16_t flags;
+    };
+    static_assert(sizeof(record_t) == 16,
+                  "FlightRecorder record must not contain padding.");
+
+    FlightRecorder();
+    ~FlightRecorder();
+
+/**
+ * \brief set how many samples to keep before and after the trigger.
+ * \details The post window includes the trigger sample. Takes effect on
+ *  the next trigger.
+ * \returns false (and leaves the window unchanged) if the windows don't
+ *  fit in the ring or the post window is empty.
+ */
+    bool set_window(uint32_t pre_samples, uint32_t post_samples);
+
+    uint32_t pre_samples() const {return pre_samples_;}
+    uint32_t post_samples() const {return post_samples_;}
+
+/**
+ * \brief discard any capture and start recording.
+ */
+    void arm();
+
+/**
+ * \brief discard any capture and stop recording.
+ */
+    void disarm();
+
+/**
+ * \brief start recording the post window if armed.
+ * \returns false if the recorder was not armed.
+ */
+    bool trigger();
+
+/**
+ * \brief record one sample.
+ * \returns true if this sample completed (and froze) the capture.
+ */
+    inline bool add(const record_t& record)
+    {
+        if (state_ == IDLE || state_ == FROZEN)
+            return false;
+        buffer_[head_] = record;
+        head_ = (head_ + 1) & MASK;
+        wrapped_ |= (head_ == 0);
+        if (state_ != TRIGGERED || --post_remaining_ != 0)
+            return false;
+        state_ = FROZEN;
+        return true;
+    }
+
+    state_t state() const {return state_;}
+
+/**
+ * \brief number of records in a frozen capture. 0 otherwise.
+ */
+    uint32_t num_records() const
+    {return (state_ == FROZEN) ? pre_count_ + post_count_ : 0;}
+
+/**
+ * \brief position of the trigger sample in a frozen capture, i.e: the
+ *  number of records before it.
+ */
+    uint32_t trigger_index() const {return pre_count_;}
+
+/**
+ * \brief copy records of a frozen capture, oldest first, starting at index.
+ * \returns the number of records copied. 0 if not frozen.
+ */
+    size_t read(size_t index, record_t* dest, size_t count) const;
+
+private:
+    record_t buffer_[CAPACITY];
+    uint32_t head_; // Next slot to write.
+    uint32_t start_; // Slot of the oldest record of the capture.
+    uint32_t pre_samples_;
+    uint32_t post_samples_;
+    uint32_t pre_count_; // Pre window records captured. Fewer than
+                         // pre_samples_ if triggered soon after arming.
+    uint32_t post_count_;
+    uint32_t post_remaining_;
+    bool wrapped_; // The ring has been filled at least once since arming.
+    state_t state_;
+};
+#endif // FLIGHT_RECORDER_H
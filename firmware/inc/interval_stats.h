@@ -0,0 +1,113 @@
+#ifndef INTERVAL_STATS_H
+#define INTERVAL_STATS_H
+#include <stdint.h>
+
+/**
+ * \brief Running min, max, and mean of the analog sensor channels over an
+ *  interval, so that a low-rate event can still report brief peaks in the
+ *  full-rate conversion stream.
+ * \details The reduction happens in two stages. accumulate() folds single
+ *  conversions into a tick_t and is called once per conversion on the hot
+ *  path, so it only does compare-selects and additions. add() then merges
+ *  whole ticks into the interval. The (slow) division for the mean is
+ *  deferred until the interval is read out.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class IntervalStats
+{
+public:
+    enum channel_t: uint8_t
+    {
+        TORQUE = 0,
+        BRAKE_CURRENT = 1,
+        NUM_CHANNELS
+    };
+
+/**
+ * \brief one channel's conversions reduced over a short span, e.g: a core1
+ *  tick. The sum of up to 65535 12-bit conversions fits in 32 bits.
+ */
+    struct tick_t
+    {
+        int32_t sum;
+        int16_t min;
+        int16_t max;
+        uint16_t count;
+    };
+
+    static constexpr tick_t EMPTY_TICK = {0, INT16_MAX, INT16_MIN, 0};
+
+/**
+ * \brief fold one conversion into a tick. Inline.
+ */
+    static inline void accumulate(tick_t& tick, int16_t value)
+    {
+        tick.min = (value < tick.min) ? value : tick.min;
+        tick.max = (value > tick.max) ? value : tick.max;
+        tick.sum += value;
+        ++tick.count;
+    }
+
+/**
+ * \brief a tick with every conversion shifted by -offset, e.g: to tare it.
+ */
+    static inline tick_t tared(tick_t tick, int16_t offset)
+    {
+        if (tick.count == 0)
+            return tick;
+        tick.min = int16_t(tick.min - offset);
+        tick.max = int16_t(tick.max - offset);
+        tick.sum -= int32_t(tick.count) * offset;
+        return tick;
+    }
+
+    IntervalStats();
+    ~IntervalStats();
+
+/**
+ * \brief start a new interval.
+ */
+    void clear();
+
+/**
+ * \brief merge a tick of one channel into the interval. Empty ticks leave
+ *  it unchanged.
+ */
+    inline void add(channel_t channel, const tick_t& tick)
+    {
+        channel_stats_t& stats = channels_[channel];
+        stats.min = (tick.min < stats.min) ? tick.min : stats.min;
+        stats.max = (tick.max > stats.max) ? tick.max : stats.max;
+        stats.sum += tick.sum;
+        stats.count += tick.count;
+    }
+
+    uint32_t num_samples(channel_t channel) const
+    {return channels_[channel].count;}
+
+/**
+ * \brief extremes of a channel over the interval. 0 if there are no samples.
+ */
+    int16_t min(channel_t channel) const
+    {return channels_[channel].count ? channels_[channel].min : 0;}
+    int16_t max(channel_t channel) const
+    {return channels_[channel].count ? channels_[channel].max : 0;}
+
+/**
+ * \brief mean of a channel over the interval, rounded to nearest. 0 if there
+ *  are no samples.
+ */
+    int16_t mean(channel_t channel) const;
+
+private:
+    struct channel_stats_t
+    {
+        int64_t sum;
+        uint32_t count;
+        int16_t min;
+        int16_t max;
+    };
+
+    channel_stats_t channels_[NUM_CHANNELS];
+};
+#endif // INTERVAL_STATS_H
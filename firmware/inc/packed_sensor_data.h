@@ -0,0 +1,71 @@
+#ifndef PACKED_SENSOR_DATA_H
+#define PACKED_SENSOR_DATA_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Encodes (and decodes) sensor samples in a compact little-endian
+ *  wire format.
+ * \details Each record is:
+ *  - header (1 byte): {analog_signed[6:5], encoder_delta[4], version[3:0]}
+ *    - version: PackedSensorData::VERSION.
+ *    - encoder_delta: 1 --> encoder is an S16 delta from the previous
+ *      record. 0 --> encoder is an absolute S32.
+ *    - analog_signed: per-field flag {brake_current[6], torque[5]}. 1 -->
+ *      the field is a two's-complement S12 (i.e: tared). 0 --> the field is
+ *      a raw U12.
+ *  - encoder (2 or 4 bytes).
+ *  - torque and brake current (3 bytes): torque[11:0], current[23:12].
+ *  Tared (signed) analog values outside the S12 range are saturated.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class PackedSensorData
+{
+public:
+    static constexpr uint8_t VERSION = 1;
+    static constexpr uint8_t VERSION_MASK = 0x0F;
+    static constexpr uint8_t ENCODER_DELTA_FLAG = 1u << 4;
+    static constexpr uint8_t TORQUE_SIGNED_FLAG = 1u << 5;
+    static constexpr uint8_t BRAKE_CURRENT_SIGNED_FLAG = 1u << 6;
+    static constexpr size_t MAX_SIZE_BYTES = 1 + sizeof(int32_t) + 3;
+
+    PackedSensorData();
+    ~PackedSensorData();
+
+/**
+ * \brief send the encoder as a delta from the previous record when it fits.
+ *  The next record is absolute.
+ */
+    void set_use_deltas(bool use_deltas);
+
+/**
+ * \brief make the next record absolute, e.g: if the previous one may not
+ *  have been received.
+ */
+    void reset() {has_previous_ = false;}
+
+/**
+ * \brief encode one record into dest, which must hold MAX_SIZE_BYTES.
+ * \returns the number of bytes written.
+ */
+    size_t pack(uint8_t* dest, int32_t encoder_ticks,
+                int16_t reaction_torque, bool torque_signed,
+                int16_t brake_current, bool brake_current_signed);
+
+/**
+ * \brief decode one record.
+ * \param encoder_ticks the previous record's encoder value on input (for
+ *  deltas). The decoded value on output.
+ * \returns the number of bytes consumed or 0 if src does not hold a valid
+ *  record.
+ */
+    static size_t unpack(const uint8_t* src, size_t num_bytes,
+                         int32_t& encoder_ticks, int16_t& reaction_torque,
+                         int16_t& brake_current);
+
+private:
+    int32_t previous_encoder_ticks_;
+    bool has_previous_;
+    bool use_deltas_;
+};
+#endif // PACKED_SENSOR_DATA_H
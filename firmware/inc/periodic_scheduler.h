@@ -0,0 +1,78 @@
+#ifndef PERIODIC_SCHEDULER_H
+#define PERIODIC_SCHEDULER_H
+#include <stdint.h>
+
+/**
+ * \brief Deadline bookkeeping for a periodic hardware alarm.
+ * \details Deadlines are absolute times on a fixed grid of start + n*period
+ *  so that lateness in servicing one deadline does not push back the next
+ *  one. If servicing is so late that one or more deadlines have already
+ *  passed, those deadlines are skipped and counted as missed.
+ * \note Time is passed in (rather than read from the hardware timer) so
+ *  that this can be built for a host and driven with a fake clock.
+ */
+class PeriodicScheduler
+{
+public:
+    PeriodicScheduler();
+    ~PeriodicScheduler();
+
+/**
+ * \brief start scheduling periodic deadlines.
+ * \returns the first deadline, which is one period after now_us.
+ */
+    uint64_t start(uint64_t now_us, uint32_t period_us);
+
+/**
+ * \brief stop scheduling.
+ */
+    void stop() {running_ = false;}
+
+    bool is_running() const {return running_;}
+
+/**
+ * \brief true if running and the current deadline has been reached.
+ * \details For polling (rather than alarm-driven) use, e.g: driven by
+ *  timestamps of incoming samples.
+ */
+    bool is_due(uint64_t now_us) const
+    {return running_ && now_us >= next_deadline_us_;}
+
+/**
+ * \brief service the current deadline and advance to the next one.
+ * \details Call when the alarm fires. Lateness of this deadline is recorded.
+ * \returns the next deadline, which is always in the future relative to now_us.
+ */
+    uint64_t service(uint64_t now_us);
+
+/**
+ * \brief advance the deadline past now_us without servicing it.
+ * \details Call if the alarm could not be armed because the deadline already
+ *  passed. Skipped deadlines are counted as missed.
+ * \returns the next deadline.
+ */
+    uint64_t skip_to(uint64_t now_us);
+
+    uint64_t next_deadline_us() const {return next_deadline_us_;}
+    uint32_t period_us() const {return period_us_;}
+
+    uint32_t serviced_count() const {return serviced_count_;}
+    uint32_t missed_count() const {return missed_count_;}
+    uint32_t last_lateness_us() const {return last_lateness_us_;}
+    uint32_t max_lateness_us() const {return max_lateness_us_;}
+
+/**
+ * \brief clear servicing statistics.
+ */
+    void clear_stats();
+
+private:
+    uint64_t next_deadline_us_;
+    uint32_t period_us_;
+    uint32_t serviced_count_;
+    uint32_t missed_count_;
+    uint32_t last_lateness_us_;
+    uint32_t max_lateness_us_;
+    bool running_;
+};
+#endif // PERIODIC_SCHEDULER_H
@@ -1,35 +1,117 @@
 #ifndef PIO_ENCODER_H
 #define PIO_ENCODER_H
 #include <pico/stdlib.h>
+#include <hardware/dma.h>
 #include <pio_encoder.pio.h>
 
+/**
+ * \brief A group of quadrature encoders on consecutive state machines of one
+ *  PIO, all running the one loaded program.
+ * \details Encoders are indexed from 0 in state machine order. Each state
+ *  machine replies to a count request on its own, so requesting several
+ *  counts in one go and then fetching them all only waits for a reply
+ *  (~11 CPU cycles) once rather than once per encoder.
+ */
 class PIOEncoder
 {
 public:
+    static constexpr uint32_t MAX_ENCODERS = 4; // One per state machine.
 
+/**
+ * \brief a single encoder.
+ */
     PIOEncoder(PIO pio, uint32_t state_machine_id,
                uint8_t base_input_pin);
 
+/**
+ * \brief num_encoders encoders on state machines base_state_machine_id
+ *  onwards, as many of them as there are state machines for.
+ * \param ab_base_pins A input of each encoder. B is the next pin.
+ */
+    PIOEncoder(PIO pio, uint32_t base_state_machine_id,
+               const uint8_t* ab_base_pins, uint32_t num_encoders);
+
     ~PIOEncoder();
 
-    //void setup_dma_stream_to_memory(uint32_t* address);
+    uint32_t num_encoders() const {return num_encoders_;}
+
+/**
+ * \brief continuously stream the count of the first encoder to the specified
+ *  address.
+ * \details A DMA pacing timer writes count requests to the TX FIFO at
+ *  request_rate_hz, and a second DMA stream drains each reply from the RX
+ *  FIFO into address, so the CPU never waits on the state machine. Each
+ *  stream is a pair of channels that trigger each other on completion such
+ *  that they run indefinitely without CPU intervention.
+ *  Each stream takes four DMA channels, so only the first encoder is
+ *  streamed. Read the rest with request_counts(1) and fetch_counts(..., 1).
+ * \note once streaming, do not call request_count(), fetch_count(), or
+ *  get_count() for the first encoder.
+ */
+    void setup_dma_stream_to_memory(volatile uint32_t* address,
+                                    uint32_t request_rate_hz);
+
+/**
+ * \brief number of replies the DMA stream has written, modulo 2^32, from
+ *  what its reply channels have left to transfer.
+ * \details A channel reads 0 left once done, and reloads when the other
+ *  re-triggers it, so this slips by one every other 2^32 replies.
+ *  Inline so that it can be called from RAM-resident interrupt handlers.
+ */
+    inline uint32_t stream_replies() const
+    {
+        return (0xFFFFFFFF - dma_hw->ch[reply_chan_[0]].transfer_count)
+               + (0xFFFFFFFF - dma_hw->ch[reply_chan_[1]].transfer_count);
+    }
 
-    void request_count();
+    void request_count(uint32_t index = 0);
 
-    uint32_t fetch_count();
+    uint32_t fetch_count(uint32_t index = 0);
 
 /**
  * \brief return the encoder count. This takes around ~11 CPU cycles.
  */
-    uint32_t get_count();
+    uint32_t get_count(uint32_t index = 0);
+
+/**
+ * \brief request the counts of encoders first onwards without waiting.
+ * \details Inline so that it can be called from RAM-resident interrupt
+ *  handlers.
+ */
+    inline void request_counts(uint32_t first = 0)
+    {
+        for (uint32_t i = first; i < num_encoders_; ++i)
+            quadrature_encoder_request_count(pio_, sm_ + i);
+    }
+
+/**
+ * \brief wait for the counts requested with request_counts(first).
+ * \param counts count of encoder first + i is written to counts[i].
+ */
+    inline void fetch_counts(uint32_t* counts, uint32_t first = 0)
+    {
+        for (uint32_t i = first; i < num_encoders_; ++i)
+            counts[i - first] = quadrature_encoder_fetch_count(pio_, sm_ + i);
+    }
+
+/**
+ * \brief return the counts of encoders first onwards. Takes about as long
+ *  as get_count() plus a few CPU cycles per encoder.
+ */
+    void get_counts(uint32_t* counts, uint32_t first = 0);
 
 
 private:
 
     PIO pio_;
-    uint32_t sm_;
-    uint32_t pin_a_;
-    uint32_t pin_b_;
+    uint32_t sm_; // State machine of the first encoder.
+    uint32_t num_encoders_;
 
+    // Request value written to the TX FIFO by DMA. Any nonzero value works.
+    uint32_t count_request_;
+    bool streaming_;
+    int dma_timer_;
+    int request_chan_[2];
+    int reply_chan_[2];
 };
 #endif // PIO_ENCODER_H
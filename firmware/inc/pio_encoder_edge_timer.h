@@ -0,0 +1,55 @@
+#ifndef PIO_ENCODER_EDGE_TIMER_H
+#define PIO_ENCODER_EDGE_TIMER_H
+#include <pico/stdlib.h>
+#include <hardware/pio.h>
+#include <encoder_edge_timer.pio.h>
+
+/**
+ * \brief Timestamps every edge of an encoder's A channel with a PIO state
+ *  machine so that speed can be measured with sub-count resolution.
+ * \note Runs alongside (not instead of) the PIOEncoder count program, which
+ *  fills its own PIO block.
+ */
+class PIOEncoderEdgeTimer
+{
+public:
+/**
+ * \brief Constructor. Claims an unused state machine on the specified PIO.
+ */
+    PIOEncoderEdgeTimer(PIO pio, uint8_t pin_a);
+
+    ~PIOEncoderEdgeTimer();
+
+/**
+ * \brief Timestamp frequency in [Hz].
+ */
+    uint32_t tick_hz() const {return tick_hz_;}
+
+/**
+ * \brief true if the RX FIFO is full, in which case subsequent edges may have
+ *  been dropped.
+ */
+    bool edges_may_be_lost()
+    {return pio_sm_get_rx_fifo_level(pio_, sm_) >= RX_FIFO_DEPTH;}
+
+/**
+ * \brief fetch the next edge timestamp if there is one. Nonblocking. Inline.
+ * \returns false if there are no new edges.
+ */
+    bool read_edge(uint32_t& timestamp)
+    {
+        if (pio_sm_is_rx_fifo_empty(pio_, sm_))
+            return false;
+        timestamp = pio_->rxf[sm_];
+        return true;
+    }
+
+private:
+    static constexpr uint RX_FIFO_DEPTH = 8; // RX FIFO is joined.
+
+    PIO pio_;
+    uint sm_;
+    uint offset_;
+    uint32_t tick_hz_;
+};
+#endif // PIO_ENCODER_EDGE_TIMER_H
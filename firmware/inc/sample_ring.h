@@ -0,0 +1,107 @@
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Circular buffer that an external writer (i.e: DMA) continuously
+ *  fills, plus a read cursor for a single consumer. Additional consumers
+ *  keep their own read index.
+ * \details The writer's position is passed in as a write index (i.e: the
+ *  index of the next element the writer will write). The ring has no way of
+ *  knowing how many times the writer has lapped it, so consumers must call
+ *  in at least once per SIZE writes to avoid losing samples.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+template <typename T, size_t SIZE>
+class SampleRing
+{
+static_assert(SIZE > 1 && (SIZE & (SIZE - 1)) == 0,
+              "SampleRing size must be a power of two.");
+public:
+    static constexpr size_t MASK = SIZE - 1;
+
+    SampleRing(): buffer_{}, read_index_{0}{}
+
+    static constexpr size_t size() {return SIZE;}
+    static constexpr size_t size_bytes() {return SIZE * sizeof(T);}
+
+/**
+ * \brief starting address of the underlying storage for the writer.
+ */
+    T* buffer() {return (T*)buffer_;}
+
+/**
+ * \brief convert a writer's address into a write index.
+ */
+    uint32_t address_to_index(uintptr_t write_address) const
+    {return uint32_t((write_address - uintptr_t(buffer_)) / sizeof(T)) & MASK;}
+
+/**
+ * \brief the most recently written sample.
+ */
+    T latest(uint32_t write_index) const
+    {return buffer_[(write_index - 1) & MASK];}
+
+/**
+ * \brief number of samples written since the last read.
+ */
+    size_t available(uint32_t write_index) const
+    {return (write_index - read_index_) & MASK;}
+
+/**
+ * \brief copy up to max_count samples written since the last read to dest
+ *  and advance the read cursor past them.
+ * \returns the number of samples copied.
+ */
+    size_t read_new(uint32_t write_index, T* dest, size_t max_count)
+    {
+        size_t count = available(write_index);
+        if (count > max_count)
+            count = max_count;
+        for (size_t i = 0; i < count; ++i)
+            dest[i] = buffer_[(read_index_ + i) & MASK];
+        read_index_ = (read_index_ + count) & MASK;
+        return count;
+    }
+
+/**
+ * \brief invoke fn(sample) on every sample written since the last read and
+ *  advance the read cursor past them.
+ * \returns the number of samples consumed.
+ */
+    template <typename Fn>
+    size_t consume(uint32_t write_index, Fn&& fn)
+    {
+        const size_t count = available(write_index);
+        for (size_t i = 0; i < count; ++i)
+            fn(buffer_[(read_index_ + i) & MASK]);
+        read_index_ = (read_index_ + count) & MASK;
+        return count;
+    }
+
+/**
+ * \brief consume() for an additional consumer with its own read index.
+ */
+    template <typename Fn>
+    size_t consume_from(uint32_t& read_index, uint32_t write_index,
+                        Fn&& fn) const
+    {
+        const size_t count = (write_index - read_index) & MASK;
+        for (size_t i = 0; i < count; ++i)
+            fn(buffer_[(read_index + i) & MASK]);
+        read_index = (read_index + count) & MASK;
+        return count;
+    }
+
+/**
+ * \brief discard all unread samples.
+ */
+    void skip(uint32_t write_index) {read_index_ = write_index & MASK;}
+
+private:
+    // Aligned to its size such that DMA ring-wrapping is also an option.
+    alignas(SIZE * sizeof(T)) volatile T buffer_[SIZE];
+    uint32_t read_index_;
+};
+#endif // SAMPLE_RING_H
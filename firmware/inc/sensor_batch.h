@@ -0,0 +1,85 @@
+#ifndef SENSOR_BATCH_H
+#define SENSOR_BATCH_H
+#include <stdint.h>
+#include <stddef.h>
+
+// One batched sample. Layout is little-endian and packed so that the batch
+// can be sent as-is as a U8 array payload.
+#pragma pack(push, 1)
+struct batch_sample_t
+{
+    uint16_t time_offset_us; // acquisition time relative to the first sample
+                             // in the batch (i.e: the event timestamp).
+    int32_t encoder_ticks;
+    int16_t reaction_torque;
+    int16_t brake_current;
+};
+#pragma pack(pop)
+
+/**
+ * \brief Packs periodic sensor samples into a single contiguous buffer
+ *  suitable for sending as one Harp array message.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class SensorBatch
+{
+public:
+    // Harp payloads top out at 245 bytes (length field is one byte and
+    // includes the header fields and checksum.)
+    static constexpr uint8_t MAX_SAMPLES = 24;
+    static constexpr size_t MAX_SIZE_BYTES = MAX_SAMPLES * sizeof(batch_sample_t);
+
+    SensorBatch();
+    ~SensorBatch();
+
+/**
+ * \brief set the number of samples that constitutes a full batch.
+ * \note clamped to [1, MAX_SAMPLES]. Clears any pending samples.
+ * \returns true if the requested size was applied without clamping.
+ */
+    bool set_batch_size(uint8_t num_samples);
+
+    uint8_t batch_size() const {return batch_size_;}
+
+/**
+ * \brief add a sample to the batch.
+ * \returns false if the sample could not be added because the batch is full
+ *  or because its time offset does not fit in 16 bits. In either case, the
+ *  batch must be sent and cleared before retrying.
+ */
+    bool add_sample(uint64_t time_us, int32_t encoder_ticks,
+                    int16_t reaction_torque, int16_t brake_current);
+
+    bool is_full() const {return num_samples_ >= batch_size_;}
+    bool is_empty() const {return num_samples_ == 0;}
+
+/**
+ * \brief clear all samples from the batch.
+ */
+    void clear() {num_samples_ = 0;}
+
+    uint8_t num_samples() const {return num_samples_;}
+    uint8_t size_bytes() const
+        {return uint8_t(num_samples_ * sizeof(batch_sample_t));}
+    const uint8_t* data() const {return (const uint8_t*)samples_;}
+    uint8_t* data() {return (uint8_t*)samples_;}
+
+/**
+ * \brief acquisition time of the first sample in the batch.
+ */
+    uint64_t start_time_us() const {return start_time_us_;}
+
+/**
+ * \brief unpack a batch payload into an array of samples.
+ * \returns the number of samples decoded.
+ */
+    static uint8_t decode(const uint8_t* payload, size_t num_bytes,
+                          batch_sample_t* samples, uint8_t max_samples);
+
+private:
+    batch_sample_t samples_[MAX_SAMPLES];
+    uint64_t start_time_us_;
+    uint8_t num_samples_;
+    uint8_t batch_size_;
+};
+#endif // SENSOR_BATCH_H
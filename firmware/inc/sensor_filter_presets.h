@@ -0,0 +1,29 @@
+#ifndef SENSOR_FILTER_PRESETS_H
+#define SENSOR_FILTER_PRESETS_H
+#include <fixed_point_filter.h>
+
+// Biquads per sensor filter: a 4th order Butterworth lowpass.
+static constexpr uint32_t SENSOR_FILTER_SECTIONS = 2;
+
+/**
+ * \brief a selectable sensor filter.
+ * \details Cutoffs are in parts per million of the biquads' (i.e: the
+ *  decimated) rate, so presets do not depend on the conversion rate or the
+ *  decimation. Every biquad has a DC gain of exactly 1.
+ */
+struct sensor_filter_preset_t
+{
+    uint32_t cutoff_ppm; // -3[dB] frequency. 0 if the filter is off.
+    const biquad_coefficients_t* sections; // nullptr for the moving average
+                                           // alone.
+};
+
+/**
+ * \brief selectable sensor filters. 0 is off (every conversion passes
+ *  through unfiltered), 1 is the moving average alone, and the rest are
+ *  Butterworth lowpasses from the highest cutoff to the lowest.
+ */
+extern const sensor_filter_preset_t SENSOR_FILTER_PRESETS[];
+extern const uint32_t NUM_SENSOR_FILTER_PRESETS;
+
+#endif // SENSOR_FILTER_PRESETS_H
@@ -0,0 +1,72 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * \brief Lock-free single-producer/single-consumer queue for passing data
+ *  between cores (or between an interrupt and the main loop).
+ * \details The producer only ever writes head_; the consumer only ever writes
+ *  tail_. Indices run freely and wrap at 2^32, so the queue can hold all
+ *  SIZE elements. Only atomic loads/stores are used (no read-modify-write),
+ *  so this is lock-free on Cortex-M0+.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+template <typename T, size_t SIZE>
+class SPSCQueue
+{
+static_assert(SIZE > 1 && (SIZE & (SIZE - 1)) == 0,
+              "SPSCQueue size must be a power of two.");
+public:
+    static constexpr uint32_t MASK = SIZE - 1;
+
+    SPSCQueue(): head_{0}, tail_{0}{}
+
+/**
+ * \brief add an item to the queue. Producer only.
+ * \returns false if the queue is full.
+ */
+    bool push(const T& item)
+    {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) >= SIZE)
+            return false;
+        buffer_[head & MASK] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+/**
+ * \brief remove the oldest item from the queue. Consumer only.
+ * \returns false if the queue is empty.
+ */
+    bool pop(T& item)
+    {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (head_.load(std::memory_order_acquire) == tail)
+            return false;
+        item = buffer_[tail & MASK];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+/**
+ * \brief number of items in the queue. Exact when called by either the
+ *  producer or the consumer; a lower (consumer) or upper (producer) bound
+ *  otherwise.
+ */
+    size_t size() const
+    {return head_.load(std::memory_order_acquire)
+            - tail_.load(std::memory_order_acquire);}
+
+    bool empty() const {return size() == 0;}
+
+    static constexpr size_t capacity() {return SIZE;}
+
+private:
+    T buffer_[SIZE];
+    std::atomic<uint32_t> head_; // Next slot to write. Producer-owned.
+    std::atomic<uint32_t> tail_; // Next slot to read. Consumer-owned.
+};
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,99 @@
+#ifndef STEP_RESPONSE_H
+#define STEP_RESPONSE_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Capture of one ADC stream around a setpoint step, e.g: the brake
+ *  current after a brake setpoint write.
+ * \details Conversions are averaged in groups of 2^decimation_log2, so a
+ *  decimation of 0 keeps every conversion. add() is called once per
+ *  conversion, so it is an add, a compare, and a store every group.
+ *  Samples are never written once the capture is full, so they may be read
+ *  from another core once it has been told (through a queue with
+ *  release/acquire ordering) that the capture is full.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class StepResponseCapture
+{
+public:
+    static constexpr uint32_t CAPACITY = 8192;
+    static constexpr uint32_t MAX_DECIMATION_LOG2 = 8;
+
+    StepResponseCapture();
+    ~StepResponseCapture();
+
+/**
+ * \brief discard any capture and start a new one.
+ * \returns false (and stops) if num_samples is 0 or doesn't fit, or the
+ *  decimation is more than 2^MAX_DECIMATION_LOG2.
+ */
+    bool start(uint32_t num_samples, uint32_t decimation_log2);
+
+/**
+ * \brief discard any capture and stop capturing.
+ */
+    void stop();
+
+/**
+ * \brief add one conversion.
+ * \returns true if this conversion completed (and filled) the capture.
+ */
+    inline bool add(uint16_t conversion)
+    {
+        if (size_ == num_samples_)
+            return false;
+        sum_ += conversion;
+        if (++group_count_ < (1u << decimation_log2_))
+            return false;
+        buffer_[size_++] = uint16_t(sum_ >> decimation_log2_);
+        sum_ = 0;
+        group_count_ = 0;
+        return size_ == num_samples_;
+    }
+
+    bool is_capturing() const {return size_ < num_samples_;}
+    bool is_full() const {return num_samples_ > 0 && size_ == num_samples_;}
+    uint32_t size() const {return size_;}
+    uint32_t decimation_log2() const {return decimation_log2_;}
+    const uint16_t* samples() const {return buffer_;}
+
+private:
+    uint16_t buffer_[CAPACITY];
+    uint32_t num_samples_;
+    uint32_t size_;
+    uint32_t decimation_log2_;
+    uint32_t group_count_;
+    uint32_t sum_;
+};
+
+struct step_response_t
+{
+    int32_t initial; // Mean before the step.
+    int32_t final; // Mean of the last tenth of the samples after the step.
+    uint32_t rise_time_ns; // 10% to 90% of the step. UINT32_MAX if 90% was
+                           // never reached.
+    uint32_t settling_time_ns; // From the step to the last sample outside
+                               // the settling band. UINT32_MAX if still
+                               // outside it when the final value starts.
+    uint32_t overshoot_permille; // Peak past the final value, in 0.1% of
+                                 // the step.
+};
+
+/**
+ * \brief extract step response metrics from evenly spaced samples.
+ * \param step_index the first sample after the step was applied. Samples
+ *  before it set the initial value.
+ * \param settling_band_permille half-width of the settling band around the
+ *  final value, in 0.1% of the step.
+ * \returns false if there are no samples on either side of the step or the
+ *  step is no larger than the peak-to-peak noise before it.
+ * \note Hardware-independent such that it can be run on a host against
+ *  recorded or simulated step traces. Linear in the number of samples.
+ */
+bool analyze_step_response(const uint16_t* samples, size_t count,
+                           size_t step_index, uint32_t sample_period_ns,
+                           uint32_t settling_band_permille,
+                           step_response_t& result);
+
+#endif // STEP_RESPONSE_H
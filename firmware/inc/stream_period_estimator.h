@@ -0,0 +1,86 @@
+#ifndef STREAM_PERIOD_ESTIMATOR_H
+#define STREAM_PERIOD_ESTIMATOR_H
+#include <stdint.h>
+
+/**
+ * \brief Measures the mean period of a free-running sample stream (e.g: ADC
+ *  conversions that DMA writes into a ring) from timestamped observations of
+ *  its write index, and from that, how old the stream's latest sample is at
+ *  each observation.
+ * \details The stream period is also the worst-case age of the stream's
+ *  latest sample at any instant that it is observed, i.e: how stale a value
+ *  latched from the stream can be relative to the latch timestamp.
+ *  Samples and elapsed time are accumulated over a window so that the
+ *  (slow) division only happens once per window.
+ *  Samples are taken on a regular grid, so every observation also bounds
+ *  where that grid lies: the latest sample arrived by the observation, after
+ *  the previous one if the index moved since, and recently enough that the
+ *  next one has not arrived yet. Carrying the bounds from one observation to
+ *  the next by the measured period narrows them down to the grid's phase,
+ *  whenever observations land at varying points of the period. Observations
+ *  locked to the stream's rate only bound its latest sample to a period.
+ * \note Time is passed in (rather than read from the hardware timer) so
+ *  that this can be built for a host and driven with a fake clock.
+ */
+class StreamPeriodEstimator
+{
+public:
+/**
+ * \param index_mask write indices wrap at index_mask + 1 (a power of two).
+ *  The stream must advance less than that between observations.
+ * \param window_us time to accumulate before each new estimate.
+ * \param jitter_ns samples arrive up to this long after their place on the
+ *  grid, e.g: DMA latency.
+ */
+    StreamPeriodEstimator(uint32_t index_mask, uint32_t window_us,
+                          uint32_t jitter_ns);
+    ~StreamPeriodEstimator();
+
+/**
+ * \brief restart accumulating from this observation.
+ */
+    void reset(uint64_t time_us, uint32_t write_index);
+
+/**
+ * \brief add an observation. Times must not decrease.
+ */
+    void update(uint64_t time_us, uint32_t write_index);
+
+/**
+ * \brief mean sample period over the last complete window [ns]. 0 before
+ *  the first window completes. If no samples arrived in the last window, the
+ *  window length, i.e: a lower bound.
+ */
+    uint32_t period_ns() const {return period_ns_;}
+
+/**
+ * \brief bounds on the age of the stream's latest sample at the last
+ *  observation [ns].
+ * \details Until the grid is found (before the first window completes, or
+ *  while the stream is stalled), 0 and period_ns().
+ */
+    uint32_t min_age_ns() const;
+    uint32_t max_age_ns() const;
+
+private:
+    void track_latest_sample(uint32_t interval_us, uint32_t new_samples);
+
+    const uint32_t index_mask_;
+    const uint32_t window_us_;
+    const uint32_t jitter_ns_;
+    uint64_t last_time_us_;
+    uint32_t last_index_;
+    uint32_t elapsed_us_;
+    uint32_t num_samples_;
+    uint32_t period_ns_;
+    // Since the stream last (re)started, for a period precise enough to
+    // carry the grid's bounds across many observations.
+    uint64_t total_elapsed_us_;
+    uint64_t total_samples_;
+    uint64_t period_ps_; // 0 while the grid is unknown.
+    uint64_t period_error_ps_; // Bound on the error of each period.
+    bool tracking_;
+    int64_t min_age_ps_; // Of the latest sample's place on the grid.
+    int64_t max_age_ps_;
+};
+#endif // STREAM_PERIOD_ESTIMATOR_H
@@ -0,0 +1,107 @@
+#ifndef TORQUE_LIMIT_MONITOR_H
+#define TORQUE_LIMIT_MONITOR_H
+#include <stdint.h>
+
+/**
+ * \brief Trip logic for the reaction torque limit, evaluated on every torque
+ *  conversion.
+ * \details Raw samples are averaged over a boxcar window whose length is a
+ *  power of two. The monitor trips (and latches) when the windowed mean
+ *  leaves [min, max]. A trip can only be cleared once the windowed mean is
+ *  back inside the limits by at least the hysteresis, so that clearing the
+ *  trip while the sensor is still near a limit does not immediately
+ *  re-trip it.
+ *  The time of the first raw out-of-range sample of the excursion that
+ *  caused the trip is recorded so that trip latency can be measured.
+ * \note Hardware-independent such that it can be built for a host and driven
+ *  with recorded torque traces.
+ */
+class TorqueLimitMonitor
+{
+public:
+    static constexpr uint32_t MAX_WINDOW = 32;
+
+    TorqueLimitMonitor();
+    ~TorqueLimitMonitor();
+
+/**
+ * \brief set the (inclusive) raw limits that the windowed mean must stay
+ *  strictly within.
+ */
+    void set_limits(int32_t min, int32_t max) {min_ = min; max_ = max;}
+
+/**
+ * \brief set the filter window length in samples and clear the filter.
+ * \returns false (and leaves the window unchanged) if window is not a power
+ *  of two in [1, MAX_WINDOW].
+ */
+    bool set_window(uint32_t window);
+
+    uint32_t window() const {return 1u << window_shift_;}
+
+    static bool is_valid_window(uint32_t window)
+    {return window > 0 && window <= MAX_WINDOW && !(window & (window - 1));}
+
+/**
+ * \brief set the margin (in raw counts) inside the limits that the windowed
+ *  mean must return to before a trip can be cleared.
+ */
+    void set_hysteresis(int32_t hysteresis) {hysteresis_ = hysteresis;}
+
+    int32_t hysteresis() const {return hysteresis_;}
+
+/**
+ * \brief enable or disable tripping. Samples are still filtered while
+ *  disabled so that the filter is current when re-enabled.
+ */
+    void set_enabled(bool enabled);
+
+    bool enabled() const {return enabled_;}
+
+/**
+ * \brief filter a new raw sample and check it against the limits.
+ * \param time_us the time that the sample was converted.
+ * \returns true if this sample tripped the monitor.
+ */
+    bool add_sample(int32_t raw, uint32_t time_us);
+
+/**
+ * \brief clear a trip.
+ * \returns false (and stays tripped) if the windowed mean is not yet inside
+ *  the limits by the hysteresis.
+ */
+    bool clear();
+
+/**
+ * \brief clear the trip and filter history. The filter restarts from the
+ *  next sample.
+ */
+    void reset();
+
+    bool tripped() const {return tripped_;}
+
+    int32_t filtered() const {return sum_ >> window_shift_;}
+
+/**
+ * \brief time of the first raw out-of-range sample of the excursion that
+ *  caused the last trip.
+ */
+    uint32_t trip_sample_time_us() const {return excursion_start_us_;}
+
+private:
+    void clear_filter();
+
+    int32_t samples_[MAX_WINDOW];
+    int32_t sum_;
+    int32_t min_;
+    int32_t max_;
+    int32_t hysteresis_;
+    uint32_t window_shift_;
+    uint32_t index_;
+    uint32_t excursion_start_us_;
+    bool primed_;   // false --> filter history is empty.
+    bool in_excursion_;
+    bool enabled_;
+    bool tripped_;
+};
+#endif // TORQUE_LIMIT_MONITOR_H
@@ -0,0 +1,62 @@
+#ifndef VIRTUAL_LOAD_H
+#define VIRTUAL_LOAD_H
+#include <stdint.h>
+
+/**
+ * \brief Brake current needed to emulate a physical load on the belt.
+ * \details The load is the sum of viscous damping (proportional to speed),
+ *  Coulomb friction (constant while moving faster than a deadband), and
+ *  added inertia (proportional to acceleration along the direction of
+ *  travel). The brake can only resist motion, so the result is clamped at
+ *  zero. In particular, added inertia resists speeding up but cannot keep
+ *  the belt moving while it slows down.
+ *  Velocity and acceleration are Q24.8 fixed-point encoder counts per second
+ *  (squared), as produced by EncoderVelocityEstimator. Gains are Q24.8 and
+ *  the output is in microamps.
+ * \note Hardware-independent such that it can be built for a host.
+ */
+class VirtualLoad
+{
+public:
+    static constexpr uint32_t FRACTIONAL_BITS = 8;
+
+    VirtualLoad();
+    ~VirtualLoad();
+
+/**
+ * \brief set the viscous damping gain in Q24.8 [uA / (counts/s)].
+ */
+    void set_damping(uint32_t damping_q8) {damping_q8_ = damping_q8;}
+
+/**
+ * \brief set the Coulomb friction [uA] and the speed [counts/s] above which
+ *  it applies.
+ */
+    void set_friction(uint32_t friction_ua) {friction_ua_ = friction_ua;}
+    void set_friction_deadband(uint32_t deadband_cps)
+    {deadband_q8_ = int64_t(deadband_cps) << FRACTIONAL_BITS;}
+
+/**
+ * \brief set the added inertia in Q24.8 [uA / (counts/s^2)].
+ */
+    void set_inertia(uint32_t inertia_q8) {inertia_q8_ = inertia_q8;}
+
+/**
+ * \brief set the largest current that update() will return [uA].
+ */
+    void set_max_output(uint32_t max_output_ua) {max_output_ua_ = max_output_ua;}
+
+/**
+ * \brief compute the brake current for the latest motion estimate.
+ * \returns brake current [uA].
+ */
+    uint32_t update(int32_t velocity_q8, int32_t acceleration_q8) const;
+
+private:
+    int64_t deadband_q8_;
+    uint32_t damping_q8_;
+    uint32_t friction_ua_;
+    uint32_t inertia_q8_;
+    uint32_t max_output_ua_;
+};
+#endif // VIRTUAL_LOAD_H
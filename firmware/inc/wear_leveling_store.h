@@ -0,0 +1,97 @@
+#ifndef WEAR_LEVELING_STORE_H
+#define WEAR_LEVELING_STORE_H
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * \brief Append-only, CRC-protected record log spread over a ring of flash
+ *  sectors so that repeated saves wear the sectors evenly.
+ * \details Each save programs one page-sized slot after the previous record
+ *  rather than erasing and rewriting a fixed location. The newest valid
+ *  record (highest sequence number with a good CRC) is the current one, so a
+ *  save that is interrupted (e.g: by a power loss) leaves the previous
+ *  record in effect.
+ *  Erasing is the slow flash operation, and it is only needed when the log
+ *  moves on to the next sector. Instead of erasing inside save(), the sector
+ *  is flagged and erased by service_erase() whenever the caller decides that
+ *  it is safe to stall. Until then, saves that need that sector fail.
+ *  Slot layout (little-endian): [magic (U32), sequence (U32),
+ *  version (U16), length (U16), payload, ..., CRC-32 (U32) of everything
+ *  from magic through the payload in the last 4 bytes of the slot].
+ * \note Flash is read through a memory-mapped pointer and written through
+ *  the supplied functions, so this can be built for a host and driven with
+ *  RAM.
+ */
+class WearLevelingStore
+{
+public:
+    static constexpr size_t SECTOR_SIZE = 4096; // Smallest erasable unit.
+    static constexpr size_t SLOT_SIZE = 256;    // Smallest programmable unit.
+    static constexpr size_t SLOTS_PER_SECTOR = SECTOR_SIZE / SLOT_SIZE;
+    static constexpr size_t HEADER_SIZE = 12;
+    static constexpr size_t MAX_PAYLOAD_SIZE = SLOT_SIZE - HEADER_SIZE
+                                               - sizeof(uint32_t);
+    static constexpr uint32_t MAGIC = 0x47464357; // "WCFG"
+
+    // offset is relative to the start of the region.
+    using erase_fn_t = void (*)(uint32_t offset);
+    using program_fn_t = void (*)(uint32_t offset, const uint8_t* data,
+                                  size_t num_bytes);
+
+/**
+ * \param region memory-mapped start of the region. Sector-aligned.
+ * \param num_sectors at least 2, so that erasing a sector never destroys
+ *  the current record.
+ */
+    WearLevelingStore(const uint8_t* region, size_t num_sectors,
+                      erase_fn_t erase_fn, program_fn_t program_fn);
+    ~WearLevelingStore();
+
+/**
+ * \brief find the current record and the next free slot.
+ * \details Call once before anything else.
+ */
+    void init();
+
+/**
+ * \brief append a record.
+ * \returns false if it was not stored because the payload is too big, the
+ *  next sector must be erased first, or it did not read back correctly.
+ */
+    bool save(uint16_t version, const void* payload, uint16_t num_bytes);
+
+/**
+ * \brief the current record's payload or nullptr if there is none.
+ */
+    const uint8_t* latest(uint16_t& version, uint16_t& num_bytes) const;
+
+    bool erase_pending() const {return erase_pending_;}
+
+/**
+ * \brief erase the sector that the next save needs, if any.
+ */
+    void service_erase();
+
+/**
+ * \brief number of records saved over the life of the region, counting
+ *  saves that did not read back.
+ */
+    uint32_t sequence() const {return sequence_;}
+
+private:
+    const uint8_t* slot(size_t index) const {return region_ + index * SLOT_SIZE;}
+    bool is_valid(size_t index) const;
+    bool is_blank(const uint8_t* data, size_t num_bytes) const;
+    void find_next_slot(size_t index);
+
+    const uint8_t* region_;
+    const erase_fn_t erase_fn_;
+    const program_fn_t program_fn_;
+    const size_t num_slots_;
+    size_t latest_slot_;
+    size_t next_slot_;
+    uint32_t sequence_;
+    bool has_latest_;
+    bool erase_pending_;
+};
+#endif // WEAR_LEVELING_STORE_H
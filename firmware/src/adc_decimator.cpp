@@ -0,0 +1,40 @@
+#include <adc_decimator.h>
+
+ADCDecimator::ADCDecimator()
+:values_{}, num_inputs_{1}, decimation_{1}
+{
+    reset();
+}
+
+ADCDecimator::~ADCDecimator()
+{}
+
+bool ADCDecimator::configure(uint32_t num_inputs, uint32_t decimation)
+{
+    if (num_inputs == 0 || num_inputs > MAX_INPUTS
+        || decimation == 0 || decimation > MAX_DECIMATION)
+        return false;
+    num_inputs_ = num_inputs;
+    decimation_ = decimation;
+    reset();
+    return true;
+}
+
+void ADCDecimator::reset()
+{
+    for (auto& sum: sums_)
+        sum = 0;
+    rounds_ = 0;
+    synced_ = false;
+}
+
+void ADCDecimator::publish()
+{
+    // Round to nearest.
+    for (uint32_t i = 0; i < num_inputs_; ++i)
+    {
+        values_[i] = uint16_t((sums_[i] + decimation_ / 2) / decimation_);
+        sums_[i] = 0;
+    }
+    rounds_ = 0;
+}
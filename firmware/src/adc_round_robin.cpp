@@ -0,0 +1,102 @@
+#include <adc_round_robin.h>
+
+ADCRoundRobin::ADCRoundRobin(uint8_t input_mask)
+:buffer_{nullptr}, num_inputs_{0}, first_input_{0},
+ input_mask_{uint8_t(input_mask & 0x1F)}, data_chan_{-1}, reload_chan_{-1},
+ transfer_count_reload_{0xFFFFFFFF}
+{
+    adc_init();
+    for (uint8_t input = 0; input <= TEMPERATURE_SENSOR_INPUT; ++input)
+    {
+        if (!(input_mask_ & (1u << input)))
+            continue;
+        if (num_inputs_++ == 0)
+            first_input_ = input;
+        if (input == TEMPERATURE_SENSOR_INPUT)
+            adc_set_temp_sensor_enabled(true);
+        else
+            adc_gpio_init(26 + input);
+    }
+    adc_set_round_robin(input_mask_);
+    // Every conversion goes to the FIFO and requests DMA. No error bit, so
+    // results are plain 12-bit values.
+    adc_fifo_setup(true, true, 1, false, false);
+    set_conversion_rate_hz(MAX_CONVERSION_RATE_HZ);
+}
+
+ADCRoundRobin::~ADCRoundRobin()
+{
+    stop();
+    if (data_chan_ < 0)
+        return;
+    dma_channel_abort(reload_chan_);
+    dma_channel_abort(data_chan_);
+    dma_channel_unclaim(reload_chan_);
+    dma_channel_unclaim(data_chan_);
+}
+
+uint32_t ADCRoundRobin::set_conversion_rate_hz(uint32_t rate_hz)
+{
+    // A conversion takes 96 ADC clock cycles, so the slowest rate is one
+    // conversion every 2^16 cycles.
+    const uint32_t min_rate_hz = ADC_CLOCK_HZ / 65536 + 1;
+    if (rate_hz > MAX_CONVERSION_RATE_HZ)
+        rate_hz = MAX_CONVERSION_RATE_HZ;
+    if (rate_hz < min_rate_hz)
+        rate_hz = min_rate_hz;
+    // One conversion every (1 + div) cycles.
+    adc_set_clkdiv(float(ADC_CLOCK_HZ) / float(rate_hz) - 1.f);
+    return rate_hz;
+}
+
+void ADCRoundRobin::setup_dma_stream_to_memory(volatile uint16_t* buffer,
+                                               size_t num_samples)
+{
+    buffer_ = buffer;
+    data_chan_ = dma_claim_unused_channel(true);
+    reload_chan_ = dma_claim_unused_channel(true);
+    uint ring_size_bits = 0;
+    while ((size_t(1) << ring_size_bits) < num_samples * sizeof(uint16_t))
+        ++ring_size_bits;
+    dma_channel_config c = dma_channel_get_default_config(data_chan_);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ring_size_bits);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    channel_config_set_chain_to(&c, reload_chan_);
+    dma_channel_configure(data_chan_, &c, buffer_, &adc_hw->fifo,
+                          transfer_count_reload_, false);
+    // Restarts the data channel without touching its write address, which
+    // has wrapped around the ring in place.
+    c = dma_channel_get_default_config(reload_chan_);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(reload_chan_, &c,
+                          &dma_hw->ch[data_chan_].al1_transfer_count_trig,
+                          &transfer_count_reload_, 1, false);
+}
+
+void ADCRoundRobin::start()
+{
+    stop();
+    if (data_chan_ >= 0)
+    {
+        dma_channel_abort(data_chan_);
+        dma_channel_abort(reload_chan_);
+        dma_channel_set_write_addr(data_chan_, buffer_, false);
+        dma_channel_set_trans_count(data_chan_, transfer_count_reload_, true);
+    }
+    adc_run(true);
+}
+
+void ADCRoundRobin::stop()
+{
+    adc_run(false);
+    // Wait out a conversion in progress, then restart the sequence.
+    while (!(adc_hw->cs & ADC_CS_READY_BITS))
+        tight_loop_contents();
+    adc_fifo_drain();
+    adc_select_input(first_input_);
+}
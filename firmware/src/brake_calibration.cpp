@@ -0,0 +1,88 @@
+#include <brake_calibration.h>
+#include <crc32.h>
+
+BrakeCalibration::BrakeCalibration()
+{
+    clear();
+}
+
+BrakeCalibration::~BrakeCalibration()
+{}
+
+size_t BrakeCalibration::write(size_t index, const uint16_t* points,
+                               size_t count)
+{
+    if (index >= MAX_POINTS)
+        return 0;
+    if (count > MAX_POINTS - index)
+        count = MAX_POINTS - index;
+    for (size_t i = 0; i < count; ++i)
+        points_[index + i] = points[i];
+    return count;
+}
+
+bool BrakeCalibration::configure(size_t num_points,
+                                 uint32_t full_scale_torque_q16)
+{
+    if (num_points < 2 || num_points > MAX_POINTS || full_scale_torque_q16 == 0)
+        return false;
+    num_points_ = uint16_t(num_points);
+    full_scale_torque_q16_ = full_scale_torque_q16;
+    index_per_torque_q16_ = (uint64_t(num_points - 1) << 32)
+                            / full_scale_torque_q16;
+    checksum_ = compute_checksum(points_, num_points_, full_scale_torque_q16_);
+    return true;
+}
+
+void BrakeCalibration::clear()
+{
+    num_points_ = 0;
+    full_scale_torque_q16_ = 0;
+    index_per_torque_q16_ = 0;
+    checksum_ = 0;
+}
+
+void BrakeCalibration::save(record_t& record) const
+{
+    record.magic = RECORD_MAGIC;
+    record.num_points = num_points_;
+    record.reserved = 0;
+    record.full_scale_torque_q16 = full_scale_torque_q16_;
+    for (size_t i = 0; i < MAX_POINTS; ++i)
+        record.points[i] = (i < num_points_) ? points_[i] : 0;
+    record.checksum = checksum_;
+}
+
+bool BrakeCalibration::load(const record_t& record)
+{
+    if (record.magic != RECORD_MAGIC || record.num_points < 2
+        || record.num_points > MAX_POINTS || record.full_scale_torque_q16 == 0
+        || record.checksum != compute_checksum(record.points, record.num_points,
+                                               record.full_scale_torque_q16))
+        return false;
+    write(0, record.points, record.num_points);
+    return configure(record.num_points, record.full_scale_torque_q16);
+}
+
+void BrakeCalibration::copy(const BrakeCalibration& other)
+{
+    if (!other.is_valid())
+    {
+        clear();
+        return;
+    }
+    write(0, other.points_, other.num_points_);
+    configure(other.num_points_, other.full_scale_torque_q16_);
+}
+
+uint32_t BrakeCalibration::compute_checksum(const uint16_t* points,
+                                            size_t num_points,
+                                            uint32_t full_scale_torque_q16)
+{
+    // Little-endian target, so in-memory layout is the wire layout.
+    const uint16_t header[4] = {uint16_t(num_points), 0,
+                                uint16_t(full_scale_torque_q16),
+                                uint16_t(full_scale_torque_q16 >> 16)};
+    const uint32_t crc = crc32((const uint8_t*)header, sizeof(header));
+    return crc32((const uint8_t*)points, num_points * sizeof(uint16_t), crc);
+}
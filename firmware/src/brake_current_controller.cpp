@@ -0,0 +1,51 @@
+#include <brake_current_controller.h>
+
+BrakeCurrentController::BrakeCurrentController()
+:setpoint_{0}, kp_q8_{0}, ki_q8_{0}
+{
+    reset();
+}
+
+BrakeCurrentController::~BrakeCurrentController()
+{}
+
+void BrakeCurrentController::reset()
+{
+    error_ = 0;
+    integrator_q8_ = 0;
+    output_ = 0;
+}
+
+uint16_t BrakeCurrentController::update(int32_t measurement_counts)
+{
+    // Error is bounded to +/-12 bits and gains to 16 bits, so products fit
+    // in 32 bits.
+    error_ = setpoint_ - measurement_counts;
+    const int32_t proportional_q8 = int32_t(kp_q8_) * error_;
+    const int32_t integrator_step_q8 = int32_t(ki_q8_) * error_;
+    int32_t integrator_q8 = integrator_q8_ + integrator_step_q8;
+    // Clamp the integrator on its own to the output range.
+    if (integrator_q8 < 0)
+        integrator_q8 = 0;
+    else if (integrator_q8 > (OUTPUT_MAX << GAIN_FRACTIONAL_BITS))
+        integrator_q8 = (OUTPUT_MAX << GAIN_FRACTIONAL_BITS);
+    int32_t output = (proportional_q8 + integrator_q8) >> GAIN_FRACTIONAL_BITS;
+    // Conditional integration: only accept the integrator update if the
+    // output is unsaturated or the error drives it out of saturation.
+    if (output > OUTPUT_MAX)
+    {
+        output = OUTPUT_MAX;
+        if (error_ < 0)
+            integrator_q8_ = integrator_q8;
+    }
+    else if (output < 0)
+    {
+        output = 0;
+        if (error_ > 0)
+            integrator_q8_ = integrator_q8;
+    }
+    else
+        integrator_q8_ = integrator_q8;
+    output_ = uint16_t(output);
+    return output_;
+}
@@ -0,0 +1,63 @@
+#include <brake_map.h>
+
+BrakeMap::BrakeMap()
+:length_{0}, spacing_log2_{0}, wrap_length_{0}, interpolate_{false}
+{}
+
+BrakeMap::~BrakeMap()
+{}
+
+size_t BrakeMap::write(size_t index, const uint16_t* points, size_t count)
+{
+    if (index >= MAX_POINTS)
+        return 0;
+    if (count > MAX_POINTS - index)
+        count = MAX_POINTS - index;
+    for (size_t i = 0; i < count; ++i)
+        points_[index + i] = points[i];
+    return count;
+}
+
+bool BrakeMap::configure(size_t length, uint32_t spacing_log2,
+                         uint32_t wrap_length_ticks, bool interpolate)
+{
+    if (length > MAX_POINTS || spacing_log2 > MAX_SPACING_LOG2
+        || wrap_length_ticks > uint32_t(INT32_MAX))
+        return false;
+    length_ = length;
+    spacing_log2_ = spacing_log2;
+    wrap_length_ = int32_t(wrap_length_ticks);
+    interpolate_ = interpolate;
+    return true;
+}
+
+uint16_t BrakeMap::evaluate(int32_t position_ticks) const
+{
+    if (length_ == 0)
+        return 0;
+    int32_t position = position_ticks;
+    if (wrap_length_ > 0)
+    {
+        position %= wrap_length_;
+        if (position < 0)
+            position += wrap_length_;
+    }
+    else if (position < 0)
+        return points_[0];
+    const uint32_t index = uint32_t(position) >> spacing_log2_;
+    if (index >= length_)
+        return points_[length_ - 1];
+    const int32_t value = points_[index];
+    if (!interpolate_)
+        return uint16_t(value);
+    uint32_t next_index = index + 1;
+    if (next_index >= length_)
+    {
+        if (wrap_length_ == 0)
+            return uint16_t(value);
+        next_index = 0;
+    }
+    const int32_t fraction = position & ((int32_t(1) << spacing_log2_) - 1);
+    const int32_t delta = int32_t(points_[next_index]) - value;
+    return uint16_t(value + ((delta * fraction) >> spacing_log2_));
+}
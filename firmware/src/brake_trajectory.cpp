@@ -0,0 +1,62 @@
+#include <brake_trajectory.h>
+
+BrakeTrajectory::BrakeTrajectory()
+:length_{0}, position_{0}, loop_{false}, playing_{false}
+{}
+
+BrakeTrajectory::~BrakeTrajectory()
+{}
+
+size_t BrakeTrajectory::write(size_t index, const uint16_t* points,
+                              size_t count)
+{
+    if (index >= MAX_POINTS)
+        return 0;
+    if (count > MAX_POINTS - index)
+        count = MAX_POINTS - index;
+    for (size_t i = 0; i < count; ++i)
+        points_[index + i] = points[i];
+    return count;
+}
+
+void BrakeTrajectory::copy_table(const BrakeTrajectory& other)
+{
+    for (size_t i = 0; i < MAX_POINTS; ++i)
+        points_[i] = other.points_[i];
+    length_ = other.length_;
+}
+
+bool BrakeTrajectory::set_length(size_t length)
+{
+    if (length > MAX_POINTS)
+        return false;
+    length_ = length;
+    return true;
+}
+
+bool BrakeTrajectory::start(bool loop)
+{
+    if (length_ == 0)
+        return false;
+    loop_ = loop;
+    position_ = 0;
+    playing_ = true;
+    return true;
+}
+
+bool BrakeTrajectory::next(uint16_t& value)
+{
+    if (!playing_)
+        return false;
+    if (position_ >= length_)
+    {
+        if (!loop_)
+        {
+            playing_ = false;
+            return false;
+        }
+        position_ = 0;
+    }
+    value = points_[position_++];
+    return true;
+}
@@ -0,0 +1,55 @@
+#include <change_trigger.h>
+
+ChangeTrigger::ChangeTrigger()
+:reference_time_us_{0}, reference_encoder_ticks_{0}, reference_torque_{0},
+ reference_brake_current_{0}, encoder_threshold_{0}, torque_deadband_{0},
+ brake_current_deadband_{0}, heartbeat_us_{0}, has_reference_{false}
+{}
+
+ChangeTrigger::~ChangeTrigger()
+{}
+
+void ChangeTrigger::set_thresholds(uint32_t encoder_ticks,
+                                   uint32_t torque_deadband,
+                                   uint32_t brake_current_deadband)
+{
+    encoder_threshold_ = encoder_ticks;
+    torque_deadband_ = torque_deadband;
+    brake_current_deadband_ = brake_current_deadband;
+    reset();
+}
+
+bool ChangeTrigger::update(uint64_t time_us, int32_t encoder_ticks,
+                           int16_t reaction_torque, int16_t brake_current)
+{
+    if (!enabled())
+        return true;
+    bool triggered = !has_reference_
+        || (heartbeat_us_ && (time_us - reference_time_us_ >= heartbeat_us_));
+    if (!triggered && encoder_threshold_)
+    {
+        // Wrapping subtraction so that counter rollover reads as a small move.
+        const int32_t delta = int32_t(uint32_t(encoder_ticks)
+                                      - uint32_t(reference_encoder_ticks_));
+        const uint32_t distance = (delta < 0) ? -uint32_t(delta) : uint32_t(delta);
+        triggered = distance >= encoder_threshold_;
+    }
+    if (!triggered && torque_deadband_)
+    {
+        const int32_t delta = int32_t(reaction_torque) - reference_torque_;
+        triggered = uint32_t(delta < 0 ? -delta : delta) > torque_deadband_;
+    }
+    if (!triggered && brake_current_deadband_)
+    {
+        const int32_t delta = int32_t(brake_current) - reference_brake_current_;
+        triggered = uint32_t(delta < 0 ? -delta : delta) > brake_current_deadband_;
+    }
+    if (!triggered)
+        return false;
+    reference_time_us_ = time_us;
+    reference_encoder_ticks_ = encoder_ticks;
+    reference_torque_ = reaction_torque;
+    reference_brake_current_ = brake_current;
+    has_reference_ = true;
+    return true;
+}
@@ -0,0 +1,97 @@
+#include <encoder_velocity_estimator.h>
+
+EncoderVelocityEstimator::EncoderVelocityEstimator(uint32_t edge_tick_hz)
+:edge_tick_hz_{edge_tick_hz}
+{
+    reset(0, 0);
+}
+
+EncoderVelocityEstimator::~EncoderVelocityEstimator()
+{}
+
+void EncoderVelocityEstimator::reset(int32_t count, uint64_t now_us)
+{
+    prev_count_ = count;
+    prev_time_us_ = now_us;
+    ref_edge_ticks_ = 0;
+    last_edge_ticks_ = 0;
+    last_edge_time_us_ = now_us;
+    new_edges_ = 0;
+    has_ref_edge_ = false;
+    edges_lost_ = false;
+    velocity_q8_ = 0;
+    acceleration_q8_ = 0;
+}
+
+int32_t EncoderVelocityEstimator::count_per_sample_velocity_q8(
+    int32_t delta_count, uint32_t delta_time_us) const
+{
+    return int32_t((int64_t(delta_count) * (1'000'000 << FRACTIONAL_BITS))
+                   / int64_t(delta_time_us));
+}
+
+void EncoderVelocityEstimator::update(int32_t count, uint64_t now_us)
+{
+    const int32_t delta_count = count - prev_count_;
+    const uint32_t delta_time_us = uint32_t(now_us - prev_time_us_);
+    if (delta_time_us == 0)
+        return;
+    int32_t velocity_q8 = velocity_q8_;
+    // The count is latched before the edge FIFO is drained, so the count
+    // that goes with an edge can arrive an update after the edge. Until it
+    // does, the direction of those edges is unknown: hold the estimate and
+    // measure them with the next update.
+    const bool defer_edges = !edges_lost_ && has_ref_edge_ && (new_edges_ > 0)
+                             && (delta_count == 0);
+    if (edges_lost_ || (new_edges_ > 0 && !has_ref_edge_))
+    {
+        // M-method: no trustworthy edge interval.
+        velocity_q8 = count_per_sample_velocity_q8(delta_count, delta_time_us);
+    }
+    else if (new_edges_ > 0 && !defer_edges)
+    {
+        // T-method over the whole span of new edges. Direction comes from
+        // the count since the edge timer only sees one channel.
+        const uint32_t span_ticks = last_edge_ticks_ - ref_edge_ticks_;
+        if (span_ticks == 0)
+            velocity_q8 = 0;
+        else
+        {
+            const int64_t speed_q8 = (int64_t(new_edges_) * COUNTS_PER_EDGE
+                                      * int64_t(edge_tick_hz_)
+                                      << FRACTIONAL_BITS) / span_ticks;
+            velocity_q8 = int32_t((delta_count > 0) ? speed_q8 : -speed_q8);
+        }
+    }
+    else if (new_edges_ == 0)
+    {
+        // No edges: the true speed is at most one edge since the last edge.
+        const uint32_t since_edge_us = uint32_t(now_us - last_edge_time_us_);
+        const int32_t bound_q8 = (since_edge_us == 0)
+            ? velocity_q8_
+            : count_per_sample_velocity_q8(COUNTS_PER_EDGE, since_edge_us);
+        if (velocity_q8 > bound_q8)
+            velocity_q8 = bound_q8;
+        else if (velocity_q8 < -bound_q8)
+            velocity_q8 = -bound_q8;
+    }
+    // Acceleration: smoothed first difference.
+    const int32_t raw_acceleration_q8 = int32_t(
+        (int64_t(velocity_q8 - velocity_q8_) * 1'000'000) / delta_time_us);
+    acceleration_q8_ += (raw_acceleration_q8 - acceleration_q8_)
+                        >> ACCEL_FILTER_SHIFT;
+    velocity_q8_ = velocity_q8;
+    prev_count_ = count;
+    prev_time_us_ = now_us;
+    if (defer_edges)
+        return;
+    // Advance the measurement window.
+    if (new_edges_ > 0)
+    {
+        ref_edge_ticks_ = last_edge_ticks_;
+        last_edge_time_us_ = now_us;
+        has_ref_edge_ = true;
+    }
+    new_edges_ = 0;
+    edges_lost_ = false;
+}
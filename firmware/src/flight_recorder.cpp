@@ -0,0 +1,62 @@
+#include <flight_recorder.h>
+
+FlightRecorder::FlightRecorder()
+:pre_samples_{CAPACITY / 2}, post_samples_{CAPACITY / 2}
+{
+    disarm();
+}
+
+FlightRecorder::~FlightRecorder()
+{}
+
+bool FlightRecorder::set_window(uint32_t pre_samples, uint32_t post_samples)
+{
+    if (post_samples == 0 || pre_samples > CAPACITY
+        || post_samples > CAPACITY - pre_samples)
+        return false;
+    pre_samples_ = pre_samples;
+    post_samples_ = post_samples;
+    return true;
+}
+
+void FlightRecorder::arm()
+{
+    disarm();
+    state_ = ARMED;
+}
+
+void FlightRecorder::disarm()
+{
+    state_ = IDLE;
+    head_ = 0;
+    start_ = 0;
+    wrapped_ = false;
+    pre_count_ = 0;
+    post_count_ = 0;
+    post_remaining_ = 0;
+}
+
+bool FlightRecorder::trigger()
+{
+    if (state_ != ARMED)
+        return false;
+    const uint32_t available = wrapped_ ? CAPACITY : head_;
+    pre_count_ = (pre_samples_ < available) ? pre_samples_ : available;
+    start_ = (head_ - pre_count_) & MASK;
+    post_count_ = post_samples_;
+    post_remaining_ = post_samples_;
+    state_ = TRIGGERED;
+    return true;
+}
+
+size_t FlightRecorder::read(size_t index, record_t* dest, size_t count) const
+{
+    const size_t size = num_records();
+    if (index >= size)
+        return 0;
+    if (count > size - index)
+        count = size - index;
+    for (size_t i = 0; i < count; ++i)
+        dest[i] = buffer_[(start_ + index + i) & MASK];
+    return count;
+}
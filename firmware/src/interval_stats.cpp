@@ -0,0 +1,32 @@
+#include <interval_stats.h>
+
+IntervalStats::IntervalStats()
+{
+    clear();
+}
+
+IntervalStats::~IntervalStats()
+{}
+
+void IntervalStats::clear()
+{
+    for (auto& stats: channels_)
+    {
+        stats.sum = 0;
+        stats.count = 0;
+        stats.min = INT16_MAX;
+        stats.max = INT16_MIN;
+    }
+}
+
+int16_t IntervalStats::mean(channel_t channel) const
+{
+    const uint32_t count = channels_[channel].count;
+    if (count == 0)
+        return 0;
+    const int64_t sum = channels_[channel].sum;
+    const int64_t half = int64_t(count / 2);
+    // Round half away from zero.
+    return int16_t((sum < 0) ? (sum - half) / int64_t(count)
+                             : (sum + half) / int64_t(count));
+}
@@ -1,19 +1,55 @@
 #include <pico/stdlib.h>
+#include <pico/multicore.h>
 #include <cstring>
+#include <hardware/dma.h>
+#include <hardware/timer.h>
+#include <hardware/structs/systick.h>
+#include <hardware/sync.h>
+#include <hardware/flash.h>
 #include <pio_encoder.h>
+#include <pio_encoder_edge_timer.h>
+#include <encoder_velocity_estimator.h>
+#include <sensor_batch.h>
+#include <packed_sensor_data.h>
+#include <change_trigger.h>
+#include <interval_stats.h>
+#include <flight_recorder.h>
+#include <step_response.h>
+#include <adc_decimator.h>
+#include <fixed_point_filter.h>
+#include <sensor_filter_presets.h>
+#include <sample_ring.h>
+#include <stream_period_estimator.h>
+#include <brake_current_controller.h>
+#include <torque_limit_monitor.h>
+#include <brake_trajectory.h>
+#include <brake_map.h>
+#include <virtual_load.h>
+#include <brake_calibration.h>
+#include <wear_leveling_store.h>
+#include <spsc_queue.h>
+#include <periodic_scheduler.h>
 #include <pio_ads7049.h>
 #include <pio_ltc264x.h>
+#include <adc_round_robin.h>
 #include <config.h>
 #include <harp_message.h>
 #include <harp_core.h>
 #include <harp_c_app.h>
 #include <harp_synchronizer.h>
+#include <tusb.h>
 #ifdef DEBUG
     #include <cstdio> // for printf
 #endif
 
 // encoder program is 29 instructions, so it needs to go on its own PIO slice.
-PIOEncoder encoder(pio1, 0, ENCODER_BASE_PIN);
+// Every encoder shares it on consecutive state machines. The treadmill is
+// encoder 0.
+const uint8_t encoder_base_pins[] = ENCODER_BASE_PINS;
+static_assert(NUM_ENCODERS >= 1 && NUM_ENCODERS <= PIOEncoder::MAX_ENCODERS
+              && NUM_ENCODERS <= count_of(encoder_base_pins),
+              "Unsupported number of encoders.");
+PIOEncoder encoder(pio1, 0, encoder_base_pins, NUM_ENCODERS);
 // Create PIO SPI ADC instances for current and torque transducer sensing.
 // Both PIO_ADS7049 instances can use the same PIO program.
 PIO_ADS7049 current_sensor(pio0,
@@ -28,6 +64,16 @@ PIO_ADS7049 reaction_torque_sensor(pio0, TORQUE_TRANSDUCER_CS_PIN,
 PIO_LTC264x brake_setpoint(pio0, // CS pin is SCK pin + 1
                            BRAKE_SETPOINT_SCK_PIN,
                            BRAKE_SETPOINT_PICO_PIN);
+// Timestamp encoder channel A edges on the last free pio0 state machine.
+PIOEncoderEdgeTimer encoder_edge_timer(pio0, ENCODER_BASE_PIN);
+// Auxiliary analog inputs on the on-chip ADC.
+static constexpr uint32_t AUX_ANALOG_NUM_INPUTS =
+    __builtin_popcount(AUX_ANALOG_INPUTS);
+static_assert(AUX_ANALOG_NUM_INPUTS > 0 && AUX_ANALOG_INPUTS < (1u << 5)
+              && (AUX_ANALOG_NUM_INPUTS & (AUX_ANALOG_NUM_INPUTS - 1)) == 0,
+              "Auxiliary analog inputs must be a power-of-two number of "
+              "ADC inputs 0-4.");
+ADCRoundRobin aux_adc(AUX_ANALOG_INPUTS);
 
 
 
@@ -39,39 +85,1130 @@ const uint8_t harp_version_minor = 0;
 const uint16_t serial_number = 0;
 
 // Setup for Harp App
-const size_t reg_count = 10;
+const size_t reg_count = 75;
 
-uint32_t __not_in_flash("dispatch_interval_us") dispatch_interval_us;
-uint32_t __not_in_flash("next_msg_dispatch_time_us") next_msg_dispatch_time_us;
+// Periodic sensor register dispatch. Driven by sample timestamps.
+PeriodicScheduler __not_in_flash("dispatch_scheduler") dispatch_scheduler;
+PackedSensorData __not_in_flash("packed_sensor_data") packed_sensor_data;
+ChangeTrigger __not_in_flash("dispatch_change_trigger") dispatch_change_trigger;
+IntervalStats __not_in_flash("dispatch_interval_stats") dispatch_interval_stats;
+
+// Set once core1 is running and must be parked for flash writes.
+bool core1_started = false;
+
+// Torque-to-setpoint calibration. Core0 only. Tables are loaded into the
+// staged one and then copied into the active one all at once.
+BrakeCalibration brake_calibration;
+BrakeCalibration staged_brake_calibration;
+
+// Batched sensor sampling.
+SensorBatch __not_in_flash("sensor_batch") sensor_batch;
+PeriodicScheduler __not_in_flash("batch_scheduler") batch_scheduler;
+
+// Incremented for each trajectory playback so that completion of an old
+// playback can be told apart from the current one.
+uint8_t __not_in_flash("trajectory_run_count") trajectory_run_count;
+// Likewise for each flight recorder (re)arm, so that stale capture events
+// are ignored.
+uint8_t __not_in_flash("flight_recorder_run_count") flight_recorder_run_count;
+// Likewise for each brake step test.
+uint8_t __not_in_flash("brake_step_run_count") brake_step_run_count;
+// Steps applied so far in the current brake step test, including the first
+// one that only settles the brake at the low setpoint.
+uint16_t __not_in_flash("brake_step_count") brake_step_count;
+
+// Which brake map core1 will be evaluating once it handles the last
+// SET_BRAKE_MAP command.
+uint8_t __not_in_flash("brake_map_pending_front") brake_map_pending_front;
+// Likewise for trajectory tables and START_TRAJECTORY, and whether the back
+// table has been written since it was swapped out, i.e: whether the next
+// playback swaps it in.
+uint8_t __not_in_flash("trajectory_pending_front") trajectory_pending_front;
+bool __not_in_flash("trajectory_back_written") trajectory_back_written;
+
+// Core0 timing diagnostics. Cleared by the reset_diagnostics register.
+uint32_t __not_in_flash("last_loop_time_us") last_loop_time_us;
+uint32_t __not_in_flash("loop_period_min_us") loop_period_min_us;
+uint32_t __not_in_flash("loop_period_max_us") loop_period_max_us;
+uint64_t __not_in_flash("loop_period_sum_us") loop_period_sum_us;
+uint32_t __not_in_flash("loop_count") loop_count;
+// Auxiliary analog inputs. Core0 only. DMA streams every conversion into the
+// ring, which holds a whole number of rounds of the inputs, so a conversion's
+// input follows from its position even if the ring laps.
+SampleRing<uint16_t, AUX_ADC_RING_SIZE> __not_in_flash("aux_adc_ring") aux_adc_ring;
+ADCDecimator __not_in_flash("aux_analog_decimator") aux_analog_decimator;
+uint32_t __not_in_flash("aux_adc_next_input") aux_adc_next_input;
+
+// Dispatch lateness bucket upper bounds double from 128[us]; the last bucket
+// is unbounded.
+static constexpr size_t DISPATCH_LATENESS_BUCKETS = 8;
+static constexpr uint32_t DISPATCH_LATENESS_BUCKET0_SHIFT = 7; // 128[us].
+uint32_t __not_in_flash("usb_tx_backpressure_count") usb_tx_backpressure_count;
+// Harp message bytes besides the payload: header (5), timestamp (6),
+// checksum (1).
+static constexpr uint32_t HARP_MSG_OVERHEAD_BYTES = 12;
+
+// Commands sent from core0 (Harp register writes) to core1.
+enum app_cmd_type_t : uint8_t
+{
+    SET_BRAKE_SETPOINT,     // value: {arrival time [us] [31:16],
+                            //         raw DAC code[15:0]}.
+    SET_CONTROL_ENABLE,     // value: 0 or 1.
+    SET_CONTROL_GAINS,      // value: {Ki[31:16], Kp[15:0]}.
+    SET_CONTROL_SETPOINT,   // value: brake current in ADC counts.
+    SET_TORQUE_LIMITING,    // value: 0 or 1.
+    CLEAR_TORQUE_LIMIT,
+    SET_TORQUE_LIMIT_WINDOW,        // value: samples (power of two).
+    SET_TORQUE_LIMIT_HYSTERESIS,    // value: raw ADC counts.
+    SET_TORQUE_LIMITS,      // value: {max[31:16], min[15:0]} raw ADC counts.
+    SET_ANALOG_TARE_OFFSETS, // value: {brake_current[31:16], torque[15:0]}.
+    RESET_DIAGNOSTICS,
+    START_TRAJECTORY,   // value: {run[31:24], unused[23:22], swap[21],
+                        //         loop[20], sample period [us] [19:0]}.
+    STOP_TRAJECTORY,
+    SET_BRAKE_MAP,      // value: 0 --> disable, 1 --> swap in back buffer and
+                        //        enable.
+    SET_VIRTUAL_LOAD_ENABLE,    // value: 0 or 1.
+    SET_VIRTUAL_DAMPING,        // value: Q24.8 [uA / (counts/s)].
+    SET_VIRTUAL_FRICTION,       // value: [uA].
+    SET_VIRTUAL_INERTIA,        // value: Q24.8 [uA / (counts/s^2)].
+    SET_VIRTUAL_FRICTION_DEADBAND, // value: [counts/s].
+    SET_FLIGHT_RECORDER,    // value: {run[31:24], unused[23:8], action[7:0]}
+                            //        action: 0 --> disarm, 1 --> arm,
+                            //        2 --> trigger.
+    SET_FLIGHT_RECORDER_WINDOW, // value: {post[31:16], pre[15:0]} samples.
+    SET_BRAKE_STEP_TEST,    // value: {run[31:24], unused[23:20],
+                            //         decimation log2[19:16],
+                            //         samples per step[15:0]}.
+                            //        0 samples --> stop with the brake off.
+    BRAKE_STEP,             // value: same as SET_BRAKE_SETPOINT.
+    TARE,                   // value: {encoders[11:8], unused[7:3],
+                            //         brake_current[2], torque[1],
+                            //         encoder 0[0]}.
+    RESET_TARE,             // value: same as TARE.
+    SET_SENSOR_FILTERS,     // value: {unused[31:16], brake_current[15:8],
+                            //         torque[7:0]} sensor filter presets.
+    SET_INTERVAL_STATS,     // value: 0 or 1.
+    RESET,
+};
+
+struct app_cmd_t
+{
+    app_cmd_type_t type;
+    uint32_t value;
+};
+
+// Samples and events sent from core1 to core0.
+enum app_event_type_t : uint8_t
+{
+    SENSOR_SAMPLE,
+    TORQUE_LIMIT_TRIGGERED,
+    TRAJECTORY_DONE,
+    FLIGHT_RECORDER_TRIGGERED,
+    FLIGHT_RECORDER_FROZEN,
+    BRAKE_STEP_CAPTURED,
+};
+
+struct app_event_t
+{
+    uint64_t time_us; // system time of acquisition.
+    int32_t encoder_ticks[NUM_ENCODERS]; // Treadmill first.
+    int16_t reaction_torque;
+    int16_t brake_current;
+    int32_t encoder_velocity; // Q24.8 [counts/s]
+    int32_t encoder_acceleration; // Q24.8 [counts/s^2]
+    uint16_t brake_setpoint; // DAC value applied as of this sample.
+    // Tared conversions since the previous sample. Empty unless interval
+    // stats are on.
+    IntervalStats::tick_t torque_stats;
+    IntervalStats::tick_t brake_current_stats;
+    app_event_type_t type;
+    uint8_t trajectory_run; // Which playback finished. TRAJECTORY_DONE only.
+    uint8_t flight_recorder_run; // Which capture. FLIGHT_RECORDER_* only.
+    uint8_t brake_step_run; // Which test. BRAKE_STEP_CAPTURED only.
+};
+
+SPSCQueue<app_cmd_t, CORE1_CMD_QUEUE_SIZE> __not_in_flash("core1_cmds") core1_cmds;
+SPSCQueue<app_event_t, CORE1_EVENT_QUEUE_SIZE> __not_in_flash("core1_events") core1_events;
+
+// Most recent sample received from core1.
+app_event_t __not_in_flash("latest_sample") latest_sample;
+
+/**
+ * \brief send a command to core1.
+ * \returns false if the command queue is full.
+ */
+inline bool send_core1_cmd(app_cmd_type_t type, uint32_t value = 0)
+{ return core1_cmds.push({type, value});}
+
+/**
+ * \brief forward a brake setpoint to core1, stamped with when it arrived so
+ *  that core1 can measure the command-to-DAC latency.
+ * \returns false if the command queue is full.
+ */
+inline bool send_brake_setpoint_cmd(app_cmd_type_t type, uint16_t setpoint)
+{ return send_core1_cmd(type, (time_us_32() << 16) | setpoint);}
+
+// Everything below until the Harp app registers is owned by core1.
+
+// Sensor values latched together at each sample alarm.
+struct latched_sample_t
+{
+    uint64_t time_us; // system time that the alarm handler latched the sample.
+    uint32_t encoder_raw[NUM_ENCODERS];
+    uint16_t torque_raw; // Filtered while the channel's filter is on.
+    uint16_t brake_current_raw;
+    // Stream positions, to measure the age of the latched values.
+    uint16_t encoder_reply_index; // Of encoder_raw[0].
+    uint16_t torque_write_index;
+    uint16_t brake_current_write_index;
+};
+
+// Sample alarm (IRQ on core1) --> core1 loop.
+SPSCQueue<latched_sample_t, SAMPLE_LATCH_QUEUE_SIZE> __not_in_flash("sample_latches") sample_latches;
+PeriodicScheduler __not_in_flash("sample_scheduler") sample_scheduler;
+uint __not_in_flash("sample_alarm_num") sample_alarm_num;
+// Latched samples dropped because the core1 loop fell behind.
+volatile uint32_t __not_in_flash("latch_overrun_count") latch_overrun_count;
 
 // PIO and DMA will periodically write raw values to these locations.
-volatile uint32_t __not_in_flash("encoder_raw") encoder_raw;
-volatile int16_t __not_in_flash("torque_raw") torque_raw;
-volatile int16_t __not_in_flash("brake_current_raw") brake_current_raw;
+volatile uint32_t __not_in_flash("encoder_stream") encoder_stream;
+volatile uint32_t __not_in_flash("encoder_raw") encoder_raw[NUM_ENCODERS];
+EncoderVelocityEstimator __not_in_flash("encoder_velocity")
+    encoder_velocity(encoder_edge_timer.tick_hz());
+// DMA streams every ADC conversion into these circular buffers.
+SampleRing<uint16_t, ADC_RING_SIZE> __not_in_flash("torque_ring") torque_ring;
+SampleRing<uint16_t, ADC_RING_SIZE> __not_in_flash("brake_current_ring") brake_current_ring;
+// DMA channels writing to each ring. Looked up after DMA is configured.
+uint __not_in_flash("torque_dma_chan") torque_dma_chan;
+uint __not_in_flash("brake_current_dma_chan") brake_current_dma_chan;
+// Period of each sensor stream, and so how old its latest value is at each
+// latch.
+StreamPeriodEstimator __not_in_flash("encoder_period")
+    encoder_period(0xFFFF, SENSOR_SKEW_WINDOW_US, SENSOR_STREAM_JITTER_NS);
+StreamPeriodEstimator __not_in_flash("torque_period")
+    torque_period(ADC_RING_SIZE - 1, SENSOR_SKEW_WINDOW_US,
+                  SENSOR_STREAM_JITTER_NS);
+StreamPeriodEstimator __not_in_flash("brake_current_period")
+    brake_current_period(ADC_RING_SIZE - 1, SENSOR_SKEW_WINDOW_US,
+                         SENSOR_STREAM_JITTER_NS);
+// Conversion period of each ADC stream, i.e: the worst-case age of a latched
+// conversion relative to the latch timestamp. Published for core0.
+volatile uint32_t __not_in_flash("torque_sample_age_ns") torque_sample_age_ns;
+volatile uint32_t __not_in_flash("brake_current_sample_age_ns") brake_current_sample_age_ns;
+// How long before the latch the latest sample's values were acquired [us].
+// Its event is stamped at the latch time less this.
+uint32_t __not_in_flash("sample_acquisition_age_us") sample_acquisition_age_us;
+// Furthest each sensor's value may be from its event's timestamp [ns],
+// [encoder, torque, brake current], over the current and the last complete
+// window. The last is published for core0.
+uint32_t __not_in_flash("window_sensor_skew_ns") window_sensor_skew_ns[3];
+uint64_t __not_in_flash("sensor_skew_window_start_us") sensor_skew_window_start_us;
+volatile uint32_t __not_in_flash("sensor_skew_ns") sensor_skew_ns[3];
+
+// Torque limit. Checked against every conversion in the torque monitor alarm
+// IRQ on core1, so the core1 loop only touches it with interrupts disabled.
+TorqueLimitMonitor __not_in_flash("torque_limit_monitor") torque_limit_monitor;
+PeriodicScheduler __not_in_flash("torque_monitor_scheduler") torque_monitor_scheduler;
+uint32_t __not_in_flash("last_torque_check_time_us") last_torque_check_time_us;
+// Set by the torque monitor alarm IRQ. Core1 loop notifies core0.
+volatile bool __not_in_flash("torque_limit_trip_pending") torque_limit_trip_pending;
+// Time from the first out-of-range conversion to the DAC write on the last trip.
+volatile uint32_t __not_in_flash("torque_limit_trip_latency_us") torque_limit_trip_latency_us;
+
+// Sensor filters. Run over every conversion in the torque monitor alarm IRQ
+// on core1, so the core1 loop only touches them with interrupts disabled.
+// While a channel's filter is on, its latched value is the filter's latest
+// output instead of the latest conversion. The torque limit monitor always
+// sees every raw conversion.
+using SensorFilter = FilterPipeline<SENSOR_FILTER_DECIMATION_LOG2,
+                                    SENSOR_FILTER_SECTIONS>;
+SensorFilter __not_in_flash("torque_filter") torque_filter;
+SensorFilter __not_in_flash("brake_current_filter") brake_current_filter;
+bool __not_in_flash("torque_filter_enabled") torque_filter_enabled;
+bool __not_in_flash("brake_current_filter_enabled") brake_current_filter_enabled;
+// The brake current ring's own read cursor belongs to the core1 loop.
+uint32_t __not_in_flash("brake_current_filter_read_index") brake_current_filter_read_index;
+
+// Per-interval statistics. The core1 loop reduces every conversion since the
+// previous latch and sends the result up with the sample for core0 to merge.
+bool __not_in_flash("interval_stats_enabled") interval_stats_enabled;
+uint32_t __not_in_flash("torque_stats_read_index") torque_stats_read_index;
+uint32_t __not_in_flash("brake_current_stats_read_index") brake_current_stats_read_index;
+
+// Closed-loop brake current control.
+BrakeCurrentController __not_in_flash("brake_current_controller") brake_current_controller;
+bool __not_in_flash("brake_current_control") brake_current_control;
+PeriodicScheduler __not_in_flash("control_scheduler") control_scheduler;
+uint16_t __not_in_flash("brake_output") brake_output; // Last DAC value written.
 
-// Filtered value for torque limit.
-volatile int32_t __not_in_flash("filtered_torque") filtered_torque;
-uint32_t __not_in_flash("torque_limit_interval_us") torque_limit_interval_us;
-uint32_t __not_in_flash("next_torque_check_time_us") next_torque_check_time_us;
+// Brake setpoint trajectory playback. Double-buffered like the brake maps:
+// core1 plays the front table while core0 writes the back one, and core1
+// publishes which table is in front once it has swapped. Points are played
+// out in the trajectory alarm IRQ.
+BrakeTrajectory __not_in_flash("brake_trajectories") brake_trajectories[2];
+volatile uint8_t __not_in_flash("trajectory_front") trajectory_front;
+PeriodicScheduler __not_in_flash("trajectory_scheduler") trajectory_scheduler;
+uint __not_in_flash("trajectory_alarm_num") trajectory_alarm_num;
+uint8_t __not_in_flash("trajectory_run") trajectory_run;
+// Set by the trajectory alarm IRQ. Core1 loop notifies core0.
+volatile bool __not_in_flash("trajectory_done_pending") trajectory_done_pending;
+
+// Position-indexed brake maps. Double-buffered: core1 evaluates the front
+// map while core0 writes the back one. Core1 publishes which map is in front
+// once it has swapped, and core0 only writes the map that is not.
+BrakeMap __not_in_flash("brake_maps") brake_maps[2];
+volatile uint8_t __not_in_flash("brake_map_front") brake_map_front;
+bool __not_in_flash("brake_map_enabled") brake_map_enabled;
+
+// Virtual load emulation. Drives the closed-loop brake current setpoint.
+VirtualLoad __not_in_flash("virtual_load") virtual_load;
+bool __not_in_flash("virtual_load_enabled") virtual_load_enabled;
+// Brake current [uA] to ADC counts in Q16.16.
+static constexpr uint32_t BRAKE_CURRENT_UA_TO_COUNTS_Q16 =
+    (uint64_t(BRAKE_CURRENT_ADC_FULL_SCALE_COUNTS) << 16)
+    / BRAKE_CURRENT_ADC_FULL_SCALE_UA;
+
+// Dropped samples because core0 fell behind.
+volatile uint32_t __not_in_flash("dropped_sample_count") dropped_sample_count;
+
+// Full-rate capture around torque limit trips. Core0 only reads records once
+// core1 reports that the capture froze.
+FlightRecorder __not_in_flash("flight_recorder") flight_recorder;
+uint8_t __not_in_flash("flight_recorder_run") flight_recorder_run;
+// Flight recorder record flags.
+static constexpr uint16_t FLIGHT_RECORD_TORQUE_LIMIT_TRIGGERED = 1u << 0;
+
+// Brake step-response self-test. Brake current conversions are captured from
+// just before each step. Core0 only reads the capture once core1 reports
+// that it is full.
+StepResponseCapture __not_in_flash("brake_step_capture") brake_step_capture;
+uint8_t __not_in_flash("brake_step_run") brake_step_run;
+uint32_t __not_in_flash("brake_step_samples") brake_step_samples; // 0 --> off.
+uint32_t __not_in_flash("brake_step_decimation_log2") brake_step_decimation_log2;
+// Time from a brake setpoint arriving at core0 to its DAC write.
+volatile uint32_t __not_in_flash("brake_setpoint_latency_us") brake_setpoint_latency_us;
+volatile uint32_t __not_in_flash("brake_setpoint_latency_max_us") brake_setpoint_latency_max_us;
 
 // offset --> measurement taken at requested time.
-int32_t __not_in_flash("encoder_offset") encoder_offset;
+int32_t __not_in_flash("encoder_offset") encoder_offset[NUM_ENCODERS];
 int16_t __not_in_flash("torque_offset") torque_offset;
 int16_t __not_in_flash("brake_current_offset") brake_current_offset;
 
 inline uint32_t get_tared_encoder_ticks()
-{ return encoder_raw - encoder_offset;}
-
-// DMA writes the data to torque_raw and brake_current_raw word-by-word
-// (2 bytes at a time in this case).
-// Subtlety: these "getter functions" make an atomic copy of the data at the
-// location that DMA is writing to into the CPU registers before doing the
-// subtraction, hence preventing part of the word (1 of 2 bytes) from being
-// overwritten by DMA while this function executes.
+{ return encoder_raw[0] - encoder_offset[0];}
+
+/**
+ * \brief encoders selected by a TARE or RESET_TARE command.
+ */
+inline uint32_t encoder_tare_mask(uint32_t cmd_value)
+{ return (cmd_value & 1u) | ((cmd_value >> 8) & 0xFu);}
+
+// The DMA write address points to the next ring element to be written.
+inline uint32_t torque_write_index()
+{ return torque_ring.address_to_index(dma_hw->ch[torque_dma_chan].write_addr);}
+inline uint32_t brake_current_write_index()
+{ return brake_current_ring.address_to_index(
+            dma_hw->ch[brake_current_dma_chan].write_addr);}
+
+// DMA writes the data to the rings word-by-word (2 bytes at a time in this
+// case), so the most recently written element is never partially written.
+inline int16_t get_raw_reaction_torque()
+{ return int16_t(torque_ring.latest(torque_write_index()));}
+inline int16_t get_raw_brake_current()
+{ return int16_t(brake_current_ring.latest(brake_current_write_index()));}
+
+/**
+ * \brief the value to report for each ADC stream: the filter's latest output
+ *  while its filter is on, otherwise the latest conversion.
+ */
+inline uint16_t get_reported_torque(uint32_t write_index)
+{
+    return (torque_filter_enabled && torque_filter.has_output())
+           ? uint16_t(torque_filter.output_counts())
+           : torque_ring.latest(write_index);
+}
+inline uint16_t get_reported_brake_current(uint32_t write_index)
+{
+    return (brake_current_filter_enabled && brake_current_filter.has_output())
+           ? uint16_t(brake_current_filter.output_counts())
+           : brake_current_ring.latest(write_index);
+}
+
 inline int16_t get_tared_reaction_torque()
-{ return torque_raw - torque_offset;}
+{ return get_raw_reaction_torque() - torque_offset;}
 inline int16_t get_tared_brake_current()
-{ return brake_current_raw - brake_current_offset;}
+{ return get_raw_brake_current() - brake_current_offset;}
+
+/**
+ * \brief find the (already-claimed) DMA channel whose write address lies
+ *  within the specified buffer.
+ * \returns the channel number or -1 if none was found.
+ */
+int find_dma_channel_writing_to(const volatile void* buffer, size_t num_bytes)
+{
+    const uintptr_t start = uintptr_t(buffer);
+    for (uint chan = 0; chan < NUM_DMA_CHANNELS; ++chan)
+    {
+        if (!dma_channel_is_claimed(chan))
+            continue;
+        const uintptr_t write_addr = dma_hw->ch[chan].write_addr;
+        if (write_addr >= start && write_addr <= start + num_bytes)
+            return int(chan);
+    }
+    return -1;
+}
+
+inline bool torque_limit_triggered()
+{ return torque_limit_monitor.tripped();}
+
+/**
+ * \brief write a new brake setpoint to the DAC. Core1 loop only.
+ * \details The torque monitor IRQ may zero the DAC at any time, so check for
+ *  a trip and write the DAC with interrupts disabled such that a trip can
+ *  never be overwritten by a stale value.
+ */
+inline void write_brake_output(uint16_t value)
+{
+    const uint32_t irq_state = save_and_disable_interrupts();
+    if (torque_limit_triggered())
+        value = 0;
+    brake_output = value;
+    brake_setpoint.write_value(value);
+    restore_interrupts(irq_state);
+}
+
+/**
+ * \brief write a setpoint forwarded from core0 and measure its latency.
+ * \param cmd_value {arrival time [us] [31:16], raw DAC code[15:0]}.
+ */
+void write_commanded_brake_output(uint32_t cmd_value)
+{
+    write_brake_output(uint16_t(cmd_value));
+    // Arrival time is truncated to 16 bits, so this wraps past 65.5[ms].
+    const uint32_t latency_us = uint16_t(time_us_32() - (cmd_value >> 16));
+    brake_setpoint_latency_us = latency_us;
+    if (latency_us > brake_setpoint_latency_max_us)
+        brake_setpoint_latency_max_us = latency_us;
+}
+
+/**
+ * \brief check every new torque conversion against the torque limit and
+ *  kill the brake directly if it trips.
+ * \note runs in interrupt context on core1.
+ */
+void __not_in_flash_func(check_torque_limit)(uint32_t now_us)
+{
+    const uint32_t write_index = torque_write_index();
+    const size_t count = torque_ring.available(write_index);
+    if (count == 0)
+        return;
+    // Conversions arrive at a steady rate, so spread their timestamps evenly
+    // over the time since the last check.
+    const uint32_t step_us = (now_us - last_torque_check_time_us) / count;
+    uint32_t sample_time_us = last_torque_check_time_us;
+    last_torque_check_time_us = now_us;
+    bool tripped = false;
+    torque_ring.consume(write_index, [&](uint16_t raw)
+    {
+        sample_time_us += step_us;
+        tripped |= torque_limit_monitor.add_sample(int16_t(raw), sample_time_us);
+        if (torque_filter_enabled)
+            torque_filter.add(raw);
+    });
+    if (!tripped)
+        return;
+    // Kill the brake.
+    brake_output = 0;
+    brake_setpoint.write_value(0);
+    torque_limit_trip_latency_us =
+        time_us_32() - torque_limit_monitor.trip_sample_time_us();
+    torque_limit_trip_pending = true;
+}
+
+/**
+ * \brief filter every new brake current conversion.
+ * \note runs in interrupt context on core1.
+ */
+void __not_in_flash_func(filter_brake_current)()
+{
+    brake_current_ring.consume_from(brake_current_filter_read_index,
+                                    brake_current_write_index(),
+        [](uint16_t raw){brake_current_filter.add(raw);});
+}
+
+/**
+ * \brief reduce every torque and brake current conversion up to the latch
+ *  into the sample's statistics.
+ */
+void reduce_interval_stats(const latched_sample_t& latch, app_event_t& sample)
+{
+    IntervalStats::tick_t torque = IntervalStats::EMPTY_TICK;
+    IntervalStats::tick_t brake_current = IntervalStats::EMPTY_TICK;
+    if (interval_stats_enabled)
+    {
+        torque_ring.consume_from(torque_stats_read_index,
+                                 latch.torque_write_index,
+            [&torque](uint16_t raw)
+            {IntervalStats::accumulate(torque, int16_t(raw));});
+        brake_current_ring.consume_from(brake_current_stats_read_index,
+                                        latch.brake_current_write_index,
+            [&brake_current](uint16_t raw)
+            {IntervalStats::accumulate(brake_current, int16_t(raw));});
+    }
+    sample.torque_stats = IntervalStats::tared(torque, torque_offset);
+    sample.brake_current_stats = IntervalStats::tared(brake_current,
+                                                      brake_current_offset);
+}
+
+/**
+ * \brief select a channel's sensor filter preset. Out of range presets turn
+ *  the filter off. Call with interrupts disabled.
+ */
+void set_sensor_filter(SensorFilter& filter, bool& enabled, uint32_t preset)
+{
+    enabled = (preset > 0) && (preset < NUM_SENSOR_FILTER_PRESETS);
+    filter.set_sections(enabled ? SENSOR_FILTER_PRESETS[preset].sections
+                                : nullptr);
+}
+
+void __not_in_flash_func(torque_monitor_alarm_callback)(uint alarm_num)
+{
+    const uint64_t now_us = time_us_64();
+    check_torque_limit(uint32_t(now_us));
+    if (brake_current_filter_enabled)
+        filter_brake_current();
+    uint64_t deadline_us = torque_monitor_scheduler.service(now_us);
+    while (hardware_alarm_set_target(alarm_num, from_us_since_boot(deadline_us)))
+        deadline_us = torque_monitor_scheduler.skip_to(time_us_64());
+}
+
+/**
+ * \brief play out the next trajectory point. Stops at the end of the table
+ *  or if the torque limit trips.
+ * \note runs in interrupt context on core1.
+ */
+void __not_in_flash_func(trajectory_alarm_callback)(uint alarm_num)
+{
+    uint16_t value;
+    // The torque monitor has already zeroed the DAC if it tripped.
+    BrakeTrajectory& trajectory = brake_trajectories[trajectory_front];
+    if (torque_limit_triggered() || !trajectory.next(value))
+    {
+        trajectory.stop();
+        trajectory_done_pending = true;
+        return; // Leave the alarm disarmed.
+    }
+    brake_output = value;
+    brake_setpoint.write_value(value);
+    uint64_t deadline_us = trajectory_scheduler.service(time_us_64());
+    while (hardware_alarm_set_target(alarm_num, from_us_since_boot(deadline_us)))
+        deadline_us = trajectory_scheduler.skip_to(time_us_64());
+}
+
+/**
+ * \brief stop trajectory playback. The brake holds its last value.
+ */
+void stop_trajectory()
+{
+    const uint32_t irq_state = save_and_disable_interrupts();
+    hardware_alarm_cancel(trajectory_alarm_num);
+    brake_trajectories[trajectory_front].stop();
+    trajectory_scheduler.stop();
+    trajectory_done_pending = false;
+    restore_interrupts(irq_state);
+}
+
+/**
+ * \brief notify core0 that playback finished outside of interrupt context.
+ */
+void handle_trajectory_done()
+{
+    if (!trajectory_done_pending)
+        return;
+    trajectory_done_pending = false;
+    app_event_t event{};
+    event.time_us = time_us_64();
+    event.brake_setpoint = brake_output;
+    event.type = TRAJECTORY_DONE;
+    event.trajectory_run = trajectory_run;
+    // Retry until there's room since this must not be dropped.
+    while (!core1_events.push(event))
+        tight_loop_contents();
+}
+
+/**
+ * \brief notify core0 of a flight recorder state change.
+ */
+void push_flight_recorder_event(app_event_type_t type, uint64_t time_us)
+{
+    app_event_t event{};
+    event.time_us = time_us;
+    event.type = type;
+    event.flight_recorder_run = flight_recorder_run;
+    // Retry until there's room since core0 must not miss a capture.
+    while (!core1_events.push(event))
+        tight_loop_contents();
+}
+
+/**
+ * \brief freeze the flight recorder after its post window, if armed.
+ * \details The next recorded sample is the trigger sample.
+ */
+void trigger_flight_recorder(uint64_t time_us)
+{
+    if (flight_recorder.trigger())
+        push_flight_recorder_event(FLIGHT_RECORDER_TRIGGERED, time_us);
+}
+
+/**
+ * \brief apply a step and capture the brake current around it.
+ * \details The capture starts BRAKE_STEP_PRE_CONVERSIONS conversions before
+ *  the DAC write, which the ring still holds.
+ */
+void apply_brake_step(uint32_t cmd_value)
+{
+    write_commanded_brake_output(cmd_value);
+    brake_current_ring.skip(brake_current_write_index()
+                            - BRAKE_STEP_PRE_CONVERSIONS);
+    brake_step_capture.start(brake_step_samples, brake_step_decimation_log2);
+}
+
+/**
+ * \brief capture every new brake current conversion during a brake step and
+ *  notify core0 once the capture is full.
+ */
+void update_brake_step_capture()
+{
+    if (!brake_step_capture.is_capturing())
+        return;
+    bool full = false;
+    brake_current_ring.consume(brake_current_write_index(),
+        [&full](uint16_t raw){full |= brake_step_capture.add(raw);});
+    if (!full)
+        return;
+    app_event_t event{};
+    event.time_us = time_us_64();
+    event.brake_setpoint = brake_output;
+    event.type = BRAKE_STEP_CAPTURED;
+    event.brake_step_run = brake_step_run;
+    // Retry until there's room since the test waits on this.
+    while (!core1_events.push(event))
+        tight_loop_contents();
+}
+
+/**
+ * \brief finish handling a torque limit trip outside of interrupt context.
+ */
+void handle_torque_limit_trip()
+{
+    if (!torque_limit_trip_pending)
+        return;
+    torque_limit_trip_pending = false;
+    brake_current_controller.reset();
+    brake_map_enabled = false;
+    // Notify core0. Retry until there's room since this must not be dropped.
+    app_event_t event{};
+    event.time_us = time_us_64();
+    event.type = TORQUE_LIMIT_TRIGGERED;
+    while (!core1_events.push(event))
+        tight_loop_contents();
+    trigger_flight_recorder(event.time_us);
+}
+
+void update_brake_map()
+{
+    if (!brake_map_enabled || torque_limit_triggered())
+        return;
+    write_brake_output(brake_maps[brake_map_front].evaluate(
+        int32_t(get_tared_encoder_ticks())));
+}
+
+void update_virtual_load()
+{
+    if (!virtual_load_enabled)
+        return;
+    const uint32_t current_ua = virtual_load.update(
+        encoder_velocity.velocity_q8(), encoder_velocity.acceleration_q8());
+    brake_current_controller.set_setpoint(int32_t(
+        (uint64_t(current_ua) * BRAKE_CURRENT_UA_TO_COUNTS_Q16) >> 16));
+}
+
+void update_brake_current_controller()
+{
+    // Bail early if open-loop or the brake is disabled by the torque limit.
+    if (!brake_current_control || torque_limit_triggered())
+        return;
+    // Average every conversion since the last update.
+    int32_t sum = 0;
+    const size_t count = brake_current_ring.consume(
+        brake_current_write_index(), [&sum](uint16_t raw){sum += int16_t(raw);});
+    // Round the mean, since truncating it biases the current high.
+    const int32_t measurement = (count > 0)
+                                ? (sum + int32_t(count / 2)) / int32_t(count)
+                                : int32_t(get_raw_brake_current());
+    write_brake_output(brake_current_controller.update(
+        measurement - brake_current_offset));
+}
+
+void update_encoder_velocity(const latched_sample_t& latch)
+{
+    // Check for a full FIFO before draining it.
+    if (encoder_edge_timer.edges_may_be_lost())
+        encoder_velocity.mark_edges_lost();
+    uint32_t edge_timestamp;
+    while (encoder_edge_timer.read_edge(edge_timestamp))
+        encoder_velocity.add_edge(edge_timestamp);
+    encoder_velocity.update(int32_t(latch.encoder_raw[0]), latch.time_us);
+}
+
+void reset_core1_state()
+{
+    stop_trajectory();
+    brake_map_enabled = false;
+    virtual_load_enabled = false;
+    virtual_load.set_damping(0);
+    virtual_load.set_friction(0);
+    virtual_load.set_inertia(0);
+    virtual_load.set_friction_deadband(0);
+    virtual_load.set_max_output(BRAKE_CURRENT_ADC_FULL_SCALE_UA);
+    uint32_t irq_state = save_and_disable_interrupts();
+    torque_limit_monitor.set_limits(RAW_TORQUE_SENSOR_MIN, RAW_TORQUE_SENSOR_MAX);
+    torque_limit_monitor.set_window(DEFAULT_TORQUE_LIMIT_WINDOW);
+    torque_limit_monitor.set_hysteresis(DEFAULT_TORQUE_LIMIT_HYSTERESIS);
+    torque_limit_monitor.set_enabled(true);
+    torque_limit_monitor.reset();
+    torque_limit_trip_pending = false;
+    torque_ring.skip(torque_write_index());
+    last_torque_check_time_us = time_us_32();
+    set_sensor_filter(torque_filter, torque_filter_enabled, 0);
+    set_sensor_filter(brake_current_filter, brake_current_filter_enabled, 0);
+    interval_stats_enabled = false;
+    sample_scheduler.clear_stats();
+    torque_monitor_scheduler.clear_stats();
+    restore_interrupts(irq_state);
+    latch_overrun_count = 0;
+    write_brake_output(0);
+    brake_current_control = false;
+    brake_current_controller.set_gains(DEFAULT_BRAKE_CURRENT_KP_Q8,
+                                       DEFAULT_BRAKE_CURRENT_KI_Q8);
+    brake_current_controller.set_setpoint(0);
+    brake_current_controller.reset();
+    // Clear torque and brake current offsets.
+    torque_offset = 0;
+    brake_current_offset = 0;
+    // Zero encoders by saving current positions as offsets.
+    for (uint32_t i = 0; i < NUM_ENCODERS; ++i)
+        encoder_offset[i] = encoder_raw[i];
+    // Clear internal filters
+    encoder_velocity.reset(int32_t(encoder_raw[0]), time_us_64());
+    brake_current_ring.skip(brake_current_write_index());
+    torque_period.reset(time_us_64(), torque_write_index());
+    brake_current_period.reset(time_us_64(), brake_current_write_index());
+    control_scheduler.start(time_us_64(), BRAKE_CURRENT_CONTROL_INTERVAL_US);
+    control_scheduler.clear_stats();
+    // Core0 rearms it once its state is reset too.
+    flight_recorder.disarm();
+    flight_recorder.set_window(DEFAULT_FLIGHT_RECORDER_PRE_SAMPLES,
+                               DEFAULT_FLIGHT_RECORDER_POST_SAMPLES);
+    brake_step_samples = 0;
+    brake_step_capture.stop();
+    brake_setpoint_latency_us = 0;
+    brake_setpoint_latency_max_us = 0;
+}
+
+void handle_core1_cmd(const app_cmd_t& cmd)
+{
+    uint32_t irq_state;
+    bool cleared;
+    uint64_t deadline_us;
+    switch (cmd.type)
+    {
+        case SET_BRAKE_SETPOINT:
+            // Torque limit may have tripped after core0 sent this.
+            if (!brake_current_control)
+                write_commanded_brake_output(cmd.value);
+            break;
+        case SET_CONTROL_ENABLE:
+            // Start (or stop) from a known state with the brake off.
+            brake_current_control = bool(cmd.value);
+            virtual_load_enabled = false;
+            brake_current_controller.reset();
+            brake_current_ring.skip(brake_current_write_index());
+            write_brake_output(0);
+            control_scheduler.start(time_us_64(),
+                                    BRAKE_CURRENT_CONTROL_INTERVAL_US);
+            break;
+        case SET_CONTROL_GAINS:
+            brake_current_controller.set_gains(uint16_t(cmd.value),
+                                               uint16_t(cmd.value >> 16));
+            break;
+        case SET_CONTROL_SETPOINT:
+            brake_current_controller.set_setpoint(int32_t(cmd.value));
+            break;
+        case SET_TORQUE_LIMITING:
+            irq_state = save_and_disable_interrupts();
+            torque_limit_monitor.set_enabled(bool(cmd.value));
+            restore_interrupts(irq_state);
+            break;
+        case CLEAR_TORQUE_LIMIT:
+            irq_state = save_and_disable_interrupts();
+            cleared = torque_limit_monitor.clear();
+            restore_interrupts(irq_state);
+            // Still near a limit. Re-notify core0 that the brake is disabled.
+            if (!cleared)
+                torque_limit_trip_pending = true;
+            break;
+        case SET_TORQUE_LIMIT_WINDOW:
+            irq_state = save_and_disable_interrupts();
+            torque_limit_monitor.set_window(cmd.value);
+            restore_interrupts(irq_state);
+            break;
+        case SET_TORQUE_LIMIT_HYSTERESIS:
+            irq_state = save_and_disable_interrupts();
+            torque_limit_monitor.set_hysteresis(int32_t(cmd.value));
+            restore_interrupts(irq_state);
+            break;
+        case SET_TORQUE_LIMITS:
+            irq_state = save_and_disable_interrupts();
+            torque_limit_monitor.set_limits(int32_t(cmd.value & 0xFFFF),
+                                            int32_t(cmd.value >> 16));
+            restore_interrupts(irq_state);
+            break;
+        case SET_SENSOR_FILTERS:
+            irq_state = save_and_disable_interrupts();
+            set_sensor_filter(torque_filter, torque_filter_enabled,
+                              cmd.value & 0xFF);
+            set_sensor_filter(brake_current_filter,
+                              brake_current_filter_enabled,
+                              (cmd.value >> 8) & 0xFF);
+            brake_current_filter_read_index = brake_current_write_index();
+            restore_interrupts(irq_state);
+            break;
+        case SET_INTERVAL_STATS:
+            // Start from the next conversion.
+            interval_stats_enabled = bool(cmd.value);
+            torque_stats_read_index = torque_write_index();
+            brake_current_stats_read_index = brake_current_write_index();
+            break;
+        case SET_ANALOG_TARE_OFFSETS:
+            torque_offset = int16_t(cmd.value);
+            brake_current_offset = int16_t(cmd.value >> 16);
+            break;
+        case SET_FLIGHT_RECORDER:
+            flight_recorder_run = uint8_t(cmd.value >> 24);
+            if ((cmd.value & 0xFF) == 0)
+                flight_recorder.disarm();
+            else if ((cmd.value & 0xFF) == 1)
+                flight_recorder.arm();
+            else
+                trigger_flight_recorder(time_us_64());
+            break;
+        case SET_FLIGHT_RECORDER_WINDOW:
+            flight_recorder.set_window(cmd.value & 0xFFFF, cmd.value >> 16);
+            break;
+        case SET_BRAKE_STEP_TEST:
+            brake_step_run = uint8_t(cmd.value >> 24);
+            brake_step_decimation_log2 = (cmd.value >> 16) & 0xF;
+            brake_step_samples = cmd.value & 0xFFFF;
+            if (brake_step_samples > 0)
+                break;
+            // Keep a full capture for core0 to read out.
+            if (brake_step_capture.is_capturing())
+                brake_step_capture.stop();
+            write_brake_output(0);
+            break;
+        case BRAKE_STEP:
+            // Torque limit may have tripped or the test may have been
+            // stopped after core0 sent this.
+            if (brake_step_samples > 0 && !brake_current_control)
+                apply_brake_step(cmd.value);
+            break;
+        case TARE:
+            for (uint32_t i = 0; i < NUM_ENCODERS; ++i) // Zero encoders
+                if (1u << i & encoder_tare_mask(cmd.value))
+                    encoder_offset[i] = encoder_raw[i];
+            if (1u << 1 & cmd.value) // Zero reaction torque sensor
+                torque_offset = int16_t(get_reported_torque(
+                    torque_write_index()));
+            if (1u << 2 & cmd.value) // Zero brake current sensor
+                brake_current_offset = int16_t(get_reported_brake_current(
+                    brake_current_write_index()));
+            break;
+        case RESET_TARE:
+            for (uint32_t i = 0; i < NUM_ENCODERS; ++i) // Reset encoders
+                if (1u << i & encoder_tare_mask(cmd.value)) // to native value.
+                    encoder_offset[i] = 0;
+            if (1u << 1 & cmd.value) // Remove reaction torque sensor offset.
+                torque_offset = 0;
+            if (1u << 2 & cmd.value) // Remove brake current sensor offset.
+                brake_current_offset = 0;
+            break;
+        case RESET_DIAGNOSTICS:
+            // Schedulers are serviced in alarm IRQs.
+            irq_state = save_and_disable_interrupts();
+            sample_scheduler.clear_stats();
+            torque_monitor_scheduler.clear_stats();
+            restore_interrupts(irq_state);
+            control_scheduler.clear_stats();
+            latch_overrun_count = 0;
+            brake_setpoint_latency_max_us = 0;
+            break;
+        case START_TRAJECTORY:
+            stop_trajectory();
+            trajectory_run = uint8_t(cmd.value >> 24);
+            if (cmd.value & (1u << 21))
+                trajectory_front ^= 1;
+            // Torque limit may have tripped after core0 sent this.
+            if (torque_limit_triggered()
+                || !brake_trajectories[trajectory_front].start(
+                       bool(cmd.value & (1u << 20))))
+            {
+                trajectory_done_pending = true;
+                break;
+            }
+            deadline_us = trajectory_scheduler.start(time_us_64(),
+                                                     cmd.value & 0xFFFFF);
+            while (hardware_alarm_set_target(trajectory_alarm_num,
+                                             from_us_since_boot(deadline_us)))
+                deadline_us = trajectory_scheduler.skip_to(time_us_64());
+            break;
+        case STOP_TRAJECTORY:
+            stop_trajectory();
+            break;
+        case SET_BRAKE_MAP:
+            if (cmd.value)
+                brake_map_front ^= 1;
+            // Torque limit may have tripped after core0 sent this.
+            brake_map_enabled = bool(cmd.value) && !torque_limit_triggered();
+            if (!brake_map_enabled)
+                write_brake_output(0);
+            break;
+        case SET_VIRTUAL_LOAD_ENABLE:
+            virtual_load_enabled = bool(cmd.value) && brake_current_control;
+            // Start (or stop) with the brake off.
+            brake_current_controller.set_setpoint(0);
+            break;
+        case SET_VIRTUAL_DAMPING:
+            virtual_load.set_damping(cmd.value);
+            break;
+        case SET_VIRTUAL_FRICTION:
+            virtual_load.set_friction(cmd.value);
+            break;
+        case SET_VIRTUAL_INERTIA:
+            virtual_load.set_inertia(cmd.value);
+            break;
+        case SET_VIRTUAL_FRICTION_DEADBAND:
+            virtual_load.set_friction_deadband(cmd.value);
+            break;
+        case RESET:
+            reset_core1_state();
+            break;
+    }
+}
+
+void update_sample_age(const latched_sample_t& latch)
+{
+    encoder_period.update(latch.time_us, latch.encoder_reply_index);
+    torque_period.update(latch.time_us, latch.torque_write_index);
+    brake_current_period.update(latch.time_us, latch.brake_current_write_index);
+    torque_sample_age_ns = torque_period.period_ns();
+    brake_current_sample_age_ns = brake_current_period.period_ns();
+    // Stamp halfway between the newest and the oldest that any of the values
+    // may be, which keeps the furthest of them as close as can be.
+    const StreamPeriodEstimator* streams[3] = {&encoder_period, &torque_period,
+                                               &brake_current_period};
+    uint32_t newest_ns = UINT32_MAX;
+    uint32_t oldest_ns = 0;
+    for (const StreamPeriodEstimator* stream: streams)
+    {
+        if (stream->min_age_ns() < newest_ns)
+            newest_ns = stream->min_age_ns();
+        if (stream->max_age_ns() > oldest_ns)
+            oldest_ns = stream->max_age_ns();
+    }
+    sample_acquisition_age_us = (newest_ns + oldest_ns + 1000) / 2000;
+    const uint32_t stamp_age_ns = sample_acquisition_age_us * 1000;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        const uint32_t max_age_ns = streams[i]->max_age_ns();
+        const uint32_t min_age_ns = streams[i]->min_age_ns();
+        // Older or newer than the stamp, whichever may be further.
+        uint32_t skew_ns = (max_age_ns > stamp_age_ns)
+                           ? max_age_ns - stamp_age_ns : 0;
+        if (min_age_ns < stamp_age_ns && stamp_age_ns - min_age_ns > skew_ns)
+            skew_ns = stamp_age_ns - min_age_ns;
+        if (skew_ns > window_sensor_skew_ns[i])
+            window_sensor_skew_ns[i] = skew_ns;
+    }
+    if (latch.time_us - sensor_skew_window_start_us < SENSOR_SKEW_WINDOW_US)
+        return;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        sensor_skew_ns[i] = window_sensor_skew_ns[i];
+        window_sensor_skew_ns[i] = 0;
+    }
+    sensor_skew_window_start_us = latch.time_us;
+}
+
+void record_flight_sample(const app_event_t& sample)
+{
+    FlightRecorder::record_t record;
+    record.time_us = uint32_t(sample.time_us);
+    record.encoder_ticks = sample.encoder_ticks[0];
+    record.reaction_torque = sample.reaction_torque;
+    record.brake_current = sample.brake_current;
+    record.brake_setpoint = sample.brake_setpoint;
+    record.flags = torque_limit_triggered()
+                   ? FLIGHT_RECORD_TORQUE_LIMIT_TRIGGERED : 0;
+    if (flight_recorder.add(record))
+        push_flight_recorder_event(FLIGHT_RECORDER_FROZEN, sample.time_us);
+}
+
+void push_sensor_sample(const latched_sample_t& latch)
+{
+    app_event_t sample;
+    sample.time_us = latch.time_us - sample_acquisition_age_us;
+    for (uint32_t i = 0; i < NUM_ENCODERS; ++i)
+        sample.encoder_ticks[i] = latch.encoder_raw[i] - encoder_offset[i];
+    sample.reaction_torque = int16_t(latch.torque_raw) - torque_offset;
+    sample.brake_current = int16_t(latch.brake_current_raw) - brake_current_offset;
+    sample.encoder_velocity = encoder_velocity.velocity_q8();
+    sample.encoder_acceleration = encoder_velocity.acceleration_q8();
+    sample.brake_setpoint = brake_output;
+    reduce_interval_stats(latch, sample);
+    sample.type = SENSOR_SAMPLE;
+    record_flight_sample(sample);
+    if (!core1_events.push(sample))
+        dropped_sample_count = dropped_sample_count + 1;
+}
+
+/**
+ * \brief latch all three sensors at the same instant and arm the alarm for
+ *  the next sample period.
+ * \note runs in interrupt context on core1.
+ */
+void __not_in_flash_func(sample_alarm_callback)(uint alarm_num)
+{
+    latched_sample_t latch;
+    // Any additional encoders reply while the rest is latched.
+    encoder.request_counts(1);
+    latch.time_us = time_us_64();
+    // The count may be a reply newer than the index says, which is within
+    // the stream's jitter.
+    latch.encoder_reply_index = uint16_t(encoder.stream_replies());
+    latch.encoder_raw[0] = encoder_stream;
+    latch.torque_write_index = uint16_t(torque_write_index());
+    latch.brake_current_write_index = uint16_t(brake_current_write_index());
+    latch.torque_raw = get_reported_torque(latch.torque_write_index);
+    latch.brake_current_raw = get_reported_brake_current(
+        latch.brake_current_write_index);
+    encoder.fetch_counts(&latch.encoder_raw[1], 1);
+    if (!sample_latches.push(latch))
+        latch_overrun_count = latch_overrun_count + 1;
+    uint64_t deadline_us = sample_scheduler.service(latch.time_us);
+    // Skip ahead if we took so long that the deadline already passed.
+    while (hardware_alarm_set_target(alarm_num, from_us_since_boot(deadline_us)))
+        deadline_us = sample_scheduler.skip_to(time_us_64());
+}
+
+/**
+ * \brief claim a hardware alarm and start firing callback on it every
+ *  period_us. The callback must service the scheduler and re-arm the alarm.
+ * \returns the alarm number.
+ */
+uint start_periodic_alarm(PeriodicScheduler& scheduler,
+                          hardware_alarm_callback_t callback,
+                          uint32_t period_us)
+{
+    const uint alarm_num = hardware_alarm_claim_unused(true);
+    // Alarm IRQ fires on the core that sets the callback.
+    hardware_alarm_set_callback(alarm_num, callback);
+    uint64_t deadline_us = scheduler.start(time_us_64(), period_us);
+    while (hardware_alarm_set_target(alarm_num, from_us_since_boot(deadline_us)))
+        deadline_us = scheduler.skip_to(time_us_64());
+    return alarm_num;
+}
+
+/**
+ * \brief mean number of CPU cycles that fn takes to run, measured with the
+ *  (per-core) SysTick timer.
+ * \details Loop overhead is included, so only differences between two
+ *  measurements are meaningful.
+ */
+template <typename F>
+uint32_t measure_mean_cycles(F fn, uint32_t iterations = 64)
+{
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5; // Enable. Count processor clock cycles.
+    const uint32_t start = systick_hw->cvr;
+    for (uint32_t i = 0; i < iterations; ++i)
+        fn();
+    const uint32_t end = systick_hw->cvr;
+    // SysTick is a 24-bit down-counter.
+    return ((start - end) & 0x00FFFFFF) / iterations;
+}
+
+// Core1 main.
+void core1_main()
+{
+    // Let core0 park this core while it writes to flash.
+    multicore_lockout_victim_init();
+    // Start from the current counts so that tares before the first sample
+    // are valid.
+    uint32_t counts[NUM_ENCODERS];
+    counts[0] = encoder_stream;
+    encoder.get_counts(&counts[1], 1);
+    for (uint32_t i = 0; i < NUM_ENCODERS; ++i)
+        encoder_raw[i] = counts[i];
+    const uint64_t now_us = time_us_64();
+    encoder_period.reset(now_us, encoder.stream_replies());
+    torque_period.reset(now_us, torque_write_index());
+    brake_current_period.reset(now_us, brake_current_write_index());
+    sensor_skew_window_start_us = now_us;
+    last_torque_check_time_us = time_us_32();
+    start_periodic_alarm(torque_monitor_scheduler,
+                         torque_monitor_alarm_callback,
+                         TORQUE_MONITOR_INTERVAL_US);
+    // Trajectory alarm is only armed during playback.
+    trajectory_alarm_num = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(trajectory_alarm_num, trajectory_alarm_callback);
+    sample_alarm_num = start_periodic_alarm(sample_scheduler,
+                                            sample_alarm_callback,
+                                            CORE1_TICK_INTERVAL_US);
+    latched_sample_t latch;
+    while (true)
+    {
+        // Run once per latched sample.
+        if (!sample_latches.pop(latch))
+        {
+            tight_loop_contents();
+            continue;
+        }
+        // Apply register writes forwarded from core0.
+        app_cmd_t cmd;
+        while (core1_cmds.pop(cmd))
+            handle_core1_cmd(cmd);
+        for (uint32_t i = 0; i < NUM_ENCODERS; ++i)
+            encoder_raw[i] = latch.encoder_raw[i];
+        update_encoder_velocity(latch);
+        update_sample_age(latch);
+        // Torque limit trips are handled in the torque monitor alarm IRQ.
+        handle_torque_limit_trip();
+        handle_trajectory_done();
+        update_brake_step_capture();
+        // Handle fixed-rate brake current control.
+        if (control_scheduler.is_due(latch.time_us))
+        {
+            control_scheduler.service(latch.time_us);
+            update_brake_map();
+            update_virtual_load();
+            update_brake_current_controller();
+        }
+        push_sensor_sample(latch);
+    }
+}
 
 #pragma pack(push, 1)
 struct app_regs_t
@@ -80,8 +1217,10 @@ struct app_regs_t
     int16_t reaction_torque;  // 33. 12-bit. underlying measurement is signed.
     int16_t brake_current;    // 34. 12-bit. underlying measurement is unsigned
                               //   but can go negative because of tare value.
-    int32_t sensors[3]; // aggregate vector of the above 3 three registers:
-                         // [position, uint32(torque), uint32(current)]
+    int32_t sensors[4 + NUM_ENCODERS]; // 35. [position, torque, current],
+                         // then the optional fields enabled in
+                         // sensor_data_fields in bit order, then the positions
+                         // of any additional encoders.
     uint16_t sensor_dispatch_frequency_hz;  // 36
     uint16_t brake_current_setpoint;    // 37. 16-bit full-scale range,
                                         // but 12-bit resolution. Unsigned.
@@ -106,11 +1245,222 @@ struct app_regs_t
                                        //       value occurs.
                                        // Write 0 to clear the torque-limit
                                        // condition and re-enable the brake.
+    uint8_t sensor_batch[SensorBatch::MAX_SIZE_BYTES]; // 42. Packed array of
+                                       // batch_sample_t. Sent as an EVENT
+                                       // when the batch fills up.
+    uint16_t sensor_batch_sample_frequency_hz; // 43. 0 disables batching.
+    uint8_t sensor_batch_size;  // 44. samples per batch EVENT.
+    uint16_t brake_current_control_gains[2]; // 45. [Kp, Ki] in Q8.8 fixed-point.
+                                             //   Ki is applied per control
+                                             //   update.
+    uint32_t brake_current_setpoint_ua; // 46. Closed-loop brake current
+                                        //   setpoint in [uA].
+    uint8_t brake_current_control;  // 47. 1 --> closed-loop control of the
+                                    //       brake current. Writes to
+                                    //       brake_current_setpoint return a
+                                    //       WRITE_ERROR.
+                                    //   0 --> open-loop. Resets to this state.
+    int32_t brake_current_control_state[3]; // 48. [error (ADC counts),
+                                            //   integrator (DAC counts),
+                                            //   output (DAC counts)]
+    int32_t encoder_velocity;       // 49. Q24.8 [counts/s]
+    int32_t encoder_acceleration;   // 50. Q24.8 [counts/s^2]
+    uint8_t sensor_data_fields; // 51. Optional fields appended to sensors:
+                                // {unused[7:2], acceleration[1], velocity[0]}
+    uint16_t encoder_read_cycles_saved; // 52. CPU cycles saved per sample by
+                                        //     streaming the encoder count
+                                        //     instead of requesting it.
+                                        //     Measured once at boot.
+    uint32_t torque_limit_trip_latency_us; // 53. Time from the first
+                                           //     out-of-range torque
+                                           //     conversion to the DAC write
+                                           //     on the last trip.
+    uint8_t torque_limit_filter_window; // 54. Torque limit boxcar filter
+                                        //     length in samples. Power of two
+                                        //     up to 32.
+    uint16_t torque_limit_hysteresis; // 55. Raw ADC counts inside the limits
+                                      //     that filtered torque must return
+                                      //     to before a trip can be cleared.
+    uint32_t loop_period_us[3]; // 56. core0 loop period [min, mean, max].
+    uint32_t dispatch_lateness_histogram[8]; // 57. sensors event count by
+                                             //     lateness [us]: [<128,
+                                             //     <256, ..., <8192, >=8192]
+    uint32_t missed_deadlines; // 58. Periodic deadlines skipped because
+                               //     servicing fell behind.
+    uint32_t torque_check_overruns; // 59. Torque monitor checks skipped.
+    uint32_t usb_tx_backpressure; // 60. Events sent while the USB TX buffer
+                                  //     could not fit them.
+    uint8_t reset_diagnostics; // 61. Write 1 to clear registers 56-60.
+    uint16_t brake_trajectory_write_index; // 62. Back table index that the
+                                           //     next brake_trajectory_data
+                                           //     write starts at. Advances
+                                           //     with each write.
+    uint16_t brake_trajectory_data[MAX_TRAJECTORY_POINTS_PER_WRITE]; // 63.
+                                        // Brake setpoints (raw DAC codes).
+                                        // Variable length.
+    uint16_t brake_trajectory_length; // 64. Number of back table points to
+                                      //     play.
+    uint16_t brake_trajectory_sample_frequency_hz; // 65.
+    uint8_t brake_trajectory_playback; // 66. 0 --> stopped, 1 --> play once,
+                                       //     2 --> loop, swapping in the back
+                                       //     table if it was written. Reverts
+                                       //     to 0 with an event when playback
+                                       //     ends or the torque limit trips.
+    uint16_t brake_map_write_index; // 67. Back map index that the next
+                                    //     brake_map_data write starts at.
+                                    //     Advances with each write.
+    uint16_t brake_map_data[MAX_BRAKE_MAP_POINTS_PER_WRITE]; // 68. Brake
+                                    // setpoints (raw DAC codes). Variable
+                                    // length.
+    uint32_t brake_map_config[4]; // 69. Back map [length (points),
+                                  //   spacing (log2 ticks per point),
+                                  //   wrap length (ticks, 0 --> none),
+                                  //   interpolate (0 or 1)]
+    uint8_t brake_map; // 70. 1 --> swap in the back map and drive the brake
+                       //     from it. 0 --> disabled. Reverts to 0 if the
+                       //     torque limit trips.
+    uint32_t virtual_load_params[4]; // 71. [damping (Q24.8 uA/(counts/s)),
+                                     //   Coulomb friction (uA),
+                                     //   inertia (Q24.8 uA/(counts/s^2)),
+                                     //   friction deadband (counts/s)]
+    uint8_t virtual_load; // 72. 1 --> drive the closed-loop brake current
+                          //     setpoint from the virtual load. Requires
+                          //     brake_current_control.
+    uint8_t sensors_packed[PackedSensorData::MAX_SIZE_BYTES + 2 * sizeof(int32_t)];
+                        // 73. Compact alternative to sensors. One packed
+                        //     record followed by any optional fields enabled
+                        //     in sensor_data_fields (S32 each), in bit order.
+    uint8_t sensor_data_format; // 74. 0 --> dispatch sensors (S32 array).
+                                //     1 --> dispatch sensors_packed.
+                                //     2 --> dispatch sensors_packed with
+                                //           encoder deltas.
+                                //     3 --> dispatch sensors_stats.
+    uint16_t sensor_dispatch_deadband[3];
+                        // 75. [encoder ticks, torque, brake current].
+                        //     Nonzero --> change-driven dispatch: only send
+                        //     events when the encoder moves >= its threshold
+                        //     or an analog value changes by more than its
+                        //     deadband (raw ADC counts).
+    uint16_t sensor_dispatch_heartbeat_ms; // 76. Longest interval between
+                                           //     change-driven events.
+                                           //     0 --> no heartbeat.
+    int32_t sensors_stats[10];
+                        // 77. Statistics of every ADC conversion since the
+                        //     previous event: [encoder, torque conversions,
+                        //     torque min, max, mean, brake current min, max,
+                        //     mean], followed
+                        //     by any optional fields enabled in
+                        //     sensor_data_fields, in bit order.
+    uint16_t brake_calibration_write_index; // 78. Staged table index that
+                                            //     the next
+                                            //     brake_calibration_data
+                                            //     write starts at. Advances
+                                            //     with each write.
+    uint16_t brake_calibration_data[MAX_BRAKE_CALIBRATION_POINTS_PER_WRITE];
+                        // 79. Brake setpoints (raw DAC codes) at evenly
+                        //     spaced torques. Variable length.
+    uint32_t brake_calibration_config[2]; // 80. [length (points),
+                                          //   full-scale torque (Q16.16
+                                          //   N*m)]. Writing applies the
+                                          //   staged table.
+    uint8_t brake_calibration_store; // 81. 1 --> store the active table in
+                                     //     flash. Requires an idle brake.
+    uint32_t brake_calibration_checksum; // 82. CRC-32 of the active table.
+                                         //     0 --> none.
+    uint32_t brake_torque_setpoint; // 83. Q16.16 N*m. Converted to a
+                                    //     brake_current_setpoint through the
+                                    //     active calibration table.
+    uint16_t torque_limits[2]; // 84. [min, max] raw torque ADC counts that
+                               //     trip the torque limit.
+    uint8_t persistent_config; // 85. Write 1 --> save, 2 --> restore,
+                               //     3 --> forget the saved configuration,
+                               //     4 --> erase ahead of the next save.
+                               //     Reads {erase pending[1], saved[0]}.
+    uint32_t sensor_skew_ns[3]; // 86. Furthest each latched value may be
+                                //     from the sample timestamp
+                                //     [encoder, torque, brake current].
+    uint8_t flight_recorder; // 87. Write 0 --> disarm, 1 --> arm (discards
+                             //     any capture), 2 --> trigger. Reads the
+                             //     FlightRecorder state.
+    uint16_t flight_recorder_window[2]; // 88. [pre, post] samples kept
+                                        //     around the trigger.
+    uint16_t flight_recorder_read_index; // 89. Record that the next data
+                                         //     read starts at. Advances with
+                                         //     each read.
+    uint8_t flight_recorder_data[MAX_FLIGHT_RECORDS_PER_READ
+                                 * sizeof(FlightRecorder::record_t)];
+                        // 90. Frozen capture records. Variable length.
+    uint16_t flight_recorder_capture[2]; // 91. [records, trigger index] of
+                                         //     the frozen capture.
+    uint8_t encoder_tare; // 92. {reset[7:4], tare[3:0]} one bit per encoder.
+                          //     Reads which encoders are tared.
+    uint16_t aux_encoder_read_cycles[2]; // 93. CPU cycles to read every
+                                         //     additional encoder [batched,
+                                         //     one at a time]. Measured
+                                         //     once at boot.
+    uint8_t brake_step_test; // 94. Write 1 --> start, 0 --> stop. Reads the
+                             //     brake_step_test_state_t.
+    uint16_t brake_step_test_config[4]; // 95. [low, high] raw DAC codes,
+                                        //     hold time per step [ms],
+                                        //     steps.
+    uint32_t brake_step_test_results[5]; // 96. [steps analyzed, worst
+                                         //     command-to-DAC latency [us],
+                                         //     worst rise time [ns], worst
+                                         //     settling time [ns], worst
+                                         //     overshoot [0.1%]].
+    uint32_t brake_setpoint_latency_us[2]; // 97. [last, max] time from a
+                                           //     setpoint write to the DAC.
+    uint16_t brake_step_trace_read_index; // 98. Sample that the next trace
+                                          //     read starts at. Advances
+                                          //     with each read.
+    uint16_t brake_step_trace[MAX_BRAKE_STEP_TRACE_SAMPLES_PER_READ];
+                        // 99. Brake current ADC counts captured around the
+                        //     last step. Variable length.
+    uint32_t brake_step_trace_info[3]; // 100. [samples, step index, sample
+                                       //      period [ns]] of the trace.
+    uint16_t aux_analog_frequency_hz; // 101. Auxiliary analog event rate.
+                                      //      0 disables the events (and
+                                      //      the on-chip ADC).
+    uint16_t aux_analog[AUX_ANALOG_NUM_INPUTS]; // 102. Averaged on-chip ADC
+                                                //      counts, one per input.
+    uint32_t aux_analog_sampling[2]; // 103. [conversions averaged per value,
+                                     //      conversions per second per
+                                     //      input].
+    uint8_t sensor_filters[2]; // 104. [torque, brake current] filter presets.
+                               //      0 --> off.
+    uint32_t sensor_filter_cutoff_hz[2]; // 105. [torque, brake current]
+                                         //      -3[dB] frequency of each
+                                         //      filter. 0 if off.
+    uint16_t sensor_filter_cycles[2]; // 106. CPU cycles per conversion,
+                                      //      and per biquad cascade output.
+                                      //      Measured once at boot.
     // More app "registers" here.
 };
 #pragma pack(pop)
 app_regs_t __not_in_flash("app_regs") app_regs;
 
+// Brake step test states, as read from the brake_step_test register.
+enum brake_step_test_state_t : uint8_t
+{
+    BRAKE_STEP_TEST_IDLE = 0,
+    BRAKE_STEP_TEST_RUNNING = 1,
+    BRAKE_STEP_TEST_DONE = 2,
+    BRAKE_STEP_TEST_ABORTED = 3, // Stopped, or the torque limit tripped.
+};
+
+// Sensor dispatch formats, as written to the sensor_data_format register.
+enum sensor_data_format_t : uint8_t
+{
+    SENSOR_DATA_FORMAT_SENSORS = 0,
+    SENSOR_DATA_FORMAT_PACKED = 1,
+    SENSOR_DATA_FORMAT_PACKED_DELTAS = 2,
+    SENSOR_DATA_FORMAT_STATS = 3,
+    NUM_SENSOR_DATA_FORMATS
+};
+
+inline bool brake_step_test_running()
+{ return app_regs.brake_step_test == BRAKE_STEP_TEST_RUNNING;}
+
 // Define "specs" per-register
 RegSpecs app_reg_specs[reg_count]
 {
@@ -123,28 +1473,158 @@ RegSpecs app_reg_specs[reg_count]
     {(uint8_t*)&app_regs.tare, sizeof(app_regs.tare), U8},
     {(uint8_t*)&app_regs.reset_tare, sizeof(app_regs.reset_tare), U8},
     {(uint8_t*)&app_regs.torque_limiting, sizeof(app_regs.torque_limiting), U8},
-    {(uint8_t*)&app_regs.torque_limiting_triggered, sizeof(app_regs.torque_limiting_triggered), U8}
+    {(uint8_t*)&app_regs.torque_limiting_triggered, sizeof(app_regs.torque_limiting_triggered), U8},
+    {(uint8_t*)&app_regs.sensor_batch, sizeof(app_regs.sensor_batch), U8},
+    {(uint8_t*)&app_regs.sensor_batch_sample_frequency_hz, sizeof(app_regs.sensor_batch_sample_frequency_hz), U16},
+    {(uint8_t*)&app_regs.sensor_batch_size, sizeof(app_regs.sensor_batch_size), U8},
+    {(uint8_t*)&app_regs.brake_current_control_gains, sizeof(app_regs.brake_current_control_gains), U16},
+    {(uint8_t*)&app_regs.brake_current_setpoint_ua, sizeof(app_regs.brake_current_setpoint_ua), U32},
+    {(uint8_t*)&app_regs.brake_current_control, sizeof(app_regs.brake_current_control), U8},
+    {(uint8_t*)&app_regs.brake_current_control_state, sizeof(app_regs.brake_current_control_state), S32},
+    {(uint8_t*)&app_regs.encoder_velocity, sizeof(app_regs.encoder_velocity), S32},
+    {(uint8_t*)&app_regs.encoder_acceleration, sizeof(app_regs.encoder_acceleration), S32},
+    {(uint8_t*)&app_regs.sensor_data_fields, sizeof(app_regs.sensor_data_fields), U8},
+    {(uint8_t*)&app_regs.encoder_read_cycles_saved, sizeof(app_regs.encoder_read_cycles_saved), U16},
+    {(uint8_t*)&app_regs.torque_limit_trip_latency_us, sizeof(app_regs.torque_limit_trip_latency_us), U32},
+    {(uint8_t*)&app_regs.torque_limit_filter_window, sizeof(app_regs.torque_limit_filter_window), U8},
+    {(uint8_t*)&app_regs.torque_limit_hysteresis, sizeof(app_regs.torque_limit_hysteresis), U16},
+    {(uint8_t*)&app_regs.loop_period_us, sizeof(app_regs.loop_period_us), U32},
+    {(uint8_t*)&app_regs.dispatch_lateness_histogram, sizeof(app_regs.dispatch_lateness_histogram), U32},
+    {(uint8_t*)&app_regs.missed_deadlines, sizeof(app_regs.missed_deadlines), U32},
+    {(uint8_t*)&app_regs.torque_check_overruns, sizeof(app_regs.torque_check_overruns), U32},
+    {(uint8_t*)&app_regs.usb_tx_backpressure, sizeof(app_regs.usb_tx_backpressure), U32},
+    {(uint8_t*)&app_regs.reset_diagnostics, sizeof(app_regs.reset_diagnostics), U8},
+    {(uint8_t*)&app_regs.brake_trajectory_write_index, sizeof(app_regs.brake_trajectory_write_index), U16},
+    {(uint8_t*)&app_regs.brake_trajectory_data, sizeof(app_regs.brake_trajectory_data), U16},
+    {(uint8_t*)&app_regs.brake_trajectory_length, sizeof(app_regs.brake_trajectory_length), U16},
+    {(uint8_t*)&app_regs.brake_trajectory_sample_frequency_hz, sizeof(app_regs.brake_trajectory_sample_frequency_hz), U16},
+    {(uint8_t*)&app_regs.brake_trajectory_playback, sizeof(app_regs.brake_trajectory_playback), U8},
+    {(uint8_t*)&app_regs.brake_map_write_index, sizeof(app_regs.brake_map_write_index), U16},
+    {(uint8_t*)&app_regs.brake_map_data, sizeof(app_regs.brake_map_data), U16},
+    {(uint8_t*)&app_regs.brake_map_config, sizeof(app_regs.brake_map_config), U32},
+    {(uint8_t*)&app_regs.brake_map, sizeof(app_regs.brake_map), U8},
+    {(uint8_t*)&app_regs.virtual_load_params, sizeof(app_regs.virtual_load_params), U32},
+    {(uint8_t*)&app_regs.virtual_load, sizeof(app_regs.virtual_load), U8},
+    {(uint8_t*)&app_regs.sensors_packed, sizeof(app_regs.sensors_packed), U8},
+    {(uint8_t*)&app_regs.sensor_data_format, sizeof(app_regs.sensor_data_format), U8},
+    {(uint8_t*)&app_regs.sensor_dispatch_deadband, sizeof(app_regs.sensor_dispatch_deadband), U16},
+    {(uint8_t*)&app_regs.sensor_dispatch_heartbeat_ms, sizeof(app_regs.sensor_dispatch_heartbeat_ms), U16},
+    {(uint8_t*)&app_regs.sensors_stats, sizeof(app_regs.sensors_stats), S32},
+    {(uint8_t*)&app_regs.brake_calibration_write_index, sizeof(app_regs.brake_calibration_write_index), U16},
+    {(uint8_t*)&app_regs.brake_calibration_data, sizeof(app_regs.brake_calibration_data), U16},
+    {(uint8_t*)&app_regs.brake_calibration_config, sizeof(app_regs.brake_calibration_config), U32},
+    {(uint8_t*)&app_regs.brake_calibration_store, sizeof(app_regs.brake_calibration_store), U8},
+    {(uint8_t*)&app_regs.brake_calibration_checksum, sizeof(app_regs.brake_calibration_checksum), U32},
+    {(uint8_t*)&app_regs.brake_torque_setpoint, sizeof(app_regs.brake_torque_setpoint), U32},
+    {(uint8_t*)&app_regs.torque_limits, sizeof(app_regs.torque_limits), U16},
+    {(uint8_t*)&app_regs.persistent_config, sizeof(app_regs.persistent_config), U8},
+    {(uint8_t*)&app_regs.sensor_skew_ns, sizeof(app_regs.sensor_skew_ns), U32},
+    {(uint8_t*)&app_regs.flight_recorder, sizeof(app_regs.flight_recorder), U8},
+    {(uint8_t*)&app_regs.flight_recorder_window, sizeof(app_regs.flight_recorder_window), U16},
+    {(uint8_t*)&app_regs.flight_recorder_read_index, sizeof(app_regs.flight_recorder_read_index), U16},
+    {(uint8_t*)&app_regs.flight_recorder_data, sizeof(app_regs.flight_recorder_data), U8},
+    {(uint8_t*)&app_regs.flight_recorder_capture, sizeof(app_regs.flight_recorder_capture), U16},
+    {(uint8_t*)&app_regs.encoder_tare, sizeof(app_regs.encoder_tare), U8},
+    {(uint8_t*)&app_regs.aux_encoder_read_cycles, sizeof(app_regs.aux_encoder_read_cycles), U16},
+    {(uint8_t*)&app_regs.brake_step_test, sizeof(app_regs.brake_step_test), U8},
+    {(uint8_t*)&app_regs.brake_step_test_config, sizeof(app_regs.brake_step_test_config), U16},
+    {(uint8_t*)&app_regs.brake_step_test_results, sizeof(app_regs.brake_step_test_results), U32},
+    {(uint8_t*)&app_regs.brake_setpoint_latency_us, sizeof(app_regs.brake_setpoint_latency_us), U32},
+    {(uint8_t*)&app_regs.brake_step_trace_read_index, sizeof(app_regs.brake_step_trace_read_index), U16},
+    {(uint8_t*)&app_regs.brake_step_trace, sizeof(app_regs.brake_step_trace), U16},
+    {(uint8_t*)&app_regs.brake_step_trace_info, sizeof(app_regs.brake_step_trace_info), U32},
+    {(uint8_t*)&app_regs.aux_analog_frequency_hz, sizeof(app_regs.aux_analog_frequency_hz), U16},
+    {(uint8_t*)&app_regs.aux_analog, sizeof(app_regs.aux_analog), U16},
+    {(uint8_t*)&app_regs.aux_analog_sampling, sizeof(app_regs.aux_analog_sampling), U32},
+    {(uint8_t*)&app_regs.sensor_filters, sizeof(app_regs.sensor_filters), U8},
+    {(uint8_t*)&app_regs.sensor_filter_cutoff_hz, sizeof(app_regs.sensor_filter_cutoff_hz), U32},
+    {(uint8_t*)&app_regs.sensor_filter_cycles, sizeof(app_regs.sensor_filter_cycles), U16}
     // More specs here if we add additional registers.
 };
 
-void write_sensor_dispatch_frequency_hz(msg_t& msg)
+/**
+ * \brief (re)start periodic sensor dispatch at the rate in its register.
+ * \returns false if the rate was clamped.
+ */
+bool apply_sensor_dispatch_frequency_hz()
 {
-    msg_type_t msg_reply_type = WRITE;
-    HarpCore::copy_msg_payload_to_register(msg);
+    bool clamped = false;
     // Clamp maximum value.
     if (app_regs.sensor_dispatch_frequency_hz > MAX_EVENT_FREQUENCY_HZ)
     {
         // Update register and dependedent values.
         app_regs.sensor_dispatch_frequency_hz = MAX_EVENT_FREQUENCY_HZ;
-        msg_reply_type = WRITE_ERROR;
+        clamped = true;
     }
+    packed_sensor_data.reset();
+    dispatch_change_trigger.reset();
+    dispatch_interval_stats.clear();
     if (app_regs.sensor_dispatch_frequency_hz > 0)
     {
-        dispatch_interval_us = div_u32u32(1'000'000,
-                                          uint32_t(app_regs.sensor_dispatch_frequency_hz));
+        dispatch_scheduler.start(time_us_64(),
+            div_u32u32(1'000'000, uint32_t(app_regs.sensor_dispatch_frequency_hz)));
+    }
+    else
+        dispatch_scheduler.stop();
+    return !clamped;
+}
+
+void write_sensor_dispatch_frequency_hz(msg_t& msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    const msg_type_t msg_reply_type = apply_sensor_dispatch_frequency_hz()
+                                      ? WRITE : WRITE_ERROR;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
+}
+
+/**
+ * \brief (re)start periodic batched sampling at the rate in its register.
+ * \returns false if the rate was clamped.
+ */
+bool apply_sensor_batch_sample_frequency_hz()
+{
+    bool clamped = false;
+    // Clamp maximum value.
+    if (app_regs.sensor_batch_sample_frequency_hz > MAX_BATCH_SAMPLE_FREQUENCY_HZ)
+    {
+        app_regs.sensor_batch_sample_frequency_hz = MAX_BATCH_SAMPLE_FREQUENCY_HZ;
+        clamped = true;
+    }
+    if (app_regs.sensor_batch_sample_frequency_hz > 0)
+    {
+        batch_scheduler.start(time_us_64(),
+            div_u32u32(1'000'000, uint32_t(app_regs.sensor_batch_sample_frequency_hz)));
+    }
+    else
+        batch_scheduler.stop();
+    // Drop any partial batch acquired at the previous rate.
+    sensor_batch.clear();
+    return !clamped;
+}
+
+void write_sensor_batch_sample_frequency_hz(msg_t& msg)
+{
+    // Samples are latched on the core1 tick, so a rate that does not divide
+    // the tick rate would alias onto unevenly spaced ticks.
+    const uint16_t frequency_hz = *((uint16_t*)msg.payload);
+    if (frequency_hz > 0 && (CORE1_TICK_FREQUENCY_HZ % frequency_hz) != 0)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
     }
-    // Update next time to dispatch.
-    next_msg_dispatch_time_us = time_us_32();
+    HarpCore::copy_msg_payload_to_register(msg);
+    const msg_type_t msg_reply_type = apply_sensor_batch_sample_frequency_hz()
+                                      ? WRITE : WRITE_ERROR;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
+}
+
+void write_sensor_batch_size(msg_t& msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    msg_type_t msg_reply_type = WRITE;
+    if (!sensor_batch.set_batch_size(app_regs.sensor_batch_size))
+        msg_reply_type = WRITE_ERROR;
+    app_regs.sensor_batch_size = sensor_batch.batch_size(); // Apply clamping.
     HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
 }
 
@@ -154,107 +1634,1635 @@ void write_brake_current_setpoint(msg_t& msg)
     // full-scale range is 16 bit.
     // Note: offset is not applied to desired current setpoint because it is
     //  distinct from measured current.
-    if (app_regs.torque_limiting_triggered) // i.e: brake should be disabled.
+    // Note: setpoint is owned by the controller in closed-loop mode.
+    // Note: core1 rejects the setpoint if the torque limit trips before it
+    //  gets there.
+    if (app_regs.torque_limiting_triggered // i.e: brake should be disabled.
+        || app_regs.brake_current_control
+        || app_regs.brake_trajectory_playback
+        || app_regs.brake_map || brake_step_test_running())
     {
         HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
         return;
     }
+    const uint16_t prev_setpoint = app_regs.brake_current_setpoint;
     HarpCore::copy_msg_payload_to_register(msg);
-    brake_setpoint.write_value(app_regs.brake_current_setpoint);
+    if (!send_brake_setpoint_cmd(SET_BRAKE_SETPOINT,
+                                 app_regs.brake_current_setpoint))
+    {
+        app_regs.brake_current_setpoint = prev_setpoint;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
     HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-void write_tare(msg_t& msg)
+void write_brake_current_control_gains(msg_t& msg)
 {
     HarpCore::copy_msg_payload_to_register(msg);
-    // Handle bits to apply tare value.
-    if (1u << 0 & app_regs.tare) // Zero encoder
-        encoder_offset = encoder_raw;
-    if (1u << 1 & app_regs.tare) // Zero reaction torque sensor
-        torque_offset = torque_raw;
-    if (1u << 2 & app_regs.tare) // Zero brake current sensor
-        brake_current_offset = brake_current_raw;
-    HarpCore::send_harp_reply(WRITE, msg.header.address);
+    const uint32_t gains = (uint32_t(app_regs.brake_current_control_gains[1]) << 16)
+                           | app_regs.brake_current_control_gains[0];
+    const msg_type_t msg_reply_type = send_core1_cmd(SET_CONTROL_GAINS, gains)
+                                      ? WRITE : WRITE_ERROR;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
 }
 
-void write_reset_tare(msg_t& msg)
+void write_brake_current_setpoint_ua(msg_t& msg)
 {
-    HarpCore::copy_msg_payload_to_register(msg);
-    // Handle bits to clear tare value.
-    if (1u << 0 & app_regs.tare) // Reset encoder to native value.
+    // Setpoint is owned by the virtual load while it is enabled.
+    if (app_regs.virtual_load)
     {
-        encoder_offset = 0;
-        app_regs.tare &= ~(1u << 0); // Also clear tare setting in tare register.
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
     }
-    if (1u << 1 & app_regs.tare) // Remove reaction torque sensor offset.
+    msg_type_t msg_reply_type = WRITE;
+    HarpCore::copy_msg_payload_to_register(msg);
+    // Clamp to the current sensor's full-scale range.
+    if (app_regs.brake_current_setpoint_ua > BRAKE_CURRENT_ADC_FULL_SCALE_UA)
     {
-        torque_offset = 0;
-        app_regs.tare &= ~(1u << 1); // Also clear tare setting in tare register.
+        app_regs.brake_current_setpoint_ua = BRAKE_CURRENT_ADC_FULL_SCALE_UA;
+        msg_reply_type = WRITE_ERROR;
     }
-    if (1u << 2 & app_regs.tare) // Remove brake current sensor offset.
+    // Convert to ADC counts once here so the control loop stays in counts.
+    const uint32_t setpoint_counts = uint32_t(
+        (uint64_t(app_regs.brake_current_setpoint_ua)
+         * BRAKE_CURRENT_ADC_FULL_SCALE_COUNTS)
+        / BRAKE_CURRENT_ADC_FULL_SCALE_UA);
+    if (!send_core1_cmd(SET_CONTROL_SETPOINT, setpoint_counts))
+        msg_reply_type = WRITE_ERROR;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
+}
+
+void write_brake_current_control(msg_t& msg)
+{
+    // Trajectory playback, a brake map, or a brake step test owns the brake.
+    if (app_regs.brake_trajectory_playback || app_regs.brake_map
+        || brake_step_test_running())
     {
-        brake_current_offset = 0;
-        app_regs.tare &= ~(1u << 2); // Also clear tare setting in tare register.
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
     }
-    // Clear register since it reads as 0.
-    app_regs.reset_tare = 0;
-    HarpCore::send_harp_reply(WRITE, msg.header.address);
+    HarpCore::copy_msg_payload_to_register(msg);
+    app_regs.brake_current_control = app_regs.brake_current_control ? 1 : 0;
+    // Core1 starts (or stops) from a known state with the brake off and the
+    // virtual load disabled.
+    app_regs.brake_current_setpoint = 0;
+    app_regs.virtual_load = 0;
+    const msg_type_t msg_reply_type
+        = send_core1_cmd(SET_CONTROL_ENABLE, app_regs.brake_current_control)
+          ? WRITE : WRITE_ERROR;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
 }
 
-void read_reg_encoder_ticks(uint8_t reg_name)
+void read_reg_brake_current_control_state(uint8_t reg_name)
 {
-    app_regs.encoder_ticks = get_tared_encoder_ticks();
+    // Controller is owned by core1, but each 32-bit field is read atomically.
+    app_regs.brake_current_control_state[0] = brake_current_controller.error();
+    app_regs.brake_current_control_state[1] = brake_current_controller.integrator();
+    app_regs.brake_current_control_state[2] = brake_current_controller.output();
     HarpCore::send_harp_reply(READ, reg_name);
 }
 
-void read_reg_reaction_torque(uint8_t reg_name)
+void write_tare(msg_t& msg)
 {
-    app_regs.reaction_torque = get_tared_reaction_torque();
-    HarpCore::send_harp_reply(READ, reg_name);
+    HarpCore::copy_msg_payload_to_register(msg);
+    // Core1 handles bits to apply tare value.
+    const msg_type_t msg_reply_type = send_core1_cmd(TARE, app_regs.tare & 0b111)
+                                      ? WRITE : WRITE_ERROR;
+    if (msg_reply_type == WRITE)
+        app_regs.encoder_tare |= app_regs.tare & 1u;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
 }
 
-void read_reg_brake_current(uint8_t reg_name)
+void write_reset_tare(msg_t& msg)
 {
-    app_regs.brake_current = get_tared_brake_current();
-    HarpCore::send_harp_reply(READ, reg_name);
+    HarpCore::copy_msg_payload_to_register(msg);
+    // Core1 handles bits to clear tare value.
+    const uint8_t reset_mask = app_regs.tare & 0b111;
+    msg_type_t msg_reply_type = WRITE_ERROR;
+    if (send_core1_cmd(RESET_TARE, reset_mask))
+    {
+        app_regs.tare &= ~reset_mask; // Also clear tare setting in tare register.
+        app_regs.encoder_tare &= ~(reset_mask & 1u);
+        msg_reply_type = WRITE;
+    }
+    // Clear register since it reads as 0.
+    app_regs.reset_tare = 0;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
 }
 
-void update_sensor_register()
+void write_encoder_tare(msg_t& msg)
 {
-    app_regs.sensors[0] = get_tared_encoder_ticks();
-    // Both torque sensor and brake current sensor are signed int16s, but
-    // we promote to int32 for now to send an array of one type as a single msg.
-    app_regs.sensors[1] = int32_t(get_tared_reaction_torque());
-    app_regs.sensors[2] = int32_t(get_tared_brake_current());
+    const uint8_t value = *((uint8_t*)msg.payload);
+    const uint8_t all = (1u << NUM_ENCODERS) - 1;
+    const uint8_t tare_mask = value & all;
+    const uint8_t reset_mask = (value >> 4) & all;
+    if ((tare_mask & reset_mask)
+        || (tare_mask && !send_core1_cmd(TARE, uint32_t(tare_mask) << 8))
+        || (reset_mask && !send_core1_cmd(RESET_TARE, uint32_t(reset_mask) << 8)))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    app_regs.encoder_tare = (app_regs.encoder_tare | tare_mask) & ~reset_mask;
+    // Keep the treadmill encoder bit of the tare register in step.
+    app_regs.tare = (app_regs.tare & ~1u) | (app_regs.encoder_tare & 1u);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-void read_reg_sensors(uint8_t reg_name)
+void write_torque_limiting(msg_t& msg)
 {
-    update_sensor_register();
+    HarpCore::copy_msg_payload_to_register(msg);
+    app_regs.torque_limiting = app_regs.torque_limiting ? 1 : 0;
+    const msg_type_t msg_reply_type
+        = send_core1_cmd(SET_TORQUE_LIMITING, app_regs.torque_limiting)
+          ? WRITE : WRITE_ERROR;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
+}
+
+void write_torque_limiting_triggered(msg_t& msg)
+{
+    // Only clearing the torque-limit condition is allowed.
+    if (*((uint8_t*)msg.payload) != 0 || !send_core1_cmd(CLEAR_TORQUE_LIMIT))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_torque_limit_filter_window(msg_t& msg)
+{
+    const uint8_t window = *((uint8_t*)msg.payload);
+    if (!TorqueLimitMonitor::is_valid_window(window)
+        || !send_core1_cmd(SET_TORQUE_LIMIT_WINDOW, window))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_torque_limit_hysteresis(msg_t& msg)
+{
+    const uint16_t hysteresis = *((uint16_t*)msg.payload);
+    if (!send_core1_cmd(SET_TORQUE_LIMIT_HYSTERESIS, hysteresis))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_torque_limits(msg_t& msg)
+{
+    const uint16_t* limits = (uint16_t*)msg.payload;
+    if (limits[0] >= limits[1] || limits[1] > RAW_TORQUE_SENSOR_FULL_SCALE
+        || !send_core1_cmd(SET_TORQUE_LIMITS,
+                           (uint32_t(limits[1]) << 16) | limits[0]))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void read_reg_sensor_skew_ns(uint8_t reg_name)
+{
+    for (uint32_t i = 0; i < 3; ++i)
+        app_regs.sensor_skew_ns[i] = sensor_skew_ns[i];
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void write_sensor_filters(msg_t& msg)
+{
+    const uint8_t* presets = (uint8_t*)msg.payload;
+    if (presets[0] >= NUM_SENSOR_FILTER_PRESETS
+        || presets[1] >= NUM_SENSOR_FILTER_PRESETS
+        || !send_core1_cmd(SET_SENSOR_FILTERS,
+                           (uint32_t(presets[1]) << 8) | presets[0]))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+/**
+ * \brief -3[dB] frequency of a sensor filter preset on a stream with the
+ *  given conversion period. 0 if the filter is off or the period is unknown.
+ */
+uint32_t sensor_filter_cutoff_hz(uint8_t preset, uint32_t conversion_period_ns)
+{
+    if (preset >= NUM_SENSOR_FILTER_PRESETS || conversion_period_ns == 0)
+        return 0;
+    // Presets are in parts per million of the decimated rate.
+    return uint32_t((uint64_t(SENSOR_FILTER_PRESETS[preset].cutoff_ppm) * 1000)
+                    / (uint64_t(conversion_period_ns)
+                       << SENSOR_FILTER_DECIMATION_LOG2));
+}
+
+void read_reg_sensor_filter_cutoff_hz(uint8_t reg_name)
+{
+    app_regs.sensor_filter_cutoff_hz[0] = sensor_filter_cutoff_hz(
+        app_regs.sensor_filters[0], torque_sample_age_ns);
+    app_regs.sensor_filter_cutoff_hz[1] = sensor_filter_cutoff_hz(
+        app_regs.sensor_filters[1], brake_current_sample_age_ns);
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void read_reg_torque_limit_trip_latency_us(uint8_t reg_name)
+{
+    app_regs.torque_limit_trip_latency_us = torque_limit_trip_latency_us;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void read_reg_loop_period_us(uint8_t reg_name)
+{
+    app_regs.loop_period_us[0] = loop_count ? loop_period_min_us : 0;
+    app_regs.loop_period_us[1] = loop_count ? uint32_t(loop_period_sum_us / loop_count) : 0;
+    app_regs.loop_period_us[2] = loop_period_max_us;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void read_reg_missed_deadlines(uint8_t reg_name)
+{
+    // Core1 counters are 32-bit, so reading them from core0 is atomic.
+    app_regs.missed_deadlines = dispatch_scheduler.missed_count()
+                                + batch_scheduler.missed_count()
+                                + sample_scheduler.missed_count()
+                                + control_scheduler.missed_count()
+                                + latch_overrun_count;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void read_reg_torque_check_overruns(uint8_t reg_name)
+{
+    app_regs.torque_check_overruns = torque_monitor_scheduler.missed_count();
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void read_reg_usb_tx_backpressure(uint8_t reg_name)
+{
+    app_regs.usb_tx_backpressure = usb_tx_backpressure_count;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+/**
+ * \brief clear core0 timing diagnostics. Core1 clears its own.
+ */
+void clear_diagnostics()
+{
+    loop_period_min_us = UINT32_MAX;
+    loop_period_max_us = 0;
+    loop_period_sum_us = 0;
+    loop_count = 0;
+    last_loop_time_us = time_us_32();
+    memset(app_regs.dispatch_lateness_histogram, 0,
+           sizeof(app_regs.dispatch_lateness_histogram));
+    dispatch_scheduler.clear_stats();
+    batch_scheduler.clear_stats();
+    usb_tx_backpressure_count = 0;
+}
+
+void write_reset_diagnostics(msg_t& msg)
+{
+    const uint8_t value = *((uint8_t*)msg.payload);
+    if (value && !send_core1_cmd(RESET_DIAGNOSTICS))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    if (value)
+        clear_diagnostics();
+    // Register always reads as 0.
+    app_regs.reset_diagnostics = 0;
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+/**
+ * \brief the trajectory table that core0 may write, or nullptr if core1 has
+ *  yet to swap in the last one submitted.
+ * \details The first write after a swap starts from a copy of the front
+ *  table, so edits build on the table last played as with a single table.
+ */
+BrakeTrajectory* back_brake_trajectory()
+{
+    if (trajectory_front != trajectory_pending_front)
+        return nullptr;
+    BrakeTrajectory& back = brake_trajectories[trajectory_pending_front ^ 1];
+    if (!trajectory_back_written)
+    {
+        back.copy_table(brake_trajectories[trajectory_pending_front]);
+        trajectory_back_written = true;
+    }
+    return &back;
+}
+
+/**
+ * \brief the table that the next playback plays.
+ */
+inline const BrakeTrajectory& staged_brake_trajectory()
+{
+    return brake_trajectories[trajectory_pending_front
+                              ^ uint8_t(trajectory_back_written)];
+}
+
+void write_brake_trajectory_write_index(msg_t& msg)
+{
+    const uint16_t index = *((uint16_t*)msg.payload);
+    if (index >= BrakeTrajectory::MAX_POINTS)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_brake_trajectory_data(msg_t& msg)
+{
+    const size_t count = msg.header.payload_length() / sizeof(uint16_t);
+    if (count == 0 || count > MAX_TRAJECTORY_POINTS_PER_WRITE
+        || app_regs.brake_trajectory_write_index + count
+           > BrakeTrajectory::MAX_POINTS)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    BrakeTrajectory* trajectory = back_brake_trajectory();
+    if (trajectory == nullptr)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    memcpy(app_regs.brake_trajectory_data, msg.payload,
+           count * sizeof(uint16_t));
+    trajectory->write(app_regs.brake_trajectory_write_index,
+                      app_regs.brake_trajectory_data, count);
+    app_regs.brake_trajectory_write_index += count;
+    // Reply with the points that were written.
+    HarpCore::send_harp_reply(WRITE, msg.header.address,
+                              (uint8_t*)app_regs.brake_trajectory_data,
+                              count * sizeof(uint16_t), U16);
+}
+
+void read_reg_brake_trajectory_data(uint8_t reg_name)
+{
+    // Read back the points at the write index of the table to play next.
+    const BrakeTrajectory& trajectory = staged_brake_trajectory();
+    const size_t index = app_regs.brake_trajectory_write_index;
+    size_t count = BrakeTrajectory::MAX_POINTS - index;
+    if (count > MAX_TRAJECTORY_POINTS_PER_WRITE)
+        count = MAX_TRAJECTORY_POINTS_PER_WRITE;
+    for (size_t i = 0; i < count; ++i)
+        app_regs.brake_trajectory_data[i] = trajectory.point(index + i);
+    HarpCore::send_harp_reply(READ, reg_name,
+                              (uint8_t*)app_regs.brake_trajectory_data,
+                              count * sizeof(uint16_t), U16);
+}
+
+void write_brake_trajectory_length(msg_t& msg)
+{
+    const uint16_t length = *((uint16_t*)msg.payload);
+    if (length > BrakeTrajectory::MAX_POINTS)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    BrakeTrajectory* trajectory = back_brake_trajectory();
+    if (trajectory == nullptr || !trajectory->set_length(length))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+// Applies from the next playback.
+void write_brake_trajectory_sample_frequency_hz(msg_t& msg)
+{
+    const uint16_t frequency_hz = *((uint16_t*)msg.payload);
+    if (frequency_hz == 0 || frequency_hz > MAX_TRAJECTORY_FREQUENCY_HZ)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_brake_trajectory_playback(msg_t& msg)
+{
+    const uint8_t mode = *((uint8_t*)msg.payload);
+    if (mode == 0)
+    {
+        if (!send_core1_cmd(STOP_TRAJECTORY))
+        {
+            HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+            return;
+        }
+        app_regs.brake_trajectory_playback = 0;
+        HarpCore::send_harp_reply(WRITE, msg.header.address);
+        return;
+    }
+    // Trajectory points are raw DAC codes, so playback is open-loop only.
+    const uint32_t period_us = div_u32u32(1'000'000,
+        uint32_t(app_regs.brake_trajectory_sample_frequency_hz));
+    const uint8_t run = trajectory_run_count + 1;
+    // Starting during playback restarts it, from the back table if written.
+    const bool swap = trajectory_back_written;
+    if (mode > 2
+        || app_regs.brake_current_control || app_regs.brake_map
+        || app_regs.torque_limiting_triggered || brake_step_test_running()
+        || staged_brake_trajectory().length() == 0
+        || !send_core1_cmd(START_TRAJECTORY,
+                           (uint32_t(run) << 24) | (uint32_t(swap) << 21)
+                           | ((mode == 2) << 20) | period_us))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    trajectory_run_count = run;
+    if (swap)
+    {
+        trajectory_pending_front ^= 1;
+        trajectory_back_written = false;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+/**
+ * \brief the map that core0 may write, or nullptr if core1 has yet to swap
+ *  in the last one submitted.
+ */
+inline BrakeMap* back_brake_map()
+{
+    if (brake_map_front != brake_map_pending_front)
+        return nullptr;
+    return &brake_maps[brake_map_pending_front ^ 1];
+}
+
+void write_brake_map_write_index(msg_t& msg)
+{
+    const uint16_t index = *((uint16_t*)msg.payload);
+    if (index >= BrakeMap::MAX_POINTS)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_brake_map_data(msg_t& msg)
+{
+    const size_t count = msg.header.payload_length() / sizeof(uint16_t);
+    BrakeMap* map = back_brake_map();
+    if (map == nullptr || count == 0 || count > MAX_BRAKE_MAP_POINTS_PER_WRITE
+        || app_regs.brake_map_write_index + count > BrakeMap::MAX_POINTS)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    memcpy(app_regs.brake_map_data, msg.payload, count * sizeof(uint16_t));
+    map->write(app_regs.brake_map_write_index, app_regs.brake_map_data, count);
+    app_regs.brake_map_write_index += count;
+    // Reply with the points that were written.
+    HarpCore::send_harp_reply(WRITE, msg.header.address,
+                              (uint8_t*)app_regs.brake_map_data,
+                              count * sizeof(uint16_t), U16);
+}
+
+void read_reg_brake_map_data(uint8_t reg_name)
+{
+    // Read back the back map points at the write index.
+    const BrakeMap& map = brake_maps[brake_map_pending_front ^ 1];
+    const size_t index = app_regs.brake_map_write_index;
+    size_t count = BrakeMap::MAX_POINTS - index;
+    if (count > MAX_BRAKE_MAP_POINTS_PER_WRITE)
+        count = MAX_BRAKE_MAP_POINTS_PER_WRITE;
+    for (size_t i = 0; i < count; ++i)
+        app_regs.brake_map_data[i] = map.point(index + i);
+    HarpCore::send_harp_reply(READ, reg_name,
+                              (uint8_t*)app_regs.brake_map_data,
+                              count * sizeof(uint16_t), U16);
+}
+
+void write_brake_map_config(msg_t& msg)
+{
+    const uint32_t* config = (uint32_t*)msg.payload;
+    BrakeMap* map = back_brake_map();
+    if (map == nullptr || config[3] > 1
+        || !map->configure(config[0], config[1], config[2], bool(config[3])))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_brake_map(msg_t& msg)
+{
+    const uint8_t enable = *((uint8_t*)msg.payload);
+    // Swapping requires the previous swap to have finished.
+    // Brake maps are open-loop only.
+    if (enable > 1
+        || (enable && (back_brake_map() == nullptr
+                       || app_regs.brake_current_control
+                       || app_regs.brake_trajectory_playback
+                       || app_regs.torque_limiting_triggered
+                       || brake_step_test_running()))
+        || !send_core1_cmd(SET_BRAKE_MAP, enable))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    if (enable)
+        brake_map_pending_front ^= 1;
+    else
+        app_regs.brake_current_setpoint = 0;
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+/**
+ * \brief true if nothing is driving the brake.
+ */
+inline bool brake_is_idle()
+{
+    return !app_regs.brake_current_setpoint && !app_regs.brake_current_control
+           && !app_regs.brake_trajectory_playback && !app_regs.brake_map
+           && !brake_step_test_running();
+}
+
+/**
+ * \brief make it safe to erase or program flash.
+ * \details Nothing may execute from flash while it is erased or programmed,
+ *  so core1 is parked (in RAM) and interrupts are disabled until
+ *  end_flash_write().
+ * \returns the interrupt state to pass to end_flash_write().
+ */
+uint32_t begin_flash_write()
+{
+    if (core1_started)
+        multicore_lockout_start_blocking();
+    return save_and_disable_interrupts();
+}
+
+void end_flash_write(uint32_t interrupts)
+{
+    restore_interrupts(interrupts);
+    if (core1_started)
+        multicore_lockout_end_blocking();
+}
+
+/**
+ * \brief overwrite one flash sector with data.
+ * \details Stalls sensing and control for tens of milliseconds, so only call
+ *  this while the brake is idle.
+ * \returns true if the sector reads back as written.
+ */
+bool write_flash_sector(uint32_t flash_offset, const uint8_t* data,
+                        size_t num_bytes)
+{
+    // Programming is in whole pages.
+    static uint8_t page_buffer[FLASH_SECTOR_SIZE];
+    if (num_bytes > sizeof(page_buffer))
+        return false;
+    const size_t program_bytes = (num_bytes + FLASH_PAGE_SIZE - 1)
+                                 & ~size_t(FLASH_PAGE_SIZE - 1);
+    memset(page_buffer, 0xFF, program_bytes);
+    memcpy(page_buffer, data, num_bytes);
+    const uint32_t interrupts = begin_flash_write();
+    flash_range_erase(flash_offset, FLASH_SECTOR_SIZE);
+    flash_range_program(flash_offset, page_buffer, program_bytes);
+    end_flash_write(interrupts);
+    return memcmp((const void*)(XIP_BASE + flash_offset), data, num_bytes) == 0;
+}
+
+/**
+ * \brief reflect the active calibration table in its registers.
+ */
+void update_brake_calibration_registers()
+{
+    app_regs.brake_calibration_config[0] = brake_calibration.num_points();
+    app_regs.brake_calibration_config[1] = brake_calibration.full_scale_torque_q16();
+    app_regs.brake_calibration_checksum = brake_calibration.checksum();
+}
+
+void write_brake_calibration_write_index(msg_t& msg)
+{
+    const uint16_t index = *((uint16_t*)msg.payload);
+    if (index >= BrakeCalibration::MAX_POINTS)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_brake_calibration_data(msg_t& msg)
+{
+    const size_t count = msg.header.payload_length() / sizeof(uint16_t);
+    if (count == 0 || count > MAX_BRAKE_CALIBRATION_POINTS_PER_WRITE
+        || app_regs.brake_calibration_write_index + count
+           > BrakeCalibration::MAX_POINTS)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    memcpy(app_regs.brake_calibration_data, msg.payload,
+           count * sizeof(uint16_t));
+    staged_brake_calibration.write(app_regs.brake_calibration_write_index,
+                                   app_regs.brake_calibration_data, count);
+    app_regs.brake_calibration_write_index += count;
+    // Reply with the points that were written.
+    HarpCore::send_harp_reply(WRITE, msg.header.address,
+                              (uint8_t*)app_regs.brake_calibration_data,
+                              count * sizeof(uint16_t), U16);
+}
+
+void read_reg_brake_calibration_data(uint8_t reg_name)
+{
+    // Read back the active table points at the write index.
+    const size_t index = app_regs.brake_calibration_write_index;
+    size_t count = BrakeCalibration::MAX_POINTS - index;
+    if (count > MAX_BRAKE_CALIBRATION_POINTS_PER_WRITE)
+        count = MAX_BRAKE_CALIBRATION_POINTS_PER_WRITE;
+    for (size_t i = 0; i < count; ++i)
+        app_regs.brake_calibration_data[i] = brake_calibration.point(index + i);
+    HarpCore::send_harp_reply(READ, reg_name,
+                              (uint8_t*)app_regs.brake_calibration_data,
+                              count * sizeof(uint16_t), U16);
+}
+
+void write_brake_calibration_config(msg_t& msg)
+{
+    const uint32_t* config = (uint32_t*)msg.payload;
+    if (!staged_brake_calibration.configure(config[0], config[1]))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    brake_calibration.copy(staged_brake_calibration);
+    update_brake_calibration_registers();
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_brake_calibration_store(msg_t& msg)
+{
+    // Flash writes pause core1, so the brake must not be doing anything.
+    if (*((uint8_t*)msg.payload) != 1 || !brake_calibration.is_valid()
+        || !brake_is_idle())
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    static BrakeCalibration::record_t record;
+    brake_calibration.save(record);
+    const bool stored = write_flash_sector(BRAKE_CALIBRATION_FLASH_OFFSET,
+                                           (const uint8_t*)&record,
+                                           sizeof(record));
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(stored ? WRITE : WRITE_ERROR, msg.header.address);
+}
+
+void write_brake_torque_setpoint(msg_t& msg)
+{
+    // Same ownership rules as writing the brake setpoint directly.
+    if (!brake_calibration.is_valid()
+        || app_regs.torque_limiting_triggered
+        || app_regs.brake_current_control
+        || app_regs.brake_trajectory_playback
+        || app_regs.brake_map || brake_step_test_running())
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    const uint32_t torque_q16 = *((uint32_t*)msg.payload);
+    const uint16_t setpoint = brake_calibration.evaluate(torque_q16);
+    if (!send_brake_setpoint_cmd(SET_BRAKE_SETPOINT, setpoint))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    app_regs.brake_current_setpoint = setpoint;
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void erase_persistent_config_sector(uint32_t offset)
+{
+    const uint32_t interrupts = begin_flash_write();
+    flash_range_erase(PERSISTENT_CONFIG_FLASH_OFFSET + offset, FLASH_SECTOR_SIZE);
+    end_flash_write(interrupts);
+}
+
+void program_persistent_config_page(uint32_t offset, const uint8_t* data,
+                                    size_t num_bytes)
+{
+    const uint32_t interrupts = begin_flash_write();
+    flash_range_program(PERSISTENT_CONFIG_FLASH_OFFSET + offset, data, num_bytes);
+    end_flash_write(interrupts);
+}
+
+WearLevelingStore persistent_config_store(
+    (const uint8_t*)(XIP_BASE + PERSISTENT_CONFIG_FLASH_OFFSET),
+    PERSISTENT_CONFIG_FLASH_SECTORS,
+    erase_persistent_config_sector, program_persistent_config_page);
+
+// Register values restored at boot (and on reset) if saved.
+struct persistent_config_t
+{
+    uint16_t sensor_dispatch_frequency_hz;
+    uint16_t sensor_dispatch_deadband[3];
+    uint16_t sensor_dispatch_heartbeat_ms;
+    uint16_t sensor_batch_sample_frequency_hz;
+    uint8_t sensor_batch_size;
+    uint8_t sensor_data_fields;
+    uint8_t sensor_data_format;
+    uint8_t tare; // brake_current[2], torque[1] only.
+    int16_t torque_offset;
+    int16_t brake_current_offset;
+    uint8_t torque_limiting;
+    uint8_t torque_limit_filter_window;
+    uint16_t torque_limit_hysteresis;
+    uint16_t torque_limits[2];
+    uint16_t brake_current_control_gains[2];
+};
+// Core1 commands that apply_persistent_config() sends.
+static constexpr size_t PERSISTENT_CONFIG_CMD_COUNT = 7;
+
+/**
+ * \brief the saved configuration or nullptr if there isn't a usable one.
+ */
+const persistent_config_t* saved_persistent_config()
+{
+    uint16_t version;
+    uint16_t num_bytes;
+    const uint8_t* payload = persistent_config_store.latest(version, num_bytes);
+    // A forgotten configuration is saved as an empty record.
+    if (payload == nullptr || version != PERSISTENT_CONFIG_VERSION
+        || num_bytes != sizeof(persistent_config_t))
+        return nullptr;
+    return (const persistent_config_t*)payload;
+}
+
+void save_persistent_config(persistent_config_t& config)
+{
+    config.sensor_dispatch_frequency_hz = app_regs.sensor_dispatch_frequency_hz;
+    memcpy(config.sensor_dispatch_deadband, app_regs.sensor_dispatch_deadband,
+           sizeof(config.sensor_dispatch_deadband));
+    config.sensor_dispatch_heartbeat_ms = app_regs.sensor_dispatch_heartbeat_ms;
+    config.sensor_batch_sample_frequency_hz = app_regs.sensor_batch_sample_frequency_hz;
+    config.sensor_batch_size = app_regs.sensor_batch_size;
+    config.sensor_data_fields = app_regs.sensor_data_fields;
+    config.sensor_data_format = app_regs.sensor_data_format;
+    // Encoder position does not survive a power cycle, so neither does its
+    // tare. Offsets are only ever written by core1, and reading them whole is
+    // atomic.
+    config.tare = app_regs.tare & 0b110;
+    config.torque_offset = (config.tare & 0b010) ? torque_offset : 0;
+    config.brake_current_offset = (config.tare & 0b100) ? brake_current_offset : 0;
+    config.torque_limiting = app_regs.torque_limiting;
+    config.torque_limit_filter_window = app_regs.torque_limit_filter_window;
+    config.torque_limit_hysteresis = app_regs.torque_limit_hysteresis;
+    memcpy(config.torque_limits, app_regs.torque_limits,
+           sizeof(config.torque_limits));
+    memcpy(config.brake_current_control_gains,
+           app_regs.brake_current_control_gains,
+           sizeof(config.brake_current_control_gains));
+}
+
+/**
+ * \brief apply a configuration on top of the current state.
+ * \note There must be room for PERSISTENT_CONFIG_CMD_COUNT core1 commands.
+ */
+void apply_persistent_config(const persistent_config_t& config)
+{
+    // Settings from a newer build that this one rejects fall back to defaults.
+    app_regs.sensor_data_fields = config.sensor_data_fields & 0b11u;
+    app_regs.sensor_data_format =
+        (config.sensor_data_format < NUM_SENSOR_DATA_FORMATS)
+        ? config.sensor_data_format : uint8_t(SENSOR_DATA_FORMAT_SENSORS);
+    packed_sensor_data.set_use_deltas(
+        app_regs.sensor_data_format == SENSOR_DATA_FORMAT_PACKED_DELTAS);
+    send_core1_cmd(SET_INTERVAL_STATS,
+                   app_regs.sensor_data_format == SENSOR_DATA_FORMAT_STATS);
+    memcpy(app_regs.sensor_dispatch_deadband, config.sensor_dispatch_deadband,
+           sizeof(app_regs.sensor_dispatch_deadband));
+    dispatch_change_trigger.set_thresholds(app_regs.sensor_dispatch_deadband[0],
+                                           app_regs.sensor_dispatch_deadband[1],
+                                           app_regs.sensor_dispatch_deadband[2]);
+    app_regs.sensor_dispatch_heartbeat_ms = config.sensor_dispatch_heartbeat_ms;
+    dispatch_change_trigger.set_heartbeat_us(
+        uint32_t(app_regs.sensor_dispatch_heartbeat_ms) * 1000);
+    app_regs.sensor_dispatch_frequency_hz = config.sensor_dispatch_frequency_hz;
+    apply_sensor_dispatch_frequency_hz();
+    sensor_batch.set_batch_size(config.sensor_batch_size);
+    app_regs.sensor_batch_size = sensor_batch.batch_size();
+    app_regs.sensor_batch_sample_frequency_hz = config.sensor_batch_sample_frequency_hz;
+    apply_sensor_batch_sample_frequency_hz();
+    app_regs.tare = (app_regs.tare & ~0b110u) | (config.tare & 0b110u);
+    send_core1_cmd(SET_ANALOG_TARE_OFFSETS,
+                   (uint32_t(uint16_t(config.brake_current_offset)) << 16)
+                   | uint16_t(config.torque_offset));
+    app_regs.torque_limiting = config.torque_limiting ? 1 : 0;
+    send_core1_cmd(SET_TORQUE_LIMITING, app_regs.torque_limiting);
+    if (TorqueLimitMonitor::is_valid_window(config.torque_limit_filter_window))
+        app_regs.torque_limit_filter_window = config.torque_limit_filter_window;
+    send_core1_cmd(SET_TORQUE_LIMIT_WINDOW, app_regs.torque_limit_filter_window);
+    app_regs.torque_limit_hysteresis = config.torque_limit_hysteresis;
+    send_core1_cmd(SET_TORQUE_LIMIT_HYSTERESIS, app_regs.torque_limit_hysteresis);
+    if (config.torque_limits[0] < config.torque_limits[1]
+        && config.torque_limits[1] <= RAW_TORQUE_SENSOR_FULL_SCALE)
+        memcpy(app_regs.torque_limits, config.torque_limits,
+               sizeof(app_regs.torque_limits));
+    send_core1_cmd(SET_TORQUE_LIMITS, (uint32_t(app_regs.torque_limits[1]) << 16)
+                                      | app_regs.torque_limits[0]);
+    memcpy(app_regs.brake_current_control_gains,
+           config.brake_current_control_gains,
+           sizeof(app_regs.brake_current_control_gains));
+    send_core1_cmd(SET_CONTROL_GAINS,
+                   (uint32_t(app_regs.brake_current_control_gains[1]) << 16)
+                   | app_regs.brake_current_control_gains[0]);
+}
+
+void read_reg_persistent_config(uint8_t reg_name)
+{
+    app_regs.persistent_config =
+        (persistent_config_store.erase_pending() << 1)
+        | (saved_persistent_config() != nullptr);
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void write_persistent_config(msg_t& msg)
+{
+    const uint8_t action = *((uint8_t*)msg.payload);
+    // Writing flash pauses core1, interrupts and USB (see
+    // begin_flash_write()), so it is only ever done here, when the host asks
+    // for it, and never while the brake is in use.
+    if ((action == 1 || action == 3 || action == 4) && !brake_is_idle())
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    bool success = false;
+    if (action == 1) // Save. Programs one page. Never erases.
+    {
+        persistent_config_t config;
+        save_persistent_config(config);
+        success = persistent_config_store.save(PERSISTENT_CONFIG_VERSION,
+                                               &config, sizeof(config));
+    }
+    else if (action == 2) // Restore.
+    {
+        const persistent_config_t* config = saved_persistent_config();
+        success = (config != nullptr)
+                  && (core1_cmds.capacity() - core1_cmds.size()
+                      >= PERSISTENT_CONFIG_CMD_COUNT);
+        if (success)
+            apply_persistent_config(*config);
+    }
+    else if (action == 3) // Forget.
+        success = persistent_config_store.save(PERSISTENT_CONFIG_VERSION,
+                                               nullptr, 0);
+    else if (action == 4) // Erase. Stalls for a sector erase if one is due.
+    {
+        persistent_config_store.service_erase();
+        success = true;
+    }
+    HarpCore::send_harp_reply(success ? WRITE : WRITE_ERROR,
+                              msg.header.address);
+}
+
+void write_virtual_load_params(msg_t& msg)
+{
+    // Apply all parameters or none of them.
+    if (core1_cmds.capacity() - core1_cmds.size() < 4)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    send_core1_cmd(SET_VIRTUAL_DAMPING, app_regs.virtual_load_params[0]);
+    send_core1_cmd(SET_VIRTUAL_FRICTION, app_regs.virtual_load_params[1]);
+    send_core1_cmd(SET_VIRTUAL_INERTIA, app_regs.virtual_load_params[2]);
+    send_core1_cmd(SET_VIRTUAL_FRICTION_DEADBAND, app_regs.virtual_load_params[3]);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_virtual_load(msg_t& msg)
+{
+    const uint8_t enable = *((uint8_t*)msg.payload);
+    // Virtual load commands the closed-loop current setpoint.
+    if (enable > 1 || (enable && !app_regs.brake_current_control)
+        || !send_core1_cmd(SET_VIRTUAL_LOAD_ENABLE, enable))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    app_regs.brake_current_setpoint_ua = 0;
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void read_reg_encoder_ticks(uint8_t reg_name)
+{
+    app_regs.encoder_ticks = latest_sample.encoder_ticks[0];
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void read_reg_reaction_torque(uint8_t reg_name)
+{
+    app_regs.reaction_torque = latest_sample.reaction_torque;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void read_reg_brake_current(uint8_t reg_name)
+{
+    app_regs.brake_current = latest_sample.brake_current;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void read_reg_encoder_velocity(uint8_t reg_name)
+{
+    app_regs.encoder_velocity = latest_sample.encoder_velocity;
     HarpCore::send_harp_reply(READ, reg_name);
 }
 
-void update_torque_limit_monitor()
+void read_reg_encoder_acceleration(uint8_t reg_name)
+{
+    app_regs.encoder_acceleration = latest_sample.encoder_acceleration;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+/**
+ * \brief update the sensors register from the latest sample.
+ * \returns the number of bytes of the register in use.
+ */
+uint8_t update_sensor_register()
+{
+    app_regs.sensors[0] = latest_sample.encoder_ticks[0];
+    // Both torque sensor and brake current sensor are signed int16s, but
+    // we promote to int32 for now to send an array of one type as a single msg.
+    app_regs.sensors[1] = int32_t(latest_sample.reaction_torque);
+    app_regs.sensors[2] = int32_t(latest_sample.brake_current);
+    uint8_t num_fields = 3;
+    if (1u << 0 & app_regs.sensor_data_fields)
+        app_regs.sensors[num_fields++] = latest_sample.encoder_velocity;
+    if (1u << 1 & app_regs.sensor_data_fields)
+        app_regs.sensors[num_fields++] = latest_sample.encoder_acceleration;
+    for (uint32_t i = 1; i < NUM_ENCODERS; ++i)
+        app_regs.sensors[num_fields++] = latest_sample.encoder_ticks[i];
+    return num_fields * sizeof(int32_t);
+}
+
+void read_reg_sensors(uint8_t reg_name)
+{
+    const uint8_t num_bytes = update_sensor_register();
+    HarpCore::send_harp_reply(READ, reg_name, (uint8_t*)app_regs.sensors,
+                              num_bytes, S32);
+}
+
+/**
+ * \brief update the packed sensors register from the latest sample.
+ * \param packer encodes the record. Deltas are relative to the last record
+ *  that this packer encoded.
+ * \returns the number of bytes of the register in use.
+ */
+uint8_t update_sensors_packed_register(PackedSensorData& packer)
+{
+    uint8_t num_bytes = packer.pack(app_regs.sensors_packed,
+        latest_sample.encoder_ticks[0],
+        latest_sample.reaction_torque, bool(app_regs.tare & (1u << 1)),
+        latest_sample.brake_current, bool(app_regs.tare & (1u << 2)));
+    if (1u << 0 & app_regs.sensor_data_fields)
+    {
+        memcpy(&app_regs.sensors_packed[num_bytes],
+               &latest_sample.encoder_velocity, sizeof(int32_t));
+        num_bytes += sizeof(int32_t);
+    }
+    if (1u << 1 & app_regs.sensor_data_fields)
+    {
+        memcpy(&app_regs.sensors_packed[num_bytes],
+               &latest_sample.encoder_acceleration, sizeof(int32_t));
+        num_bytes += sizeof(int32_t);
+    }
+    return num_bytes;
+}
+
+void read_reg_sensors_packed(uint8_t reg_name)
+{
+    // Reads are always absolute and don't disturb the event delta chain.
+    PackedSensorData packer;
+    const uint8_t num_bytes = update_sensors_packed_register(packer);
+    HarpCore::send_harp_reply(READ, reg_name, app_regs.sensors_packed,
+                              num_bytes, U8);
+}
+
+/**
+ * \brief update the sensor statistics register from the current interval.
+ * \returns the number of bytes of the register in use.
+ */
+uint8_t update_sensors_stats_register()
+{
+    const IntervalStats& stats = dispatch_interval_stats;
+    app_regs.sensors_stats[0] = latest_sample.encoder_ticks[0];
+    app_regs.sensors_stats[1] = int32_t(stats.num_samples(IntervalStats::TORQUE));
+    app_regs.sensors_stats[2] = stats.min(IntervalStats::TORQUE);
+    app_regs.sensors_stats[3] = stats.max(IntervalStats::TORQUE);
+    app_regs.sensors_stats[4] = stats.mean(IntervalStats::TORQUE);
+    app_regs.sensors_stats[5] = stats.min(IntervalStats::BRAKE_CURRENT);
+    app_regs.sensors_stats[6] = stats.max(IntervalStats::BRAKE_CURRENT);
+    app_regs.sensors_stats[7] = stats.mean(IntervalStats::BRAKE_CURRENT);
+    uint8_t num_fields = 8;
+    if (1u << 0 & app_regs.sensor_data_fields)
+        app_regs.sensors_stats[num_fields++] = latest_sample.encoder_velocity;
+    if (1u << 1 & app_regs.sensor_data_fields)
+        app_regs.sensors_stats[num_fields++] = latest_sample.encoder_acceleration;
+    return num_fields * sizeof(int32_t);
+}
+
+void read_reg_sensors_stats(uint8_t reg_name)
+{
+    // Reads report the interval in progress without ending it.
+    const uint8_t num_bytes = update_sensors_stats_register();
+    HarpCore::send_harp_reply(READ, reg_name, (uint8_t*)app_regs.sensors_stats,
+                              num_bytes, S32);
+}
+
+void write_sensor_data_format(msg_t& msg)
+{
+    const uint8_t format = *((uint8_t*)msg.payload);
+    // Core1 only reduces conversions for interval stats while they are on.
+    if (format >= NUM_SENSOR_DATA_FORMATS
+        || !send_core1_cmd(SET_INTERVAL_STATS,
+                           format == SENSOR_DATA_FORMAT_STATS))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    packed_sensor_data.set_use_deltas(format == SENSOR_DATA_FORMAT_PACKED_DELTAS);
+    dispatch_interval_stats.clear();
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_sensor_dispatch_deadband(msg_t& msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    dispatch_change_trigger.set_thresholds(app_regs.sensor_dispatch_deadband[0],
+                                           app_regs.sensor_dispatch_deadband[1],
+                                           app_regs.sensor_dispatch_deadband[2]);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_sensor_dispatch_heartbeat_ms(msg_t& msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    dispatch_change_trigger.set_heartbeat_us(
+        uint32_t(app_regs.sensor_dispatch_heartbeat_ms) * 1000);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_sensor_data_fields(msg_t& msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    msg_type_t msg_reply_type = WRITE;
+    if (app_regs.sensor_data_fields & ~0b11u)
+    {
+        app_regs.sensor_data_fields &= 0b11u;
+        msg_reply_type = WRITE_ERROR;
+    }
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
+}
+
+/**
+ * \returns true if the USB TX buffer cannot fit the message.
+ */
+inline bool count_usb_tx_backpressure(uint32_t payload_bytes)
+{
+    if (tud_cdc_write_available() >= HARP_MSG_OVERHEAD_BYTES + payload_bytes)
+        return false;
+    ++usb_tx_backpressure_count;
+    return true;
+}
+
+inline void record_dispatch_lateness(uint64_t lateness_us)
+{
+    // Bucket is the bit length of the lateness in 128[us] units.
+    uint32_t bucket = DISPATCH_LATENESS_BUCKETS - 1;
+    if (lateness_us < (1u << (DISPATCH_LATENESS_BUCKET0_SHIFT + bucket)))
+    {
+        const uint32_t scaled = uint32_t(lateness_us)
+                                >> DISPATCH_LATENESS_BUCKET0_SHIFT;
+        bucket = scaled ? 32 - __builtin_clz(scaled) : 0;
+    }
+    ++app_regs.dispatch_lateness_histogram[bucket];
+}
+
+void send_sensor_batch(msg_type_t msg_type)
+{
+    // Copy the packed samples into the register so that it reads back the
+    // most recently sent batch.
+    memcpy(app_regs.sensor_batch, sensor_batch.data(), sensor_batch.size_bytes());
+    const uint8_t address_offset = 10; // "sensor_batch" register address.
+    count_usb_tx_backpressure(sensor_batch.size_bytes());
+    // Timestamp the message with the acquisition time of the first sample.
+    HarpCore::send_harp_reply(msg_type, APP_REG_START_ADDRESS + address_offset,
+        app_regs.sensor_batch, sensor_batch.size_bytes(), U8,
+        HarpCore::system_to_harp_us_64(sensor_batch.start_time_us()));
+}
+
+void read_reg_sensor_batch(uint8_t reg_name)
+{
+    // Only send the valid portion of the batch.
+    HarpCore::send_harp_reply(READ, reg_name, app_regs.sensor_batch,
+                              sensor_batch.batch_size() * sizeof(batch_sample_t),
+                              U8);
+}
+
+void update_sensor_batch(const app_event_t& sample)
+{
+    if (!batch_scheduler.is_due(sample.time_us))
+        return;
+    batch_scheduler.service(sample.time_us);
+    if (sensor_batch.add_sample(sample.time_us, sample.encoder_ticks[0],
+                                sample.reaction_torque, sample.brake_current))
+    {
+        if (!sensor_batch.is_full())
+            return;
+        send_sensor_batch(EVENT);
+        sensor_batch.clear();
+        return;
+    }
+    // Sample did not fit (time offset overflow). Flush and start a new batch.
+    send_sensor_batch(EVENT);
+    sensor_batch.clear();
+    sensor_batch.add_sample(sample.time_us, sample.encoder_ticks[0],
+                            sample.reaction_torque, sample.brake_current);
+}
+
+void update_sensor_dispatch(const app_event_t& sample)
 {
-    // Check measured torque limit and disable the brake if we measure either
-    // limit.
-    // Bail early if torque limiting is unset or we already tripped it.
-    if (!app_regs.torque_limiting || app_regs.torque_limiting_triggered)
+    if (!dispatch_scheduler.is_due(sample.time_us))
+        return;
+    record_dispatch_lateness(time_us_64() - dispatch_scheduler.next_deadline_us());
+    dispatch_scheduler.service(sample.time_us);
+    // Timestamp events with the acquisition time of the sample.
+    const uint64_t harp_time_us = HarpCore::system_to_harp_us_64(sample.time_us);
+    if (!dispatch_change_trigger.update(sample.time_us, sample.encoder_ticks[0],
+                                        sample.reaction_torque,
+                                        sample.brake_current))
+        return;
+    if (app_regs.sensor_data_format == SENSOR_DATA_FORMAT_SENSORS)
+    {
+        const uint8_t num_bytes = update_sensor_register();
+        // If this message might not make it, send the next one regardless.
+        if (count_usb_tx_backpressure(num_bytes))
+            dispatch_change_trigger.reset();
+        const uint8_t address_offset = 3; // "sensors" register address.
+        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + address_offset,
+                                  (uint8_t*)app_regs.sensors, num_bytes, S32,
+                                  harp_time_us);
         return;
-    // y[n] = 15/16 * y[n-1] + 1/16 * x[n]
-    filtered_torque = ((filtered_torque*15) >> 4) + (torque_raw >> 4);
-    if (filtered_torque > RAW_TORQUE_SENSOR_MIN && filtered_torque < RAW_TORQUE_SENSOR_MAX)
+    }
+    if (app_regs.sensor_data_format == SENSOR_DATA_FORMAT_STATS)
+    {
+        const uint8_t num_bytes = update_sensors_stats_register();
+        dispatch_interval_stats.clear();
+        if (count_usb_tx_backpressure(num_bytes))
+            dispatch_change_trigger.reset();
+        const uint8_t address_offset = 45; // "sensors_stats" register address.
+        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + address_offset,
+                                  (uint8_t*)app_regs.sensors_stats, num_bytes,
+                                  S32, harp_time_us);
         return;
-    // Kill the brake; clear the current brake setpoint.
+    }
+    const uint8_t num_bytes = update_sensors_packed_register(packed_sensor_data);
+    // If this message might not make it, don't base the next delta on it.
+    if (count_usb_tx_backpressure(num_bytes))
+    {
+        packed_sensor_data.reset();
+        dispatch_change_trigger.reset();
+    }
+    const uint8_t address_offset = 41; // "sensors_packed" register address.
+    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + address_offset,
+                              app_regs.sensors_packed, num_bytes, U8,
+                              harp_time_us);
+}
+
+/**
+ * \brief end a brake step test with the brake off.
+ */
+void finish_brake_step_test(brake_step_test_state_t state)
+{
+    // Retry until there's room since the brake must not be left on.
+    while (!send_core1_cmd(SET_BRAKE_STEP_TEST,
+                           uint32_t(brake_step_run_count) << 24))
+        tight_loop_contents();
+    app_regs.brake_step_test = state;
+    app_regs.brake_current_setpoint = 0;
+    // Core1 may have been partway through capturing a step.
+    if (state == BRAKE_STEP_TEST_ABORTED)
+        memset(app_regs.brake_step_trace_info, 0,
+               sizeof(app_regs.brake_step_trace_info));
+    if (HarpCore::is_muted())
+        return;
+    const uint8_t address_offset = 62; // brake_step_test reg.
+    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + address_offset);
+}
+
+/**
+ * \brief start stepping the brake between the configured setpoints.
+ * \details Conversions are captured at the full brake current ADC rate
+ *  unless the hold time doesn't fit in the capture, in which case they are
+ *  averaged in the fewest power-of-two groups that fit.
+ * \returns false if the brake is in use, the configuration is invalid, or
+ *  the command queue is full.
+ */
+bool start_brake_step_test()
+{
+    const uint16_t* config = app_regs.brake_step_test_config;
+    const uint32_t period_ns = brake_current_sample_age_ns;
+    if (!brake_is_idle() || app_regs.torque_limiting_triggered
+        || config[2] == 0 || config[3] == 0 || period_ns == 0
+        || core1_cmds.capacity() - core1_cmds.size() < 2)
+        return false;
+    const uint32_t conversions = BRAKE_STEP_PRE_CONVERSIONS
+        + uint32_t((uint64_t(config[2]) * 1'000'000) / period_ns);
+    uint32_t decimation_log2 = 0;
+    while ((conversions >> decimation_log2) > StepResponseCapture::CAPACITY)
+        ++decimation_log2;
+    if (decimation_log2 > StepResponseCapture::MAX_DECIMATION_LOG2)
+        return false;
+    const uint8_t run = brake_step_run_count + 1;
+    const uint32_t samples = conversions >> decimation_log2;
+    send_core1_cmd(SET_BRAKE_STEP_TEST, (uint32_t(run) << 24)
+                                        | (decimation_log2 << 16) | samples);
+    // The first step only settles the brake at the low setpoint.
+    send_brake_setpoint_cmd(BRAKE_STEP, config[0]);
+    brake_step_run_count = run;
+    brake_step_count = 0;
+    app_regs.brake_step_test = BRAKE_STEP_TEST_RUNNING;
+    app_regs.brake_current_setpoint = config[0];
+    memset(app_regs.brake_step_test_results, 0,
+           sizeof(app_regs.brake_step_test_results));
+    app_regs.brake_step_trace_info[0] = samples;
+    app_regs.brake_step_trace_info[1] = BRAKE_STEP_PRE_CONVERSIONS
+                                        >> decimation_log2;
+    app_regs.brake_step_trace_info[2] = period_ns << decimation_log2;
+    app_regs.brake_step_trace_read_index = 0;
+    return true;
+}
+
+void write_brake_step_test(msg_t& msg)
+{
+    const uint8_t action = *((uint8_t*)msg.payload);
+    if (action > 1 || (action == 1 && !start_brake_step_test()))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    if (action == 0 && brake_step_test_running())
+        finish_brake_step_test(BRAKE_STEP_TEST_ABORTED);
+    else if (action == 0)
+        app_regs.brake_step_test = BRAKE_STEP_TEST_IDLE;
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_brake_step_test_config(msg_t& msg)
+{
+    if (brake_step_test_running())
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void read_reg_brake_setpoint_latency_us(uint8_t reg_name)
+{
+    app_regs.brake_setpoint_latency_us[0] = brake_setpoint_latency_us;
+    app_regs.brake_setpoint_latency_us[1] = brake_setpoint_latency_max_us;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void write_brake_step_trace_read_index(msg_t& msg)
+{
+    const uint16_t index = *((uint16_t*)msg.payload);
+    if (index >= StepResponseCapture::CAPACITY)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+// Core1 never writes the capture outside of a test, so core0 can read it
+// freely.
+void read_reg_brake_step_trace(uint8_t reg_name)
+{
+    if (brake_step_test_running())
+    {
+        HarpCore::send_harp_reply(READ_ERROR, reg_name);
+        return;
+    }
+    const uint32_t size = app_regs.brake_step_trace_info[0];
+    const uint32_t index = app_regs.brake_step_trace_read_index;
+    uint32_t count = (index < size) ? size - index : 0;
+    if (count > MAX_BRAKE_STEP_TRACE_SAMPLES_PER_READ)
+        count = MAX_BRAKE_STEP_TRACE_SAMPLES_PER_READ;
+    memcpy(app_regs.brake_step_trace, brake_step_capture.samples() + index,
+           count * sizeof(uint16_t));
+    app_regs.brake_step_trace_read_index += count;
+    HarpCore::send_harp_reply(READ, reg_name,
+                              (uint8_t*)app_regs.brake_step_trace,
+                              count * sizeof(uint16_t), U16);
+}
+
+/**
+ * \brief fold the metrics of the step that was just captured into the
+ *  results.
+ */
+void add_brake_step_results()
+{
+    uint32_t* results = app_regs.brake_step_test_results;
+    const uint32_t latency_us = brake_setpoint_latency_us;
+    if (latency_us > results[1])
+        results[1] = latency_us;
+    step_response_t response;
+    if (!analyze_step_response(brake_step_capture.samples(),
+                               brake_step_capture.size(),
+                               app_regs.brake_step_trace_info[1],
+                               app_regs.brake_step_trace_info[2],
+                               BRAKE_STEP_SETTLING_BAND_PERMILLE, response))
+        return;
+    ++results[0];
+    if (response.rise_time_ns > results[2])
+        results[2] = response.rise_time_ns;
+    if (response.settling_time_ns > results[3])
+        results[3] = response.settling_time_ns;
+    if (response.overshoot_permille > results[4])
+        results[4] = response.overshoot_permille;
+}
+
+// Core1 doesn't touch a full capture until the next step is sent.
+void handle_brake_step_captured(const app_event_t& event)
+{
+    // Ignore captures from a test that has since been stopped or restarted.
+    if (event.brake_step_run != brake_step_run_count
+        || !brake_step_test_running())
+        return;
+    if (brake_step_count > 0)
+        add_brake_step_results();
+    const uint16_t* config = app_regs.brake_step_test_config;
+    if (brake_step_count == config[3])
+    {
+        finish_brake_step_test(BRAKE_STEP_TEST_DONE);
+        return;
+    }
+    ++brake_step_count;
+    // Odd steps go up to the high setpoint; even steps come back down.
+    const uint16_t setpoint = (brake_step_count & 1) ? config[1] : config[0];
+    if (!send_brake_setpoint_cmd(BRAKE_STEP, setpoint))
+    {
+        finish_brake_step_test(BRAKE_STEP_TEST_ABORTED);
+        return;
+    }
+    app_regs.brake_current_setpoint = setpoint;
+}
+
+void handle_trajectory_done(const app_event_t& event)
+{
+    // Ignore completion of a playback that has since been stopped or
+    // restarted.
+    if (!app_regs.brake_trajectory_playback
+        || event.trajectory_run != trajectory_run_count)
+        return;
+    app_regs.brake_trajectory_playback = 0;
+    app_regs.brake_current_setpoint = event.brake_setpoint;
+    if (HarpCore::is_muted())
+        return;
+    const uint8_t address_offset = 34; // brake_trajectory_playback reg.
+    HarpCore::send_harp_reply(EVENT, (APP_REG_START_ADDRESS + address_offset));
+}
+
+void handle_torque_limit_triggered()
+{
     app_regs.brake_current_setpoint = 0;
-    brake_setpoint.write_value(0);
     app_regs.torque_limiting_triggered = 1; //i.e: brake disabled.
+    app_regs.brake_map = 0; // Core1 disables the map on a trip.
+    if (brake_step_test_running())
+        finish_brake_step_test(BRAKE_STEP_TEST_ABORTED);
     if (HarpCore::is_muted())
         return;
     const uint8_t address_offset = 9; // torque_limiting_triggered reg.
     HarpCore::send_harp_reply(EVENT, (APP_REG_START_ADDRESS + address_offset));
 }
 
+/**
+ * \brief (re)arm or disarm the flight recorder, discarding any capture.
+ * \returns false if the command queue is full.
+ */
+bool set_flight_recorder_armed(bool armed)
+{
+    const uint8_t run = flight_recorder_run_count + 1;
+    if (!send_core1_cmd(SET_FLIGHT_RECORDER,
+                        (uint32_t(run) << 24) | uint32_t(armed)))
+        return false;
+    flight_recorder_run_count = run;
+    app_regs.flight_recorder = armed ? FlightRecorder::ARMED
+                                     : FlightRecorder::IDLE;
+    app_regs.flight_recorder_read_index = 0;
+    return true;
+}
+
+void write_flight_recorder(msg_t& msg)
+{
+    const uint8_t action = *((uint8_t*)msg.payload);
+    bool ok = false;
+    if (action < 2)
+        ok = set_flight_recorder_armed(bool(action));
+    // Only an armed recorder can be triggered. It may have been triggered
+    // by a trip already, in which case core1 ignores this.
+    else if (action == 2 && app_regs.flight_recorder == FlightRecorder::ARMED)
+        ok = send_core1_cmd(SET_FLIGHT_RECORDER,
+                            (uint32_t(flight_recorder_run_count) << 24) | 2);
+    if (!ok)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_flight_recorder_window(msg_t& msg)
+{
+    const uint16_t* window = (uint16_t*)msg.payload;
+    if (window[1] == 0
+        || uint32_t(window[0]) + window[1] > FlightRecorder::CAPACITY
+        || !send_core1_cmd(SET_FLIGHT_RECORDER_WINDOW,
+                           (uint32_t(window[1]) << 16) | window[0]))
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_flight_recorder_read_index(msg_t& msg)
+{
+    const uint16_t index = *((uint16_t*)msg.payload);
+    if (index >= FlightRecorder::CAPACITY)
+    {
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+// Core1 never writes a frozen capture, so core0 can read it freely.
+void read_reg_flight_recorder_data(uint8_t reg_name)
+{
+    if (app_regs.flight_recorder != FlightRecorder::FROZEN)
+    {
+        HarpCore::send_harp_reply(READ_ERROR, reg_name);
+        return;
+    }
+    FlightRecorder::record_t records[MAX_FLIGHT_RECORDS_PER_READ];
+    FlightRecorder::record_t trigger_record;
+    flight_recorder.read(flight_recorder.trigger_index(), &trigger_record, 1);
+    const size_t count = flight_recorder.read(
+        app_regs.flight_recorder_read_index, records,
+        MAX_FLIGHT_RECORDS_PER_READ);
+    // Times are sent relative to the trigger sample.
+    for (size_t i = 0; i < count; ++i)
+        records[i].time_us -= trigger_record.time_us;
+    memcpy(app_regs.flight_recorder_data, records,
+           count * sizeof(FlightRecorder::record_t));
+    app_regs.flight_recorder_read_index += count;
+    HarpCore::send_harp_reply(READ, reg_name, app_regs.flight_recorder_data,
+                              count * sizeof(FlightRecorder::record_t), U8);
+}
+
+void read_reg_flight_recorder_capture(uint8_t reg_name)
+{
+    // Both are 0 unless frozen. Core1 may be recording otherwise.
+    const bool frozen = (app_regs.flight_recorder == FlightRecorder::FROZEN);
+    app_regs.flight_recorder_capture[0] = frozen
+                                          ? flight_recorder.num_records() : 0;
+    app_regs.flight_recorder_capture[1] = frozen
+                                          ? flight_recorder.trigger_index() : 0;
+    HarpCore::send_harp_reply(READ, reg_name);
+}
+
+void handle_flight_recorder_event(const app_event_t& event)
+{
+    // Ignore events from a capture that has since been rearmed or disarmed.
+    if (event.flight_recorder_run != flight_recorder_run_count
+        || app_regs.flight_recorder == FlightRecorder::IDLE)
+        return;
+    app_regs.flight_recorder = (event.type == FLIGHT_RECORDER_FROZEN)
+                               ? FlightRecorder::FROZEN
+                               : FlightRecorder::TRIGGERED;
+    if (HarpCore::is_muted())
+        return;
+    const uint8_t address_offset = 55; // flight_recorder reg.
+    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + address_offset,
+                              HarpCore::system_to_harp_us_64(event.time_us));
+}
+
+/**
+ * \brief (re)start the auxiliary analog inputs at the rate in their register.
+ * \details The on-chip ADC oversamples as much as its conversion rate
+ *  allows, and conversions are averaged down to the event rate.
+ * \returns false if the rate was clamped.
+ */
+bool apply_aux_analog_frequency_hz()
+{
+    bool clamped = false;
+    if (app_regs.aux_analog_frequency_hz > MAX_EVENT_FREQUENCY_HZ)
+    {
+        app_regs.aux_analog_frequency_hz = MAX_EVENT_FREQUENCY_HZ;
+        clamped = true;
+    }
+    aux_adc.stop();
+    memset(app_regs.aux_analog_sampling, 0,
+           sizeof(app_regs.aux_analog_sampling));
+    const uint32_t frequency_hz = app_regs.aux_analog_frequency_hz;
+    if (frequency_hz == 0)
+        return !clamped;
+    const uint32_t rounds_per_second = AUX_ANALOG_NUM_INPUTS * frequency_hz;
+    uint32_t decimation = div_u32u32(AUX_ADC_CONVERSION_RATE_HZ,
+                                     rounds_per_second);
+    if (decimation == 0)
+        decimation = 1;
+    if (decimation > ADCDecimator::MAX_DECIMATION)
+        decimation = ADCDecimator::MAX_DECIMATION;
+    aux_adc.set_conversion_rate_hz(rounds_per_second * decimation);
+    aux_analog_decimator.configure(AUX_ANALOG_NUM_INPUTS, decimation);
+    // DMA restarts from the start of the ring with the first input.
+    aux_adc.start();
+    aux_adc_ring.skip(0);
+    aux_adc_next_input = 0;
+    app_regs.aux_analog_sampling[0] = decimation;
+    app_regs.aux_analog_sampling[1] = frequency_hz * decimation;
+    return !clamped;
+}
+
+void write_aux_analog_frequency_hz(msg_t& msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    const msg_type_t msg_reply_type = apply_aux_analog_frequency_hz()
+                                      ? WRITE : WRITE_ERROR;
+    HarpCore::send_harp_reply(msg_reply_type, msg.header.address);
+}
+
+/**
+ * \brief average every new auxiliary analog conversion and send an event
+ *  for each completed set of values.
+ * \details Events are timestamped when they are sent, which is at most one
+ *  core0 loop period after their last conversion.
+ */
+void update_aux_analog()
+{
+    if (!app_regs.aux_analog_frequency_hz)
+        return;
+    const uint32_t write_index = aux_adc_ring.address_to_index(
+        aux_adc.write_address());
+    aux_adc_ring.consume(write_index, [](uint16_t conversion)
+    {
+        const bool updated = aux_analog_decimator.add(aux_adc_next_input,
+                                                      conversion);
+        if (++aux_adc_next_input == AUX_ANALOG_NUM_INPUTS)
+            aux_adc_next_input = 0;
+        if (!updated)
+            return;
+        memcpy(app_regs.aux_analog, aux_analog_decimator.values(),
+               sizeof(app_regs.aux_analog));
+        if (HarpCore::is_muted())
+            return;
+        const uint8_t address_offset = 70; // aux_analog reg.
+        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + address_offset);
+    });
+}
+
 RegFnPair reg_handler_fns[reg_count]
 {
     {&read_reg_encoder_ticks, &HarpCore::write_to_read_only_reg_error},
@@ -265,55 +3273,231 @@ RegFnPair reg_handler_fns[reg_count]
     {&HarpCore::read_reg_generic, &write_brake_current_setpoint},
     {&HarpCore::read_reg_generic, &write_tare},
     {&HarpCore::read_reg_generic, &write_reset_tare},
-    {&HarpCore::read_reg_generic, &HarpCore::write_reg_generic},
-    {&HarpCore::read_reg_generic, &HarpCore::write_reg_generic}
+    {&HarpCore::read_reg_generic, &write_torque_limiting},
+    {&HarpCore::read_reg_generic, &write_torque_limiting_triggered},
+    {&read_reg_sensor_batch, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_sensor_batch_sample_frequency_hz},
+    {&HarpCore::read_reg_generic, &write_sensor_batch_size},
+    {&HarpCore::read_reg_generic, &write_brake_current_control_gains},
+    {&HarpCore::read_reg_generic, &write_brake_current_setpoint_ua},
+    {&HarpCore::read_reg_generic, &write_brake_current_control},
+    {&read_reg_brake_current_control_state, &HarpCore::write_to_read_only_reg_error},
+    {&read_reg_encoder_velocity, &HarpCore::write_to_read_only_reg_error},
+    {&read_reg_encoder_acceleration, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_sensor_data_fields},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&read_reg_torque_limit_trip_latency_us, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_torque_limit_filter_window},
+    {&HarpCore::read_reg_generic, &write_torque_limit_hysteresis},
+    {&read_reg_loop_period_us, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&read_reg_missed_deadlines, &HarpCore::write_to_read_only_reg_error},
+    {&read_reg_torque_check_overruns, &HarpCore::write_to_read_only_reg_error},
+    {&read_reg_usb_tx_backpressure, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_reset_diagnostics},
+    {&HarpCore::read_reg_generic, &write_brake_trajectory_write_index},
+    {&read_reg_brake_trajectory_data, &write_brake_trajectory_data},
+    {&HarpCore::read_reg_generic, &write_brake_trajectory_length},
+    {&HarpCore::read_reg_generic, &write_brake_trajectory_sample_frequency_hz},
+    {&HarpCore::read_reg_generic, &write_brake_trajectory_playback},
+    {&HarpCore::read_reg_generic, &write_brake_map_write_index},
+    {&read_reg_brake_map_data, &write_brake_map_data},
+    {&HarpCore::read_reg_generic, &write_brake_map_config},
+    {&HarpCore::read_reg_generic, &write_brake_map},
+    {&HarpCore::read_reg_generic, &write_virtual_load_params},
+    {&HarpCore::read_reg_generic, &write_virtual_load},
+    {&read_reg_sensors_packed, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_sensor_data_format},
+    {&HarpCore::read_reg_generic, &write_sensor_dispatch_deadband},
+    {&HarpCore::read_reg_generic, &write_sensor_dispatch_heartbeat_ms},
+    {&read_reg_sensors_stats, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_brake_calibration_write_index},
+    {&read_reg_brake_calibration_data, &write_brake_calibration_data},
+    {&HarpCore::read_reg_generic, &write_brake_calibration_config},
+    {&HarpCore::read_reg_generic, &write_brake_calibration_store},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_brake_torque_setpoint},
+    {&HarpCore::read_reg_generic, &write_torque_limits},
+    {&read_reg_persistent_config, &write_persistent_config},
+    {&read_reg_sensor_skew_ns, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_flight_recorder},
+    {&HarpCore::read_reg_generic, &write_flight_recorder_window},
+    {&HarpCore::read_reg_generic, &write_flight_recorder_read_index},
+    {&read_reg_flight_recorder_data, &HarpCore::write_to_read_only_reg_error},
+    {&read_reg_flight_recorder_capture, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_encoder_tare},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_brake_step_test},
+    {&HarpCore::read_reg_generic, &write_brake_step_test_config},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&read_reg_brake_setpoint_latency_us, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_brake_step_trace_read_index},
+    {&read_reg_brake_step_trace, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_aux_analog_frequency_hz},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_sensor_filters},
+    {&read_reg_sensor_filter_cutoff_hz, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error}
     // More handler function pairs here if we add additional registers.
 };
 
 void update_app_state()
 {
-    uint32_t curr_time_us = time_us_32();
-    // Handle periodic safety check.
-    if (int32_t(curr_time_us - next_torque_check_time_us) >= torque_limit_interval_us)
-    {
-        next_torque_check_time_us += torque_limit_interval_us;
-        update_torque_limit_monitor();
-    }
-    // Update encoder count.
-    // (Brake current and Transducer Torque update automatically.)
-    encoder_raw = encoder.fetch_count(); // Get previously-requested count.
-    encoder.request_count(); // request count for the next iteration.
-    if (HarpCore::is_muted() || (app_regs.sensor_dispatch_frequency_hz == 0))
-        return;
-    // Handle periodic sensor register dispatch.
-    if (int32_t(curr_time_us - next_msg_dispatch_time_us) >= dispatch_interval_us)
+    // Track the period between calls. This is the core0 loop period.
+    const uint32_t now_us = time_us_32();
+    const uint32_t loop_period_us = now_us - last_loop_time_us;
+    last_loop_time_us = now_us;
+    if (loop_period_us < loop_period_min_us)
+        loop_period_min_us = loop_period_us;
+    if (loop_period_us > loop_period_max_us)
+        loop_period_max_us = loop_period_us;
+    loop_period_sum_us += loop_period_us;
+    ++loop_count;
+    // Drain everything core1 has produced since the last iteration.
+    app_event_t event;
+    while (core1_events.pop(event))
     {
-        next_msg_dispatch_time_us += dispatch_interval_us;
-        update_sensor_register();
-        const uint8_t address_offset = 3; // "sensors" register address.
-        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + address_offset);
+        if (event.type == TORQUE_LIMIT_TRIGGERED)
+        {
+            handle_torque_limit_triggered();
+            continue;
+        }
+        if (event.type == TRAJECTORY_DONE)
+        {
+            handle_trajectory_done(event);
+            continue;
+        }
+        if (event.type == FLIGHT_RECORDER_TRIGGERED
+            || event.type == FLIGHT_RECORDER_FROZEN)
+        {
+            handle_flight_recorder_event(event);
+            continue;
+        }
+        if (event.type == BRAKE_STEP_CAPTURED)
+        {
+            handle_brake_step_captured(event);
+            continue;
+        }
+        latest_sample = event;
+        // Closed-loop control and trajectory playback update the setpoint on
+        // their own.
+        if ((app_regs.brake_current_control || app_regs.brake_trajectory_playback
+             || app_regs.brake_map)
+            && !app_regs.torque_limiting_triggered)
+            app_regs.brake_current_setpoint = event.brake_setpoint;
+        if (HarpCore::is_muted())
+        {
+            // Restart the packed delta chain once events resume.
+            packed_sensor_data.reset();
+            dispatch_change_trigger.reset();
+            dispatch_interval_stats.clear();
+            continue;
+        }
+        // Handle periodic batched sensor sampling.
+        if (app_regs.sensor_batch_sample_frequency_hz > 0)
+            update_sensor_batch(event);
+        // Handle periodic sensor register dispatch.
+        if (app_regs.sensor_dispatch_frequency_hz > 0)
+        {
+            if (app_regs.sensor_data_format == SENSOR_DATA_FORMAT_STATS)
+            {
+                dispatch_interval_stats.add(IntervalStats::TORQUE,
+                                            event.torque_stats);
+                dispatch_interval_stats.add(IntervalStats::BRAKE_CURRENT,
+                                            event.brake_current_stats);
+            }
+            update_sensor_dispatch(event);
+        }
     }
+    update_aux_analog();
 }
 
 void reset_app()
 {
     app_regs.sensor_dispatch_frequency_hz = 0;
+    app_regs.sensor_data_fields = 0;
+    app_regs.sensor_data_format = SENSOR_DATA_FORMAT_SENSORS;
+    packed_sensor_data.set_use_deltas(false);
+    for (auto& deadband: app_regs.sensor_dispatch_deadband)
+        deadband = 0;
+    app_regs.sensor_dispatch_heartbeat_ms = DEFAULT_SENSOR_DISPATCH_HEARTBEAT_MS;
+    dispatch_change_trigger.set_thresholds(0, 0, 0);
+    dispatch_interval_stats.clear();
+    // The calibration table itself persists across resets.
+    app_regs.brake_calibration_write_index = 0;
+    app_regs.brake_calibration_store = 0;
+    app_regs.brake_torque_setpoint = 0;
+    staged_brake_calibration.copy(brake_calibration);
+    update_brake_calibration_registers();
+    dispatch_change_trigger.set_heartbeat_us(
+        uint32_t(app_regs.sensor_dispatch_heartbeat_ms) * 1000);
     app_regs.tare = 0b111 << 4; // All sensor "untare" bits are set.
-    dispatch_interval_us = 0;
+    app_regs.encoder_tare = 0;
+    dispatch_scheduler.stop();
+    app_regs.sensor_batch_sample_frequency_hz = 0;
+    batch_scheduler.stop();
+    clear_diagnostics();
+    sensor_batch.set_batch_size(SensorBatch::MAX_SAMPLES);
+    app_regs.sensor_batch_size = sensor_batch.batch_size();
     app_regs.brake_current_setpoint = 0;
     app_regs.torque_limiting = 1;
     app_regs.torque_limiting_triggered = 0;
-    brake_setpoint.write_value(app_regs.brake_current_setpoint);
-    // Clear torque and brake current offsets.
-    torque_offset = 0;
-    brake_current_offset = 0;
-    // Zero encoder by saving current position as offset.
-    encoder_offset = encoder.get_count();
-    encoder.request_count(); // Enter update loop by first requesting encoder count.
-    // Clear internal filters
-    filtered_torque = 0;
-    torque_limit_interval_us = 1000; // 1[ms]
-    next_torque_check_time_us = time_us_32();
+    app_regs.brake_trajectory_write_index = 0;
+    app_regs.brake_trajectory_length = 0;
+    app_regs.brake_trajectory_sample_frequency_hz = DEFAULT_TRAJECTORY_FREQUENCY_HZ;
+    app_regs.brake_trajectory_playback = 0;
+    if (BrakeTrajectory* trajectory = back_brake_trajectory())
+        trajectory->set_length(0);
+    app_regs.brake_map = 0;
+    app_regs.virtual_load = 0;
+    memset(app_regs.virtual_load_params, 0, sizeof(app_regs.virtual_load_params));
+    app_regs.brake_map_write_index = 0;
+    memset(app_regs.brake_map_config, 0, sizeof(app_regs.brake_map_config));
+    if (BrakeMap* map = back_brake_map())
+        map->configure(0, 0, 0, false);
+    app_regs.torque_limit_filter_window = DEFAULT_TORQUE_LIMIT_WINDOW;
+    app_regs.torque_limit_hysteresis = DEFAULT_TORQUE_LIMIT_HYSTERESIS;
+    app_regs.torque_limits[0] = RAW_TORQUE_SENSOR_MIN;
+    app_regs.torque_limits[1] = RAW_TORQUE_SENSOR_MAX;
+    app_regs.persistent_config = 0;
+    app_regs.brake_current_control = 0;
+    app_regs.brake_current_setpoint_ua = 0;
+    app_regs.brake_current_control_gains[0] = DEFAULT_BRAKE_CURRENT_KP_Q8;
+    app_regs.brake_current_control_gains[1] = DEFAULT_BRAKE_CURRENT_KI_Q8;
+    app_regs.flight_recorder_window[0] = DEFAULT_FLIGHT_RECORDER_PRE_SAMPLES;
+    app_regs.flight_recorder_window[1] = DEFAULT_FLIGHT_RECORDER_POST_SAMPLES;
+    memset(app_regs.flight_recorder_capture, 0,
+           sizeof(app_regs.flight_recorder_capture));
+    app_regs.brake_step_test = BRAKE_STEP_TEST_IDLE;
+    app_regs.brake_step_test_config[0] = DEFAULT_BRAKE_STEP_LOW;
+    app_regs.brake_step_test_config[1] = DEFAULT_BRAKE_STEP_HIGH;
+    app_regs.brake_step_test_config[2] = DEFAULT_BRAKE_STEP_HOLD_MS;
+    app_regs.brake_step_test_config[3] = DEFAULT_BRAKE_STEP_COUNT;
+    memset(app_regs.brake_step_test_results, 0,
+           sizeof(app_regs.brake_step_test_results));
+    app_regs.brake_step_trace_read_index = 0;
+    memset(app_regs.brake_step_trace_info, 0,
+           sizeof(app_regs.brake_step_trace_info));
+    app_regs.aux_analog_frequency_hz = 0;
+    apply_aux_analog_frequency_hz();
+    memset(app_regs.sensor_filters, 0, sizeof(app_regs.sensor_filters));
+    memset(app_regs.aux_analog, 0, sizeof(app_regs.aux_analog));
+    // Core1 clears the brake, offsets, filters, and controller to match.
+    // Retry until there's room since a reset must not be dropped.
+    while (!send_core1_cmd(RESET))
+        tight_loop_contents();
+    // Always capture trips.
+    while (!set_flight_recorder_armed(true))
+        tight_loop_contents();
+    // Warm start from the saved configuration, if any.
+    const persistent_config_t* config = saved_persistent_config();
+    if (config == nullptr)
+        return;
+    while (core1_cmds.capacity() - core1_cmds.size() < PERSISTENT_CONFIG_CMD_COUNT)
+        tight_loop_contents();
+    apply_persistent_config(*config);
 }
 
 // Create Core.
@@ -338,15 +3522,83 @@ int main()
     HarpSynchronizer::init(uart1, HARP_SYNC_RX_PIN);
     app.set_synchronizer(&HarpSynchronizer::instance());
     //app.set_visual_indicators_fn(set_led_state);
-    // Init PIO encoder on pins 0 and 1.
+    // Boot-time micro-benchmarks for registers 52, 93 and 106. Nothing else
+    // runs yet, so they leave out the IRQ load and bus contention of the
+    // running device.
+    // Measure a blocking encoder count request before streaming it.
+    const uint32_t blocking_read_cycles = measure_mean_cycles([](){
+        volatile uint32_t count = encoder.get_count(); (void)count;});
+    // Stream the encoder count to memory via DMA.
+    encoder.setup_dma_stream_to_memory(&encoder_stream,
+                                       ENCODER_COUNT_REQUEST_FREQUENCY_HZ);
+    const uint32_t streamed_read_cycles = measure_mean_cycles([](){
+        volatile uint32_t count = encoder_stream; (void)count;});
+    app_regs.encoder_read_cycles_saved =
+        (blocking_read_cycles > streamed_read_cycles)
+        ? blocking_read_cycles - streamed_read_cycles
+        : 0;
+    // Additional encoders are read in one batch per sample. Compare with
+    // reading them one at a time.
+    if (NUM_ENCODERS > 1)
+    {
+        const uint32_t loop_cycles = measure_mean_cycles([](){});
+        const uint32_t batched_cycles = measure_mean_cycles([](){
+            uint32_t counts[NUM_ENCODERS];
+            encoder.get_counts(counts, 1);
+            volatile uint32_t count = counts[0]; (void)count;});
+        const uint32_t sequential_cycles = measure_mean_cycles([](){
+            for (uint32_t i = 1; i < NUM_ENCODERS; ++i)
+            {
+                volatile uint32_t count = encoder.get_count(i); (void)count;
+            }});
+        app_regs.aux_encoder_read_cycles[0] = batched_cycles - loop_cycles;
+        app_regs.aux_encoder_read_cycles[1] = sequential_cycles - loop_cycles;
+    }
+    // Cost of a sensor filter: every conversion of one decimation period,
+    // with and without the biquads.
+    {
+        static SensorFilter filter;
+        const auto filter_period = [](){
+            for (uint32_t i = 0; i < SensorFilter::DECIMATION; ++i)
+                filter.add(2048);
+            volatile int32_t output = filter.output(); (void)output;};
+        const uint32_t loop_cycles = measure_mean_cycles([](){});
+        filter.set_sections(nullptr);
+        const uint32_t average_cycles = measure_mean_cycles(filter_period);
+        filter.set_sections(SENSOR_FILTER_PRESETS[NUM_SENSOR_FILTER_PRESETS - 1].sections);
+        const uint32_t filter_cycles = measure_mean_cycles(filter_period);
+        app_regs.sensor_filter_cycles[0] =
+            (filter_cycles - loop_cycles) / SensorFilter::DECIMATION;
+        app_regs.sensor_filter_cycles[1] = filter_cycles - average_cycles;
+    }
     // Init PIO-based ADC with continuous streaming to memory via DMA.
-    current_sensor.setup_dma_stream_to_memory((uint16_t*)&brake_current_raw, 1);
-    reaction_torque_sensor.setup_dma_stream_to_memory((uint16_t*)&torque_raw, 1);
+    // DMA restarts at the beginning of each buffer once it reaches the end.
+    current_sensor.setup_dma_stream_to_memory(brake_current_ring.buffer(),
+                                              brake_current_ring.size());
+    reaction_torque_sensor.setup_dma_stream_to_memory(torque_ring.buffer(),
+                                                      torque_ring.size());
+    brake_current_dma_chan = find_dma_channel_writing_to(
+        brake_current_ring.buffer(), brake_current_ring.size_bytes());
+    torque_dma_chan = find_dma_channel_writing_to(torque_ring.buffer(),
+                                                  torque_ring.size_bytes());
+    // The on-chip ADC only runs while auxiliary analog events are enabled.
+    aux_adc.setup_dma_stream_to_memory(aux_adc_ring.buffer(),
+                                       aux_adc_ring.size());
     // Start PIO-connected hardware.
     current_sensor.start();
     reaction_torque_sensor.start();
     brake_setpoint.start();
+    // Find the saved configuration. Erase ahead of the next save now, while
+    // nothing else is running.
+    persistent_config_store.init();
+    persistent_config_store.service_erase();
+    // Load the brake calibration table, if one was stored.
+    brake_calibration.load(*(const BrakeCalibration::record_t*)(
+        XIP_BASE + BRAKE_CALIBRATION_FLASH_OFFSET));
     reset_app(); // Apply app register starting values.
+    // Sensing, safety, and control run on core1 from here onward.
+    multicore_launch_core1(core1_main);
+    core1_started = true;
     while(true)
         app.run();
 }
@@ -0,0 +1,109 @@
+#include <packed_sensor_data.h>
+
+namespace
+{
+constexpr int32_t S12_MIN = -2048;
+constexpr int32_t S12_MAX = 2047;
+constexpr uint32_t U12_MASK = 0xFFF;
+
+uint32_t to_12_bits(int16_t value, bool is_signed)
+{
+    int32_t clamped = value;
+    const int32_t min = is_signed ? S12_MIN : 0;
+    const int32_t max = is_signed ? S12_MAX : int32_t(U12_MASK);
+    if (clamped < min)
+        clamped = min;
+    else if (clamped > max)
+        clamped = max;
+    return uint32_t(clamped) & U12_MASK;
+}
+
+int16_t from_12_bits(uint32_t bits, bool is_signed)
+{
+    bits &= U12_MASK;
+    if (is_signed && (bits & 0x800))
+        return int16_t(int32_t(bits) - 4096);
+    return int16_t(bits);
+}
+}
+
+PackedSensorData::PackedSensorData()
+:previous_encoder_ticks_{0}, has_previous_{false}, use_deltas_{false}
+{}
+
+PackedSensorData::~PackedSensorData()
+{}
+
+void PackedSensorData::set_use_deltas(bool use_deltas)
+{
+    use_deltas_ = use_deltas;
+    has_previous_ = false;
+}
+
+size_t PackedSensorData::pack(uint8_t* dest, int32_t encoder_ticks,
+                              int16_t reaction_torque, bool torque_signed,
+                              int16_t brake_current, bool brake_current_signed)
+{
+    uint8_t header = VERSION;
+    if (torque_signed)
+        header |= TORQUE_SIGNED_FLAG;
+    if (brake_current_signed)
+        header |= BRAKE_CURRENT_SIGNED_FLAG;
+    size_t size = 1;
+    // Wrapping difference, so a delta across the int32 wrap is still valid.
+    const int32_t delta = int32_t(uint32_t(encoder_ticks)
+                                  - uint32_t(previous_encoder_ticks_));
+    if (use_deltas_ && has_previous_ && delta >= INT16_MIN && delta <= INT16_MAX)
+    {
+        header |= ENCODER_DELTA_FLAG;
+        dest[size++] = uint8_t(delta);
+        dest[size++] = uint8_t(delta >> 8);
+    }
+    else
+    {
+        for (size_t i = 0; i < sizeof(int32_t); ++i)
+            dest[size++] = uint8_t(uint32_t(encoder_ticks) >> (8 * i));
+    }
+    const uint32_t analog = to_12_bits(reaction_torque, torque_signed)
+                            | (to_12_bits(brake_current, brake_current_signed) << 12);
+    dest[size++] = uint8_t(analog);
+    dest[size++] = uint8_t(analog >> 8);
+    dest[size++] = uint8_t(analog >> 16);
+    dest[0] = header;
+    previous_encoder_ticks_ = encoder_ticks;
+    has_previous_ = true;
+    return size;
+}
+
+size_t PackedSensorData::unpack(const uint8_t* src, size_t num_bytes,
+                                int32_t& encoder_ticks,
+                                int16_t& reaction_torque,
+                                int16_t& brake_current)
+{
+    if (num_bytes < 1 || (src[0] & VERSION_MASK) != VERSION)
+        return 0;
+    const uint8_t header = src[0];
+    const bool is_delta = header & ENCODER_DELTA_FLAG;
+    const size_t size = 1 + (is_delta ? sizeof(int16_t) : sizeof(int32_t)) + 3;
+    if (num_bytes < size)
+        return 0;
+    size_t i = 1;
+    if (is_delta)
+    {
+        const int16_t delta = int16_t(uint16_t(src[1]) | (uint16_t(src[2]) << 8));
+        encoder_ticks = int32_t(uint32_t(encoder_ticks) + uint32_t(int32_t(delta)));
+        i += sizeof(int16_t);
+    }
+    else
+    {
+        encoder_ticks = int32_t(uint32_t(src[1]) | (uint32_t(src[2]) << 8)
+                                | (uint32_t(src[3]) << 16)
+                                | (uint32_t(src[4]) << 24));
+        i += sizeof(int32_t);
+    }
+    const uint32_t analog = uint32_t(src[i]) | (uint32_t(src[i + 1]) << 8)
+                            | (uint32_t(src[i + 2]) << 16);
+    reaction_torque = from_12_bits(analog, header & TORQUE_SIGNED_FLAG);
+    brake_current = from_12_bits(analog >> 12, header & BRAKE_CURRENT_SIGNED_FLAG);
+    return size;
+}
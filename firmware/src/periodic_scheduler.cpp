@@ -0,0 +1,50 @@
+#include <periodic_scheduler.h>
+
+PeriodicScheduler::PeriodicScheduler()
+:next_deadline_us_{0}, period_us_{0}, running_{false}
+{
+    clear_stats();
+}
+
+PeriodicScheduler::~PeriodicScheduler()
+{}
+
+uint64_t PeriodicScheduler::start(uint64_t now_us, uint32_t period_us)
+{
+    period_us_ = period_us;
+    next_deadline_us_ = now_us + period_us_;
+    running_ = true;
+    return next_deadline_us_;
+}
+
+uint64_t PeriodicScheduler::service(uint64_t now_us)
+{
+    const uint32_t lateness_us = (now_us > next_deadline_us_)
+                                 ? uint32_t(now_us - next_deadline_us_)
+                                 : 0;
+    last_lateness_us_ = lateness_us;
+    if (lateness_us > max_lateness_us_)
+        max_lateness_us_ = lateness_us;
+    ++serviced_count_;
+    next_deadline_us_ += period_us_;
+    return skip_to(now_us);
+}
+
+uint64_t PeriodicScheduler::skip_to(uint64_t now_us)
+{
+    // Usually zero or one iteration, so avoid a (slow) 64-bit divide.
+    while (next_deadline_us_ <= now_us)
+    {
+        next_deadline_us_ += period_us_;
+        ++missed_count_;
+    }
+    return next_deadline_us_;
+}
+
+void PeriodicScheduler::clear_stats()
+{
+    serviced_count_ = 0;
+    missed_count_ = 0;
+    last_lateness_us_ = 0;
+    max_lateness_us_ = 0;
+}
@@ -3,33 +3,103 @@
 
 PIOEncoder::PIOEncoder(PIO pio, uint32_t state_machine_id,
                        uint8_t ab_base_pin)
-:pio_{pio}, sm_{state_machine_id}, pin_a_{ab_base_pin}, pin_b_{ab_base_pin + 1}
+:PIOEncoder(pio, state_machine_id, &ab_base_pin, 1)
+{}
+
+PIOEncoder::PIOEncoder(PIO pio, uint32_t base_state_machine_id,
+                       const uint8_t* ab_base_pins, uint32_t num_encoders)
+:pio_{pio}, sm_{base_state_machine_id},
+ num_encoders_{base_state_machine_id >= MAX_ENCODERS ? 0
+               : num_encoders > MAX_ENCODERS - base_state_machine_id
+               ? MAX_ENCODERS - base_state_machine_id : num_encoders},
+ count_request_{1}, streaming_{false}
 {
     // TODO: ensure state of PIO hardware is compatible with this program.
     // i.e: FIFO has not been joined, state machine is unused, etc.
-    // This program must be loaded at offset 0.
+    // This program must be loaded at offset 0. All encoders share it.
     pio_add_program_at_offset(pio_, &quadrature_encoder_program, 0);
-    quadrature_encoder_program_init(pio_, sm_, 0, ab_base_pin, 0);
+    for (uint32_t i = 0; i < num_encoders_; ++i)
+        quadrature_encoder_program_init(pio_, sm_ + i, 0, ab_base_pins[i], 0);
 }
 
 PIOEncoder::~PIOEncoder()
 {
+    if (streaming_)
+    {
+        for (uint i = 0; i < 2; ++i)
+        {
+            dma_channel_abort(request_chan_[i]);
+            dma_channel_abort(reply_chan_[i]);
+            dma_channel_unclaim(request_chan_[i]);
+            dma_channel_unclaim(reply_chan_[i]);
+        }
+        dma_timer_unclaim(dma_timer_);
+    }
     pio_remove_program(pio_, &quadrature_encoder_program, 0);
     // TODO: unit GPIO pins?
 }
 
-void PIOEncoder::request_count()
+void PIOEncoder::setup_dma_stream_to_memory(volatile uint32_t* address,
+                                            uint32_t request_rate_hz)
+{
+    // Pace requests at clk_sys * 1/N.
+    dma_timer_ = dma_claim_unused_timer(true);
+    const uint32_t divisor = clock_get_hz(clk_sys) / request_rate_hz;
+    dma_timer_set_fraction(dma_timer_, 1, divisor > 0xFFFF? 0xFFFF: divisor);
+    for (uint i = 0; i < 2; ++i)
+    {
+        request_chan_[i] = dma_claim_unused_channel(true);
+        reply_chan_[i] = dma_claim_unused_channel(true);
+    }
+    // The hardware reloads each channel's transfer count from the last value
+    // written whenever it is re-triggered, and neither address increments, so
+    // each pair can bounce between its two channels forever as-configured.
+    for (uint i = 0; i < 2; ++i)
+    {
+        dma_channel_config c = dma_channel_get_default_config(request_chan_[i]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, dma_get_timer_dreq(dma_timer_));
+        channel_config_set_chain_to(&c, request_chan_[i ^ 1]);
+        dma_channel_configure(request_chan_[i], &c, &pio_->txf[sm_],
+                              &count_request_, 0xFFFFFFFF, false);
+
+        c = dma_channel_get_default_config(reply_chan_[i]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, pio_get_dreq(pio_, sm_, false));
+        channel_config_set_chain_to(&c, reply_chan_[i ^ 1]);
+        dma_channel_configure(reply_chan_[i], &c, address, &pio_->rxf[sm_],
+                              0xFFFFFFFF, false);
+    }
+    // Discard any replies to earlier requests.
+    pio_sm_clear_fifos(pio_, sm_);
+    streaming_ = true;
+    // Start the reply stream first so that no reply is ever left waiting.
+    dma_channel_start(reply_chan_[0]);
+    dma_channel_start(request_chan_[0]);
+}
+
+void PIOEncoder::request_count(uint32_t index)
+{
+    return quadrature_encoder_request_count(pio_, sm_ + index);
+}
+
+uint32_t PIOEncoder::fetch_count(uint32_t index)
 {
-    return quadrature_encoder_request_count(pio_, sm_);
+    return quadrature_encoder_fetch_count(pio_, sm_ + index);
 }
 
-uint32_t PIOEncoder::fetch_count()
+uint32_t PIOEncoder::get_count(uint32_t index)
 {
-    return quadrature_encoder_fetch_count(pio_, sm_);
+    return quadrature_encoder_get_count(pio_, sm_ + index);
 }
 
-uint32_t PIOEncoder::get_count()
+void PIOEncoder::get_counts(uint32_t* counts, uint32_t first)
 {
-    return quadrature_encoder_get_count(pio_, sm_);
+    request_counts(first);
+    fetch_counts(counts, first);
 }
 
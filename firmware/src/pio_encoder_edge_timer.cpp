@@ -0,0 +1,18 @@
+#include <pio_encoder_edge_timer.h>
+
+
+PIOEncoderEdgeTimer::PIOEncoderEdgeTimer(PIO pio, uint8_t pin_a)
+:pio_{pio}
+{
+    sm_ = pio_claim_unused_sm(pio_, true);
+    offset_ = pio_add_program(pio_, &encoder_edge_timer_program);
+    encoder_edge_timer_program_init(pio_, sm_, offset_, pin_a);
+    tick_hz_ = encoder_edge_timer_tick_hz();
+}
+
+PIOEncoderEdgeTimer::~PIOEncoderEdgeTimer()
+{
+    pio_sm_set_enabled(pio_, sm_, false);
+    pio_remove_program(pio_, &encoder_edge_timer_program, offset_);
+    pio_sm_unclaim(pio_, sm_);
+}
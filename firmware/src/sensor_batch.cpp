@@ -0,0 +1,56 @@
+#include <sensor_batch.h>
+#include <cstring>
+
+
+SensorBatch::SensorBatch()
+:start_time_us_{0}, num_samples_{0}, batch_size_{MAX_SAMPLES}
+{}
+
+SensorBatch::~SensorBatch()
+{}
+
+bool SensorBatch::set_batch_size(uint8_t num_samples)
+{
+    bool in_range = true;
+    if (num_samples < 1)
+    {
+        num_samples = 1;
+        in_range = false;
+    }
+    else if (num_samples > MAX_SAMPLES)
+    {
+        num_samples = MAX_SAMPLES;
+        in_range = false;
+    }
+    batch_size_ = num_samples;
+    clear();
+    return in_range;
+}
+
+bool SensorBatch::add_sample(uint64_t time_us, int32_t encoder_ticks,
+                             int16_t reaction_torque, int16_t brake_current)
+{
+    if (is_full())
+        return false;
+    if (num_samples_ == 0)
+        start_time_us_ = time_us;
+    else if ((time_us - start_time_us_) > UINT16_MAX)
+        return false;
+    batch_sample_t& sample = samples_[num_samples_++];
+    sample.time_offset_us = uint16_t(time_us - start_time_us_);
+    sample.encoder_ticks = encoder_ticks;
+    sample.reaction_torque = reaction_torque;
+    sample.brake_current = brake_current;
+    return true;
+}
+
+uint8_t SensorBatch::decode(const uint8_t* payload, size_t num_bytes,
+                            batch_sample_t* samples, uint8_t max_samples)
+{
+    size_t num_samples = num_bytes / sizeof(batch_sample_t);
+    if (num_samples > max_samples)
+        num_samples = max_samples;
+    // memcpy since the payload may not be aligned.
+    memcpy(samples, payload, num_samples * sizeof(batch_sample_t));
+    return uint8_t(num_samples);
+}
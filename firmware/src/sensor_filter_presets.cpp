@@ -0,0 +1,68 @@
+#include <sensor_filter_presets.h>
+
+// Butterworth lowpass sections, designed with the bilinear transform
+// (prewarped at the cutoff) and quantized to Q2.29. b0 and b2 are rounded
+// from the quantized a1 and a2, and b1 takes up the remainder, so that each
+// section's DC gain is exactly 1. Regenerate with
+// sensor_filter_bench --print-presets.
+namespace
+{
+// 20.0%
+const biquad_coefficients_t BUTTERWORTH_200000_PPM[SENSOR_FILTER_SECTIONS] =
+{
+    {98732168, 197464337, 98732168, -176617472, 34675233},
+    {135990214, 271980428, 135990214, -243266690, 250356634}
+};
+
+// 10.0%
+const biquad_coefficients_t BUTTERWORTH_100000_PPM[SENSOR_FILTER_SECTIONS] =
+{
+    {33224361, 66448723, 33224361, -562962611, 158989144},
+    {41852492, 83704983, 41852492, -709159998, 339699053}
+};
+
+// 5.0%
+const biquad_coefficients_t BUTTERWORTH_50000_PPM[SENSOR_FILTER_SECTIONS] =
+{
+    {10220321, 20440643, 10220321, -794394046, 298404419},
+    {11748804, 23497606, 11748804, -913198272, 423322574}
+};
+
+// 2.0%
+const biquad_coefficients_t BUTTERWORTH_20000_PPM[SENSOR_FILTER_SECTIONS] =
+{
+    {1897031, 3794063, 1897031, -954724784, 425441997},
+    {2019817, 4039635, 2019817, -1016519761, 487728118}
+};
+
+// 1.0%
+const biquad_coefficients_t BUTTERWORTH_10000_PPM[SENSOR_FILTER_SECTIONS] =
+{
+    {500653, 1001305, 500653, -1012865807, 477997506},
+    {517267, 1034533, 517267, -1046477349, 511675504}
+};
+
+// 0.5%
+const biquad_coefficients_t BUTTERWORTH_5000_PPM[SENSOR_FILTER_SECTIONS] =
+{
+    {128721, 257442, 128721, -1042945959, 506589931},
+    {130884, 261766, 130884, -1060464810, 524117432}
+};
+}
+
+const sensor_filter_preset_t SENSOR_FILTER_PRESETS[] =
+{
+    {0, nullptr}, // Off.
+    // Moving average alone. Its -3[dB] frequency is 0.443 of the decimated
+    // rate for a decimation of 16 or more.
+    {443'000, nullptr},
+    {200'000, BUTTERWORTH_200000_PPM},
+    {100'000, BUTTERWORTH_100000_PPM},
+    {50'000, BUTTERWORTH_50000_PPM},
+    {20'000, BUTTERWORTH_20000_PPM},
+    {10'000, BUTTERWORTH_10000_PPM},
+    {5'000, BUTTERWORTH_5000_PPM}
+};
+
+const uint32_t NUM_SENSOR_FILTER_PRESETS =
+    sizeof(SENSOR_FILTER_PRESETS) / sizeof(SENSOR_FILTER_PRESETS[0]);
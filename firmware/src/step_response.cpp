@@ -0,0 +1,107 @@
+#include <step_response.h>
+
+namespace
+{
+/**
+ * \brief time of a number of sample periods, saturating short of UINT32_MAX.
+ */
+uint32_t samples_to_ns(size_t num_samples, uint32_t sample_period_ns)
+{
+    const uint64_t time_ns = uint64_t(num_samples) * sample_period_ns;
+    return (time_ns < UINT32_MAX) ? uint32_t(time_ns) : UINT32_MAX - 1;
+}
+}
+
+StepResponseCapture::StepResponseCapture()
+{
+    stop();
+}
+
+StepResponseCapture::~StepResponseCapture()
+{}
+
+bool StepResponseCapture::start(uint32_t num_samples, uint32_t decimation_log2)
+{
+    stop();
+    if (num_samples == 0 || num_samples > CAPACITY
+        || decimation_log2 > MAX_DECIMATION_LOG2)
+        return false;
+    decimation_log2_ = decimation_log2;
+    num_samples_ = num_samples;
+    return true;
+}
+
+void StepResponseCapture::stop()
+{
+    num_samples_ = 0;
+    size_ = 0;
+    decimation_log2_ = 0;
+    group_count_ = 0;
+    sum_ = 0;
+}
+
+bool analyze_step_response(const uint16_t* samples, size_t count,
+                           size_t step_index, uint32_t sample_period_ns,
+                           uint32_t settling_band_permille,
+                           step_response_t& result)
+{
+    if (step_index == 0 || step_index >= count)
+        return false;
+    // Initial value and noise before the step.
+    int32_t sum = 0;
+    int32_t min = samples[0];
+    int32_t max = samples[0];
+    for (size_t i = 0; i < step_index; ++i)
+    {
+        const int32_t sample = samples[i];
+        sum += sample;
+        min = (sample < min) ? sample : min;
+        max = (sample > max) ? sample : max;
+    }
+    result.initial = sum / int32_t(step_index);
+    // Final value.
+    size_t tail = (count - step_index) / 10;
+    tail = (tail > 0) ? tail : 1;
+    sum = 0;
+    for (size_t i = count - tail; i < count; ++i)
+        sum += samples[i];
+    result.final = sum / int32_t(tail);
+    // Work with a rising step of size step from here on.
+    const int32_t sign = (result.final < result.initial) ? -1 : 1;
+    const int32_t step = sign * (result.final - result.initial);
+    if (step == 0 || step <= max - min)
+        return false;
+    const int32_t band = int32_t((int64_t(step) * settling_band_permille)
+                                 / 1000);
+    size_t rise_start = count;
+    size_t rise_end = count;
+    size_t last_unsettled = count;
+    int32_t peak = 0;
+    for (size_t i = step_index; i < count; ++i)
+    {
+        const int32_t value = sign * (int32_t(samples[i]) - result.initial);
+        if (rise_start == count && value * 10 >= step)
+            rise_start = i;
+        if (rise_end == count && value * 10 >= step * 9)
+            rise_end = i;
+        peak = (value > peak) ? value : peak;
+        const int32_t error = value - step;
+        if (error > band || error < -band)
+            last_unsettled = i;
+    }
+    result.rise_time_ns = (rise_end < count)
+                          ? samples_to_ns(rise_end - rise_start,
+                                          sample_period_ns)
+                          : UINT32_MAX;
+    if (last_unsettled == count)
+        result.settling_time_ns = 0;
+    else if (last_unsettled >= count - tail)
+        result.settling_time_ns = UINT32_MAX;
+    else
+        result.settling_time_ns = samples_to_ns(last_unsettled + 1 - step_index,
+                                                sample_period_ns);
+    result.overshoot_permille = (peak > step)
+                                ? uint32_t((int64_t(peak - step) * 1000) / step)
+                                : 0;
+    return true;
+}
@@ -0,0 +1,125 @@
+#include <stream_period_estimator.h>
+
+StreamPeriodEstimator::StreamPeriodEstimator(uint32_t index_mask,
+                                             uint32_t window_us,
+                                             uint32_t jitter_ns)
+:index_mask_{index_mask}, window_us_{window_us}, jitter_ns_{jitter_ns},
+ last_time_us_{0}, last_index_{0}, elapsed_us_{0}, num_samples_{0},
+ period_ns_{0}, total_elapsed_us_{0}, total_samples_{0}, period_ps_{0},
+ period_error_ps_{0}, tracking_{false}, min_age_ps_{0}, max_age_ps_{0}
+{}
+
+StreamPeriodEstimator::~StreamPeriodEstimator()
+{}
+
+void StreamPeriodEstimator::reset(uint64_t time_us, uint32_t write_index)
+{
+    last_time_us_ = time_us;
+    last_index_ = write_index & index_mask_;
+    elapsed_us_ = 0;
+    num_samples_ = 0;
+    period_ns_ = 0;
+    total_elapsed_us_ = 0;
+    total_samples_ = 0;
+    period_ps_ = 0;
+    tracking_ = false;
+}
+
+void StreamPeriodEstimator::update(uint64_t time_us, uint32_t write_index)
+{
+    write_index &= index_mask_;
+    const uint32_t new_samples = (write_index - last_index_) & index_mask_;
+    const uint32_t interval_us = uint32_t(time_us - last_time_us_);
+    num_samples_ += new_samples;
+    elapsed_us_ += interval_us;
+    last_index_ = write_index;
+    last_time_us_ = time_us;
+    track_latest_sample(interval_us, new_samples);
+    if (elapsed_us_ < window_us_)
+        return;
+    period_ns_ = (num_samples_ == 0)
+        ? elapsed_us_ * 1000
+        : uint32_t((uint64_t(elapsed_us_) * 1000 + num_samples_ / 2)
+                   / num_samples_);
+    if (num_samples_ == 0)
+    {
+        // Stalled. Find the grid again once it restarts.
+        total_elapsed_us_ = 0;
+        total_samples_ = 0;
+        period_ps_ = 0;
+        tracking_ = false;
+    }
+    else
+    {
+        total_elapsed_us_ += elapsed_us_;
+        total_samples_ += num_samples_;
+        // Halving both keeps the period while bounding the sums.
+        if (total_elapsed_us_ >= (1ull << 32))
+        {
+            total_elapsed_us_ /= 2;
+            total_samples_ /= 2;
+        }
+        period_ps_ = total_elapsed_us_ * 1'000'000 / total_samples_;
+        // The count over the total is off by up to a sample and the jitter
+        // at either end. Doubled for margin, plus rounding.
+        const uint64_t period_ns = period_ps_ / 1000;
+        period_error_ps_ = 2 * period_ns * (period_ns + jitter_ns_)
+                           / total_elapsed_us_ + 1;
+    }
+    elapsed_us_ = 0;
+    num_samples_ = 0;
+}
+
+void StreamPeriodEstimator::track_latest_sample(uint32_t interval_us,
+                                                uint32_t new_samples)
+{
+    if (period_ps_ == 0)
+        return;
+    const int64_t interval_ps = int64_t(interval_us) * 1'000'000;
+    const int64_t period_ps = int64_t(period_ps_);
+    const int64_t jitter_ps = int64_t(jitter_ns_) * 1000;
+    // Where this observation alone places the latest sample: arrived by now,
+    // and recently enough that the next has not. If it arrived since the
+    // last observation, after that too.
+    int64_t min_age_ps = 0;
+    int64_t max_age_ps = period_ps + jitter_ps;
+    if (new_samples > 0 && interval_ps + jitter_ps < max_age_ps)
+        max_age_ps = interval_ps + jitter_ps;
+    if (tracking_)
+    {
+        // Where the last bounds place it, new_samples periods on.
+        const int64_t shift_ps = interval_ps - int64_t(new_samples) * period_ps;
+        const int64_t spread_ps = int64_t(new_samples)
+                                  * int64_t(period_error_ps_);
+        const int64_t carried_min_ps = min_age_ps_ + shift_ps - spread_ps;
+        const int64_t carried_max_ps = max_age_ps_ + shift_ps + spread_ps;
+        // If they disagree, the stream slipped. Start over from here.
+        if (carried_min_ps <= max_age_ps && carried_max_ps >= min_age_ps)
+        {
+            if (carried_min_ps > min_age_ps)
+                min_age_ps = carried_min_ps;
+            if (carried_max_ps < max_age_ps)
+                max_age_ps = carried_max_ps;
+        }
+    }
+    min_age_ps_ = min_age_ps;
+    max_age_ps_ = max_age_ps;
+    tracking_ = true;
+}
+
+uint32_t StreamPeriodEstimator::min_age_ns() const
+{
+    if (!tracking_)
+        return 0;
+    // The latest sample may have arrived after its place on the grid.
+    const int64_t jitter_ps = int64_t(jitter_ns_) * 1000;
+    return (min_age_ps_ > jitter_ps)
+        ? uint32_t((min_age_ps_ - jitter_ps) / 1000) : 0;
+}
+
+uint32_t StreamPeriodEstimator::max_age_ns() const
+{
+    if (!tracking_)
+        return period_ns_;
+    return uint32_t((max_age_ps_ + 999) / 1000);
+}
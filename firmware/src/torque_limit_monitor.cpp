@@ -0,0 +1,98 @@
+#include <torque_limit_monitor.h>
+
+TorqueLimitMonitor::TorqueLimitMonitor()
+:min_{INT32_MIN}, max_{INT32_MAX}, hysteresis_{0}, window_shift_{0},
+ enabled_{false}
+{
+    reset();
+}
+
+TorqueLimitMonitor::~TorqueLimitMonitor()
+{}
+
+bool TorqueLimitMonitor::set_window(uint32_t window)
+{
+    if (!is_valid_window(window))
+        return false;
+    window_shift_ = 0;
+    while ((1u << window_shift_) < window)
+        ++window_shift_;
+    clear_filter();
+    return true;
+}
+
+void TorqueLimitMonitor::set_enabled(bool enabled)
+{
+    enabled_ = enabled;
+    in_excursion_ = false;
+}
+
+void TorqueLimitMonitor::clear_filter()
+{
+    sum_ = 0;
+    index_ = 0;
+    primed_ = false;
+}
+
+void TorqueLimitMonitor::reset()
+{
+    clear_filter();
+    excursion_start_us_ = 0;
+    in_excursion_ = false;
+    tripped_ = false;
+}
+
+bool TorqueLimitMonitor::add_sample(int32_t raw, uint32_t time_us)
+{
+    const uint32_t window = 1u << window_shift_;
+    // Fill the whole window with the first sample rather than averaging in
+    // zeros, which could trip on the low limit.
+    if (!primed_)
+    {
+        for (uint32_t i = 0; i < window; ++i)
+            samples_[i] = raw;
+        sum_ = raw << window_shift_;
+        index_ = 0;
+        primed_ = true;
+    }
+    else
+    {
+        sum_ += raw - samples_[index_];
+        samples_[index_] = raw;
+        index_ = (index_ + 1) & (window - 1);
+    }
+    if (!enabled_ || tripped_)
+        return false;
+    const int32_t mean = filtered();
+    const bool raw_in_range = (raw > min_) && (raw < max_);
+    const bool mean_in_range = (mean > min_) && (mean < max_);
+    // Track the first out-of-range sample of the current excursion.
+    if (!raw_in_range && !in_excursion_)
+    {
+        in_excursion_ = true;
+        excursion_start_us_ = time_us;
+    }
+    else if (raw_in_range && mean_in_range)
+        in_excursion_ = false;
+    if (mean_in_range)
+        return false;
+    // The mean can only leave the range if a raw sample in the window did,
+    // but that sample may predate enabling the monitor.
+    if (!in_excursion_)
+        excursion_start_us_ = time_us;
+    in_excursion_ = false;
+    tripped_ = true;
+    return true;
+}
+
+bool TorqueLimitMonitor::clear()
+{
+    if (!tripped_)
+        return true;
+    const int32_t mean = filtered();
+    if (primed_ && (mean <= min_ + hysteresis_ || mean >= max_ - hysteresis_))
+        return false;
+    tripped_ = false;
+    in_excursion_ = false;
+    return true;
+}
@@ -0,0 +1,29 @@
+#include <virtual_load.h>
+
+VirtualLoad::VirtualLoad()
+:deadband_q8_{0}, damping_q8_{0}, friction_ua_{0}, inertia_q8_{0},
+ max_output_ua_{UINT32_MAX}
+{}
+
+VirtualLoad::~VirtualLoad()
+{}
+
+uint32_t VirtualLoad::update(int32_t velocity_q8, int32_t acceleration_q8) const
+{
+    // Work in the direction of travel so that every term resists motion.
+    const bool reverse = velocity_q8 < 0;
+    const int64_t speed_q8 = reverse ? -int64_t(velocity_q8) : velocity_q8;
+    const int64_t acceleration_along_q8 = reverse ? -int64_t(acceleration_q8)
+                                                  : acceleration_q8;
+    // Q24.8 * Q24.8 --> Q48.16.
+    int64_t current_ua = (int64_t(damping_q8_) * speed_q8
+                          + int64_t(inertia_q8_) * acceleration_along_q8)
+                         >> (2 * FRACTIONAL_BITS);
+    if (speed_q8 > deadband_q8_)
+        current_ua += friction_ua_;
+    if (current_ua < 0)
+        return 0;
+    if (current_ua > int64_t(max_output_ua_))
+        return max_output_ua_;
+    return uint32_t(current_ua);
+}
@@ -0,0 +1,139 @@
+#include <wear_leveling_store.h>
+#include <crc32.h>
+#include <cstring>
+
+namespace
+{
+struct slot_header_t
+{
+    uint32_t magic;
+    uint32_t sequence;
+    uint16_t version;
+    uint16_t length;
+};
+static_assert(sizeof(slot_header_t) == WearLevelingStore::HEADER_SIZE,
+              "Slot header must not contain padding.");
+}
+
+WearLevelingStore::WearLevelingStore(const uint8_t* region, size_t num_sectors,
+                                     erase_fn_t erase_fn,
+                                     program_fn_t program_fn)
+:region_{region}, erase_fn_{erase_fn}, program_fn_{program_fn},
+ num_slots_{num_sectors * SLOTS_PER_SECTOR}, latest_slot_{0}, next_slot_{0},
+ sequence_{0}, has_latest_{false}, erase_pending_{false}
+{}
+
+WearLevelingStore::~WearLevelingStore()
+{}
+
+void WearLevelingStore::init()
+{
+    has_latest_ = false;
+    for (size_t i = 0; i < num_slots_; ++i)
+    {
+        if (!is_valid(i))
+            continue;
+        slot_header_t header;
+        memcpy(&header, slot(i), sizeof(header));
+        // Sequence numbers are compared as a wrapping difference.
+        if (!has_latest_ || int32_t(header.sequence - sequence_) > 0)
+        {
+            latest_slot_ = i;
+            sequence_ = header.sequence;
+            has_latest_ = true;
+        }
+    }
+    if (!has_latest_)
+        sequence_ = 0;
+    find_next_slot(has_latest_ ? latest_slot_ + 1 : 0);
+}
+
+bool WearLevelingStore::save(uint16_t version, const void* payload,
+                             uint16_t num_bytes)
+{
+    if (num_bytes > MAX_PAYLOAD_SIZE || erase_pending_)
+        return false;
+    uint8_t buffer[SLOT_SIZE];
+    memset(buffer, 0xFF, sizeof(buffer));
+    const slot_header_t header{MAGIC, sequence_ + 1, version, num_bytes};
+    memcpy(buffer, &header, sizeof(header));
+    if (num_bytes)
+        memcpy(buffer + HEADER_SIZE, payload, num_bytes);
+    const uint32_t crc = crc32(buffer, HEADER_SIZE + num_bytes);
+    memcpy(buffer + SLOT_SIZE - sizeof(crc), &crc, sizeof(crc));
+    const size_t index = next_slot_;
+    program_fn_(uint32_t(index * SLOT_SIZE), buffer, SLOT_SIZE);
+    // Never reuse this slot or its sequence number, even if it did not
+    // program correctly: it may still pass its CRC after a reset, and must
+    // not then win over a later save.
+    find_next_slot(index + 1);
+    sequence_ = header.sequence;
+    if (memcmp(slot(index), buffer, SLOT_SIZE) != 0)
+        return false;
+    latest_slot_ = index;
+    has_latest_ = true;
+    return true;
+}
+
+const uint8_t* WearLevelingStore::latest(uint16_t& version,
+                                         uint16_t& num_bytes) const
+{
+    if (!has_latest_)
+        return nullptr;
+    slot_header_t header;
+    memcpy(&header, slot(latest_slot_), sizeof(header));
+    version = header.version;
+    num_bytes = header.length;
+    return slot(latest_slot_) + HEADER_SIZE;
+}
+
+void WearLevelingStore::service_erase()
+{
+    if (!erase_pending_)
+        return;
+    erase_fn_(uint32_t(next_slot_ * SLOT_SIZE));
+    erase_pending_ = false;
+}
+
+bool WearLevelingStore::is_valid(size_t index) const
+{
+    slot_header_t header;
+    memcpy(&header, slot(index), sizeof(header));
+    if (header.magic != MAGIC || header.length > MAX_PAYLOAD_SIZE)
+        return false;
+    uint32_t crc;
+    memcpy(&crc, slot(index) + SLOT_SIZE - sizeof(crc), sizeof(crc));
+    return crc == crc32(slot(index), HEADER_SIZE + header.length);
+}
+
+bool WearLevelingStore::is_blank(const uint8_t* data, size_t num_bytes) const
+{
+    for (size_t i = 0; i < num_bytes; ++i)
+    {
+        if (data[i] != 0xFF)
+            return false;
+    }
+    return true;
+}
+
+void WearLevelingStore::find_next_slot(size_t index)
+{
+    // Skip any partially-programmed slots in the current sector. A new sector
+    // is only written once it is entirely blank.
+    for (size_t count = 0; count < num_slots_; ++count, ++index)
+    {
+        index %= num_slots_;
+        if (index % SLOTS_PER_SECTOR == 0)
+        {
+            next_slot_ = index;
+            erase_pending_ = !is_blank(slot(index), SECTOR_SIZE);
+            return;
+        }
+        if (is_blank(slot(index), SLOT_SIZE))
+        {
+            next_slot_ = index;
+            erase_pending_ = false;
+            return;
+        }
+    }
+}
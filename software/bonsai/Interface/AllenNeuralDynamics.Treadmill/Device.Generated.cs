@@ -46,7 +46,72 @@ namespace AllenNeuralDynamics.Treadmill
             { 38, typeof(TareSensors) },
             { 39, typeof(ResetTareSensors) },
             { 40, typeof(EnableTorqueLimit) },
-            { 41, typeof(TorqueLimitState) }
+            { 41, typeof(TorqueLimitState) },
+            { 42, typeof(SensorDataBatch) },
+            { 43, typeof(SensorDataBatchSampleRate) },
+            { 44, typeof(SensorDataBatchSize) },
+            { 45, typeof(BrakeCurrentControlGains) },
+            { 46, typeof(BrakeCurrentSetPointMicroamps) },
+            { 47, typeof(BrakeCurrentControl) },
+            { 48, typeof(BrakeCurrentControlState) },
+            { 49, typeof(EncoderVelocity) },
+            { 50, typeof(EncoderAcceleration) },
+            { 51, typeof(SensorDataFields) },
+            { 52, typeof(EncoderReadCyclesSaved) },
+            { 53, typeof(TorqueLimitTripLatency) },
+            { 54, typeof(TorqueLimitFilterWindow) },
+            { 55, typeof(TorqueLimitHysteresis) },
+            { 56, typeof(LoopPeriod) },
+            { 57, typeof(DispatchLatenessHistogram) },
+            { 58, typeof(MissedDeadlines) },
+            { 59, typeof(TorqueCheckOverruns) },
+            { 60, typeof(UsbTxBackpressure) },
+            { 61, typeof(ResetDiagnostics) },
+            { 62, typeof(BrakeTrajectoryWriteIndex) },
+            { 63, typeof(BrakeTrajectoryData) },
+            { 64, typeof(BrakeTrajectoryLength) },
+            { 65, typeof(BrakeTrajectorySampleRate) },
+            { 66, typeof(BrakeTrajectoryPlayback) },
+            { 67, typeof(BrakeMapWriteIndex) },
+            { 68, typeof(BrakeMapData) },
+            { 69, typeof(BrakeMapConfig) },
+            { 70, typeof(BrakeMap) },
+            { 71, typeof(VirtualLoadParams) },
+            { 72, typeof(VirtualLoad) },
+            { 73, typeof(SensorDataPacked) },
+            { 74, typeof(SensorDataFormat) },
+            { 75, typeof(SensorDataDispatchDeadband) },
+            { 76, typeof(SensorDataDispatchHeartbeat) },
+            { 77, typeof(SensorDataStats) },
+            { 78, typeof(BrakeCalibrationWriteIndex) },
+            { 79, typeof(BrakeCalibrationData) },
+            { 80, typeof(BrakeCalibrationConfig) },
+            { 81, typeof(BrakeCalibrationStore) },
+            { 82, typeof(BrakeCalibrationChecksum) },
+            { 83, typeof(BrakeTorqueSetPoint) },
+            { 84, typeof(TorqueLimits) },
+            { 85, typeof(PersistentConfig) },
+            { 86, typeof(SensorSkew) },
+            { 87, typeof(FlightRecorder) },
+            { 88, typeof(FlightRecorderWindow) },
+            { 89, typeof(FlightRecorderReadIndex) },
+            { 90, typeof(FlightRecorderData) },
+            { 91, typeof(FlightRecorderCapture) },
+            { 92, typeof(EncoderTare) },
+            { 93, typeof(AuxEncoderReadCycles) },
+            { 94, typeof(BrakeStepTest) },
+            { 95, typeof(BrakeStepTestConfig) },
+            { 96, typeof(BrakeStepTestResults) },
+            { 97, typeof(BrakeSetpointLatency) },
+            { 98, typeof(BrakeStepTraceReadIndex) },
+            { 99, typeof(BrakeStepTrace) },
+            { 100, typeof(BrakeStepTraceInfo) },
+            { 101, typeof(AuxAnalogDispatchRate) },
+            { 102, typeof(AuxAnalog) },
+            { 103, typeof(AuxAnalogSampling) },
+            { 104, typeof(SensorFilters) },
+            { 105, typeof(SensorFilterCutoff) },
+            { 106, typeof(SensorFilterCycles) }
         };
 
         /// <summary>
@@ -120,6 +185,71 @@ namespace AllenNeuralDynamics.Treadmill
     /// <seealso cref="ResetTareSensors"/>
     /// <seealso cref="EnableTorqueLimit"/>
     /// <seealso cref="TorqueLimitState"/>
+    /// <seealso cref="SensorDataBatch"/>
+    /// <seealso cref="SensorDataBatchSampleRate"/>
+    /// <seealso cref="SensorDataBatchSize"/>
+    /// <seealso cref="BrakeCurrentControlGains"/>
+    /// <seealso cref="BrakeCurrentSetPointMicroamps"/>
+    /// <seealso cref="BrakeCurrentControl"/>
+    /// <seealso cref="BrakeCurrentControlState"/>
+    /// <seealso cref="EncoderVelocity"/>
+    /// <seealso cref="EncoderAcceleration"/>
+    /// <seealso cref="SensorDataFields"/>
+    /// <seealso cref="EncoderReadCyclesSaved"/>
+    /// <seealso cref="TorqueLimitTripLatency"/>
+    /// <seealso cref="TorqueLimitFilterWindow"/>
+    /// <seealso cref="TorqueLimitHysteresis"/>
+    /// <seealso cref="LoopPeriod"/>
+    /// <seealso cref="DispatchLatenessHistogram"/>
+    /// <seealso cref="MissedDeadlines"/>
+    /// <seealso cref="TorqueCheckOverruns"/>
+    /// <seealso cref="UsbTxBackpressure"/>
+    /// <seealso cref="ResetDiagnostics"/>
+    /// <seealso cref="BrakeTrajectoryWriteIndex"/>
+    /// <seealso cref="BrakeTrajectoryData"/>
+    /// <seealso cref="BrakeTrajectoryLength"/>
+    /// <seealso cref="BrakeTrajectorySampleRate"/>
+    /// <seealso cref="BrakeTrajectoryPlayback"/>
+    /// <seealso cref="BrakeMapWriteIndex"/>
+    /// <seealso cref="BrakeMapData"/>
+    /// <seealso cref="BrakeMapConfig"/>
+    /// <seealso cref="BrakeMap"/>
+    /// <seealso cref="VirtualLoadParams"/>
+    /// <seealso cref="VirtualLoad"/>
+    /// <seealso cref="SensorDataPacked"/>
+    /// <seealso cref="SensorDataFormat"/>
+    /// <seealso cref="SensorDataDispatchDeadband"/>
+    /// <seealso cref="SensorDataDispatchHeartbeat"/>
+    /// <seealso cref="SensorDataStats"/>
+    /// <seealso cref="BrakeCalibrationWriteIndex"/>
+    /// <seealso cref="BrakeCalibrationData"/>
+    /// <seealso cref="BrakeCalibrationConfig"/>
+    /// <seealso cref="BrakeCalibrationStore"/>
+    /// <seealso cref="BrakeCalibrationChecksum"/>
+    /// <seealso cref="BrakeTorqueSetPoint"/>
+    /// <seealso cref="TorqueLimits"/>
+    /// <seealso cref="PersistentConfig"/>
+    /// <seealso cref="SensorSkew"/>
+    /// <seealso cref="FlightRecorder"/>
+    /// <seealso cref="FlightRecorderWindow"/>
+    /// <seealso cref="FlightRecorderReadIndex"/>
+    /// <seealso cref="FlightRecorderData"/>
+    /// <seealso cref="FlightRecorderCapture"/>
+    /// <seealso cref="EncoderTare"/>
+    /// <seealso cref="AuxEncoderReadCycles"/>
+    /// <seealso cref="BrakeStepTest"/>
+    /// <seealso cref="BrakeStepTestConfig"/>
+    /// <seealso cref="BrakeStepTestResults"/>
+    /// <seealso cref="BrakeSetpointLatency"/>
+    /// <seealso cref="BrakeStepTraceReadIndex"/>
+    /// <seealso cref="BrakeStepTrace"/>
+    /// <seealso cref="BrakeStepTraceInfo"/>
+    /// <seealso cref="AuxAnalogDispatchRate"/>
+    /// <seealso cref="AuxAnalog"/>
+    /// <seealso cref="AuxAnalogSampling"/>
+    /// <seealso cref="SensorFilters"/>
+    /// <seealso cref="SensorFilterCutoff"/>
+    /// <seealso cref="SensorFilterCycles"/>
     [XmlInclude(typeof(Encoder))]
     [XmlInclude(typeof(Torque))]
     [XmlInclude(typeof(TorqueLoadCurrent))]
@@ -130,6 +260,71 @@ namespace AllenNeuralDynamics.Treadmill
     [XmlInclude(typeof(ResetTareSensors))]
     [XmlInclude(typeof(EnableTorqueLimit))]
     [XmlInclude(typeof(TorqueLimitState))]
+    [XmlInclude(typeof(SensorDataBatch))]
+    [XmlInclude(typeof(SensorDataBatchSampleRate))]
+    [XmlInclude(typeof(SensorDataBatchSize))]
+    [XmlInclude(typeof(BrakeCurrentControlGains))]
+    [XmlInclude(typeof(BrakeCurrentSetPointMicroamps))]
+    [XmlInclude(typeof(BrakeCurrentControl))]
+    [XmlInclude(typeof(BrakeCurrentControlState))]
+    [XmlInclude(typeof(EncoderVelocity))]
+    [XmlInclude(typeof(EncoderAcceleration))]
+    [XmlInclude(typeof(SensorDataFields))]
+    [XmlInclude(typeof(EncoderReadCyclesSaved))]
+    [XmlInclude(typeof(TorqueLimitTripLatency))]
+    [XmlInclude(typeof(TorqueLimitFilterWindow))]
+    [XmlInclude(typeof(TorqueLimitHysteresis))]
+    [XmlInclude(typeof(LoopPeriod))]
+    [XmlInclude(typeof(DispatchLatenessHistogram))]
+    [XmlInclude(typeof(MissedDeadlines))]
+    [XmlInclude(typeof(TorqueCheckOverruns))]
+    [XmlInclude(typeof(UsbTxBackpressure))]
+    [XmlInclude(typeof(ResetDiagnostics))]
+    [XmlInclude(typeof(BrakeTrajectoryWriteIndex))]
+    [XmlInclude(typeof(BrakeTrajectoryData))]
+    [XmlInclude(typeof(BrakeTrajectoryLength))]
+    [XmlInclude(typeof(BrakeTrajectorySampleRate))]
+    [XmlInclude(typeof(BrakeTrajectoryPlayback))]
+    [XmlInclude(typeof(BrakeMapWriteIndex))]
+    [XmlInclude(typeof(BrakeMapData))]
+    [XmlInclude(typeof(BrakeMapConfig))]
+    [XmlInclude(typeof(BrakeMap))]
+    [XmlInclude(typeof(VirtualLoadParams))]
+    [XmlInclude(typeof(VirtualLoad))]
+    [XmlInclude(typeof(SensorDataPacked))]
+    [XmlInclude(typeof(SensorDataFormat))]
+    [XmlInclude(typeof(SensorDataDispatchDeadband))]
+    [XmlInclude(typeof(SensorDataDispatchHeartbeat))]
+    [XmlInclude(typeof(SensorDataStats))]
+    [XmlInclude(typeof(BrakeCalibrationWriteIndex))]
+    [XmlInclude(typeof(BrakeCalibrationData))]
+    [XmlInclude(typeof(BrakeCalibrationConfig))]
+    [XmlInclude(typeof(BrakeCalibrationStore))]
+    [XmlInclude(typeof(BrakeCalibrationChecksum))]
+    [XmlInclude(typeof(BrakeTorqueSetPoint))]
+    [XmlInclude(typeof(TorqueLimits))]
+    [XmlInclude(typeof(PersistentConfig))]
+    [XmlInclude(typeof(SensorSkew))]
+    [XmlInclude(typeof(FlightRecorder))]
+    [XmlInclude(typeof(FlightRecorderWindow))]
+    [XmlInclude(typeof(FlightRecorderReadIndex))]
+    [XmlInclude(typeof(FlightRecorderData))]
+    [XmlInclude(typeof(FlightRecorderCapture))]
+    [XmlInclude(typeof(EncoderTare))]
+    [XmlInclude(typeof(AuxEncoderReadCycles))]
+    [XmlInclude(typeof(BrakeStepTest))]
+    [XmlInclude(typeof(BrakeStepTestConfig))]
+    [XmlInclude(typeof(BrakeStepTestResults))]
+    [XmlInclude(typeof(BrakeSetpointLatency))]
+    [XmlInclude(typeof(BrakeStepTraceReadIndex))]
+    [XmlInclude(typeof(BrakeStepTrace))]
+    [XmlInclude(typeof(BrakeStepTraceInfo))]
+    [XmlInclude(typeof(AuxAnalogDispatchRate))]
+    [XmlInclude(typeof(AuxAnalog))]
+    [XmlInclude(typeof(AuxAnalogSampling))]
+    [XmlInclude(typeof(SensorFilters))]
+    [XmlInclude(typeof(SensorFilterCutoff))]
+    [XmlInclude(typeof(SensorFilterCycles))]
     [Description("Filters register-specific messages reported by the Treadmill device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -161,6 +356,71 @@ namespace AllenNeuralDynamics.Treadmill
     /// <seealso cref="ResetTareSensors"/>
     /// <seealso cref="EnableTorqueLimit"/>
     /// <seealso cref="TorqueLimitState"/>
+    /// <seealso cref="SensorDataBatch"/>
+    /// <seealso cref="SensorDataBatchSampleRate"/>
+    /// <seealso cref="SensorDataBatchSize"/>
+    /// <seealso cref="BrakeCurrentControlGains"/>
+    /// <seealso cref="BrakeCurrentSetPointMicroamps"/>
+    /// <seealso cref="BrakeCurrentControl"/>
+    /// <seealso cref="BrakeCurrentControlState"/>
+    /// <seealso cref="EncoderVelocity"/>
+    /// <seealso cref="EncoderAcceleration"/>
+    /// <seealso cref="SensorDataFields"/>
+    /// <seealso cref="EncoderReadCyclesSaved"/>
+    /// <seealso cref="TorqueLimitTripLatency"/>
+    /// <seealso cref="TorqueLimitFilterWindow"/>
+    /// <seealso cref="TorqueLimitHysteresis"/>
+    /// <seealso cref="LoopPeriod"/>
+    /// <seealso cref="DispatchLatenessHistogram"/>
+    /// <seealso cref="MissedDeadlines"/>
+    /// <seealso cref="TorqueCheckOverruns"/>
+    /// <seealso cref="UsbTxBackpressure"/>
+    /// <seealso cref="ResetDiagnostics"/>
+    /// <seealso cref="BrakeTrajectoryWriteIndex"/>
+    /// <seealso cref="BrakeTrajectoryData"/>
+    /// <seealso cref="BrakeTrajectoryLength"/>
+    /// <seealso cref="BrakeTrajectorySampleRate"/>
+    /// <seealso cref="BrakeTrajectoryPlayback"/>
+    /// <seealso cref="BrakeMapWriteIndex"/>
+    /// <seealso cref="BrakeMapData"/>
+    /// <seealso cref="BrakeMapConfig"/>
+    /// <seealso cref="BrakeMap"/>
+    /// <seealso cref="VirtualLoadParams"/>
+    /// <seealso cref="VirtualLoad"/>
+    /// <seealso cref="SensorDataPacked"/>
+    /// <seealso cref="SensorDataFormat"/>
+    /// <seealso cref="SensorDataDispatchDeadband"/>
+    /// <seealso cref="SensorDataDispatchHeartbeat"/>
+    /// <seealso cref="SensorDataStats"/>
+    /// <seealso cref="BrakeCalibrationWriteIndex"/>
+    /// <seealso cref="BrakeCalibrationData"/>
+    /// <seealso cref="BrakeCalibrationConfig"/>
+    /// <seealso cref="BrakeCalibrationStore"/>
+    /// <seealso cref="BrakeCalibrationChecksum"/>
+    /// <seealso cref="BrakeTorqueSetPoint"/>
+    /// <seealso cref="TorqueLimits"/>
+    /// <seealso cref="PersistentConfig"/>
+    /// <seealso cref="SensorSkew"/>
+    /// <seealso cref="FlightRecorder"/>
+    /// <seealso cref="FlightRecorderWindow"/>
+    /// <seealso cref="FlightRecorderReadIndex"/>
+    /// <seealso cref="FlightRecorderData"/>
+    /// <seealso cref="FlightRecorderCapture"/>
+    /// <seealso cref="EncoderTare"/>
+    /// <seealso cref="AuxEncoderReadCycles"/>
+    /// <seealso cref="BrakeStepTest"/>
+    /// <seealso cref="BrakeStepTestConfig"/>
+    /// <seealso cref="BrakeStepTestResults"/>
+    /// <seealso cref="BrakeSetpointLatency"/>
+    /// <seealso cref="BrakeStepTraceReadIndex"/>
+    /// <seealso cref="BrakeStepTrace"/>
+    /// <seealso cref="BrakeStepTraceInfo"/>
+    /// <seealso cref="AuxAnalogDispatchRate"/>
+    /// <seealso cref="AuxAnalog"/>
+    /// <seealso cref="AuxAnalogSampling"/>
+    /// <seealso cref="SensorFilters"/>
+    /// <seealso cref="SensorFilterCutoff"/>
+    /// <seealso cref="SensorFilterCycles"/>
     [XmlInclude(typeof(Encoder))]
     [XmlInclude(typeof(Torque))]
     [XmlInclude(typeof(TorqueLoadCurrent))]
@@ -171,6 +431,71 @@ namespace AllenNeuralDynamics.Treadmill
     [XmlInclude(typeof(ResetTareSensors))]
     [XmlInclude(typeof(EnableTorqueLimit))]
     [XmlInclude(typeof(TorqueLimitState))]
+    [XmlInclude(typeof(SensorDataBatch))]
+    [XmlInclude(typeof(SensorDataBatchSampleRate))]
+    [XmlInclude(typeof(SensorDataBatchSize))]
+    [XmlInclude(typeof(BrakeCurrentControlGains))]
+    [XmlInclude(typeof(BrakeCurrentSetPointMicroamps))]
+    [XmlInclude(typeof(BrakeCurrentControl))]
+    [XmlInclude(typeof(BrakeCurrentControlState))]
+    [XmlInclude(typeof(EncoderVelocity))]
+    [XmlInclude(typeof(EncoderAcceleration))]
+    [XmlInclude(typeof(SensorDataFields))]
+    [XmlInclude(typeof(EncoderReadCyclesSaved))]
+    [XmlInclude(typeof(TorqueLimitTripLatency))]
+    [XmlInclude(typeof(TorqueLimitFilterWindow))]
+    [XmlInclude(typeof(TorqueLimitHysteresis))]
+    [XmlInclude(typeof(LoopPeriod))]
+    [XmlInclude(typeof(DispatchLatenessHistogram))]
+    [XmlInclude(typeof(MissedDeadlines))]
+    [XmlInclude(typeof(TorqueCheckOverruns))]
+    [XmlInclude(typeof(UsbTxBackpressure))]
+    [XmlInclude(typeof(ResetDiagnostics))]
+    [XmlInclude(typeof(BrakeTrajectoryWriteIndex))]
+    [XmlInclude(typeof(BrakeTrajectoryData))]
+    [XmlInclude(typeof(BrakeTrajectoryLength))]
+    [XmlInclude(typeof(BrakeTrajectorySampleRate))]
+    [XmlInclude(typeof(BrakeTrajectoryPlayback))]
+    [XmlInclude(typeof(BrakeMapWriteIndex))]
+    [XmlInclude(typeof(BrakeMapData))]
+    [XmlInclude(typeof(BrakeMapConfig))]
+    [XmlInclude(typeof(BrakeMap))]
+    [XmlInclude(typeof(VirtualLoadParams))]
+    [XmlInclude(typeof(VirtualLoad))]
+    [XmlInclude(typeof(SensorDataPacked))]
+    [XmlInclude(typeof(SensorDataFormat))]
+    [XmlInclude(typeof(SensorDataDispatchDeadband))]
+    [XmlInclude(typeof(SensorDataDispatchHeartbeat))]
+    [XmlInclude(typeof(SensorDataStats))]
+    [XmlInclude(typeof(BrakeCalibrationWriteIndex))]
+    [XmlInclude(typeof(BrakeCalibrationData))]
+    [XmlInclude(typeof(BrakeCalibrationConfig))]
+    [XmlInclude(typeof(BrakeCalibrationStore))]
+    [XmlInclude(typeof(BrakeCalibrationChecksum))]
+    [XmlInclude(typeof(BrakeTorqueSetPoint))]
+    [XmlInclude(typeof(TorqueLimits))]
+    [XmlInclude(typeof(PersistentConfig))]
+    [XmlInclude(typeof(SensorSkew))]
+    [XmlInclude(typeof(FlightRecorder))]
+    [XmlInclude(typeof(FlightRecorderWindow))]
+    [XmlInclude(typeof(FlightRecorderReadIndex))]
+    [XmlInclude(typeof(FlightRecorderData))]
+    [XmlInclude(typeof(FlightRecorderCapture))]
+    [XmlInclude(typeof(EncoderTare))]
+    [XmlInclude(typeof(AuxEncoderReadCycles))]
+    [XmlInclude(typeof(BrakeStepTest))]
+    [XmlInclude(typeof(BrakeStepTestConfig))]
+    [XmlInclude(typeof(BrakeStepTestResults))]
+    [XmlInclude(typeof(BrakeSetpointLatency))]
+    [XmlInclude(typeof(BrakeStepTraceReadIndex))]
+    [XmlInclude(typeof(BrakeStepTrace))]
+    [XmlInclude(typeof(BrakeStepTraceInfo))]
+    [XmlInclude(typeof(AuxAnalogDispatchRate))]
+    [XmlInclude(typeof(AuxAnalog))]
+    [XmlInclude(typeof(AuxAnalogSampling))]
+    [XmlInclude(typeof(SensorFilters))]
+    [XmlInclude(typeof(SensorFilterCutoff))]
+    [XmlInclude(typeof(SensorFilterCycles))]
     [XmlInclude(typeof(TimestampedEncoder))]
     [XmlInclude(typeof(TimestampedTorque))]
     [XmlInclude(typeof(TimestampedTorqueLoadCurrent))]
@@ -181,6 +506,71 @@ namespace AllenNeuralDynamics.Treadmill
     [XmlInclude(typeof(TimestampedResetTareSensors))]
     [XmlInclude(typeof(TimestampedEnableTorqueLimit))]
     [XmlInclude(typeof(TimestampedTorqueLimitState))]
+    [XmlInclude(typeof(TimestampedSensorDataBatch))]
+    [XmlInclude(typeof(TimestampedSensorDataBatchSampleRate))]
+    [XmlInclude(typeof(TimestampedSensorDataBatchSize))]
+    [XmlInclude(typeof(TimestampedBrakeCurrentControlGains))]
+    [XmlInclude(typeof(TimestampedBrakeCurrentSetPointMicroamps))]
+    [XmlInclude(typeof(TimestampedBrakeCurrentControl))]
+    [XmlInclude(typeof(TimestampedBrakeCurrentControlState))]
+    [XmlInclude(typeof(TimestampedEncoderVelocity))]
+    [XmlInclude(typeof(TimestampedEncoderAcceleration))]
+    [XmlInclude(typeof(TimestampedSensorDataFields))]
+    [XmlInclude(typeof(TimestampedEncoderReadCyclesSaved))]
+    [XmlInclude(typeof(TimestampedTorqueLimitTripLatency))]
+    [XmlInclude(typeof(TimestampedTorqueLimitFilterWindow))]
+    [XmlInclude(typeof(TimestampedTorqueLimitHysteresis))]
+    [XmlInclude(typeof(TimestampedLoopPeriod))]
+    [XmlInclude(typeof(TimestampedDispatchLatenessHistogram))]
+    [XmlInclude(typeof(TimestampedMissedDeadlines))]
+    [XmlInclude(typeof(TimestampedTorqueCheckOverruns))]
+    [XmlInclude(typeof(TimestampedUsbTxBackpressure))]
+    [XmlInclude(typeof(TimestampedResetDiagnostics))]
+    [XmlInclude(typeof(TimestampedBrakeTrajectoryWriteIndex))]
+    [XmlInclude(typeof(TimestampedBrakeTrajectoryData))]
+    [XmlInclude(typeof(TimestampedBrakeTrajectoryLength))]
+    [XmlInclude(typeof(TimestampedBrakeTrajectorySampleRate))]
+    [XmlInclude(typeof(TimestampedBrakeTrajectoryPlayback))]
+    [XmlInclude(typeof(TimestampedBrakeMapWriteIndex))]
+    [XmlInclude(typeof(TimestampedBrakeMapData))]
+    [XmlInclude(typeof(TimestampedBrakeMapConfig))]
+    [XmlInclude(typeof(TimestampedBrakeMap))]
+    [XmlInclude(typeof(TimestampedVirtualLoadParams))]
+    [XmlInclude(typeof(TimestampedVirtualLoad))]
+    [XmlInclude(typeof(TimestampedSensorDataPacked))]
+    [XmlInclude(typeof(TimestampedSensorDataFormat))]
+    [XmlInclude(typeof(TimestampedSensorDataDispatchDeadband))]
+    [XmlInclude(typeof(TimestampedSensorDataDispatchHeartbeat))]
+    [XmlInclude(typeof(TimestampedSensorDataStats))]
+    [XmlInclude(typeof(TimestampedBrakeCalibrationWriteIndex))]
+    [XmlInclude(typeof(TimestampedBrakeCalibrationData))]
+    [XmlInclude(typeof(TimestampedBrakeCalibrationConfig))]
+    [XmlInclude(typeof(TimestampedBrakeCalibrationStore))]
+    [XmlInclude(typeof(TimestampedBrakeCalibrationChecksum))]
+    [XmlInclude(typeof(TimestampedBrakeTorqueSetPoint))]
+    [XmlInclude(typeof(TimestampedTorqueLimits))]
+    [XmlInclude(typeof(TimestampedPersistentConfig))]
+    [XmlInclude(typeof(TimestampedSensorSkew))]
+    [XmlInclude(typeof(TimestampedFlightRecorder))]
+    [XmlInclude(typeof(TimestampedFlightRecorderWindow))]
+    [XmlInclude(typeof(TimestampedFlightRecorderReadIndex))]
+    [XmlInclude(typeof(TimestampedFlightRecorderData))]
+    [XmlInclude(typeof(TimestampedFlightRecorderCapture))]
+    [XmlInclude(typeof(TimestampedEncoderTare))]
+    [XmlInclude(typeof(TimestampedAuxEncoderReadCycles))]
+    [XmlInclude(typeof(TimestampedBrakeStepTest))]
+    [XmlInclude(typeof(TimestampedBrakeStepTestConfig))]
+    [XmlInclude(typeof(TimestampedBrakeStepTestResults))]
+    [XmlInclude(typeof(TimestampedBrakeSetpointLatency))]
+    [XmlInclude(typeof(TimestampedBrakeStepTraceReadIndex))]
+    [XmlInclude(typeof(TimestampedBrakeStepTrace))]
+    [XmlInclude(typeof(TimestampedBrakeStepTraceInfo))]
+    [XmlInclude(typeof(TimestampedAuxAnalogDispatchRate))]
+    [XmlInclude(typeof(TimestampedAuxAnalog))]
+    [XmlInclude(typeof(TimestampedAuxAnalogSampling))]
+    [XmlInclude(typeof(TimestampedSensorFilters))]
+    [XmlInclude(typeof(TimestampedSensorFilterCutoff))]
+    [XmlInclude(typeof(TimestampedSensorFilterCycles))]
     [Description("Filters and selects specific messages reported by the Treadmill device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -209,6 +599,71 @@ namespace AllenNeuralDynamics.Treadmill
     /// <seealso cref="ResetTareSensors"/>
     /// <seealso cref="EnableTorqueLimit"/>
     /// <seealso cref="TorqueLimitState"/>
+    /// <seealso cref="SensorDataBatch"/>
+    /// <seealso cref="SensorDataBatchSampleRate"/>
+    /// <seealso cref="SensorDataBatchSize"/>
+    /// <seealso cref="BrakeCurrentControlGains"/>
+    /// <seealso cref="BrakeCurrentSetPointMicroamps"/>
+    /// <seealso cref="BrakeCurrentControl"/>
+    /// <seealso cref="BrakeCurrentControlState"/>
+    /// <seealso cref="EncoderVelocity"/>
+    /// <seealso cref="EncoderAcceleration"/>
+    /// <seealso cref="SensorDataFields"/>
+    /// <seealso cref="EncoderReadCyclesSaved"/>
+    /// <seealso cref="TorqueLimitTripLatency"/>
+    /// <seealso cref="TorqueLimitFilterWindow"/>
+    /// <seealso cref="TorqueLimitHysteresis"/>
+    /// <seealso cref="LoopPeriod"/>
+    /// <seealso cref="DispatchLatenessHistogram"/>
+    /// <seealso cref="MissedDeadlines"/>
+    /// <seealso cref="TorqueCheckOverruns"/>
+    /// <seealso cref="UsbTxBackpressure"/>
+    /// <seealso cref="ResetDiagnostics"/>
+    /// <seealso cref="BrakeTrajectoryWriteIndex"/>
+    /// <seealso cref="BrakeTrajectoryData"/>
+    /// <seealso cref="BrakeTrajectoryLength"/>
+    /// <seealso cref="BrakeTrajectorySampleRate"/>
+    /// <seealso cref="BrakeTrajectoryPlayback"/>
+    /// <seealso cref="BrakeMapWriteIndex"/>
+    /// <seealso cref="BrakeMapData"/>
+    /// <seealso cref="BrakeMapConfig"/>
+    /// <seealso cref="BrakeMap"/>
+    /// <seealso cref="VirtualLoadParams"/>
+    /// <seealso cref="VirtualLoad"/>
+    /// <seealso cref="SensorDataPacked"/>
+    /// <seealso cref="SensorDataFormat"/>
+    /// <seealso cref="SensorDataDispatchDeadband"/>
+    /// <seealso cref="SensorDataDispatchHeartbeat"/>
+    /// <seealso cref="SensorDataStats"/>
+    /// <seealso cref="BrakeCalibrationWriteIndex"/>
+    /// <seealso cref="BrakeCalibrationData"/>
+    /// <seealso cref="BrakeCalibrationConfig"/>
+    /// <seealso cref="BrakeCalibrationStore"/>
+    /// <seealso cref="BrakeCalibrationChecksum"/>
+    /// <seealso cref="BrakeTorqueSetPoint"/>
+    /// <seealso cref="TorqueLimits"/>
+    /// <seealso cref="PersistentConfig"/>
+    /// <seealso cref="SensorSkew"/>
+    /// <seealso cref="FlightRecorder"/>
+    /// <seealso cref="FlightRecorderWindow"/>
+    /// <seealso cref="FlightRecorderReadIndex"/>
+    /// <seealso cref="FlightRecorderData"/>
+    /// <seealso cref="FlightRecorderCapture"/>
+    /// <seealso cref="EncoderTare"/>
+    /// <seealso cref="AuxEncoderReadCycles"/>
+    /// <seealso cref="BrakeStepTest"/>
+    /// <seealso cref="BrakeStepTestConfig"/>
+    /// <seealso cref="BrakeStepTestResults"/>
+    /// <seealso cref="BrakeSetpointLatency"/>
+    /// <seealso cref="BrakeStepTraceReadIndex"/>
+    /// <seealso cref="BrakeStepTrace"/>
+    /// <seealso cref="BrakeStepTraceInfo"/>
+    /// <seealso cref="AuxAnalogDispatchRate"/>
+    /// <seealso cref="AuxAnalog"/>
+    /// <seealso cref="AuxAnalogSampling"/>
+    /// <seealso cref="SensorFilters"/>
+    /// <seealso cref="SensorFilterCutoff"/>
+    /// <seealso cref="SensorFilterCycles"/>
     [XmlInclude(typeof(Encoder))]
     [XmlInclude(typeof(Torque))]
     [XmlInclude(typeof(TorqueLoadCurrent))]
@@ -219,6 +674,71 @@ namespace AllenNeuralDynamics.Treadmill
     [XmlInclude(typeof(ResetTareSensors))]
     [XmlInclude(typeof(EnableTorqueLimit))]
     [XmlInclude(typeof(TorqueLimitState))]
+    [XmlInclude(typeof(SensorDataBatch))]
+    [XmlInclude(typeof(SensorDataBatchSampleRate))]
+    [XmlInclude(typeof(SensorDataBatchSize))]
+    [XmlInclude(typeof(BrakeCurrentControlGains))]
+    [XmlInclude(typeof(BrakeCurrentSetPointMicroamps))]
+    [XmlInclude(typeof(BrakeCurrentControl))]
+    [XmlInclude(typeof(BrakeCurrentControlState))]
+    [XmlInclude(typeof(EncoderVelocity))]
+    [XmlInclude(typeof(EncoderAcceleration))]
+    [XmlInclude(typeof(SensorDataFields))]
+    [XmlInclude(typeof(EncoderReadCyclesSaved))]
+    [XmlInclude(typeof(TorqueLimitTripLatency))]
+    [XmlInclude(typeof(TorqueLimitFilterWindow))]
+    [XmlInclude(typeof(TorqueLimitHysteresis))]
+    [XmlInclude(typeof(LoopPeriod))]
+    [XmlInclude(typeof(DispatchLatenessHistogram))]
+    [XmlInclude(typeof(MissedDeadlines))]
+    [XmlInclude(typeof(TorqueCheckOverruns))]
+    [XmlInclude(typeof(UsbTxBackpressure))]
+    [XmlInclude(typeof(ResetDiagnostics))]
+    [XmlInclude(typeof(BrakeTrajectoryWriteIndex))]
+    [XmlInclude(typeof(BrakeTrajectoryData))]
+    [XmlInclude(typeof(BrakeTrajectoryLength))]
+    [XmlInclude(typeof(BrakeTrajectorySampleRate))]
+    [XmlInclude(typeof(BrakeTrajectoryPlayback))]
+    [XmlInclude(typeof(BrakeMapWriteIndex))]
+    [XmlInclude(typeof(BrakeMapData))]
+    [XmlInclude(typeof(BrakeMapConfig))]
+    [XmlInclude(typeof(BrakeMap))]
+    [XmlInclude(typeof(VirtualLoadParams))]
+    [XmlInclude(typeof(VirtualLoad))]
+    [XmlInclude(typeof(SensorDataPacked))]
+    [XmlInclude(typeof(SensorDataFormat))]
+    [XmlInclude(typeof(SensorDataDispatchDeadband))]
+    [XmlInclude(typeof(SensorDataDispatchHeartbeat))]
+    [XmlInclude(typeof(SensorDataStats))]
+    [XmlInclude(typeof(BrakeCalibrationWriteIndex))]
+    [XmlInclude(typeof(BrakeCalibrationData))]
+    [XmlInclude(typeof(BrakeCalibrationConfig))]
+    [XmlInclude(typeof(BrakeCalibrationStore))]
+    [XmlInclude(typeof(BrakeCalibrationChecksum))]
+    [XmlInclude(typeof(BrakeTorqueSetPoint))]
+    [XmlInclude(typeof(TorqueLimits))]
+    [XmlInclude(typeof(PersistentConfig))]
+    [XmlInclude(typeof(SensorSkew))]
+    [XmlInclude(typeof(FlightRecorder))]
+    [XmlInclude(typeof(FlightRecorderWindow))]
+    [XmlInclude(typeof(FlightRecorderReadIndex))]
+    [XmlInclude(typeof(FlightRecorderData))]
+    [XmlInclude(typeof(FlightRecorderCapture))]
+    [XmlInclude(typeof(EncoderTare))]
+    [XmlInclude(typeof(AuxEncoderReadCycles))]
+    [XmlInclude(typeof(BrakeStepTest))]
+    [XmlInclude(typeof(BrakeStepTestConfig))]
+    [XmlInclude(typeof(BrakeStepTestResults))]
+    [XmlInclude(typeof(BrakeSetpointLatency))]
+    [XmlInclude(typeof(BrakeStepTraceReadIndex))]
+    [XmlInclude(typeof(BrakeStepTrace))]
+    [XmlInclude(typeof(BrakeStepTraceInfo))]
+    [XmlInclude(typeof(AuxAnalogDispatchRate))]
+    [XmlInclude(typeof(AuxAnalog))]
+    [XmlInclude(typeof(AuxAnalogSampling))]
+    [XmlInclude(typeof(SensorFilters))]
+    [XmlInclude(typeof(SensorFilterCutoff))]
+    [XmlInclude(typeof(SensorFilterCycles))]
     [Description("Formats a sequence of values as specific Treadmill register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -522,9 +1042,9 @@ namespace AllenNeuralDynamics.Treadmill
     }
 
     /// <summary>
-    /// Represents a register that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent].
+    /// Represents a register that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]. Fields enabled in SensorDataFields are appended in bit order, followed by the positions of any additional encoders (see EncoderTare). Events are timestamped with the (Harp-synchronized) time that all sensors were latched together. See SensorSkew.
     /// </summary>
-    [Description("Emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]")]
+    [Description("Emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]. Fields enabled in SensorDataFields are appended in bit order, followed by the positions of any additional encoders (see EncoderTare). Events are timestamped with the (Harp-synchronized) time that all sensors were latched together. See SensorSkew.")]
     public partial class SensorData
     {
         /// <summary>
@@ -1121,9 +1641,9 @@ namespace AllenNeuralDynamics.Treadmill
     }
 
     /// <summary>
-    /// Represents a register that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.
+    /// Represents a register that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.
     /// </summary>
-    [Description("A value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.")]
+    [Description("A value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.")]
     public partial class TorqueLimitState
     {
         /// <summary>
@@ -1216,611 +1736,10746 @@ namespace AllenNeuralDynamics.Treadmill
         }
     }
 
+    /// <summary>
+    /// Represents a register that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.
+    /// </summary>
+    [Description("Emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.")]
+    public partial class SensorDataBatch
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 42;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 240;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataBatch"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataBatch"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataBatch"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataBatch"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataBatch register.
+    /// </summary>
+    /// <seealso cref="SensorDataBatch"/>
+    [Description("Filters and selects timestamped messages from the SensorDataBatch register.")]
+    public partial class TimestampedSensorDataBatch
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataBatch.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return SensorDataBatch.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.
+    /// </summary>
+    [Description("Value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.")]
+    public partial class SensorDataBatchSampleRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataBatchSampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 43;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataBatchSampleRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataBatchSampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataBatchSampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataBatchSampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataBatchSampleRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataBatchSampleRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataBatchSampleRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataBatchSampleRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataBatchSampleRate register.
+    /// </summary>
+    /// <seealso cref="SensorDataBatchSampleRate"/>
+    [Description("Filters and selects timestamped messages from the SensorDataBatchSampleRate register.")]
+    public partial class TimestampedSensorDataBatchSampleRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataBatchSampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataBatchSampleRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataBatchSampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SensorDataBatchSampleRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of samples per SensorDataBatch event.
+    /// </summary>
+    [Description("Number of samples per SensorDataBatch event.")]
+    public partial class SensorDataBatchSize
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataBatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 44;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataBatchSize"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataBatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataBatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataBatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataBatchSize"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataBatchSize"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataBatchSize"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataBatchSize"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataBatchSize register.
+    /// </summary>
+    /// <seealso cref="SensorDataBatchSize"/>
+    [Description("Filters and selects timestamped messages from the SensorDataBatchSize register.")]
+    public partial class TimestampedSensorDataBatchSize
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataBatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataBatchSize.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataBatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SensorDataBatchSize.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that proportional and integral gains of the closed-loop brake current controller in Q8.8 fixed-point. The integral gain is applied per control update (5 kHz).
+    /// </summary>
+    [Description("Proportional and integral gains of the closed-loop brake current controller in Q8.8 fixed-point. The integral gain is applied per control update (5 kHz).")]
+    public partial class BrakeCurrentControlGains
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCurrentControlGains"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 45;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCurrentControlGains"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCurrentControlGains"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static BrakeCurrentControlGainsPayload ParsePayload(ushort[] payload)
+        {
+            BrakeCurrentControlGainsPayload result;
+            result.Kp = payload[0];
+            result.Ki = payload[1];
+            return result;
+        }
+
+        static ushort[] FormatPayload(BrakeCurrentControlGainsPayload value)
+        {
+            ushort[] result;
+            result = new ushort[2];
+            result[0] = value.Kp;
+            result[1] = value.Ki;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCurrentControlGains"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static BrakeCurrentControlGainsPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCurrentControlGains"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BrakeCurrentControlGainsPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCurrentControlGains"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCurrentControlGains"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, BrakeCurrentControlGainsPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCurrentControlGains"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCurrentControlGains"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, BrakeCurrentControlGainsPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCurrentControlGains register.
+    /// </summary>
+    /// <seealso cref="BrakeCurrentControlGains"/>
+    [Description("Filters and selects timestamped messages from the BrakeCurrentControlGains register.")]
+    public partial class TimestampedBrakeCurrentControlGains
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCurrentControlGains"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCurrentControlGains.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCurrentControlGains"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BrakeCurrentControlGainsPayload> GetPayload(HarpMessage message)
+        {
+            return BrakeCurrentControlGains.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.
+    /// </summary>
+    [Description("Closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.")]
+    public partial class BrakeCurrentSetPointMicroamps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCurrentSetPointMicroamps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 46;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCurrentSetPointMicroamps"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCurrentSetPointMicroamps"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCurrentSetPointMicroamps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCurrentSetPointMicroamps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCurrentSetPointMicroamps"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCurrentSetPointMicroamps"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCurrentSetPointMicroamps"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCurrentSetPointMicroamps"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCurrentSetPointMicroamps register.
+    /// </summary>
+    /// <seealso cref="BrakeCurrentSetPointMicroamps"/>
+    [Description("Filters and selects timestamped messages from the BrakeCurrentSetPointMicroamps register.")]
+    public partial class TimestampedBrakeCurrentSetPointMicroamps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCurrentSetPointMicroamps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCurrentSetPointMicroamps.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCurrentSetPointMicroamps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return BrakeCurrentSetPointMicroamps.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.
+    /// </summary>
+    [Description("Enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.")]
+    public partial class BrakeCurrentControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCurrentControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 47;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCurrentControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCurrentControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCurrentControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCurrentControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCurrentControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCurrentControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCurrentControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCurrentControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCurrentControl register.
+    /// </summary>
+    /// <seealso cref="BrakeCurrentControl"/>
+    [Description("Filters and selects timestamped messages from the BrakeCurrentControl register.")]
+    public partial class TimestampedBrakeCurrentControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCurrentControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCurrentControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCurrentControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return BrakeCurrentControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that state of the brake current controller. [Error (ADC counts), Integrator (DAC counts), Output (DAC counts)].
+    /// </summary>
+    [Description("State of the brake current controller. [Error (ADC counts), Integrator (DAC counts), Output (DAC counts)]")]
+    public partial class BrakeCurrentControlState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCurrentControlState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 48;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCurrentControlState"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCurrentControlState"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        static BrakeCurrentControlStatePayload ParsePayload(int[] payload)
+        {
+            BrakeCurrentControlStatePayload result;
+            result.Error = payload[0];
+            result.Integrator = payload[1];
+            result.Output = payload[2];
+            return result;
+        }
+
+        static int[] FormatPayload(BrakeCurrentControlStatePayload value)
+        {
+            int[] result;
+            result = new int[3];
+            result[0] = value.Error;
+            result[1] = value.Integrator;
+            result[2] = value.Output;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCurrentControlState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static BrakeCurrentControlStatePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<int>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCurrentControlState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BrakeCurrentControlStatePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<int>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCurrentControlState"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCurrentControlState"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, BrakeCurrentControlStatePayload value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCurrentControlState"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCurrentControlState"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, BrakeCurrentControlStatePayload value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCurrentControlState register.
+    /// </summary>
+    /// <seealso cref="BrakeCurrentControlState"/>
+    [Description("Filters and selects timestamped messages from the BrakeCurrentControlState register.")]
+    public partial class TimestampedBrakeCurrentControlState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCurrentControlState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCurrentControlState.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCurrentControlState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BrakeCurrentControlStatePayload> GetPayload(HarpMessage message)
+        {
+            return BrakeCurrentControlState.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).
+    /// </summary>
+    [Description("Encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).")]
+    public partial class EncoderVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 49;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EncoderVelocity"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EncoderVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EncoderVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EncoderVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EncoderVelocity"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderVelocity"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EncoderVelocity"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderVelocity"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EncoderVelocity register.
+    /// </summary>
+    /// <seealso cref="EncoderVelocity"/>
+    [Description("Filters and selects timestamped messages from the EncoderVelocity register.")]
+    public partial class TimestampedEncoderVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EncoderVelocity.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EncoderVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return EncoderVelocity.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that encoder acceleration in Q24.8 fixed-point counts per second squared.
+    /// </summary>
+    [Description("Encoder acceleration in Q24.8 fixed-point counts per second squared.")]
+    public partial class EncoderAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 50;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EncoderAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EncoderAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EncoderAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EncoderAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EncoderAcceleration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderAcceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EncoderAcceleration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderAcceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EncoderAcceleration register.
+    /// </summary>
+    /// <seealso cref="EncoderAcceleration"/>
+    [Description("Filters and selects timestamped messages from the EncoderAcceleration register.")]
+    public partial class TimestampedEncoderAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EncoderAcceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EncoderAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return EncoderAcceleration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that optional fields to append to SensorData events.
+    /// </summary>
+    [Description("Optional fields to append to SensorData events.")]
+    public partial class SensorDataFields
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataFields"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 51;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataFields"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataFields"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataFields"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SensorDataFields GetPayload(HarpMessage message)
+        {
+            return (SensorDataFields)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataFields"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SensorDataFields> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SensorDataFields)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataFields"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataFields"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SensorDataFields value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataFields"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataFields"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SensorDataFields value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataFields register.
+    /// </summary>
+    /// <seealso cref="SensorDataFields"/>
+    [Description("Filters and selects timestamped messages from the SensorDataFields register.")]
+    public partial class TimestampedSensorDataFields
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataFields"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataFields.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataFields"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SensorDataFields> GetPayload(HarpMessage message)
+        {
+            return SensorDataFields.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+    /// </summary>
+    [Description("CPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class EncoderReadCyclesSaved
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderReadCyclesSaved"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 52;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EncoderReadCyclesSaved"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EncoderReadCyclesSaved"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EncoderReadCyclesSaved"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EncoderReadCyclesSaved"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EncoderReadCyclesSaved"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderReadCyclesSaved"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EncoderReadCyclesSaved"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderReadCyclesSaved"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EncoderReadCyclesSaved register.
+    /// </summary>
+    /// <seealso cref="EncoderReadCyclesSaved"/>
+    [Description("Filters and selects timestamped messages from the EncoderReadCyclesSaved register.")]
+    public partial class TimestampedEncoderReadCyclesSaved
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderReadCyclesSaved"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EncoderReadCyclesSaved.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EncoderReadCyclesSaved"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return EncoderReadCyclesSaved.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.
+    /// </summary>
+    [Description("Time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.")]
+    public partial class TorqueLimitTripLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueLimitTripLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 53;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TorqueLimitTripLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TorqueLimitTripLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TorqueLimitTripLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TorqueLimitTripLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TorqueLimitTripLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueLimitTripLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TorqueLimitTripLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueLimitTripLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TorqueLimitTripLatency register.
+    /// </summary>
+    /// <seealso cref="TorqueLimitTripLatency"/>
+    [Description("Filters and selects timestamped messages from the TorqueLimitTripLatency register.")]
+    public partial class TimestampedTorqueLimitTripLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueLimitTripLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TorqueLimitTripLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TorqueLimitTripLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return TorqueLimitTripLatency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.
+    /// </summary>
+    [Description("Number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.")]
+    public partial class TorqueLimitFilterWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueLimitFilterWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 54;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TorqueLimitFilterWindow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TorqueLimitFilterWindow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TorqueLimitFilterWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TorqueLimitFilterWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TorqueLimitFilterWindow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueLimitFilterWindow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TorqueLimitFilterWindow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueLimitFilterWindow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TorqueLimitFilterWindow register.
+    /// </summary>
+    /// <seealso cref="TorqueLimitFilterWindow"/>
+    [Description("Filters and selects timestamped messages from the TorqueLimitFilterWindow register.")]
+    public partial class TimestampedTorqueLimitFilterWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueLimitFilterWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TorqueLimitFilterWindow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TorqueLimitFilterWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return TorqueLimitFilterWindow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.
+    /// </summary>
+    [Description("Margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.")]
+    public partial class TorqueLimitHysteresis
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueLimitHysteresis"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 55;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TorqueLimitHysteresis"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TorqueLimitHysteresis"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TorqueLimitHysteresis"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TorqueLimitHysteresis"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TorqueLimitHysteresis"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueLimitHysteresis"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TorqueLimitHysteresis"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueLimitHysteresis"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TorqueLimitHysteresis register.
+    /// </summary>
+    /// <seealso cref="TorqueLimitHysteresis"/>
+    [Description("Filters and selects timestamped messages from the TorqueLimitHysteresis register.")]
+    public partial class TimestampedTorqueLimitHysteresis
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueLimitHysteresis"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TorqueLimitHysteresis.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TorqueLimitHysteresis"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return TorqueLimitHysteresis.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that main loop period in microseconds since the last diagnostics reset [min, mean, max].
+    /// </summary>
+    [Description("Main loop period in microseconds since the last diagnostics reset [min, mean, max].")]
+    public partial class LoopPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoopPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 56;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoopPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoopPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoopPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoopPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoopPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoopPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoopPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoopPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoopPeriod register.
+    /// </summary>
+    /// <seealso cref="LoopPeriod"/>
+    [Description("Filters and selects timestamped messages from the LoopPeriod register.")]
+    public partial class TimestampedLoopPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoopPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoopPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoopPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return LoopPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].
+    /// </summary>
+    [Description("Count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].")]
+    public partial class DispatchLatenessHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DispatchLatenessHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 57;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DispatchLatenessHistogram"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DispatchLatenessHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DispatchLatenessHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DispatchLatenessHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DispatchLatenessHistogram"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DispatchLatenessHistogram"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DispatchLatenessHistogram"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DispatchLatenessHistogram"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DispatchLatenessHistogram register.
+    /// </summary>
+    /// <seealso cref="DispatchLatenessHistogram"/>
+    [Description("Filters and selects timestamped messages from the DispatchLatenessHistogram register.")]
+    public partial class TimestampedDispatchLatenessHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DispatchLatenessHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DispatchLatenessHistogram.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DispatchLatenessHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return DispatchLatenessHistogram.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.
+    /// </summary>
+    [Description("Number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.")]
+    public partial class MissedDeadlines
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MissedDeadlines"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 58;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MissedDeadlines"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MissedDeadlines"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MissedDeadlines"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MissedDeadlines"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MissedDeadlines"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MissedDeadlines"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MissedDeadlines"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MissedDeadlines"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MissedDeadlines register.
+    /// </summary>
+    /// <seealso cref="MissedDeadlines"/>
+    [Description("Filters and selects timestamped messages from the MissedDeadlines register.")]
+    public partial class TimestampedMissedDeadlines
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MissedDeadlines"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MissedDeadlines.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MissedDeadlines"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return MissedDeadlines.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of torque limit checks skipped because the torque monitor interrupt ran late.
+    /// </summary>
+    [Description("Number of torque limit checks skipped because the torque monitor interrupt ran late.")]
+    public partial class TorqueCheckOverruns
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueCheckOverruns"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 59;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TorqueCheckOverruns"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TorqueCheckOverruns"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TorqueCheckOverruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TorqueCheckOverruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TorqueCheckOverruns"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueCheckOverruns"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TorqueCheckOverruns"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueCheckOverruns"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TorqueCheckOverruns register.
+    /// </summary>
+    /// <seealso cref="TorqueCheckOverruns"/>
+    [Description("Filters and selects timestamped messages from the TorqueCheckOverruns register.")]
+    public partial class TimestampedTorqueCheckOverruns
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueCheckOverruns"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TorqueCheckOverruns.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TorqueCheckOverruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return TorqueCheckOverruns.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of events sent while the USB transmit buffer did not have room for them.
+    /// </summary>
+    [Description("Number of events sent while the USB transmit buffer did not have room for them.")]
+    public partial class UsbTxBackpressure
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UsbTxBackpressure"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="UsbTxBackpressure"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="UsbTxBackpressure"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="UsbTxBackpressure"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="UsbTxBackpressure"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="UsbTxBackpressure"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UsbTxBackpressure"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="UsbTxBackpressure"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UsbTxBackpressure"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// UsbTxBackpressure register.
+    /// </summary>
+    /// <seealso cref="UsbTxBackpressure"/>
+    [Description("Filters and selects timestamped messages from the UsbTxBackpressure register.")]
+    public partial class TimestampedUsbTxBackpressure
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UsbTxBackpressure"/> register. This field is constant.
+        /// </summary>
+        public const int Address = UsbTxBackpressure.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="UsbTxBackpressure"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return UsbTxBackpressure.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.
+    /// </summary>
+    [Description("Write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.")]
+    public partial class ResetDiagnostics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ResetDiagnostics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ResetDiagnostics"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ResetDiagnostics"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ResetDiagnostics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ResetDiagnostics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ResetDiagnostics"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ResetDiagnostics"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ResetDiagnostics"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ResetDiagnostics"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ResetDiagnostics register.
+    /// </summary>
+    /// <seealso cref="ResetDiagnostics"/>
+    [Description("Filters and selects timestamped messages from the ResetDiagnostics register.")]
+    public partial class TimestampedResetDiagnostics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ResetDiagnostics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ResetDiagnostics.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ResetDiagnostics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return ResetDiagnostics.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.
+    /// </summary>
+    [Description("Index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.")]
+    public partial class BrakeTrajectoryWriteIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectoryWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeTrajectoryWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeTrajectoryWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeTrajectoryWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeTrajectoryWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeTrajectoryWriteIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectoryWriteIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeTrajectoryWriteIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectoryWriteIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeTrajectoryWriteIndex register.
+    /// </summary>
+    /// <seealso cref="BrakeTrajectoryWriteIndex"/>
+    [Description("Filters and selects timestamped messages from the BrakeTrajectoryWriteIndex register.")]
+    public partial class TimestampedBrakeTrajectoryWriteIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectoryWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeTrajectoryWriteIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeTrajectoryWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return BrakeTrajectoryWriteIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.
+    /// </summary>
+    [Description("Up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.")]
+    public partial class BrakeTrajectoryData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectoryData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeTrajectoryData"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeTrajectoryData"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 120;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeTrajectoryData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeTrajectoryData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeTrajectoryData"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectoryData"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeTrajectoryData"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectoryData"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeTrajectoryData register.
+    /// </summary>
+    /// <seealso cref="BrakeTrajectoryData"/>
+    [Description("Filters and selects timestamped messages from the BrakeTrajectoryData register.")]
+    public partial class TimestampedBrakeTrajectoryData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectoryData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeTrajectoryData.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeTrajectoryData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return BrakeTrajectoryData.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of back trajectory table points to play.
+    /// </summary>
+    [Description("Number of back trajectory table points to play.")]
+    public partial class BrakeTrajectoryLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectoryLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeTrajectoryLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeTrajectoryLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeTrajectoryLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeTrajectoryLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeTrajectoryLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectoryLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeTrajectoryLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectoryLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeTrajectoryLength register.
+    /// </summary>
+    /// <seealso cref="BrakeTrajectoryLength"/>
+    [Description("Filters and selects timestamped messages from the BrakeTrajectoryLength register.")]
+    public partial class TimestampedBrakeTrajectoryLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectoryLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeTrajectoryLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeTrajectoryLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return BrakeTrajectoryLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.
+    /// </summary>
+    [Description("Rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.")]
+    public partial class BrakeTrajectorySampleRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectorySampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeTrajectorySampleRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeTrajectorySampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeTrajectorySampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeTrajectorySampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeTrajectorySampleRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectorySampleRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeTrajectorySampleRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectorySampleRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeTrajectorySampleRate register.
+    /// </summary>
+    /// <seealso cref="BrakeTrajectorySampleRate"/>
+    [Description("Filters and selects timestamped messages from the BrakeTrajectorySampleRate register.")]
+    public partial class TimestampedBrakeTrajectorySampleRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectorySampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeTrajectorySampleRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeTrajectorySampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return BrakeTrajectorySampleRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.
+    /// </summary>
+    [Description("0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.")]
+    public partial class BrakeTrajectoryPlayback
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectoryPlayback"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeTrajectoryPlayback"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeTrajectoryPlayback"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeTrajectoryPlayback"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TrajectoryPlayback GetPayload(HarpMessage message)
+        {
+            return (TrajectoryPlayback)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeTrajectoryPlayback"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TrajectoryPlayback> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TrajectoryPlayback)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeTrajectoryPlayback"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectoryPlayback"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TrajectoryPlayback value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeTrajectoryPlayback"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTrajectoryPlayback"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TrajectoryPlayback value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeTrajectoryPlayback register.
+    /// </summary>
+    /// <seealso cref="BrakeTrajectoryPlayback"/>
+    [Description("Filters and selects timestamped messages from the BrakeTrajectoryPlayback register.")]
+    public partial class TimestampedBrakeTrajectoryPlayback
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTrajectoryPlayback"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeTrajectoryPlayback.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeTrajectoryPlayback"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TrajectoryPlayback> GetPayload(HarpMessage message)
+        {
+            return BrakeTrajectoryPlayback.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.
+    /// </summary>
+    [Description("Index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.")]
+    public partial class BrakeMapWriteIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeMapWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeMapWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeMapWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeMapWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeMapWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeMapWriteIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeMapWriteIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeMapWriteIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeMapWriteIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeMapWriteIndex register.
+    /// </summary>
+    /// <seealso cref="BrakeMapWriteIndex"/>
+    [Description("Filters and selects timestamped messages from the BrakeMapWriteIndex register.")]
+    public partial class TimestampedBrakeMapWriteIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeMapWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeMapWriteIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeMapWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return BrakeMapWriteIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.
+    /// </summary>
+    [Description("Up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.")]
+    public partial class BrakeMapData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeMapData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeMapData"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeMapData"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 120;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeMapData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeMapData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeMapData"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeMapData"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeMapData"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeMapData"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeMapData register.
+    /// </summary>
+    /// <seealso cref="BrakeMapData"/>
+    [Description("Filters and selects timestamped messages from the BrakeMapData register.")]
+    public partial class TimestampedBrakeMapData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeMapData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeMapData.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeMapData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return BrakeMapData.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.
+    /// </summary>
+    [Description("Back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.")]
+    public partial class BrakeMapConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeMapConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeMapConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeMapConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeMapConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeMapConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeMapConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeMapConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeMapConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeMapConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeMapConfig register.
+    /// </summary>
+    /// <seealso cref="BrakeMapConfig"/>
+    [Description("Filters and selects timestamped messages from the BrakeMapConfig register.")]
+    public partial class TimestampedBrakeMapConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeMapConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeMapConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeMapConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return BrakeMapConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.
+    /// </summary>
+    [Description("Writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.")]
+    public partial class BrakeMap
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeMap"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeMap"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeMap"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeMap"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeMap"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeMap"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeMap"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeMap"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeMap"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeMap register.
+    /// </summary>
+    /// <seealso cref="BrakeMap"/>
+    [Description("Filters and selects timestamped messages from the BrakeMap register.")]
+    public partial class TimestampedBrakeMap
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeMap"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeMap.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeMap"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return BrakeMap.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.
+    /// </summary>
+    [Description("Virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.")]
+    public partial class VirtualLoadParams
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualLoadParams"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="VirtualLoadParams"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="VirtualLoadParams"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="VirtualLoadParams"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="VirtualLoadParams"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="VirtualLoadParams"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualLoadParams"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="VirtualLoadParams"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualLoadParams"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// VirtualLoadParams register.
+    /// </summary>
+    /// <seealso cref="VirtualLoadParams"/>
+    [Description("Filters and selects timestamped messages from the VirtualLoadParams register.")]
+    public partial class TimestampedVirtualLoadParams
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualLoadParams"/> register. This field is constant.
+        /// </summary>
+        public const int Address = VirtualLoadParams.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="VirtualLoadParams"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return VirtualLoadParams.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.
+    /// </summary>
+    [Description("Writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.")]
+    public partial class VirtualLoad
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualLoad"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="VirtualLoad"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="VirtualLoad"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="VirtualLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="VirtualLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="VirtualLoad"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualLoad"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="VirtualLoad"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualLoad"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// VirtualLoad register.
+    /// </summary>
+    /// <seealso cref="VirtualLoad"/>
+    [Description("Filters and selects timestamped messages from the VirtualLoad register.")]
+    public partial class TimestampedVirtualLoad
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualLoad"/> register. This field is constant.
+        /// </summary>
+        public const int Address = VirtualLoad.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="VirtualLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return VirtualLoad.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.
+    /// </summary>
+    [Description("Compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.")]
+    public partial class SensorDataPacked
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataPacked"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataPacked"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataPacked"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataPacked"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataPacked"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataPacked"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataPacked"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataPacked"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataPacked"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataPacked register.
+    /// </summary>
+    /// <seealso cref="SensorDataPacked"/>
+    [Description("Filters and selects timestamped messages from the SensorDataPacked register.")]
+    public partial class TimestampedSensorDataPacked
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataPacked"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataPacked.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataPacked"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return SensorDataPacked.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the event format used for periodic sensor data dispatch.
+    /// </summary>
+    [Description("Selects the event format used for periodic sensor data dispatch.")]
+    public partial class SensorDataFormat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataFormat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataFormat"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataFormat"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataFormat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SensorDataFormat GetPayload(HarpMessage message)
+        {
+            return (SensorDataFormat)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataFormat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SensorDataFormat> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SensorDataFormat)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataFormat"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataFormat"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SensorDataFormat value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataFormat"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataFormat"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SensorDataFormat value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataFormat register.
+    /// </summary>
+    /// <seealso cref="SensorDataFormat"/>
+    [Description("Filters and selects timestamped messages from the SensorDataFormat register.")]
+    public partial class TimestampedSensorDataFormat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataFormat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataFormat.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataFormat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SensorDataFormat> GetPayload(HarpMessage message)
+        {
+            return SensorDataFormat.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.
+    /// </summary>
+    [Description("Change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.")]
+    public partial class SensorDataDispatchDeadband
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataDispatchDeadband"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataDispatchDeadband"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataDispatchDeadband"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataDispatchDeadband"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataDispatchDeadband"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataDispatchDeadband"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataDispatchDeadband"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataDispatchDeadband"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataDispatchDeadband"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataDispatchDeadband register.
+    /// </summary>
+    /// <seealso cref="SensorDataDispatchDeadband"/>
+    [Description("Filters and selects timestamped messages from the SensorDataDispatchDeadband register.")]
+    public partial class TimestampedSensorDataDispatchDeadband
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataDispatchDeadband"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataDispatchDeadband.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataDispatchDeadband"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return SensorDataDispatchDeadband.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.
+    /// </summary>
+    [Description("Longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.")]
+    public partial class SensorDataDispatchHeartbeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataDispatchHeartbeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataDispatchHeartbeat"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataDispatchHeartbeat"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataDispatchHeartbeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataDispatchHeartbeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataDispatchHeartbeat"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataDispatchHeartbeat"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataDispatchHeartbeat"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataDispatchHeartbeat"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataDispatchHeartbeat register.
+    /// </summary>
+    /// <seealso cref="SensorDataDispatchHeartbeat"/>
+    [Description("Filters and selects timestamped messages from the SensorDataDispatchHeartbeat register.")]
+    public partial class TimestampedSensorDataDispatchHeartbeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataDispatchHeartbeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataDispatchHeartbeat.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataDispatchHeartbeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SensorDataDispatchHeartbeat.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that extended alternative to SensorData, emitted instead of it when SensorDataFormat is Stats. Reduces every torque and load current ADC conversion since the previous event to [Encoder, SampleCount, TorqueMin, TorqueMax, TorqueMean, TorqueLoadCurrentMin, TorqueLoadCurrentMax, TorqueLoadCurrentMean]. Encoder is the latest value. SampleCount is the number of torque conversions. Conversions are tared like SensorData but never filtered. Fields enabled in SensorDataFields are appended in bit order.
+    /// </summary>
+    [Description("Extended alternative to SensorData, emitted instead of it when SensorDataFormat is Stats. Reduces every torque and load current ADC conversion since the previous event to [Encoder, SampleCount, TorqueMin, TorqueMax, TorqueMean, TorqueLoadCurrentMin, TorqueLoadCurrentMax, TorqueLoadCurrentMean]. Encoder is the latest value. SampleCount is the number of torque conversions. Conversions are tared like SensorData but never filtered. Fields enabled in SensorDataFields are appended in bit order.")]
+    public partial class SensorDataStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorDataStats"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorDataStats"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 10;
+
+        static SensorDataStatsPayload ParsePayload(int[] payload)
+        {
+            SensorDataStatsPayload result;
+            result.Encoder = payload[0];
+            result.SampleCount = payload[1];
+            result.TorqueMin = payload[2];
+            result.TorqueMax = payload[3];
+            result.TorqueMean = payload[4];
+            result.TorqueLoadCurrentMin = payload[5];
+            result.TorqueLoadCurrentMax = payload[6];
+            result.TorqueLoadCurrentMean = payload[7];
+            return result;
+        }
+
+        static int[] FormatPayload(SensorDataStatsPayload value)
+        {
+            int[] result;
+            result = new int[10];
+            result[0] = value.Encoder;
+            result[1] = value.SampleCount;
+            result[2] = value.TorqueMin;
+            result[3] = value.TorqueMax;
+            result[4] = value.TorqueMean;
+            result[5] = value.TorqueLoadCurrentMin;
+            result[6] = value.TorqueLoadCurrentMax;
+            result[7] = value.TorqueLoadCurrentMean;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorDataStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SensorDataStatsPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<int>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorDataStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SensorDataStatsPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<int>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorDataStats"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataStats"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SensorDataStatsPayload value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorDataStats"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorDataStats"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SensorDataStatsPayload value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorDataStats register.
+    /// </summary>
+    /// <seealso cref="SensorDataStats"/>
+    [Description("Filters and selects timestamped messages from the SensorDataStats register.")]
+    public partial class TimestampedSensorDataStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorDataStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorDataStats.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorDataStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SensorDataStatsPayload> GetPayload(HarpMessage message)
+        {
+            return SensorDataStats.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.
+    /// </summary>
+    [Description("Staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.")]
+    public partial class BrakeCalibrationWriteIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCalibrationWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCalibrationWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCalibrationWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCalibrationWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCalibrationWriteIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationWriteIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCalibrationWriteIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationWriteIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCalibrationWriteIndex register.
+    /// </summary>
+    /// <seealso cref="BrakeCalibrationWriteIndex"/>
+    [Description("Filters and selects timestamped messages from the BrakeCalibrationWriteIndex register.")]
+    public partial class TimestampedBrakeCalibrationWriteIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationWriteIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCalibrationWriteIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCalibrationWriteIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return BrakeCalibrationWriteIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.
+    /// </summary>
+    [Description("Up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.")]
+    public partial class BrakeCalibrationData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCalibrationData"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCalibrationData"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 120;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCalibrationData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCalibrationData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCalibrationData"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationData"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCalibrationData"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationData"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCalibrationData register.
+    /// </summary>
+    /// <seealso cref="BrakeCalibrationData"/>
+    [Description("Filters and selects timestamped messages from the BrakeCalibrationData register.")]
+    public partial class TimestampedBrakeCalibrationData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCalibrationData.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCalibrationData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return BrakeCalibrationData.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.
+    /// </summary>
+    [Description("Staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.")]
+    public partial class BrakeCalibrationConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCalibrationConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCalibrationConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCalibrationConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCalibrationConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCalibrationConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCalibrationConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCalibrationConfig register.
+    /// </summary>
+    /// <seealso cref="BrakeCalibrationConfig"/>
+    [Description("Filters and selects timestamped messages from the BrakeCalibrationConfig register.")]
+    public partial class TimestampedBrakeCalibrationConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCalibrationConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCalibrationConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return BrakeCalibrationConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.
+    /// </summary>
+    [Description("Writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.")]
+    public partial class BrakeCalibrationStore
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationStore"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCalibrationStore"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCalibrationStore"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCalibrationStore"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCalibrationStore"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCalibrationStore"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationStore"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCalibrationStore"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationStore"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCalibrationStore register.
+    /// </summary>
+    /// <seealso cref="BrakeCalibrationStore"/>
+    [Description("Filters and selects timestamped messages from the BrakeCalibrationStore register.")]
+    public partial class TimestampedBrakeCalibrationStore
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationStore"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCalibrationStore.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCalibrationStore"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return BrakeCalibrationStore.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.
+    /// </summary>
+    [Description("Checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.")]
+    public partial class BrakeCalibrationChecksum
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationChecksum"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeCalibrationChecksum"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeCalibrationChecksum"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeCalibrationChecksum"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeCalibrationChecksum"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeCalibrationChecksum"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationChecksum"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeCalibrationChecksum"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeCalibrationChecksum"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeCalibrationChecksum register.
+    /// </summary>
+    /// <seealso cref="BrakeCalibrationChecksum"/>
+    [Description("Filters and selects timestamped messages from the BrakeCalibrationChecksum register.")]
+    public partial class TimestampedBrakeCalibrationChecksum
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeCalibrationChecksum"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeCalibrationChecksum.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeCalibrationChecksum"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return BrakeCalibrationChecksum.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.
+    /// </summary>
+    [Description("Brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.")]
+    public partial class BrakeTorqueSetPoint
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTorqueSetPoint"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeTorqueSetPoint"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeTorqueSetPoint"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeTorqueSetPoint"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeTorqueSetPoint"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeTorqueSetPoint"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTorqueSetPoint"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeTorqueSetPoint"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeTorqueSetPoint"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeTorqueSetPoint register.
+    /// </summary>
+    /// <seealso cref="BrakeTorqueSetPoint"/>
+    [Description("Filters and selects timestamped messages from the BrakeTorqueSetPoint register.")]
+    public partial class TimestampedBrakeTorqueSetPoint
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeTorqueSetPoint"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeTorqueSetPoint.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeTorqueSetPoint"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return BrakeTorqueSetPoint.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.
+    /// </summary>
+    [Description("Raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.")]
+    public partial class TorqueLimits
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueLimits"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TorqueLimits"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TorqueLimits"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TorqueLimits"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TorqueLimits"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TorqueLimits"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueLimits"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TorqueLimits"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TorqueLimits"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TorqueLimits register.
+    /// </summary>
+    /// <seealso cref="TorqueLimits"/>
+    [Description("Filters and selects timestamped messages from the TorqueLimits register.")]
+    public partial class TimestampedTorqueLimits
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TorqueLimits"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TorqueLimits.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TorqueLimits"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return TorqueLimits.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.
+    /// </summary>
+    [Description("Save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.")]
+    public partial class PersistentConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PersistentConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PersistentConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PersistentConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PersistentConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PersistentConfigAction GetPayload(HarpMessage message)
+        {
+            return (PersistentConfigAction)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PersistentConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PersistentConfigAction> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PersistentConfigAction)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PersistentConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PersistentConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PersistentConfigAction value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PersistentConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PersistentConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PersistentConfigAction value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PersistentConfig register.
+    /// </summary>
+    /// <seealso cref="PersistentConfig"/>
+    [Description("Filters and selects timestamped messages from the PersistentConfig register.")]
+    public partial class TimestampedPersistentConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PersistentConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PersistentConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PersistentConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PersistentConfigAction> GetPayload(HarpMessage message)
+        {
+            return PersistentConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.
+    /// </summary>
+    [Description("Furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.")]
+    public partial class SensorSkew
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorSkew"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorSkew"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorSkew"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorSkew"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorSkew"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorSkew"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorSkew"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorSkew register.
+    /// </summary>
+    /// <seealso cref="SensorSkew"/>
+    [Description("Filters and selects timestamped messages from the SensorSkew register.")]
+    public partial class TimestampedSensorSkew
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorSkew"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorSkew.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return SensorSkew.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.
+    /// </summary>
+    [Description("Full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.")]
+    public partial class FlightRecorder
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorder"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlightRecorder"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlightRecorder"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlightRecorder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FlightRecorderAction GetPayload(HarpMessage message)
+        {
+            return (FlightRecorderAction)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlightRecorder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlightRecorderAction> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FlightRecorderAction)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlightRecorder"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorder"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FlightRecorderAction value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlightRecorder"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorder"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FlightRecorderAction value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlightRecorder register.
+    /// </summary>
+    /// <seealso cref="FlightRecorder"/>
+    [Description("Filters and selects timestamped messages from the FlightRecorder register.")]
+    public partial class TimestampedFlightRecorder
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorder"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlightRecorder.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlightRecorder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlightRecorderAction> GetPayload(HarpMessage message)
+        {
+            return FlightRecorder.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.
+    /// </summary>
+    [Description("Samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.")]
+    public partial class FlightRecorderWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorderWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlightRecorderWindow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlightRecorderWindow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlightRecorderWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlightRecorderWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlightRecorderWindow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorderWindow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlightRecorderWindow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorderWindow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlightRecorderWindow register.
+    /// </summary>
+    /// <seealso cref="FlightRecorderWindow"/>
+    [Description("Filters and selects timestamped messages from the FlightRecorderWindow register.")]
+    public partial class TimestampedFlightRecorderWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorderWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlightRecorderWindow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlightRecorderWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return FlightRecorderWindow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.
+    /// </summary>
+    [Description("Record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.")]
+    public partial class FlightRecorderReadIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorderReadIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 89;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlightRecorderReadIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlightRecorderReadIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlightRecorderReadIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlightRecorderReadIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlightRecorderReadIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorderReadIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlightRecorderReadIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorderReadIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlightRecorderReadIndex register.
+    /// </summary>
+    /// <seealso cref="FlightRecorderReadIndex"/>
+    [Description("Filters and selects timestamped messages from the FlightRecorderReadIndex register.")]
+    public partial class TimestampedFlightRecorderReadIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorderReadIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlightRecorderReadIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlightRecorderReadIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return FlightRecorderReadIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.
+    /// </summary>
+    [Description("Up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.")]
+    public partial class FlightRecorderData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorderData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 90;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlightRecorderData"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlightRecorderData"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 240;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlightRecorderData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlightRecorderData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlightRecorderData"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorderData"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlightRecorderData"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorderData"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlightRecorderData register.
+    /// </summary>
+    /// <seealso cref="FlightRecorderData"/>
+    [Description("Filters and selects timestamped messages from the FlightRecorderData register.")]
+    public partial class TimestampedFlightRecorderData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorderData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlightRecorderData.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlightRecorderData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return FlightRecorderData.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.
+    /// </summary>
+    [Description("Frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.")]
+    public partial class FlightRecorderCapture
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorderCapture"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 91;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlightRecorderCapture"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlightRecorderCapture"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlightRecorderCapture"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlightRecorderCapture"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlightRecorderCapture"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorderCapture"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlightRecorderCapture"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlightRecorderCapture"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlightRecorderCapture register.
+    /// </summary>
+    /// <seealso cref="FlightRecorderCapture"/>
+    [Description("Filters and selects timestamped messages from the FlightRecorderCapture register.")]
+    public partial class TimestampedFlightRecorderCapture
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlightRecorderCapture"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlightRecorderCapture.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlightRecorderCapture"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return FlightRecorderCapture.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.
+    /// </summary>
+    [Description("Per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.")]
+    public partial class EncoderTare
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderTare"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 92;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EncoderTare"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EncoderTare"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EncoderTare"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EncoderTare"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EncoderTare"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderTare"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EncoderTare"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EncoderTare"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EncoderTare register.
+    /// </summary>
+    /// <seealso cref="EncoderTare"/>
+    [Description("Filters and selects timestamped messages from the EncoderTare register.")]
+    public partial class TimestampedEncoderTare
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EncoderTare"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EncoderTare.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EncoderTare"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return EncoderTare.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+    /// </summary>
+    [Description("Mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class AuxEncoderReadCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AuxEncoderReadCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 93;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AuxEncoderReadCycles"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AuxEncoderReadCycles"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AuxEncoderReadCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AuxEncoderReadCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AuxEncoderReadCycles"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AuxEncoderReadCycles"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AuxEncoderReadCycles"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AuxEncoderReadCycles"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AuxEncoderReadCycles register.
+    /// </summary>
+    /// <seealso cref="AuxEncoderReadCycles"/>
+    [Description("Filters and selects timestamped messages from the AuxEncoderReadCycles register.")]
+    public partial class TimestampedAuxEncoderReadCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AuxEncoderReadCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AuxEncoderReadCycles.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AuxEncoderReadCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return AuxEncoderReadCycles.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.
+    /// </summary>
+    [Description("Brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.")]
+    public partial class BrakeStepTest
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTest"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 94;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeStepTest"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeStepTest"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeStepTest"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static BrakeStepTestAction GetPayload(HarpMessage message)
+        {
+            return (BrakeStepTestAction)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeStepTest"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BrakeStepTestAction> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((BrakeStepTestAction)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeStepTest"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTest"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, BrakeStepTestAction value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeStepTest"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTest"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, BrakeStepTestAction value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeStepTest register.
+    /// </summary>
+    /// <seealso cref="BrakeStepTest"/>
+    [Description("Filters and selects timestamped messages from the BrakeStepTest register.")]
+    public partial class TimestampedBrakeStepTest
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTest"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeStepTest.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeStepTest"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BrakeStepTestAction> GetPayload(HarpMessage message)
+        {
+            return BrakeStepTest.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.
+    /// </summary>
+    [Description("Brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.")]
+    public partial class BrakeStepTestConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTestConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 95;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeStepTestConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeStepTestConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeStepTestConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeStepTestConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeStepTestConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTestConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeStepTestConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTestConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeStepTestConfig register.
+    /// </summary>
+    /// <seealso cref="BrakeStepTestConfig"/>
+    [Description("Filters and selects timestamped messages from the BrakeStepTestConfig register.")]
+    public partial class TimestampedBrakeStepTestConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTestConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeStepTestConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeStepTestConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return BrakeStepTestConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.
+    /// </summary>
+    [Description("Brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.")]
+    public partial class BrakeStepTestResults
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTestResults"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 96;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeStepTestResults"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeStepTestResults"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeStepTestResults"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeStepTestResults"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeStepTestResults"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTestResults"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeStepTestResults"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTestResults"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeStepTestResults register.
+    /// </summary>
+    /// <seealso cref="BrakeStepTestResults"/>
+    [Description("Filters and selects timestamped messages from the BrakeStepTestResults register.")]
+    public partial class TimestampedBrakeStepTestResults
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTestResults"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeStepTestResults.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeStepTestResults"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return BrakeStepTestResults.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.
+    /// </summary>
+    [Description("Time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.")]
+    public partial class BrakeSetpointLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeSetpointLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 97;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeSetpointLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeSetpointLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeSetpointLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeSetpointLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeSetpointLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeSetpointLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeSetpointLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeSetpointLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeSetpointLatency register.
+    /// </summary>
+    /// <seealso cref="BrakeSetpointLatency"/>
+    [Description("Filters and selects timestamped messages from the BrakeSetpointLatency register.")]
+    public partial class TimestampedBrakeSetpointLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeSetpointLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeSetpointLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeSetpointLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return BrakeSetpointLatency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.
+    /// </summary>
+    [Description("Sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.")]
+    public partial class BrakeStepTraceReadIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTraceReadIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 98;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeStepTraceReadIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeStepTraceReadIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeStepTraceReadIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeStepTraceReadIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeStepTraceReadIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTraceReadIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeStepTraceReadIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTraceReadIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeStepTraceReadIndex register.
+    /// </summary>
+    /// <seealso cref="BrakeStepTraceReadIndex"/>
+    [Description("Filters and selects timestamped messages from the BrakeStepTraceReadIndex register.")]
+    public partial class TimestampedBrakeStepTraceReadIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTraceReadIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeStepTraceReadIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeStepTraceReadIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return BrakeStepTraceReadIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.
+    /// </summary>
+    [Description("Up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.")]
+    public partial class BrakeStepTrace
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTrace"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 99;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeStepTrace"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeStepTrace"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 120;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeStepTrace"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeStepTrace"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeStepTrace"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTrace"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeStepTrace"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTrace"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeStepTrace register.
+    /// </summary>
+    /// <seealso cref="BrakeStepTrace"/>
+    [Description("Filters and selects timestamped messages from the BrakeStepTrace register.")]
+    public partial class TimestampedBrakeStepTrace
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTrace"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeStepTrace.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeStepTrace"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return BrakeStepTrace.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.
+    /// </summary>
+    [Description("Brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.")]
+    public partial class BrakeStepTraceInfo
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTraceInfo"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 100;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BrakeStepTraceInfo"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BrakeStepTraceInfo"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BrakeStepTraceInfo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BrakeStepTraceInfo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BrakeStepTraceInfo"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTraceInfo"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BrakeStepTraceInfo"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BrakeStepTraceInfo"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BrakeStepTraceInfo register.
+    /// </summary>
+    /// <seealso cref="BrakeStepTraceInfo"/>
+    [Description("Filters and selects timestamped messages from the BrakeStepTraceInfo register.")]
+    public partial class TimestampedBrakeStepTraceInfo
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BrakeStepTraceInfo"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BrakeStepTraceInfo.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BrakeStepTraceInfo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return BrakeStepTraceInfo.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.
+    /// </summary>
+    [Description("Value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.")]
+    public partial class AuxAnalogDispatchRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AuxAnalogDispatchRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 101;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AuxAnalogDispatchRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AuxAnalogDispatchRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AuxAnalogDispatchRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AuxAnalogDispatchRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AuxAnalogDispatchRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AuxAnalogDispatchRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AuxAnalogDispatchRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AuxAnalogDispatchRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AuxAnalogDispatchRate register.
+    /// </summary>
+    /// <seealso cref="AuxAnalogDispatchRate"/>
+    [Description("Filters and selects timestamped messages from the AuxAnalogDispatchRate register.")]
+    public partial class TimestampedAuxAnalogDispatchRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AuxAnalogDispatchRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AuxAnalogDispatchRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AuxAnalogDispatchRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return AuxAnalogDispatchRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).
+    /// </summary>
+    [Description("Auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).")]
+    public partial class AuxAnalog
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AuxAnalog"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 102;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AuxAnalog"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AuxAnalog"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AuxAnalog"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AuxAnalog"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AuxAnalog"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AuxAnalog"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AuxAnalog"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AuxAnalog"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AuxAnalog register.
+    /// </summary>
+    /// <seealso cref="AuxAnalog"/>
+    [Description("Filters and selects timestamped messages from the AuxAnalog register.")]
+    public partial class TimestampedAuxAnalog
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AuxAnalog"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AuxAnalog.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AuxAnalog"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return AuxAnalog.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.
+    /// </summary>
+    [Description("Auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.")]
+    public partial class AuxAnalogSampling
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AuxAnalogSampling"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 103;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AuxAnalogSampling"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AuxAnalogSampling"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AuxAnalogSampling"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AuxAnalogSampling"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AuxAnalogSampling"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AuxAnalogSampling"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AuxAnalogSampling"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AuxAnalogSampling"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AuxAnalogSampling register.
+    /// </summary>
+    /// <seealso cref="AuxAnalogSampling"/>
+    [Description("Filters and selects timestamped messages from the AuxAnalogSampling register.")]
+    public partial class TimestampedAuxAnalogSampling
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AuxAnalogSampling"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AuxAnalogSampling.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AuxAnalogSampling"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return AuxAnalogSampling.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that filter applied to every conversion of [Torque, TorqueLoadCurrent]. While a filter is on, SensorData and every other report of that sensor carry the filter's latest output instead of the latest conversion, and tares use it too. Every filter first averages 16 conversions, and the Butterworth lowpasses (4th order) then run at that decimated rate, with cutoffs given as a fraction of it. Filters add delay, so SensorSkew no longer bounds a filtered sensor's age. The torque limit always checks raw conversions. Defaults to Off.
+    /// </summary>
+    [Description("Filter applied to every conversion of [Torque, TorqueLoadCurrent]. While a filter is on, SensorData and every other report of that sensor carry the filter's latest output instead of the latest conversion, and tares use it too. Every filter first averages 16 conversions, and the Butterworth lowpasses (4th order) then run at that decimated rate, with cutoffs given as a fraction of it. Filters add delay, so SensorSkew no longer bounds a filtered sensor's age. The torque limit always checks raw conversions. Defaults to Off.")]
+    public partial class SensorFilters
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorFilters"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 104;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorFilters"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorFilters"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static SensorFiltersPayload ParsePayload(byte[] payload)
+        {
+            SensorFiltersPayload result;
+            result.Torque = (SensorFilterPreset)payload[0];
+            result.TorqueLoadCurrent = (SensorFilterPreset)payload[1];
+            return result;
+        }
+
+        static byte[] FormatPayload(SensorFiltersPayload value)
+        {
+            byte[] result;
+            result = new byte[2];
+            result[0] = (byte)value.Torque;
+            result[1] = (byte)value.TorqueLoadCurrent;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorFilters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SensorFiltersPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorFilters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SensorFiltersPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorFilters"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorFilters"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SensorFiltersPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorFilters"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorFilters"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SensorFiltersPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorFilters register.
+    /// </summary>
+    /// <seealso cref="SensorFilters"/>
+    [Description("Filters and selects timestamped messages from the SensorFilters register.")]
+    public partial class TimestampedSensorFilters
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorFilters"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorFilters.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorFilters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SensorFiltersPayload> GetPayload(HarpMessage message)
+        {
+            return SensorFilters.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.
+    /// </summary>
+    [Description("-3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.")]
+    public partial class SensorFilterCutoff
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorFilterCutoff"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 105;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorFilterCutoff"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorFilterCutoff"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorFilterCutoff"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorFilterCutoff"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorFilterCutoff"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorFilterCutoff"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorFilterCutoff"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorFilterCutoff"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorFilterCutoff register.
+    /// </summary>
+    /// <seealso cref="SensorFilterCutoff"/>
+    [Description("Filters and selects timestamped messages from the SensorFilterCutoff register.")]
+    public partial class TimestampedSensorFilterCutoff
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorFilterCutoff"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorFilterCutoff.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorFilterCutoff"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return SensorFilterCutoff.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+    /// </summary>
+    [Description("CPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class SensorFilterCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorFilterCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 106;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SensorFilterCycles"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SensorFilterCycles"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SensorFilterCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SensorFilterCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SensorFilterCycles"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorFilterCycles"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SensorFilterCycles"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SensorFilterCycles"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SensorFilterCycles register.
+    /// </summary>
+    /// <seealso cref="SensorFilterCycles"/>
+    [Description("Filters and selects timestamped messages from the SensorFilterCycles register.")]
+    public partial class TimestampedSensorFilterCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SensorFilterCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SensorFilterCycles.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SensorFilterCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return SensorFilterCycles.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// Treadmill device.
     /// </summary>
-    /// <seealso cref="CreateEncoderPayload"/>
-    /// <seealso cref="CreateTorquePayload"/>
-    /// <seealso cref="CreateTorqueLoadCurrentPayload"/>
-    /// <seealso cref="CreateSensorDataPayload"/>
-    /// <seealso cref="CreateSensorDataDispatchRatePayload"/>
-    /// <seealso cref="CreateBrakeCurrentSetPointPayload"/>
-    /// <seealso cref="CreateTareSensorsPayload"/>
-    /// <seealso cref="CreateResetTareSensorsPayload"/>
-    /// <seealso cref="CreateEnableTorqueLimitPayload"/>
-    /// <seealso cref="CreateTorqueLimitStatePayload"/>
-    [XmlInclude(typeof(CreateEncoderPayload))]
-    [XmlInclude(typeof(CreateTorquePayload))]
-    [XmlInclude(typeof(CreateTorqueLoadCurrentPayload))]
-    [XmlInclude(typeof(CreateSensorDataPayload))]
-    [XmlInclude(typeof(CreateSensorDataDispatchRatePayload))]
-    [XmlInclude(typeof(CreateBrakeCurrentSetPointPayload))]
-    [XmlInclude(typeof(CreateTareSensorsPayload))]
-    [XmlInclude(typeof(CreateResetTareSensorsPayload))]
-    [XmlInclude(typeof(CreateEnableTorqueLimitPayload))]
-    [XmlInclude(typeof(CreateTorqueLimitStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedEncoderPayload))]
-    [XmlInclude(typeof(CreateTimestampedTorquePayload))]
-    [XmlInclude(typeof(CreateTimestampedTorqueLoadCurrentPayload))]
-    [XmlInclude(typeof(CreateTimestampedSensorDataPayload))]
-    [XmlInclude(typeof(CreateTimestampedSensorDataDispatchRatePayload))]
-    [XmlInclude(typeof(CreateTimestampedBrakeCurrentSetPointPayload))]
-    [XmlInclude(typeof(CreateTimestampedTareSensorsPayload))]
-    [XmlInclude(typeof(CreateTimestampedResetTareSensorsPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableTorqueLimitPayload))]
-    [XmlInclude(typeof(CreateTimestampedTorqueLimitStatePayload))]
-    [Description("Creates standard message payloads for the Treadmill device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateEncoderPayload"/>
+    /// <seealso cref="CreateTorquePayload"/>
+    /// <seealso cref="CreateTorqueLoadCurrentPayload"/>
+    /// <seealso cref="CreateSensorDataPayload"/>
+    /// <seealso cref="CreateSensorDataDispatchRatePayload"/>
+    /// <seealso cref="CreateBrakeCurrentSetPointPayload"/>
+    /// <seealso cref="CreateTareSensorsPayload"/>
+    /// <seealso cref="CreateResetTareSensorsPayload"/>
+    /// <seealso cref="CreateEnableTorqueLimitPayload"/>
+    /// <seealso cref="CreateTorqueLimitStatePayload"/>
+    /// <seealso cref="CreateSensorDataBatchPayload"/>
+    /// <seealso cref="CreateSensorDataBatchSampleRatePayload"/>
+    /// <seealso cref="CreateSensorDataBatchSizePayload"/>
+    /// <seealso cref="CreateBrakeCurrentControlGainsPayload"/>
+    /// <seealso cref="CreateBrakeCurrentSetPointMicroampsPayload"/>
+    /// <seealso cref="CreateBrakeCurrentControlPayload"/>
+    /// <seealso cref="CreateBrakeCurrentControlStatePayload"/>
+    /// <seealso cref="CreateEncoderVelocityPayload"/>
+    /// <seealso cref="CreateEncoderAccelerationPayload"/>
+    /// <seealso cref="CreateSensorDataFieldsPayload"/>
+    /// <seealso cref="CreateEncoderReadCyclesSavedPayload"/>
+    /// <seealso cref="CreateTorqueLimitTripLatencyPayload"/>
+    /// <seealso cref="CreateTorqueLimitFilterWindowPayload"/>
+    /// <seealso cref="CreateTorqueLimitHysteresisPayload"/>
+    /// <seealso cref="CreateLoopPeriodPayload"/>
+    /// <seealso cref="CreateDispatchLatenessHistogramPayload"/>
+    /// <seealso cref="CreateMissedDeadlinesPayload"/>
+    /// <seealso cref="CreateTorqueCheckOverrunsPayload"/>
+    /// <seealso cref="CreateUsbTxBackpressurePayload"/>
+    /// <seealso cref="CreateResetDiagnosticsPayload"/>
+    /// <seealso cref="CreateBrakeTrajectoryWriteIndexPayload"/>
+    /// <seealso cref="CreateBrakeTrajectoryDataPayload"/>
+    /// <seealso cref="CreateBrakeTrajectoryLengthPayload"/>
+    /// <seealso cref="CreateBrakeTrajectorySampleRatePayload"/>
+    /// <seealso cref="CreateBrakeTrajectoryPlaybackPayload"/>
+    /// <seealso cref="CreateBrakeMapWriteIndexPayload"/>
+    /// <seealso cref="CreateBrakeMapDataPayload"/>
+    /// <seealso cref="CreateBrakeMapConfigPayload"/>
+    /// <seealso cref="CreateBrakeMapPayload"/>
+    /// <seealso cref="CreateVirtualLoadParamsPayload"/>
+    /// <seealso cref="CreateVirtualLoadPayload"/>
+    /// <seealso cref="CreateSensorDataPackedPayload"/>
+    /// <seealso cref="CreateSensorDataFormatPayload"/>
+    /// <seealso cref="CreateSensorDataDispatchDeadbandPayload"/>
+    /// <seealso cref="CreateSensorDataDispatchHeartbeatPayload"/>
+    /// <seealso cref="CreateSensorDataStatsPayload"/>
+    /// <seealso cref="CreateBrakeCalibrationWriteIndexPayload"/>
+    /// <seealso cref="CreateBrakeCalibrationDataPayload"/>
+    /// <seealso cref="CreateBrakeCalibrationConfigPayload"/>
+    /// <seealso cref="CreateBrakeCalibrationStorePayload"/>
+    /// <seealso cref="CreateBrakeCalibrationChecksumPayload"/>
+    /// <seealso cref="CreateBrakeTorqueSetPointPayload"/>
+    /// <seealso cref="CreateTorqueLimitsPayload"/>
+    /// <seealso cref="CreatePersistentConfigPayload"/>
+    /// <seealso cref="CreateSensorSkewPayload"/>
+    /// <seealso cref="CreateFlightRecorderPayload"/>
+    /// <seealso cref="CreateFlightRecorderWindowPayload"/>
+    /// <seealso cref="CreateFlightRecorderReadIndexPayload"/>
+    /// <seealso cref="CreateFlightRecorderDataPayload"/>
+    /// <seealso cref="CreateFlightRecorderCapturePayload"/>
+    /// <seealso cref="CreateEncoderTarePayload"/>
+    /// <seealso cref="CreateAuxEncoderReadCyclesPayload"/>
+    /// <seealso cref="CreateBrakeStepTestPayload"/>
+    /// <seealso cref="CreateBrakeStepTestConfigPayload"/>
+    /// <seealso cref="CreateBrakeStepTestResultsPayload"/>
+    /// <seealso cref="CreateBrakeSetpointLatencyPayload"/>
+    /// <seealso cref="CreateBrakeStepTraceReadIndexPayload"/>
+    /// <seealso cref="CreateBrakeStepTracePayload"/>
+    /// <seealso cref="CreateBrakeStepTraceInfoPayload"/>
+    /// <seealso cref="CreateAuxAnalogDispatchRatePayload"/>
+    /// <seealso cref="CreateAuxAnalogPayload"/>
+    /// <seealso cref="CreateAuxAnalogSamplingPayload"/>
+    /// <seealso cref="CreateSensorFiltersPayload"/>
+    /// <seealso cref="CreateSensorFilterCutoffPayload"/>
+    /// <seealso cref="CreateSensorFilterCyclesPayload"/>
+    [XmlInclude(typeof(CreateEncoderPayload))]
+    [XmlInclude(typeof(CreateTorquePayload))]
+    [XmlInclude(typeof(CreateTorqueLoadCurrentPayload))]
+    [XmlInclude(typeof(CreateSensorDataPayload))]
+    [XmlInclude(typeof(CreateSensorDataDispatchRatePayload))]
+    [XmlInclude(typeof(CreateBrakeCurrentSetPointPayload))]
+    [XmlInclude(typeof(CreateTareSensorsPayload))]
+    [XmlInclude(typeof(CreateResetTareSensorsPayload))]
+    [XmlInclude(typeof(CreateEnableTorqueLimitPayload))]
+    [XmlInclude(typeof(CreateTorqueLimitStatePayload))]
+    [XmlInclude(typeof(CreateSensorDataBatchPayload))]
+    [XmlInclude(typeof(CreateSensorDataBatchSampleRatePayload))]
+    [XmlInclude(typeof(CreateSensorDataBatchSizePayload))]
+    [XmlInclude(typeof(CreateBrakeCurrentControlGainsPayload))]
+    [XmlInclude(typeof(CreateBrakeCurrentSetPointMicroampsPayload))]
+    [XmlInclude(typeof(CreateBrakeCurrentControlPayload))]
+    [XmlInclude(typeof(CreateBrakeCurrentControlStatePayload))]
+    [XmlInclude(typeof(CreateEncoderVelocityPayload))]
+    [XmlInclude(typeof(CreateEncoderAccelerationPayload))]
+    [XmlInclude(typeof(CreateSensorDataFieldsPayload))]
+    [XmlInclude(typeof(CreateEncoderReadCyclesSavedPayload))]
+    [XmlInclude(typeof(CreateTorqueLimitTripLatencyPayload))]
+    [XmlInclude(typeof(CreateTorqueLimitFilterWindowPayload))]
+    [XmlInclude(typeof(CreateTorqueLimitHysteresisPayload))]
+    [XmlInclude(typeof(CreateLoopPeriodPayload))]
+    [XmlInclude(typeof(CreateDispatchLatenessHistogramPayload))]
+    [XmlInclude(typeof(CreateMissedDeadlinesPayload))]
+    [XmlInclude(typeof(CreateTorqueCheckOverrunsPayload))]
+    [XmlInclude(typeof(CreateUsbTxBackpressurePayload))]
+    [XmlInclude(typeof(CreateResetDiagnosticsPayload))]
+    [XmlInclude(typeof(CreateBrakeTrajectoryWriteIndexPayload))]
+    [XmlInclude(typeof(CreateBrakeTrajectoryDataPayload))]
+    [XmlInclude(typeof(CreateBrakeTrajectoryLengthPayload))]
+    [XmlInclude(typeof(CreateBrakeTrajectorySampleRatePayload))]
+    [XmlInclude(typeof(CreateBrakeTrajectoryPlaybackPayload))]
+    [XmlInclude(typeof(CreateBrakeMapWriteIndexPayload))]
+    [XmlInclude(typeof(CreateBrakeMapDataPayload))]
+    [XmlInclude(typeof(CreateBrakeMapConfigPayload))]
+    [XmlInclude(typeof(CreateBrakeMapPayload))]
+    [XmlInclude(typeof(CreateVirtualLoadParamsPayload))]
+    [XmlInclude(typeof(CreateVirtualLoadPayload))]
+    [XmlInclude(typeof(CreateSensorDataPackedPayload))]
+    [XmlInclude(typeof(CreateSensorDataFormatPayload))]
+    [XmlInclude(typeof(CreateSensorDataDispatchDeadbandPayload))]
+    [XmlInclude(typeof(CreateSensorDataDispatchHeartbeatPayload))]
+    [XmlInclude(typeof(CreateSensorDataStatsPayload))]
+    [XmlInclude(typeof(CreateBrakeCalibrationWriteIndexPayload))]
+    [XmlInclude(typeof(CreateBrakeCalibrationDataPayload))]
+    [XmlInclude(typeof(CreateBrakeCalibrationConfigPayload))]
+    [XmlInclude(typeof(CreateBrakeCalibrationStorePayload))]
+    [XmlInclude(typeof(CreateBrakeCalibrationChecksumPayload))]
+    [XmlInclude(typeof(CreateBrakeTorqueSetPointPayload))]
+    [XmlInclude(typeof(CreateTorqueLimitsPayload))]
+    [XmlInclude(typeof(CreatePersistentConfigPayload))]
+    [XmlInclude(typeof(CreateSensorSkewPayload))]
+    [XmlInclude(typeof(CreateFlightRecorderPayload))]
+    [XmlInclude(typeof(CreateFlightRecorderWindowPayload))]
+    [XmlInclude(typeof(CreateFlightRecorderReadIndexPayload))]
+    [XmlInclude(typeof(CreateFlightRecorderDataPayload))]
+    [XmlInclude(typeof(CreateFlightRecorderCapturePayload))]
+    [XmlInclude(typeof(CreateEncoderTarePayload))]
+    [XmlInclude(typeof(CreateAuxEncoderReadCyclesPayload))]
+    [XmlInclude(typeof(CreateBrakeStepTestPayload))]
+    [XmlInclude(typeof(CreateBrakeStepTestConfigPayload))]
+    [XmlInclude(typeof(CreateBrakeStepTestResultsPayload))]
+    [XmlInclude(typeof(CreateBrakeSetpointLatencyPayload))]
+    [XmlInclude(typeof(CreateBrakeStepTraceReadIndexPayload))]
+    [XmlInclude(typeof(CreateBrakeStepTracePayload))]
+    [XmlInclude(typeof(CreateBrakeStepTraceInfoPayload))]
+    [XmlInclude(typeof(CreateAuxAnalogDispatchRatePayload))]
+    [XmlInclude(typeof(CreateAuxAnalogPayload))]
+    [XmlInclude(typeof(CreateAuxAnalogSamplingPayload))]
+    [XmlInclude(typeof(CreateSensorFiltersPayload))]
+    [XmlInclude(typeof(CreateSensorFilterCutoffPayload))]
+    [XmlInclude(typeof(CreateSensorFilterCyclesPayload))]
+    [XmlInclude(typeof(CreateTimestampedEncoderPayload))]
+    [XmlInclude(typeof(CreateTimestampedTorquePayload))]
+    [XmlInclude(typeof(CreateTimestampedTorqueLoadCurrentPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataDispatchRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCurrentSetPointPayload))]
+    [XmlInclude(typeof(CreateTimestampedTareSensorsPayload))]
+    [XmlInclude(typeof(CreateTimestampedResetTareSensorsPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableTorqueLimitPayload))]
+    [XmlInclude(typeof(CreateTimestampedTorqueLimitStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataBatchPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataBatchSampleRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataBatchSizePayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCurrentControlGainsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCurrentSetPointMicroampsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCurrentControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCurrentControlStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedEncoderVelocityPayload))]
+    [XmlInclude(typeof(CreateTimestampedEncoderAccelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataFieldsPayload))]
+    [XmlInclude(typeof(CreateTimestampedEncoderReadCyclesSavedPayload))]
+    [XmlInclude(typeof(CreateTimestampedTorqueLimitTripLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedTorqueLimitFilterWindowPayload))]
+    [XmlInclude(typeof(CreateTimestampedTorqueLimitHysteresisPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoopPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedDispatchLatenessHistogramPayload))]
+    [XmlInclude(typeof(CreateTimestampedMissedDeadlinesPayload))]
+    [XmlInclude(typeof(CreateTimestampedTorqueCheckOverrunsPayload))]
+    [XmlInclude(typeof(CreateTimestampedUsbTxBackpressurePayload))]
+    [XmlInclude(typeof(CreateTimestampedResetDiagnosticsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeTrajectoryWriteIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeTrajectoryDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeTrajectoryLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeTrajectorySampleRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeTrajectoryPlaybackPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeMapWriteIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeMapDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeMapConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeMapPayload))]
+    [XmlInclude(typeof(CreateTimestampedVirtualLoadParamsPayload))]
+    [XmlInclude(typeof(CreateTimestampedVirtualLoadPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataPackedPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataFormatPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataDispatchDeadbandPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataDispatchHeartbeatPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorDataStatsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCalibrationWriteIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCalibrationDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCalibrationConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCalibrationStorePayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeCalibrationChecksumPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeTorqueSetPointPayload))]
+    [XmlInclude(typeof(CreateTimestampedTorqueLimitsPayload))]
+    [XmlInclude(typeof(CreateTimestampedPersistentConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorSkewPayload))]
+    [XmlInclude(typeof(CreateTimestampedFlightRecorderPayload))]
+    [XmlInclude(typeof(CreateTimestampedFlightRecorderWindowPayload))]
+    [XmlInclude(typeof(CreateTimestampedFlightRecorderReadIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedFlightRecorderDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedFlightRecorderCapturePayload))]
+    [XmlInclude(typeof(CreateTimestampedEncoderTarePayload))]
+    [XmlInclude(typeof(CreateTimestampedAuxEncoderReadCyclesPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeStepTestPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeStepTestConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeStepTestResultsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeSetpointLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeStepTraceReadIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeStepTracePayload))]
+    [XmlInclude(typeof(CreateTimestampedBrakeStepTraceInfoPayload))]
+    [XmlInclude(typeof(CreateTimestampedAuxAnalogDispatchRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedAuxAnalogPayload))]
+    [XmlInclude(typeof(CreateTimestampedAuxAnalogSamplingPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorFiltersPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorFilterCutoffPayload))]
+    [XmlInclude(typeof(CreateTimestampedSensorFilterCyclesPayload))]
+    [Description("Creates standard message payloads for the Treadmill device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateEncoderPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(Treadmill)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the current accumulated number of ticks.
+    /// </summary>
+    [DisplayName("EncoderPayload")]
+    [Description("Creates a message payload that contains the current accumulated number of ticks.")]
+    public partial class CreateEncoderPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the current accumulated number of ticks.
+        /// </summary>
+        [Description("The value that contains the current accumulated number of ticks.")]
+        public int Encoder { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Encoder register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return Encoder;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the current accumulated number of ticks.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Encoder register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.Encoder.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the current accumulated number of ticks.
+    /// </summary>
+    [DisplayName("TimestampedEncoderPayload")]
+    [Description("Creates a timestamped message payload that contains the current accumulated number of ticks.")]
+    public partial class CreateTimestampedEncoderPayload : CreateEncoderPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the current accumulated number of ticks.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Encoder register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.Encoder.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the current torque value.
+    /// </summary>
+    [DisplayName("TorquePayload")]
+    [Description("Creates a message payload that contains the current torque value.")]
+    public partial class CreateTorquePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the current torque value.
+        /// </summary>
+        [Description("The value that contains the current torque value.")]
+        public short Torque { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Torque register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return Torque;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the current torque value.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Torque register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.Torque.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the current torque value.
+    /// </summary>
+    [DisplayName("TimestampedTorquePayload")]
+    [Description("Creates a timestamped message payload that contains the current torque value.")]
+    public partial class CreateTimestampedTorquePayload : CreateTorquePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the current torque value.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Torque register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.Torque.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the current output current applied to the variable torque load.
+    /// </summary>
+    [DisplayName("TorqueLoadCurrentPayload")]
+    [Description("Creates a message payload that contains the current output current applied to the variable torque load.")]
+    public partial class CreateTorqueLoadCurrentPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the current output current applied to the variable torque load.
+        /// </summary>
+        [Description("The value that contains the current output current applied to the variable torque load.")]
+        public short TorqueLoadCurrent { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TorqueLoadCurrent register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return TorqueLoadCurrent;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the current output current applied to the variable torque load.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TorqueLoadCurrent register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLoadCurrent.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the current output current applied to the variable torque load.
+    /// </summary>
+    [DisplayName("TimestampedTorqueLoadCurrentPayload")]
+    [Description("Creates a timestamped message payload that contains the current output current applied to the variable torque load.")]
+    public partial class CreateTimestampedTorqueLoadCurrentPayload : CreateTorqueLoadCurrentPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the current output current applied to the variable torque load.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TorqueLoadCurrent register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLoadCurrent.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]. Fields enabled in SensorDataFields are appended in bit order, followed by the positions of any additional encoders (see EncoderTare). Events are timestamped with the (Harp-synchronized) time that all sensors were latched together. See SensorSkew.
+    /// </summary>
+    [DisplayName("SensorDataPayload")]
+    [Description("Creates a message payload that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]. Fields enabled in SensorDataFields are appended in bit order, followed by the positions of any additional encoders (see EncoderTare). Events are timestamped with the (Harp-synchronized) time that all sensors were latched together. See SensorSkew.")]
+    public partial class CreateSensorDataPayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Encoder.
+        /// </summary>
+        [Description("")]
+        public int Encoder { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Torque.
+        /// </summary>
+        [Description("")]
+        public int Torque { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TorqueLoadCurrent.
+        /// </summary>
+        [Description("")]
+        public int TorqueLoadCurrent { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SensorDataPayload GetPayload()
+        {
+            SensorDataPayload value;
+            value.Encoder = Encoder;
+            value.Torque = Torque;
+            value.TorqueLoadCurrent = TorqueLoadCurrent;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]. Fields enabled in SensorDataFields are appended in bit order, followed by the positions of any additional encoders (see EncoderTare). Events are timestamped with the (Harp-synchronized) time that all sensors were latched together. See SensorSkew.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]. Fields enabled in SensorDataFields are appended in bit order, followed by the positions of any additional encoders (see EncoderTare). Events are timestamped with the (Harp-synchronized) time that all sensors were latched together. See SensorSkew.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataPayload")]
+    [Description("Creates a timestamped message payload that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]. Fields enabled in SensorDataFields are appended in bit order, followed by the positions of any additional encoders (see EncoderTare). Events are timestamped with the (Harp-synchronized) time that all sensors were latched together. See SensorSkew.")]
+    public partial class CreateTimestampedSensorDataPayload : CreateSensorDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent]. Fields enabled in SensorDataFields are appended in bit order, followed by the positions of any additional encoders (see EncoderTare). Events are timestamped with the (Harp-synchronized) time that all sensors were latched together. See SensorSkew.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+    /// </summary>
+    [DisplayName("SensorDataDispatchRatePayload")]
+    [Description("Creates a message payload that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).")]
+    public partial class CreateSensorDataDispatchRatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+        /// </summary>
+        [Range(min: 0, max: 1000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).")]
+        public ushort SensorDataDispatchRate { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataDispatchRate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SensorDataDispatchRate;
+        }
+
+        /// <summary>
+        /// Creates a message that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataDispatchRate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataDispatchRate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+    /// </summary>
+    [DisplayName("TimestampedSensorDataDispatchRatePayload")]
+    [Description("Creates a timestamped message payload that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).")]
+    public partial class CreateTimestampedSensorDataDispatchRatePayload : CreateSensorDataDispatchRatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataDispatchRate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataDispatchRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+    /// </summary>
+    [DisplayName("BrakeCurrentSetPointPayload")]
+    [Description("Creates a message payload that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.")]
+    public partial class CreateBrakeCurrentSetPointPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+        /// </summary>
+        [Range(min: 0, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.")]
+        public ushort BrakeCurrentSetPoint { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCurrentSetPoint register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BrakeCurrentSetPoint;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCurrentSetPoint register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentSetPoint.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+    /// </summary>
+    [DisplayName("TimestampedBrakeCurrentSetPointPayload")]
+    [Description("Creates a timestamped message payload that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.")]
+    public partial class CreateTimestampedBrakeCurrentSetPointPayload : CreateBrakeCurrentSetPointPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCurrentSetPoint register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentSetPoint.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that tares the specified sensors.
+    /// </summary>
+    [DisplayName("TareSensorsPayload")]
+    [Description("Creates a message payload that tares the specified sensors.")]
+    public partial class CreateTareSensorsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that tares the specified sensors.
+        /// </summary>
+        [Description("The value that tares the specified sensors.")]
+        public Sensors TareSensors { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TareSensors register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Sensors GetPayload()
+        {
+            return TareSensors;
+        }
+
+        /// <summary>
+        /// Creates a message that tares the specified sensors.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TareSensors register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TareSensors.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that tares the specified sensors.
+    /// </summary>
+    [DisplayName("TimestampedTareSensorsPayload")]
+    [Description("Creates a timestamped message payload that tares the specified sensors.")]
+    public partial class CreateTimestampedTareSensorsPayload : CreateTareSensorsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that tares the specified sensors.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TareSensors register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TareSensors.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that removes the tare from the specified sensors.
+    /// </summary>
+    [DisplayName("ResetTareSensorsPayload")]
+    [Description("Creates a message payload that removes the tare from the specified sensors.")]
+    public partial class CreateResetTareSensorsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that removes the tare from the specified sensors.
+        /// </summary>
+        [Description("The value that removes the tare from the specified sensors.")]
+        public Sensors ResetTareSensors { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ResetTareSensors register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Sensors GetPayload()
+        {
+            return ResetTareSensors;
+        }
+
+        /// <summary>
+        /// Creates a message that removes the tare from the specified sensors.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ResetTareSensors register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.ResetTareSensors.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that removes the tare from the specified sensors.
+    /// </summary>
+    [DisplayName("TimestampedResetTareSensorsPayload")]
+    [Description("Creates a timestamped message payload that removes the tare from the specified sensors.")]
+    public partial class CreateTimestampedResetTareSensorsPayload : CreateResetTareSensorsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that removes the tare from the specified sensors.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ResetTareSensors register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.ResetTareSensors.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+    /// </summary>
+    [DisplayName("EnableTorqueLimitPayload")]
+    [Description("Creates a message payload that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.")]
+    public partial class CreateEnableTorqueLimitPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+        /// </summary>
+        [Description("The value that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.")]
+        public EnableFlag EnableTorqueLimit { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableTorqueLimit register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return EnableTorqueLimit;
+        }
+
+        /// <summary>
+        /// Creates a message that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableTorqueLimit register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EnableTorqueLimit.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+    /// </summary>
+    [DisplayName("TimestampedEnableTorqueLimitPayload")]
+    [Description("Creates a timestamped message payload that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.")]
+    public partial class CreateTimestampedEnableTorqueLimitPayload : CreateEnableTorqueLimitPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableTorqueLimit register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EnableTorqueLimit.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.
+    /// </summary>
+    [DisplayName("TorqueLimitStatePayload")]
+    [Description("Creates a message payload that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.")]
+    public partial class CreateTorqueLimitStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.
+        /// </summary>
+        [Description("The value that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.")]
+        public byte TorqueLimitState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TorqueLimitState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return TorqueLimitState;
+        }
+
+        /// <summary>
+        /// Creates a message that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TorqueLimitState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimitState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.
+    /// </summary>
+    [DisplayName("TimestampedTorqueLimitStatePayload")]
+    [Description("Creates a timestamped message payload that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.")]
+    public partial class CreateTimestampedTorqueLimitStatePayload : CreateTorqueLimitStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake. If filtered torque is still within TorqueLimitHysteresis of a limit, the trip stands and another event is emitted.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TorqueLimitState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimitState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.
+    /// </summary>
+    [DisplayName("SensorDataBatchPayload")]
+    [Description("Creates a message payload that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.")]
+    public partial class CreateSensorDataBatchPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.
+        /// </summary>
+        [Description("The value that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.")]
+        public byte[] SensorDataBatch { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataBatch register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return SensorDataBatch;
+        }
+
+        /// <summary>
+        /// Creates a message that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataBatch register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataBatch.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataBatchPayload")]
+    [Description("Creates a timestamped message payload that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.")]
+    public partial class CreateTimestampedSensorDataBatchPayload : CreateSensorDataBatchPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits a batch of up to 24 packed sensor samples once the batch is full. Each 10-byte sample is [TimeOffsetUs (U16), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16)], little-endian. The event timestamp is the acquisition time of the first sample and TimeOffsetUs is relative to it. Only the filled portion of the batch is sent.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataBatch register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataBatch.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.
+    /// </summary>
+    [DisplayName("SensorDataBatchSampleRatePayload")]
+    [Description("Creates a message payload that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.")]
+    public partial class CreateSensorDataBatchSampleRatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.
+        /// </summary>
+        [Range(min: 0, max: 10000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.")]
+        public ushort SensorDataBatchSampleRate { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataBatchSampleRate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SensorDataBatchSampleRate;
+        }
+
+        /// <summary>
+        /// Creates a message that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataBatchSampleRate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataBatchSampleRate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataBatchSampleRatePayload")]
+    [Description("Creates a timestamped message payload that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.")]
+    public partial class CreateTimestampedSensorDataBatchSampleRatePayload : CreateSensorDataBatchSampleRatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value greater than 0 will enable batched acquisition of treadmill data at the specified rate (sp/s). Samples are latched at 10 kHz, so the rate must divide 10000 (e.g. 1000, 2000, 2500, 5000). Other rates return a WRITE_ERROR.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataBatchSampleRate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataBatchSampleRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of samples per SensorDataBatch event.
+    /// </summary>
+    [DisplayName("SensorDataBatchSizePayload")]
+    [Description("Creates a message payload that number of samples per SensorDataBatch event.")]
+    public partial class CreateSensorDataBatchSizePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of samples per SensorDataBatch event.
+        /// </summary>
+        [Range(min: 1, max: 24)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that number of samples per SensorDataBatch event.")]
+        public byte SensorDataBatchSize { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataBatchSize register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return SensorDataBatchSize;
+        }
+
+        /// <summary>
+        /// Creates a message that number of samples per SensorDataBatch event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataBatchSize register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataBatchSize.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of samples per SensorDataBatch event.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataBatchSizePayload")]
+    [Description("Creates a timestamped message payload that number of samples per SensorDataBatch event.")]
+    public partial class CreateTimestampedSensorDataBatchSizePayload : CreateSensorDataBatchSizePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of samples per SensorDataBatch event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataBatchSize register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataBatchSize.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that proportional and integral gains of the closed-loop brake current controller in Q8.8 fixed-point. The integral gain is applied per control update (5 kHz).
+    /// </summary>
+    [DisplayName("BrakeCurrentControlGainsPayload")]
+    [Description("Creates a message payload that proportional and integral gains of the closed-loop brake current controller in Q8.8 fixed-point. The integral gain is applied per control update (5 kHz).")]
+    public partial class CreateBrakeCurrentControlGainsPayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Kp.
+        /// </summary>
+        [Description("")]
+        public ushort Kp { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Ki.
+        /// </summary>
+        [Description("")]
+        public ushort Ki { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCurrentControlGains register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public BrakeCurrentControlGainsPayload GetPayload()
+        {
+            BrakeCurrentControlGainsPayload value;
+            value.Kp = Kp;
+            value.Ki = Ki;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that proportional and integral gains of the closed-loop brake current controller in Q8.8 fixed-point. The integral gain is applied per control update (5 kHz).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCurrentControlGains register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentControlGains.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that proportional and integral gains of the closed-loop brake current controller in Q8.8 fixed-point. The integral gain is applied per control update (5 kHz).
+    /// </summary>
+    [DisplayName("TimestampedBrakeCurrentControlGainsPayload")]
+    [Description("Creates a timestamped message payload that proportional and integral gains of the closed-loop brake current controller in Q8.8 fixed-point. The integral gain is applied per control update (5 kHz).")]
+    public partial class CreateTimestampedBrakeCurrentControlGainsPayload : CreateBrakeCurrentControlGainsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that proportional and integral gains of the closed-loop brake current controller in Q8.8 fixed-point. The integral gain is applied per control update (5 kHz).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCurrentControlGains register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentControlGains.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.
+    /// </summary>
+    [DisplayName("BrakeCurrentSetPointMicroampsPayload")]
+    [Description("Creates a message payload that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.")]
+    public partial class CreateBrakeCurrentSetPointMicroampsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.
+        /// </summary>
+        [Range(min: 0, max: 206250)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.")]
+        public uint BrakeCurrentSetPointMicroamps { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCurrentSetPointMicroamps register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return BrakeCurrentSetPointMicroamps;
+        }
+
+        /// <summary>
+        /// Creates a message that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCurrentSetPointMicroamps register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentSetPointMicroamps.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.
+    /// </summary>
+    [DisplayName("TimestampedBrakeCurrentSetPointMicroampsPayload")]
+    [Description("Creates a timestamped message payload that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.")]
+    public partial class CreateTimestampedBrakeCurrentSetPointMicroampsPayload : CreateBrakeCurrentSetPointMicroampsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that closed-loop brake current setpoint in microamps. Applied when BrakeCurrentControl is enabled.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCurrentSetPointMicroamps register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentSetPointMicroamps.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.
+    /// </summary>
+    [DisplayName("BrakeCurrentControlPayload")]
+    [Description("Creates a message payload that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.")]
+    public partial class CreateBrakeCurrentControlPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.
+        /// </summary>
+        [Description("The value that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.")]
+        public EnableFlag BrakeCurrentControl { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCurrentControl register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return BrakeCurrentControl;
+        }
+
+        /// <summary>
+        /// Creates a message that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCurrentControl register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentControl.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.
+    /// </summary>
+    [DisplayName("TimestampedBrakeCurrentControlPayload")]
+    [Description("Creates a timestamped message payload that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.")]
+    public partial class CreateTimestampedBrakeCurrentControlPayload : CreateBrakeCurrentControlPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables(1)/Disables(0) closed-loop control of the brake current. While enabled, writes to BrakeCurrentSetPoint return a WRITE_ERROR. The brake is cleared when this value changes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCurrentControl register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentControl.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that state of the brake current controller. [Error (ADC counts), Integrator (DAC counts), Output (DAC counts)].
+    /// </summary>
+    [DisplayName("BrakeCurrentControlStatePayload")]
+    [Description("Creates a message payload that state of the brake current controller. [Error (ADC counts), Integrator (DAC counts), Output (DAC counts)].")]
+    public partial class CreateBrakeCurrentControlStatePayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Error.
+        /// </summary>
+        [Description("")]
+        public int Error { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Integrator.
+        /// </summary>
+        [Description("")]
+        public int Integrator { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output.
+        /// </summary>
+        [Description("")]
+        public int Output { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCurrentControlState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public BrakeCurrentControlStatePayload GetPayload()
+        {
+            BrakeCurrentControlStatePayload value;
+            value.Error = Error;
+            value.Integrator = Integrator;
+            value.Output = Output;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that state of the brake current controller. [Error (ADC counts), Integrator (DAC counts), Output (DAC counts)].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCurrentControlState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentControlState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that state of the brake current controller. [Error (ADC counts), Integrator (DAC counts), Output (DAC counts)].
+    /// </summary>
+    [DisplayName("TimestampedBrakeCurrentControlStatePayload")]
+    [Description("Creates a timestamped message payload that state of the brake current controller. [Error (ADC counts), Integrator (DAC counts), Output (DAC counts)].")]
+    public partial class CreateTimestampedBrakeCurrentControlStatePayload : CreateBrakeCurrentControlStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that state of the brake current controller. [Error (ADC counts), Integrator (DAC counts), Output (DAC counts)].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCurrentControlState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCurrentControlState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).
+    /// </summary>
+    [DisplayName("EncoderVelocityPayload")]
+    [Description("Creates a message payload that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).")]
+    public partial class CreateEncoderVelocityPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).
+        /// </summary>
+        [Description("The value that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).")]
+        public int EncoderVelocity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EncoderVelocity register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return EncoderVelocity;
+        }
+
+        /// <summary>
+        /// Creates a message that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EncoderVelocity register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EncoderVelocity.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).
+    /// </summary>
+    [DisplayName("TimestampedEncoderVelocityPayload")]
+    [Description("Creates a timestamped message payload that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).")]
+    public partial class CreateTimestampedEncoderVelocityPayload : CreateEncoderVelocityPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that encoder velocity in Q24.8 fixed-point counts per second, measured from edge timestamps (M/T method).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EncoderVelocity register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EncoderVelocity.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that encoder acceleration in Q24.8 fixed-point counts per second squared.
+    /// </summary>
+    [DisplayName("EncoderAccelerationPayload")]
+    [Description("Creates a message payload that encoder acceleration in Q24.8 fixed-point counts per second squared.")]
+    public partial class CreateEncoderAccelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that encoder acceleration in Q24.8 fixed-point counts per second squared.
+        /// </summary>
+        [Description("The value that encoder acceleration in Q24.8 fixed-point counts per second squared.")]
+        public int EncoderAcceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EncoderAcceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return EncoderAcceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that encoder acceleration in Q24.8 fixed-point counts per second squared.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EncoderAcceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EncoderAcceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that encoder acceleration in Q24.8 fixed-point counts per second squared.
+    /// </summary>
+    [DisplayName("TimestampedEncoderAccelerationPayload")]
+    [Description("Creates a timestamped message payload that encoder acceleration in Q24.8 fixed-point counts per second squared.")]
+    public partial class CreateTimestampedEncoderAccelerationPayload : CreateEncoderAccelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that encoder acceleration in Q24.8 fixed-point counts per second squared.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EncoderAcceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EncoderAcceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that optional fields to append to SensorData events.
+    /// </summary>
+    [DisplayName("SensorDataFieldsPayload")]
+    [Description("Creates a message payload that optional fields to append to SensorData events.")]
+    public partial class CreateSensorDataFieldsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that optional fields to append to SensorData events.
+        /// </summary>
+        [Description("The value that optional fields to append to SensorData events.")]
+        public SensorDataFields SensorDataFields { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataFields register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SensorDataFields GetPayload()
+        {
+            return SensorDataFields;
+        }
+
+        /// <summary>
+        /// Creates a message that optional fields to append to SensorData events.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataFields register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataFields.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that optional fields to append to SensorData events.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataFieldsPayload")]
+    [Description("Creates a timestamped message payload that optional fields to append to SensorData events.")]
+    public partial class CreateTimestampedSensorDataFieldsPayload : CreateSensorDataFieldsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that optional fields to append to SensorData events.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataFields register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataFields.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+    /// </summary>
+    [DisplayName("EncoderReadCyclesSavedPayload")]
+    [Description("Creates a message payload that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class CreateEncoderReadCyclesSavedPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+        /// </summary>
+        [Description("The value that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+        public ushort EncoderReadCyclesSaved { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EncoderReadCyclesSaved register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return EncoderReadCyclesSaved;
+        }
+
+        /// <summary>
+        /// Creates a message that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EncoderReadCyclesSaved register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EncoderReadCyclesSaved.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+    /// </summary>
+    [DisplayName("TimestampedEncoderReadCyclesSavedPayload")]
+    [Description("Creates a timestamped message payload that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class CreateTimestampedEncoderReadCyclesSavedPayload : CreateEncoderReadCyclesSavedPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that cPU cycles saved per sample by streaming the encoder count to memory via DMA rather than requesting it from the PIO program and waiting for the reply. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EncoderReadCyclesSaved register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EncoderReadCyclesSaved.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.
+    /// </summary>
+    [DisplayName("TorqueLimitTripLatencyPayload")]
+    [Description("Creates a message payload that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.")]
+    public partial class CreateTorqueLimitTripLatencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.
+        /// </summary>
+        [Description("The value that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.")]
+        public uint TorqueLimitTripLatency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TorqueLimitTripLatency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return TorqueLimitTripLatency;
+        }
+
+        /// <summary>
+        /// Creates a message that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TorqueLimitTripLatency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimitTripLatency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.
+    /// </summary>
+    [DisplayName("TimestampedTorqueLimitTripLatencyPayload")]
+    [Description("Creates a timestamped message payload that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.")]
+    public partial class CreateTimestampedTorqueLimitTripLatencyPayload : CreateTorqueLimitTripLatencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time in microseconds from the first out-of-range reaction torque conversion to disabling the brake on the last torque limit trip. Conversion times are interpolated between torque monitor checks.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TorqueLimitTripLatency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimitTripLatency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.
+    /// </summary>
+    [DisplayName("TorqueLimitFilterWindowPayload")]
+    [Description("Creates a message payload that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.")]
+    public partial class CreateTorqueLimitFilterWindowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.
+        /// </summary>
+        [Description("The value that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.")]
+        public byte TorqueLimitFilterWindow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TorqueLimitFilterWindow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return TorqueLimitFilterWindow;
+        }
+
+        /// <summary>
+        /// Creates a message that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TorqueLimitFilterWindow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimitFilterWindow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.
+    /// </summary>
+    [DisplayName("TimestampedTorqueLimitFilterWindowPayload")]
+    [Description("Creates a timestamped message payload that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.")]
+    public partial class CreateTimestampedTorqueLimitFilterWindowPayload : CreateTorqueLimitFilterWindowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of reaction torque conversions averaged by the torque limit filter. Must be a power of two up to 32.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TorqueLimitFilterWindow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimitFilterWindow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.
+    /// </summary>
+    [DisplayName("TorqueLimitHysteresisPayload")]
+    [Description("Creates a message payload that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.")]
+    public partial class CreateTorqueLimitHysteresisPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.
+        /// </summary>
+        [Description("The value that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.")]
+        public ushort TorqueLimitHysteresis { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TorqueLimitHysteresis register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return TorqueLimitHysteresis;
+        }
+
+        /// <summary>
+        /// Creates a message that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TorqueLimitHysteresis register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimitHysteresis.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.
+    /// </summary>
+    [DisplayName("TimestampedTorqueLimitHysteresisPayload")]
+    [Description("Creates a timestamped message payload that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.")]
+    public partial class CreateTimestampedTorqueLimitHysteresisPayload : CreateTorqueLimitHysteresisPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that margin in raw ADC counts inside the torque limits that filtered torque must return to before TorqueLimitingTriggered can be cleared.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TorqueLimitHysteresis register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimitHysteresis.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that main loop period in microseconds since the last diagnostics reset [min, mean, max].
+    /// </summary>
+    [DisplayName("LoopPeriodPayload")]
+    [Description("Creates a message payload that main loop period in microseconds since the last diagnostics reset [min, mean, max].")]
+    public partial class CreateLoopPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that main loop period in microseconds since the last diagnostics reset [min, mean, max].
+        /// </summary>
+        [Description("The value that main loop period in microseconds since the last diagnostics reset [min, mean, max].")]
+        public uint[] LoopPeriod { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LoopPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return LoopPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that main loop period in microseconds since the last diagnostics reset [min, mean, max].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LoopPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.LoopPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that main loop period in microseconds since the last diagnostics reset [min, mean, max].
+    /// </summary>
+    [DisplayName("TimestampedLoopPeriodPayload")]
+    [Description("Creates a timestamped message payload that main loop period in microseconds since the last diagnostics reset [min, mean, max].")]
+    public partial class CreateTimestampedLoopPeriodPayload : CreateLoopPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that main loop period in microseconds since the last diagnostics reset [min, mean, max].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LoopPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.LoopPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].
+    /// </summary>
+    [DisplayName("DispatchLatenessHistogramPayload")]
+    [Description("Creates a message payload that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].")]
+    public partial class CreateDispatchLatenessHistogramPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].
+        /// </summary>
+        [Description("The value that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].")]
+        public uint[] DispatchLatenessHistogram { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DispatchLatenessHistogram register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return DispatchLatenessHistogram;
+        }
+
+        /// <summary>
+        /// Creates a message that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DispatchLatenessHistogram register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.DispatchLatenessHistogram.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].
+    /// </summary>
+    [DisplayName("TimestampedDispatchLatenessHistogramPayload")]
+    [Description("Creates a timestamped message payload that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].")]
+    public partial class CreateTimestampedDispatchLatenessHistogramPayload : CreateDispatchLatenessHistogramPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that count of SensorData events by dispatch lateness in microseconds [<128, <256, <512, <1024, <2048, <4096, <8192, >=8192].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DispatchLatenessHistogram register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.DispatchLatenessHistogram.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.
+    /// </summary>
+    [DisplayName("MissedDeadlinesPayload")]
+    [Description("Creates a message payload that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.")]
+    public partial class CreateMissedDeadlinesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.
+        /// </summary>
+        [Description("The value that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.")]
+        public uint MissedDeadlines { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MissedDeadlines register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return MissedDeadlines;
+        }
+
+        /// <summary>
+        /// Creates a message that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MissedDeadlines register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.MissedDeadlines.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.
+    /// </summary>
+    [DisplayName("TimestampedMissedDeadlinesPayload")]
+    [Description("Creates a timestamped message payload that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.")]
+    public partial class CreateTimestampedMissedDeadlinesPayload : CreateMissedDeadlinesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of periodic sampling, control, and dispatch deadlines skipped because servicing fell behind.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MissedDeadlines register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.MissedDeadlines.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of torque limit checks skipped because the torque monitor interrupt ran late.
+    /// </summary>
+    [DisplayName("TorqueCheckOverrunsPayload")]
+    [Description("Creates a message payload that number of torque limit checks skipped because the torque monitor interrupt ran late.")]
+    public partial class CreateTorqueCheckOverrunsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of torque limit checks skipped because the torque monitor interrupt ran late.
+        /// </summary>
+        [Description("The value that number of torque limit checks skipped because the torque monitor interrupt ran late.")]
+        public uint TorqueCheckOverruns { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TorqueCheckOverruns register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return TorqueCheckOverruns;
+        }
+
+        /// <summary>
+        /// Creates a message that number of torque limit checks skipped because the torque monitor interrupt ran late.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TorqueCheckOverruns register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueCheckOverruns.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of torque limit checks skipped because the torque monitor interrupt ran late.
+    /// </summary>
+    [DisplayName("TimestampedTorqueCheckOverrunsPayload")]
+    [Description("Creates a timestamped message payload that number of torque limit checks skipped because the torque monitor interrupt ran late.")]
+    public partial class CreateTimestampedTorqueCheckOverrunsPayload : CreateTorqueCheckOverrunsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of torque limit checks skipped because the torque monitor interrupt ran late.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TorqueCheckOverruns register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueCheckOverruns.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of events sent while the USB transmit buffer did not have room for them.
+    /// </summary>
+    [DisplayName("UsbTxBackpressurePayload")]
+    [Description("Creates a message payload that number of events sent while the USB transmit buffer did not have room for them.")]
+    public partial class CreateUsbTxBackpressurePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of events sent while the USB transmit buffer did not have room for them.
+        /// </summary>
+        [Description("The value that number of events sent while the USB transmit buffer did not have room for them.")]
+        public uint UsbTxBackpressure { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the UsbTxBackpressure register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return UsbTxBackpressure;
+        }
+
+        /// <summary>
+        /// Creates a message that number of events sent while the USB transmit buffer did not have room for them.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the UsbTxBackpressure register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.UsbTxBackpressure.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of events sent while the USB transmit buffer did not have room for them.
+    /// </summary>
+    [DisplayName("TimestampedUsbTxBackpressurePayload")]
+    [Description("Creates a timestamped message payload that number of events sent while the USB transmit buffer did not have room for them.")]
+    public partial class CreateTimestampedUsbTxBackpressurePayload : CreateUsbTxBackpressurePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of events sent while the USB transmit buffer did not have room for them.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the UsbTxBackpressure register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.UsbTxBackpressure.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.
+    /// </summary>
+    [DisplayName("ResetDiagnosticsPayload")]
+    [Description("Creates a message payload that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.")]
+    public partial class CreateResetDiagnosticsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.
+        /// </summary>
+        [Description("The value that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.")]
+        public byte ResetDiagnostics { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ResetDiagnostics register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return ResetDiagnostics;
+        }
+
+        /// <summary>
+        /// Creates a message that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ResetDiagnostics register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.ResetDiagnostics.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.
+    /// </summary>
+    [DisplayName("TimestampedResetDiagnosticsPayload")]
+    [Description("Creates a timestamped message payload that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.")]
+    public partial class CreateTimestampedResetDiagnosticsPayload : CreateResetDiagnosticsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write 1 to clear LoopPeriod, DispatchLatenessHistogram, MissedDeadlines, TorqueCheckOverruns, and UsbTxBackpressure.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ResetDiagnostics register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.ResetDiagnostics.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.
+    /// </summary>
+    [DisplayName("BrakeTrajectoryWriteIndexPayload")]
+    [Description("Creates a message payload that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.")]
+    public partial class CreateBrakeTrajectoryWriteIndexPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.
+        /// </summary>
+        [Description("The value that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.")]
+        public ushort BrakeTrajectoryWriteIndex { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeTrajectoryWriteIndex register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BrakeTrajectoryWriteIndex;
+        }
+
+        /// <summary>
+        /// Creates a message that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeTrajectoryWriteIndex register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectoryWriteIndex.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.
+    /// </summary>
+    [DisplayName("TimestampedBrakeTrajectoryWriteIndexPayload")]
+    [Description("Creates a timestamped message payload that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.")]
+    public partial class CreateTimestampedBrakeTrajectoryWriteIndexPayload : CreateBrakeTrajectoryWriteIndexPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that index into the back trajectory table that the next BrakeTrajectoryData write starts at. Advances by the number of points in each write.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeTrajectoryWriteIndex register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectoryWriteIndex.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.
+    /// </summary>
+    [DisplayName("BrakeTrajectoryDataPayload")]
+    [Description("Creates a message payload that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.")]
+    public partial class CreateBrakeTrajectoryDataPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.
+        /// </summary>
+        [Description("The value that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.")]
+        public ushort[] BrakeTrajectoryData { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeTrajectoryData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return BrakeTrajectoryData;
+        }
+
+        /// <summary>
+        /// Creates a message that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeTrajectoryData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectoryData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.
+    /// </summary>
+    [DisplayName("TimestampedBrakeTrajectoryDataPayload")]
+    [Description("Creates a timestamped message payload that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.")]
+    public partial class CreateTimestampedBrakeTrajectoryDataPayload : CreateBrakeTrajectoryDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back trajectory table at BrakeTrajectoryWriteIndex. Each table holds 2048 points, and the first write after a swap starts from a copy of the table last played. Reads return the points at BrakeTrajectoryWriteIndex of the table that plays next.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeTrajectoryData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectoryData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of back trajectory table points to play.
+    /// </summary>
+    [DisplayName("BrakeTrajectoryLengthPayload")]
+    [Description("Creates a message payload that number of back trajectory table points to play.")]
+    public partial class CreateBrakeTrajectoryLengthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of back trajectory table points to play.
+        /// </summary>
+        [Description("The value that number of back trajectory table points to play.")]
+        public ushort BrakeTrajectoryLength { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeTrajectoryLength register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BrakeTrajectoryLength;
+        }
+
+        /// <summary>
+        /// Creates a message that number of back trajectory table points to play.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeTrajectoryLength register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectoryLength.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of back trajectory table points to play.
+    /// </summary>
+    [DisplayName("TimestampedBrakeTrajectoryLengthPayload")]
+    [Description("Creates a timestamped message payload that number of back trajectory table points to play.")]
+    public partial class CreateTimestampedBrakeTrajectoryLengthPayload : CreateBrakeTrajectoryLengthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of back trajectory table points to play.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeTrajectoryLength register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectoryLength.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.
+    /// </summary>
+    [DisplayName("BrakeTrajectorySampleRatePayload")]
+    [Description("Creates a message payload that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.")]
+    public partial class CreateBrakeTrajectorySampleRatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.
+        /// </summary>
+        [Description("The value that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.")]
+        public ushort BrakeTrajectorySampleRate { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeTrajectorySampleRate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BrakeTrajectorySampleRate;
+        }
+
+        /// <summary>
+        /// Creates a message that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeTrajectorySampleRate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectorySampleRate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.
+    /// </summary>
+    [DisplayName("TimestampedBrakeTrajectorySampleRatePayload")]
+    [Description("Creates a timestamped message payload that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.")]
+    public partial class CreateTimestampedBrakeTrajectorySampleRatePayload : CreateBrakeTrajectorySampleRatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that rate in Hz at which trajectory points are applied to the brake, from the next playback. Maximum 10000.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeTrajectorySampleRate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectorySampleRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.
+    /// </summary>
+    [DisplayName("BrakeTrajectoryPlaybackPayload")]
+    [Description("Creates a message payload that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.")]
+    public partial class CreateBrakeTrajectoryPlaybackPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.
+        /// </summary>
+        [Description("The value that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.")]
+        public TrajectoryPlayback BrakeTrajectoryPlayback { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeTrajectoryPlayback register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TrajectoryPlayback GetPayload()
+        {
+            return BrakeTrajectoryPlayback;
+        }
+
+        /// <summary>
+        /// Creates a message that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeTrajectoryPlayback register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectoryPlayback.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.
+    /// </summary>
+    [DisplayName("TimestampedBrakeTrajectoryPlaybackPayload")]
+    [Description("Creates a timestamped message payload that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.")]
+    public partial class CreateTimestampedBrakeTrajectoryPlaybackPayload : CreateBrakeTrajectoryPlaybackPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that 0 stops playback, 1 plays the trajectory once, and 2 loops it. Writing 1 or 2 swaps in the back table if it was written since the last playback, and otherwise replays the last table. Writing 1 or 2 during playback restarts it seamlessly. Table writes are rejected until a swap completes. Playback is open-loop only and starts one sample period after the write. The brake holds its last value when playback ends. Reverts to 0 with an event when playback ends or the torque limit is triggered.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeTrajectoryPlayback register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTrajectoryPlayback.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.
+    /// </summary>
+    [DisplayName("BrakeMapWriteIndexPayload")]
+    [Description("Creates a message payload that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.")]
+    public partial class CreateBrakeMapWriteIndexPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.
+        /// </summary>
+        [Description("The value that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.")]
+        public ushort BrakeMapWriteIndex { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeMapWriteIndex register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BrakeMapWriteIndex;
+        }
+
+        /// <summary>
+        /// Creates a message that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeMapWriteIndex register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeMapWriteIndex.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.
+    /// </summary>
+    [DisplayName("TimestampedBrakeMapWriteIndexPayload")]
+    [Description("Creates a timestamped message payload that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.")]
+    public partial class CreateTimestampedBrakeMapWriteIndexPayload : CreateBrakeMapWriteIndexPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that index into the back brake map that the next BrakeMapData write starts at. Advances by the number of points in each write.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeMapWriteIndex register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeMapWriteIndex.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.
+    /// </summary>
+    [DisplayName("BrakeMapDataPayload")]
+    [Description("Creates a message payload that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.")]
+    public partial class CreateBrakeMapDataPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.
+        /// </summary>
+        [Description("The value that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.")]
+        public ushort[] BrakeMapData { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeMapData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return BrakeMapData;
+        }
+
+        /// <summary>
+        /// Creates a message that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeMapData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeMapData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.
+    /// </summary>
+    [DisplayName("TimestampedBrakeMapDataPayload")]
+    [Description("Creates a timestamped message payload that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.")]
+    public partial class CreateTimestampedBrakeMapDataPayload : CreateBrakeMapDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that up to 120 brake setpoints (raw DAC codes, as in BrakeCurrentSetPoint) to write to the back brake map at BrakeMapWriteIndex. Each map holds 1024 points. Reads return the points at BrakeMapWriteIndex.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeMapData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeMapData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.
+    /// </summary>
+    [DisplayName("BrakeMapConfigPayload")]
+    [Description("Creates a message payload that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.")]
+    public partial class CreateBrakeMapConfigPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.
+        /// </summary>
+        [Description("The value that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.")]
+        public uint[] BrakeMapConfig { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeMapConfig register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return BrakeMapConfig;
+        }
+
+        /// <summary>
+        /// Creates a message that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeMapConfig register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeMapConfig.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.
+    /// </summary>
+    [DisplayName("TimestampedBrakeMapConfigPayload")]
+    [Description("Creates a timestamped message payload that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.")]
+    public partial class CreateTimestampedBrakeMapConfigPayload : CreateBrakeMapConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that back brake map configuration [length (points), spacing (log2 of encoder ticks per point, up to 15), wrap length (encoder ticks, 0 for none), interpolate (0 or 1)]. Points start at tared encoder position 0. Positions outside the map hold the value at the nearest end.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeMapConfig register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeMapConfig.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.
+    /// </summary>
+    [DisplayName("BrakeMapPayload")]
+    [Description("Creates a message payload that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.")]
+    public partial class CreateBrakeMapPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.
+        /// </summary>
+        [Description("The value that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.")]
+        public EnableFlag BrakeMap { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeMap register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return BrakeMap;
+        }
+
+        /// <summary>
+        /// Creates a message that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeMap register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeMap.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.
+    /// </summary>
+    [DisplayName("TimestampedBrakeMapPayload")]
+    [Description("Creates a timestamped message payload that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.")]
+    public partial class CreateTimestampedBrakeMapPayload : CreateBrakeMapPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that writing 1 swaps the back brake map in and drives the brake from it at the control rate, indexed by tared encoder position. Writing 1 again swaps in a new map seamlessly. Writing 0 disables the map and turns the brake off. Open-loop only. Reverts to 0 if the torque limit is triggered. Map writes are rejected until a swap completes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeMap register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeMap.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.
+    /// </summary>
+    [DisplayName("VirtualLoadParamsPayload")]
+    [Description("Creates a message payload that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.")]
+    public partial class CreateVirtualLoadParamsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.
+        /// </summary>
+        [Description("The value that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.")]
+        public uint[] VirtualLoadParams { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the VirtualLoadParams register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return VirtualLoadParams;
+        }
+
+        /// <summary>
+        /// Creates a message that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the VirtualLoadParams register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.VirtualLoadParams.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.
+    /// </summary>
+    [DisplayName("TimestampedVirtualLoadParamsPayload")]
+    [Description("Creates a timestamped message payload that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.")]
+    public partial class CreateTimestampedVirtualLoadParamsPayload : CreateVirtualLoadParamsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that virtual load parameters [viscous damping (Q24.8 microamps per count/s), Coulomb friction (microamps), added inertia (Q24.8 microamps per count/s^2), friction deadband (counts/s)]. Every term resists motion, and the total brake current is clamped at zero since the brake cannot drive the belt.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the VirtualLoadParams register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.VirtualLoadParams.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.
+    /// </summary>
+    [DisplayName("VirtualLoadPayload")]
+    [Description("Creates a message payload that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.")]
+    public partial class CreateVirtualLoadPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.
+        /// </summary>
+        [Description("The value that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.")]
+        public EnableFlag VirtualLoad { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the VirtualLoad register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return VirtualLoad;
+        }
+
+        /// <summary>
+        /// Creates a message that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the VirtualLoad register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.VirtualLoad.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.
+    /// </summary>
+    [DisplayName("TimestampedVirtualLoadPayload")]
+    [Description("Creates a timestamped message payload that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.")]
+    public partial class CreateTimestampedVirtualLoadPayload : CreateVirtualLoadPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that writing 1 drives the closed-loop brake current setpoint from encoder velocity and acceleration at the control rate to emulate the load set in VirtualLoadParams. Requires BrakeCurrentControl. BrakeCurrentSetPointMicroamps writes are rejected while enabled.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the VirtualLoad register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.VirtualLoad.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.
+    /// </summary>
+    [DisplayName("SensorDataPackedPayload")]
+    [Description("Creates a message payload that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.")]
+    public partial class CreateSensorDataPackedPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.
+        /// </summary>
+        [Description("The value that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.")]
+        public byte[] SensorDataPacked { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataPacked register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return SensorDataPacked;
+        }
+
+        /// <summary>
+        /// Creates a message that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataPacked register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataPacked.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataPackedPayload")]
+    [Description("Creates a timestamped message payload that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.")]
+    public partial class CreateTimestampedSensorDataPackedPayload : CreateSensorDataPackedPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that compact alternative to SensorData, emitted instead of it when SensorDataFormat is not Legacy. Little-endian record of [header (U8), Encoder (S32, or S16 delta from the previous event), Torque and TorqueLoadCurrent (3 bytes, Torque in bits 11:0, TorqueLoadCurrent in bits 23:12)]. Header bits 3:0 hold the format version (1), bit 4 is set if Encoder is a delta, and bits 5 and 6 are set if Torque and TorqueLoadCurrent (respectively) are tared S12 rather than raw U12 values. Tared values are saturated to the S12 range. Fields enabled in SensorDataFields are appended as S32 in bit order. The first event after enabling, muting, a rate change, or USB backpressure is always absolute.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataPacked register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataPacked.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that selects the event format used for periodic sensor data dispatch.
+    /// </summary>
+    [DisplayName("SensorDataFormatPayload")]
+    [Description("Creates a message payload that selects the event format used for periodic sensor data dispatch.")]
+    public partial class CreateSensorDataFormatPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that selects the event format used for periodic sensor data dispatch.
+        /// </summary>
+        [Description("The value that selects the event format used for periodic sensor data dispatch.")]
+        public SensorDataFormat SensorDataFormat { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataFormat register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SensorDataFormat GetPayload()
+        {
+            return SensorDataFormat;
+        }
+
+        /// <summary>
+        /// Creates a message that selects the event format used for periodic sensor data dispatch.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataFormat register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataFormat.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that selects the event format used for periodic sensor data dispatch.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataFormatPayload")]
+    [Description("Creates a timestamped message payload that selects the event format used for periodic sensor data dispatch.")]
+    public partial class CreateTimestampedSensorDataFormatPayload : CreateSensorDataFormatPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that selects the event format used for periodic sensor data dispatch.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataFormat register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataFormat.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.
+    /// </summary>
+    [DisplayName("SensorDataDispatchDeadbandPayload")]
+    [Description("Creates a message payload that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.")]
+    public partial class CreateSensorDataDispatchDeadbandPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.
+        /// </summary>
+        [Description("The value that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.")]
+        public ushort[] SensorDataDispatchDeadband { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataDispatchDeadband register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return SensorDataDispatchDeadband;
+        }
+
+        /// <summary>
+        /// Creates a message that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataDispatchDeadband register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataDispatchDeadband.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataDispatchDeadbandPayload")]
+    [Description("Creates a timestamped message payload that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.")]
+    public partial class CreateTimestampedSensorDataDispatchDeadbandPayload : CreateSensorDataDispatchDeadbandPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that change-driven dispatch thresholds [Encoder (ticks), Torque (raw counts), TorqueLoadCurrent (raw counts)]. If any is nonzero, a periodic sensor data event is only sent when the encoder has moved by at least its threshold, or an analog value has changed by more than its deadband, since the last event sent. Zero thresholds are ignored. All zero sends every event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataDispatchDeadband register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataDispatchDeadband.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.
+    /// </summary>
+    [DisplayName("SensorDataDispatchHeartbeatPayload")]
+    [Description("Creates a message payload that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.")]
+    public partial class CreateSensorDataDispatchHeartbeatPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.
+        /// </summary>
+        [Description("The value that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.")]
+        public ushort SensorDataDispatchHeartbeat { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataDispatchHeartbeat register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SensorDataDispatchHeartbeat;
+        }
+
+        /// <summary>
+        /// Creates a message that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataDispatchHeartbeat register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataDispatchHeartbeat.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataDispatchHeartbeatPayload")]
+    [Description("Creates a timestamped message payload that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.")]
+    public partial class CreateTimestampedSensorDataDispatchHeartbeatPayload : CreateSensorDataDispatchHeartbeatPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that longest interval (ms) between change-driven sensor data events, so that a stationary treadmill still produces events. 0 disables the heartbeat. Defaults to 1000.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataDispatchHeartbeat register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataDispatchHeartbeat.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that extended alternative to SensorData, emitted instead of it when SensorDataFormat is Stats. Reduces every torque and load current ADC conversion since the previous event to [Encoder, SampleCount, TorqueMin, TorqueMax, TorqueMean, TorqueLoadCurrentMin, TorqueLoadCurrentMax, TorqueLoadCurrentMean]. Encoder is the latest value. SampleCount is the number of torque conversions. Conversions are tared like SensorData but never filtered. Fields enabled in SensorDataFields are appended in bit order.
+    /// </summary>
+    [DisplayName("SensorDataStatsPayload")]
+    [Description("Creates a message payload that extended alternative to SensorData, emitted instead of it when SensorDataFormat is Stats. Reduces every torque and load current ADC conversion since the previous event to [Encoder, SampleCount, TorqueMin, TorqueMax, TorqueMean, TorqueLoadCurrentMin, TorqueLoadCurrentMax, TorqueLoadCurrentMean]. Encoder is the latest value. SampleCount is the number of torque conversions. Conversions are tared like SensorData but never filtered. Fields enabled in SensorDataFields are appended in bit order.")]
+    public partial class CreateSensorDataStatsPayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Encoder.
+        /// </summary>
+        [Description("")]
+        public int Encoder { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member SampleCount.
+        /// </summary>
+        [Description("")]
+        public int SampleCount { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TorqueMin.
+        /// </summary>
+        [Description("")]
+        public int TorqueMin { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TorqueMax.
+        /// </summary>
+        [Description("")]
+        public int TorqueMax { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TorqueMean.
+        /// </summary>
+        [Description("")]
+        public int TorqueMean { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TorqueLoadCurrentMin.
+        /// </summary>
+        [Description("")]
+        public int TorqueLoadCurrentMin { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TorqueLoadCurrentMax.
+        /// </summary>
+        [Description("")]
+        public int TorqueLoadCurrentMax { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TorqueLoadCurrentMean.
+        /// </summary>
+        [Description("")]
+        public int TorqueLoadCurrentMean { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorDataStats register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SensorDataStatsPayload GetPayload()
+        {
+            SensorDataStatsPayload value;
+            value.Encoder = Encoder;
+            value.SampleCount = SampleCount;
+            value.TorqueMin = TorqueMin;
+            value.TorqueMax = TorqueMax;
+            value.TorqueMean = TorqueMean;
+            value.TorqueLoadCurrentMin = TorqueLoadCurrentMin;
+            value.TorqueLoadCurrentMax = TorqueLoadCurrentMax;
+            value.TorqueLoadCurrentMean = TorqueLoadCurrentMean;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that extended alternative to SensorData, emitted instead of it when SensorDataFormat is Stats. Reduces every torque and load current ADC conversion since the previous event to [Encoder, SampleCount, TorqueMin, TorqueMax, TorqueMean, TorqueLoadCurrentMin, TorqueLoadCurrentMax, TorqueLoadCurrentMean]. Encoder is the latest value. SampleCount is the number of torque conversions. Conversions are tared like SensorData but never filtered. Fields enabled in SensorDataFields are appended in bit order.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorDataStats register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataStats.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that extended alternative to SensorData, emitted instead of it when SensorDataFormat is Stats. Reduces every torque and load current ADC conversion since the previous event to [Encoder, SampleCount, TorqueMin, TorqueMax, TorqueMean, TorqueLoadCurrentMin, TorqueLoadCurrentMax, TorqueLoadCurrentMean]. Encoder is the latest value. SampleCount is the number of torque conversions. Conversions are tared like SensorData but never filtered. Fields enabled in SensorDataFields are appended in bit order.
+    /// </summary>
+    [DisplayName("TimestampedSensorDataStatsPayload")]
+    [Description("Creates a timestamped message payload that extended alternative to SensorData, emitted instead of it when SensorDataFormat is Stats. Reduces every torque and load current ADC conversion since the previous event to [Encoder, SampleCount, TorqueMin, TorqueMax, TorqueMean, TorqueLoadCurrentMin, TorqueLoadCurrentMax, TorqueLoadCurrentMean]. Encoder is the latest value. SampleCount is the number of torque conversions. Conversions are tared like SensorData but never filtered. Fields enabled in SensorDataFields are appended in bit order.")]
+    public partial class CreateTimestampedSensorDataStatsPayload : CreateSensorDataStatsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that extended alternative to SensorData, emitted instead of it when SensorDataFormat is Stats. Reduces every torque and load current ADC conversion since the previous event to [Encoder, SampleCount, TorqueMin, TorqueMax, TorqueMean, TorqueLoadCurrentMin, TorqueLoadCurrentMax, TorqueLoadCurrentMean]. Encoder is the latest value. SampleCount is the number of torque conversions. Conversions are tared like SensorData but never filtered. Fields enabled in SensorDataFields are appended in bit order.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorDataStats register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorDataStats.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.
+    /// </summary>
+    [DisplayName("BrakeCalibrationWriteIndexPayload")]
+    [Description("Creates a message payload that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.")]
+    public partial class CreateBrakeCalibrationWriteIndexPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.
+        /// </summary>
+        [Range(min: 0, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.")]
+        public ushort BrakeCalibrationWriteIndex { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCalibrationWriteIndex register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BrakeCalibrationWriteIndex;
+        }
+
+        /// <summary>
+        /// Creates a message that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCalibrationWriteIndex register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationWriteIndex.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.
+    /// </summary>
+    [DisplayName("TimestampedBrakeCalibrationWriteIndexPayload")]
+    [Description("Creates a timestamped message payload that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.")]
+    public partial class CreateTimestampedBrakeCalibrationWriteIndexPayload : CreateBrakeCalibrationWriteIndexPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that staged brake calibration table index that the next BrakeCalibrationData write starts at. Advances by the number of points written.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCalibrationWriteIndex register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationWriteIndex.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.
+    /// </summary>
+    [DisplayName("BrakeCalibrationDataPayload")]
+    [Description("Creates a message payload that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.")]
+    public partial class CreateBrakeCalibrationDataPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.
+        /// </summary>
+        [Description("The value that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.")]
+        public ushort[] BrakeCalibrationData { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCalibrationData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return BrakeCalibrationData;
+        }
+
+        /// <summary>
+        /// Creates a message that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCalibrationData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.
+    /// </summary>
+    [DisplayName("TimestampedBrakeCalibrationDataPayload")]
+    [Description("Creates a timestamped message payload that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.")]
+    public partial class CreateTimestampedBrakeCalibrationDataPayload : CreateBrakeCalibrationDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that up to 120 brake setpoints (raw DAC codes) to copy into the staged calibration table at BrakeCalibrationWriteIndex. Points are the setpoints at evenly spaced torques from 0 to the full-scale torque. Reads return the active table points at BrakeCalibrationWriteIndex.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCalibrationData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.
+    /// </summary>
+    [DisplayName("BrakeCalibrationConfigPayload")]
+    [Description("Creates a message payload that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.")]
+    public partial class CreateBrakeCalibrationConfigPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.
+        /// </summary>
+        [Description("The value that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.")]
+        public uint[] BrakeCalibrationConfig { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCalibrationConfig register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return BrakeCalibrationConfig;
+        }
+
+        /// <summary>
+        /// Creates a message that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCalibrationConfig register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationConfig.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.
+    /// </summary>
+    [DisplayName("TimestampedBrakeCalibrationConfigPayload")]
+    [Description("Creates a timestamped message payload that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.")]
+    public partial class CreateTimestampedBrakeCalibrationConfigPayload : CreateBrakeCalibrationConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that staged calibration table [length (2 to 256 points), full-scale torque (Q16.16 N*m)]. Writing applies the staged table, replacing the active one.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCalibrationConfig register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationConfig.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.
+    /// </summary>
+    [DisplayName("BrakeCalibrationStorePayload")]
+    [Description("Creates a message payload that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.")]
+    public partial class CreateBrakeCalibrationStorePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.
+        /// </summary>
+        [Description("The value that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.")]
+        public byte BrakeCalibrationStore { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCalibrationStore register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return BrakeCalibrationStore;
+        }
+
+        /// <summary>
+        /// Creates a message that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCalibrationStore register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationStore.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.
+    /// </summary>
+    [DisplayName("TimestampedBrakeCalibrationStorePayload")]
+    [Description("Creates a timestamped message payload that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.")]
+    public partial class CreateTimestampedBrakeCalibrationStorePayload : CreateBrakeCalibrationStorePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that writing 1 stores the active calibration table in flash, where it is loaded from at power-up. Sensing and control pause briefly, so this is rejected unless the brake is idle.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCalibrationStore register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationStore.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.
+    /// </summary>
+    [DisplayName("BrakeCalibrationChecksumPayload")]
+    [Description("Creates a message payload that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.")]
+    public partial class CreateBrakeCalibrationChecksumPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.
+        /// </summary>
+        [Description("The value that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.")]
+        public uint BrakeCalibrationChecksum { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeCalibrationChecksum register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return BrakeCalibrationChecksum;
+        }
+
+        /// <summary>
+        /// Creates a message that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeCalibrationChecksum register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationChecksum.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.
+    /// </summary>
+    [DisplayName("TimestampedBrakeCalibrationChecksumPayload")]
+    [Description("Creates a timestamped message payload that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.")]
+    public partial class CreateTimestampedBrakeCalibrationChecksumPayload : CreateBrakeCalibrationChecksumPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that checksum (CRC-32, as zlib.crc32) of the active calibration table's little-endian [length (U16), 0 (U16), full-scale torque (U32), points (U16)]. 0 if there is no table.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeCalibrationChecksum register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeCalibrationChecksum.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.
+    /// </summary>
+    [DisplayName("BrakeTorqueSetPointPayload")]
+    [Description("Creates a message payload that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.")]
+    public partial class CreateBrakeTorqueSetPointPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.
+        /// </summary>
+        [Description("The value that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.")]
+        public uint BrakeTorqueSetPoint { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeTorqueSetPoint register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return BrakeTorqueSetPoint;
+        }
+
+        /// <summary>
+        /// Creates a message that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeTorqueSetPoint register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTorqueSetPoint.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.
+    /// </summary>
+    [DisplayName("TimestampedBrakeTorqueSetPointPayload")]
+    [Description("Creates a timestamped message payload that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.")]
+    public partial class CreateTimestampedBrakeTorqueSetPointPayload : CreateBrakeTorqueSetPointPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that brake torque setpoint in Q16.16 N*m. Converted to BrakeCurrentSetPoint by interpolating the active calibration table. Torques beyond full scale use the last point. Rejected if there is no table and under the same conditions as BrakeCurrentSetPoint.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeTorqueSetPoint register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeTorqueSetPoint.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.
+    /// </summary>
+    [DisplayName("TorqueLimitsPayload")]
+    [Description("Creates a message payload that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.")]
+    public partial class CreateTorqueLimitsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.
+        /// </summary>
+        [Description("The value that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.")]
+        public ushort[] TorqueLimits { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TorqueLimits register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return TorqueLimits;
+        }
+
+        /// <summary>
+        /// Creates a message that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TorqueLimits register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimits.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.
+    /// </summary>
+    [DisplayName("TimestampedTorqueLimitsPayload")]
+    [Description("Creates a timestamped message payload that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.")]
+    public partial class CreateTimestampedTorqueLimitsPayload : CreateTorqueLimitsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that raw torque sensor values [min, max] outside of which the (filtered) torque trips the torque limit. Defaults to [100, 3995]. Max must be greater than min and at most 4095.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TorqueLimits register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.TorqueLimits.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.
+    /// </summary>
+    [DisplayName("PersistentConfigPayload")]
+    [Description("Creates a message payload that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.")]
+    public partial class CreatePersistentConfigPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.
+        /// </summary>
+        [Description("The value that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.")]
+        public PersistentConfigAction PersistentConfig { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PersistentConfig register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PersistentConfigAction GetPayload()
+        {
+            return PersistentConfig;
+        }
+
+        /// <summary>
+        /// Creates a message that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PersistentConfig register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.PersistentConfig.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.
+    /// </summary>
+    [DisplayName("TimestampedPersistentConfigPayload")]
+    [Description("Creates a timestamped message payload that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.")]
+    public partial class CreateTimestampedPersistentConfigPayload : CreatePersistentConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that save stores the current dispatch rates and formats, batch settings, Torque and TorqueLoadCurrent tares, torque limit settings, and brake current control gains in flash. They are restored at power-up and on reset. Restore applies the saved configuration now. Forget reverts to defaults on the next reset. Erase prepares flash for the next Save. Flash is only written when Save, Forget or Erase is requested, and only while the brake is idle, because writing it pauses sensing, control, events and USB. Save and Forget program one page, which takes about 1 ms. Erase erases a sector if one is due, which takes about 45 ms. One is due every 16 saves, and Save and Forget fail until it is erased. Due erases are also done at power-up. Bit 0 reads 1 if a configuration is saved, and bit 1 if an erase is due.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PersistentConfig register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.PersistentConfig.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.
+    /// </summary>
+    [DisplayName("SensorSkewPayload")]
+    [Description("Creates a message payload that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.")]
+    public partial class CreateSensorSkewPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.
+        /// </summary>
+        [Description("The value that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.")]
+        public uint[] SensorSkew { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorSkew register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return SensorSkew;
+        }
+
+        /// <summary>
+        /// Creates a message that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SensorSkew register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorSkew.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.
+    /// </summary>
+    [DisplayName("TimestampedSensorSkewPayload")]
+    [Description("Creates a timestamped message payload that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.")]
+    public partial class CreateTimestampedSensorSkewPayload : CreateSensorSkewPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that furthest (ns) that each sensor value may have been acquired from the timestamp of its event over the last 100 ms [Encoder, Torque, TorqueLoadCurrent]. The device measures the pace and phase of each sensor stream, and stamps each event halfway between the oldest and newest that its values may be. The skew between any two sensors is at most the sum of their values.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SensorSkew register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.SensorSkew.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.
+    /// </summary>
+    [DisplayName("FlightRecorderPayload")]
+    [Description("Creates a message payload that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.")]
+    public partial class CreateFlightRecorderPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.
+        /// </summary>
+        [Description("The value that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.")]
+        public FlightRecorderAction FlightRecorder { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FlightRecorder register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public FlightRecorderAction GetPayload()
+        {
+            return FlightRecorder;
+        }
+
+        /// <summary>
+        /// Creates a message that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FlightRecorder register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorder.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.
+    /// </summary>
+    [DisplayName("TimestampedFlightRecorderPayload")]
+    [Description("Creates a timestamped message payload that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.")]
+    public partial class CreateTimestampedFlightRecorderPayload : CreateFlightRecorderPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that full-rate (10 kHz) capture around torque limit trips. Armed at power-up and on reset. While armed, samples are recorded into a 2048-sample ring. A torque limit trip or a Trigger write records the post window and then freezes the capture until it is rearmed or disarmed. Arm and Disarm discard any capture. Reads the FlightRecorderState. An event is sent when the capture is triggered (timestamped at the trigger) and when it freezes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FlightRecorder register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorder.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.
+    /// </summary>
+    [DisplayName("FlightRecorderWindowPayload")]
+    [Description("Creates a message payload that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.")]
+    public partial class CreateFlightRecorderWindowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.
+        /// </summary>
+        [Description("The value that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.")]
+        public ushort[] FlightRecorderWindow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FlightRecorderWindow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return FlightRecorderWindow;
+        }
+
+        /// <summary>
+        /// Creates a message that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FlightRecorderWindow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorderWindow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.
+    /// </summary>
+    [DisplayName("TimestampedFlightRecorderWindowPayload")]
+    [Description("Creates a timestamped message payload that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.")]
+    public partial class CreateTimestampedFlightRecorderWindowPayload : CreateFlightRecorderWindowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that samples [pre, post] to keep around the trigger. The post window starts with the trigger sample and must not be empty. Their sum must be at most 2048. Defaults to [1024, 1024]. Takes effect on the next trigger.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FlightRecorderWindow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorderWindow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.
+    /// </summary>
+    [DisplayName("FlightRecorderReadIndexPayload")]
+    [Description("Creates a message payload that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.")]
+    public partial class CreateFlightRecorderReadIndexPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.
+        /// </summary>
+        [Description("The value that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.")]
+        public ushort FlightRecorderReadIndex { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FlightRecorderReadIndex register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return FlightRecorderReadIndex;
+        }
+
+        /// <summary>
+        /// Creates a message that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FlightRecorderReadIndex register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorderReadIndex.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.
+    /// </summary>
+    [DisplayName("TimestampedFlightRecorderReadIndexPayload")]
+    [Description("Creates a timestamped message payload that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.")]
+    public partial class CreateTimestampedFlightRecorderReadIndexPayload : CreateFlightRecorderReadIndexPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that record of the frozen capture that the next FlightRecorderData read starts at. Advances by the number of records read. Reset to 0 when the recorder is armed or disarmed.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FlightRecorderReadIndex register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorderReadIndex.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.
+    /// </summary>
+    [DisplayName("FlightRecorderDataPayload")]
+    [Description("Creates a message payload that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.")]
+    public partial class CreateFlightRecorderDataPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.
+        /// </summary>
+        [Description("The value that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.")]
+        public byte[] FlightRecorderData { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FlightRecorderData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return FlightRecorderData;
+        }
+
+        /// <summary>
+        /// Creates a message that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FlightRecorderData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorderData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.
+    /// </summary>
+    [DisplayName("TimestampedFlightRecorderDataPayload")]
+    [Description("Creates a timestamped message payload that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.")]
+    public partial class CreateTimestampedFlightRecorderDataPayload : CreateFlightRecorderDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that up to 15 records of the frozen capture, starting at FlightRecorderReadIndex. Variable length; empty past the end of the capture. Read error unless the capture is frozen. Each 16-byte little-endian record is [time relative to the trigger sample in us (S32), Encoder (S32), Torque (S16), TorqueLoadCurrent (S16), brake setpoint DAC code (U16), flags (U16)]. Flags bit 0 is set if the torque limit was triggered as of the sample.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FlightRecorderData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorderData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.
+    /// </summary>
+    [DisplayName("FlightRecorderCapturePayload")]
+    [Description("Creates a message payload that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.")]
+    public partial class CreateFlightRecorderCapturePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.
+        /// </summary>
+        [Description("The value that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.")]
+        public ushort[] FlightRecorderCapture { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FlightRecorderCapture register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return FlightRecorderCapture;
+        }
+
+        /// <summary>
+        /// Creates a message that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FlightRecorderCapture register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorderCapture.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.
+    /// </summary>
+    [DisplayName("TimestampedFlightRecorderCapturePayload")]
+    [Description("Creates a timestamped message payload that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.")]
+    public partial class CreateTimestampedFlightRecorderCapturePayload : CreateFlightRecorderCapturePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that frozen capture [records, trigger index]. The trigger index is the position of the trigger sample, i.e. the number of pre window records, which can be fewer than requested if the trigger came soon after arming. Both are 0 unless the capture is frozen.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FlightRecorderCapture register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.FlightRecorderCapture.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.
+    /// </summary>
+    [DisplayName("EncoderTarePayload")]
+    [Description("Creates a message payload that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.")]
+    public partial class CreateEncoderTarePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.
+        /// </summary>
+        [Description("The value that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.")]
+        public byte EncoderTare { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EncoderTare register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return EncoderTare;
+        }
+
+        /// <summary>
+        /// Creates a message that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EncoderTare register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EncoderTare.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.
+    /// </summary>
+    [DisplayName("TimestampedEncoderTarePayload")]
+    [Description("Creates a timestamped message payload that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.")]
+    public partial class CreateTimestampedEncoderTarePayload : CreateEncoderTarePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that per-encoder tare for rigs with additional encoders, e.g. a motorized belt or a rotating wheel, alongside the treadmill (encoder 0). Bits 3:0 tare, and bits 7:4 remove the tare from, encoders 0-3. Tare and remove bits for the same encoder are rejected. Reads which encoders are tared. Encoder 0 is kept in step with the Encoder bit of TareSensors and ResetTareSensors. The number of encoders is set at build time.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EncoderTare register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.EncoderTare.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+    /// </summary>
+    [DisplayName("AuxEncoderReadCyclesPayload")]
+    [Description("Creates a message payload that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class CreateAuxEncoderReadCyclesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+        /// </summary>
+        [Description("The value that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+        public ushort[] AuxEncoderReadCycles { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AuxEncoderReadCycles register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return AuxEncoderReadCycles;
+        }
+
+        /// <summary>
+        /// Creates a message that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AuxEncoderReadCycles register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.AuxEncoderReadCycles.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+    /// </summary>
+    [DisplayName("TimestampedAuxEncoderReadCyclesPayload")]
+    [Description("Creates a timestamped message payload that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class CreateTimestampedAuxEncoderReadCyclesPayload : CreateAuxEncoderReadCyclesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mean CPU cycles to read the positions of every additional encoder [requested together then fetched, requested and fetched one at a time]. The first is what each sample costs. Both are 0 if there are no additional encoders. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AuxEncoderReadCycles register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.AuxEncoderReadCycles.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.
+    /// </summary>
+    [DisplayName("BrakeStepTestPayload")]
+    [Description("Creates a message payload that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.")]
+    public partial class CreateBrakeStepTestPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.
+        /// </summary>
+        [Description("The value that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.")]
+        public BrakeStepTestAction BrakeStepTest { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeStepTest register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public BrakeStepTestAction GetPayload()
+        {
+            return BrakeStepTest;
+        }
+
+        /// <summary>
+        /// Creates a message that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeStepTest register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeStepTest.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.
+    /// </summary>
+    [DisplayName("TimestampedBrakeStepTestPayload")]
+    [Description("Creates a timestamped message payload that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.")]
+    public partial class CreateTimestampedBrakeStepTestPayload : CreateBrakeStepTestPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Creates a timestamped message that brake step-response self-test. Start steps the brake open-loop between the BrakeStepTestConfig setpoints, first settling at the low one, and captures the brake current around each step at the full ADC rate. Conversions are averaged in power-of-two groups only if the hold time does not fit in 8192 samples. Each step is analyzed on the device and folded into BrakeStepTestResults. Start is rejected unless the brake is idle. Brake setpoint writes, closed-loop control, trajectory playback and brake maps are rejected while running. Stop, or a torque limit trip, aborts the test. The brake is off when the test ends. Reads the BrakeStepTestState. An event is sent when the test ends.
         /// </summary>
-        public CreateMessage()
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeStepTest register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            Payload = new CreateEncoderPayload();
+            return AllenNeuralDynamics.Treadmill.BrakeStepTest.FromPayload(timestamp, messageType, GetPayload());
         }
+    }
 
-        string INamedElement.Name => $"{nameof(Treadmill)}.{GetElementDisplayName(Payload)}";
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.
+    /// </summary>
+    [DisplayName("BrakeStepTestConfigPayload")]
+    [Description("Creates a message payload that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.")]
+    public partial class CreateBrakeStepTestConfigPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.
+        /// </summary>
+        [Description("The value that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.")]
+        public ushort[] BrakeStepTestConfig { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BrakeStepTestConfig register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return BrakeStepTestConfig;
+        }
+
+        /// <summary>
+        /// Creates a message that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeStepTestConfig register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeStepTestConfig.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.
+    /// </summary>
+    [DisplayName("TimestampedBrakeStepTestConfigPayload")]
+    [Description("Creates a timestamped message payload that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.")]
+    public partial class CreateTimestampedBrakeStepTestConfigPayload : CreateBrakeStepTestConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that brake step test [low, high] raw DAC setpoints, hold time per step in ms, and number of steps. Steps alternate between high and low. Defaults to [0, 2048, 20, 10]. Rejected while running.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeStepTestConfig register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeStepTestConfig.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that contains the current accumulated number of ticks.
+    /// that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.
     /// </summary>
-    [DisplayName("EncoderPayload")]
-    [Description("Creates a message payload that contains the current accumulated number of ticks.")]
-    public partial class CreateEncoderPayload
+    [DisplayName("BrakeStepTestResultsPayload")]
+    [Description("Creates a message payload that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.")]
+    public partial class CreateBrakeStepTestResultsPayload
     {
         /// <summary>
-        /// Gets or sets the value that contains the current accumulated number of ticks.
+        /// Gets or sets the value that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.
         /// </summary>
-        [Description("The value that contains the current accumulated number of ticks.")]
-        public int Encoder { get; set; }
+        [Description("The value that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.")]
+        public uint[] BrakeStepTestResults { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Encoder register.
+        /// Creates a message payload for the BrakeStepTestResults register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public int GetPayload()
+        public uint[] GetPayload()
         {
-            return Encoder;
+            return BrakeStepTestResults;
         }
 
         /// <summary>
-        /// Creates a message that contains the current accumulated number of ticks.
+        /// Creates a message that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Encoder register.</returns>
+        /// <returns>A new message for the BrakeStepTestResults register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.Encoder.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.BrakeStepTestResults.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that contains the current accumulated number of ticks.
+    /// that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.
     /// </summary>
-    [DisplayName("TimestampedEncoderPayload")]
-    [Description("Creates a timestamped message payload that contains the current accumulated number of ticks.")]
-    public partial class CreateTimestampedEncoderPayload : CreateEncoderPayload
+    [DisplayName("TimestampedBrakeStepTestResultsPayload")]
+    [Description("Creates a timestamped message payload that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.")]
+    public partial class CreateTimestampedBrakeStepTestResultsPayload : CreateBrakeStepTestResultsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that contains the current accumulated number of ticks.
+        /// Creates a timestamped message that brake step test results [steps analyzed, worst command-to-DAC latency in us, worst 10-90% rise time in ns, worst settling time to within 2% of the step in ns, worst overshoot in 0.1% of the step]. Rise and settling times are 0xFFFFFFFF if a step never reached 90% or did not settle before the last tenth of its capture. Steps no larger than the noise before them are not analyzed. Cleared when a test starts.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Encoder register.</returns>
+        /// <returns>A new timestamped message for the BrakeStepTestResults register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.Encoder.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.BrakeStepTestResults.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that contains the current torque value.
+    /// that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.
     /// </summary>
-    [DisplayName("TorquePayload")]
-    [Description("Creates a message payload that contains the current torque value.")]
-    public partial class CreateTorquePayload
+    [DisplayName("BrakeSetpointLatencyPayload")]
+    [Description("Creates a message payload that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.")]
+    public partial class CreateBrakeSetpointLatencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that contains the current torque value.
+        /// Gets or sets the value that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.
         /// </summary>
-        [Description("The value that contains the current torque value.")]
-        public short Torque { get; set; }
+        [Description("The value that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.")]
+        public uint[] BrakeSetpointLatency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Torque register.
+        /// Creates a message payload for the BrakeSetpointLatency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public uint[] GetPayload()
         {
-            return Torque;
+            return BrakeSetpointLatency;
         }
 
         /// <summary>
-        /// Creates a message that contains the current torque value.
+        /// Creates a message that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Torque register.</returns>
+        /// <returns>A new message for the BrakeSetpointLatency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.Torque.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.BrakeSetpointLatency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that contains the current torque value.
+    /// that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.
     /// </summary>
-    [DisplayName("TimestampedTorquePayload")]
-    [Description("Creates a timestamped message payload that contains the current torque value.")]
-    public partial class CreateTimestampedTorquePayload : CreateTorquePayload
+    [DisplayName("TimestampedBrakeSetpointLatencyPayload")]
+    [Description("Creates a timestamped message payload that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.")]
+    public partial class CreateTimestampedBrakeSetpointLatencyPayload : CreateBrakeSetpointLatencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that contains the current torque value.
+        /// Creates a timestamped message that time in microseconds from a BrakeCurrentSetPoint, BrakeTorqueSetPoint, or brake step test setpoint being handled to its DAC write [last, max]. It includes waiting for the next core1 loop tick. It does not include USB transfer or Harp message parsing. Wraps past 65535 us. The max is cleared by ResetDiagnostics.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Torque register.</returns>
+        /// <returns>A new timestamped message for the BrakeSetpointLatency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.Torque.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.BrakeSetpointLatency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that contains the current output current applied to the variable torque load.
+    /// that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.
     /// </summary>
-    [DisplayName("TorqueLoadCurrentPayload")]
-    [Description("Creates a message payload that contains the current output current applied to the variable torque load.")]
-    public partial class CreateTorqueLoadCurrentPayload
+    [DisplayName("BrakeStepTraceReadIndexPayload")]
+    [Description("Creates a message payload that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.")]
+    public partial class CreateBrakeStepTraceReadIndexPayload
     {
         /// <summary>
-        /// Gets or sets the value that contains the current output current applied to the variable torque load.
+        /// Gets or sets the value that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.
         /// </summary>
-        [Description("The value that contains the current output current applied to the variable torque load.")]
-        public short TorqueLoadCurrent { get; set; }
+        [Description("The value that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.")]
+        public ushort BrakeStepTraceReadIndex { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the TorqueLoadCurrent register.
+        /// Creates a message payload for the BrakeStepTraceReadIndex register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public ushort GetPayload()
         {
-            return TorqueLoadCurrent;
+            return BrakeStepTraceReadIndex;
         }
 
         /// <summary>
-        /// Creates a message that contains the current output current applied to the variable torque load.
+        /// Creates a message that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TorqueLoadCurrent register.</returns>
+        /// <returns>A new message for the BrakeStepTraceReadIndex register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.TorqueLoadCurrent.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.BrakeStepTraceReadIndex.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that contains the current output current applied to the variable torque load.
+    /// that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.
     /// </summary>
-    [DisplayName("TimestampedTorqueLoadCurrentPayload")]
-    [Description("Creates a timestamped message payload that contains the current output current applied to the variable torque load.")]
-    public partial class CreateTimestampedTorqueLoadCurrentPayload : CreateTorqueLoadCurrentPayload
+    [DisplayName("TimestampedBrakeStepTraceReadIndexPayload")]
+    [Description("Creates a timestamped message payload that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.")]
+    public partial class CreateTimestampedBrakeStepTraceReadIndexPayload : CreateBrakeStepTraceReadIndexPayload
     {
         /// <summary>
-        /// Creates a timestamped message that contains the current output current applied to the variable torque load.
+        /// Creates a timestamped message that sample of the brake step trace that the next BrakeStepTrace read starts at. Advances by the number of samples read. Reset to 0 when a test starts.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TorqueLoadCurrent register.</returns>
+        /// <returns>A new timestamped message for the BrakeStepTraceReadIndex register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.TorqueLoadCurrent.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.BrakeStepTraceReadIndex.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent].
+    /// that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.
     /// </summary>
-    [DisplayName("SensorDataPayload")]
-    [Description("Creates a message payload that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent].")]
-    public partial class CreateSensorDataPayload
+    [DisplayName("BrakeStepTracePayload")]
+    [Description("Creates a message payload that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.")]
+    public partial class CreateBrakeStepTracePayload
     {
         /// <summary>
-        /// Gets or sets a value to write on payload member Encoder.
+        /// Gets or sets the value that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.
         /// </summary>
-        [Description("")]
-        public int Encoder { get; set; }
+        [Description("The value that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.")]
+        public ushort[] BrakeStepTrace { get; set; }
 
         /// <summary>
-        /// Gets or sets a value to write on payload member Torque.
+        /// Creates a message payload for the BrakeStepTrace register.
         /// </summary>
-        [Description("")]
-        public int Torque { get; set; }
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return BrakeStepTrace;
+        }
 
         /// <summary>
-        /// Gets or sets a value to write on payload member TorqueLoadCurrent.
+        /// Creates a message that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.
         /// </summary>
-        [Description("")]
-        public int TorqueLoadCurrent { get; set; }
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BrakeStepTrace register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeStepTrace.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.
+    /// </summary>
+    [DisplayName("TimestampedBrakeStepTracePayload")]
+    [Description("Creates a timestamped message payload that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.")]
+    public partial class CreateTimestampedBrakeStepTracePayload : CreateBrakeStepTracePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that up to 120 raw brake current ADC counts of the last step's capture, starting at BrakeStepTraceReadIndex. Variable length; empty past the end of the trace. Read error while a test is running. Empty after an aborted test.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BrakeStepTrace register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return AllenNeuralDynamics.Treadmill.BrakeStepTrace.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.
+    /// </summary>
+    [DisplayName("BrakeStepTraceInfoPayload")]
+    [Description("Creates a message payload that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.")]
+    public partial class CreateBrakeStepTraceInfoPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.
+        /// </summary>
+        [Description("The value that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.")]
+        public uint[] BrakeStepTraceInfo { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SensorData register.
+        /// Creates a message payload for the BrakeStepTraceInfo register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public SensorDataPayload GetPayload()
+        public uint[] GetPayload()
         {
-            SensorDataPayload value;
-            value.Encoder = Encoder;
-            value.Torque = Torque;
-            value.TorqueLoadCurrent = TorqueLoadCurrent;
-            return value;
+            return BrakeStepTraceInfo;
         }
 
         /// <summary>
-        /// Creates a message that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent].
+        /// Creates a message that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SensorData register.</returns>
+        /// <returns>A new message for the BrakeStepTraceInfo register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.SensorData.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.BrakeStepTraceInfo.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent].
+    /// that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.
     /// </summary>
-    [DisplayName("TimestampedSensorDataPayload")]
-    [Description("Creates a timestamped message payload that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent].")]
-    public partial class CreateTimestampedSensorDataPayload : CreateSensorDataPayload
+    [DisplayName("TimestampedBrakeStepTraceInfoPayload")]
+    [Description("Creates a timestamped message payload that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.")]
+    public partial class CreateTimestampedBrakeStepTraceInfoPayload : CreateBrakeStepTraceInfoPayload
     {
         /// <summary>
-        /// Creates a timestamped message that emits a periodic event containing the packaged treadmill data. [Encoder, Torque, TorqueLoadCurrent].
+        /// Creates a timestamped message that brake step trace [samples, index of the first sample after the step, sample period in ns]. All 0 if there is no trace.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SensorData register.</returns>
+        /// <returns>A new timestamped message for the BrakeStepTraceInfo register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.SensorData.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.BrakeStepTraceInfo.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+    /// that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.
     /// </summary>
-    [DisplayName("SensorDataDispatchRatePayload")]
-    [Description("Creates a message payload that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).")]
-    public partial class CreateSensorDataDispatchRatePayload
+    [DisplayName("AuxAnalogDispatchRatePayload")]
+    [Description("Creates a message payload that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.")]
+    public partial class CreateAuxAnalogDispatchRatePayload
     {
         /// <summary>
-        /// Gets or sets the value that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+        /// Gets or sets the value that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.
         /// </summary>
         [Range(min: 0, max: 1000)]
         [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).")]
-        public ushort SensorDataDispatchRate { get; set; } = 0;
+        [Description("The value that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.")]
+        public ushort AuxAnalogDispatchRate { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the SensorDataDispatchRate register.
+        /// Creates a message payload for the AuxAnalogDispatchRate register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return SensorDataDispatchRate;
+            return AuxAnalogDispatchRate;
         }
 
         /// <summary>
-        /// Creates a message that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+        /// Creates a message that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SensorDataDispatchRate register.</returns>
+        /// <returns>A new message for the AuxAnalogDispatchRate register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.SensorDataDispatchRate.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.AuxAnalogDispatchRate.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+    /// that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.
     /// </summary>
-    [DisplayName("TimestampedSensorDataDispatchRatePayload")]
-    [Description("Creates a timestamped message payload that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).")]
-    public partial class CreateTimestampedSensorDataDispatchRatePayload : CreateSensorDataDispatchRatePayload
+    [DisplayName("TimestampedAuxAnalogDispatchRatePayload")]
+    [Description("Creates a timestamped message payload that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.")]
+    public partial class CreateTimestampedAuxAnalogDispatchRatePayload : CreateAuxAnalogDispatchRatePayload
     {
         /// <summary>
-        /// Creates a timestamped message that value greater than 0 will enable the periodic dispatch of treadmill data events at the specified rate (sp/s).
+        /// Creates a timestamped message that value greater than 0 will run the on-chip ADC over the auxiliary analog inputs (selected at build time) and emit AuxAnalog events at the specified rate (sp/s). 0 stops the ADC.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SensorDataDispatchRate register.</returns>
+        /// <returns>A new timestamped message for the AuxAnalogDispatchRate register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.SensorDataDispatchRate.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.AuxAnalogDispatchRate.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+    /// that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).
     /// </summary>
-    [DisplayName("BrakeCurrentSetPointPayload")]
-    [Description("Creates a message payload that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.")]
-    public partial class CreateBrakeCurrentSetPointPayload
+    [DisplayName("AuxAnalogPayload")]
+    [Description("Creates a message payload that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).")]
+    public partial class CreateAuxAnalogPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+        /// Gets or sets the value that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).
         /// </summary>
-        [Range(min: 0, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.")]
-        public ushort BrakeCurrentSetPoint { get; set; } = 0;
+        [Description("The value that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).")]
+        public ushort AuxAnalog { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the BrakeCurrentSetPoint register.
+        /// Creates a message payload for the AuxAnalog register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return BrakeCurrentSetPoint;
+            return AuxAnalog;
         }
 
         /// <summary>
-        /// Creates a message that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+        /// Creates a message that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the BrakeCurrentSetPoint register.</returns>
+        /// <returns>A new message for the AuxAnalog register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.BrakeCurrentSetPoint.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.AuxAnalog.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+    /// that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).
     /// </summary>
-    [DisplayName("TimestampedBrakeCurrentSetPointPayload")]
-    [Description("Creates a timestamped message payload that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.")]
-    public partial class CreateTimestampedBrakeCurrentSetPointPayload : CreateBrakeCurrentSetPointPayload
+    [DisplayName("TimestampedAuxAnalogPayload")]
+    [Description("Creates a timestamped message payload that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).")]
+    public partial class CreateTimestampedAuxAnalogPayload : CreateAuxAnalogPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the raw value of the torque set-point to be applied to the treadmill. This value is cleared to 0 if torque_limiting is enabled and triggered. Further writes in this condition return a WRITE_ERROR.
+        /// Creates a timestamped message that auxiliary analog inputs in 12-bit ADC counts, in ADC input order, each the mean of AuxAnalogSampling[0] conversions. The length is the number of inputs selected at build time (the on-chip temperature sensor by default).
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the BrakeCurrentSetPoint register.</returns>
+        /// <returns>A new timestamped message for the AuxAnalog register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.BrakeCurrentSetPoint.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.AuxAnalog.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that tares the specified sensors.
+    /// that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.
     /// </summary>
-    [DisplayName("TareSensorsPayload")]
-    [Description("Creates a message payload that tares the specified sensors.")]
-    public partial class CreateTareSensorsPayload
+    [DisplayName("AuxAnalogSamplingPayload")]
+    [Description("Creates a message payload that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.")]
+    public partial class CreateAuxAnalogSamplingPayload
     {
         /// <summary>
-        /// Gets or sets the value that tares the specified sensors.
+        /// Gets or sets the value that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.
         /// </summary>
-        [Description("The value that tares the specified sensors.")]
-        public Sensors TareSensors { get; set; }
+        [Description("The value that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.")]
+        public uint[] AuxAnalogSampling { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the TareSensors register.
+        /// Creates a message payload for the AuxAnalogSampling register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Sensors GetPayload()
+        public uint[] GetPayload()
         {
-            return TareSensors;
+            return AuxAnalogSampling;
         }
 
         /// <summary>
-        /// Creates a message that tares the specified sensors.
+        /// Creates a message that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TareSensors register.</returns>
+        /// <returns>A new message for the AuxAnalogSampling register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.TareSensors.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.AuxAnalogSampling.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that tares the specified sensors.
+    /// that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.
     /// </summary>
-    [DisplayName("TimestampedTareSensorsPayload")]
-    [Description("Creates a timestamped message payload that tares the specified sensors.")]
-    public partial class CreateTimestampedTareSensorsPayload : CreateTareSensorsPayload
+    [DisplayName("TimestampedAuxAnalogSamplingPayload")]
+    [Description("Creates a timestamped message payload that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.")]
+    public partial class CreateTimestampedAuxAnalogSamplingPayload : CreateAuxAnalogSamplingPayload
     {
         /// <summary>
-        /// Creates a timestamped message that tares the specified sensors.
+        /// Creates a timestamped message that auxiliary analog sampling [conversions averaged per value, conversions per second per input]. All 0 while stopped.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TareSensors register.</returns>
+        /// <returns>A new timestamped message for the AuxAnalogSampling register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.TareSensors.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.AuxAnalogSampling.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that removes the tare from the specified sensors.
+    /// that filter applied to every conversion of [Torque, TorqueLoadCurrent]. While a filter is on, SensorData and every other report of that sensor carry the filter's latest output instead of the latest conversion, and tares use it too. Every filter first averages 16 conversions, and the Butterworth lowpasses (4th order) then run at that decimated rate, with cutoffs given as a fraction of it. Filters add delay, so SensorSkew no longer bounds a filtered sensor's age. The torque limit always checks raw conversions. Defaults to Off.
     /// </summary>
-    [DisplayName("ResetTareSensorsPayload")]
-    [Description("Creates a message payload that removes the tare from the specified sensors.")]
-    public partial class CreateResetTareSensorsPayload
+    [DisplayName("SensorFiltersPayload")]
+    [Description("Creates a message payload that filter applied to every conversion of [Torque, TorqueLoadCurrent]. While a filter is on, SensorData and every other report of that sensor carry the filter's latest output instead of the latest conversion, and tares use it too. Every filter first averages 16 conversions, and the Butterworth lowpasses (4th order) then run at that decimated rate, with cutoffs given as a fraction of it. Filters add delay, so SensorSkew no longer bounds a filtered sensor's age. The torque limit always checks raw conversions. Defaults to Off.")]
+    public partial class CreateSensorFiltersPayload
     {
         /// <summary>
-        /// Gets or sets the value that removes the tare from the specified sensors.
+        /// Gets or sets a value to write on payload member Torque.
         /// </summary>
-        [Description("The value that removes the tare from the specified sensors.")]
-        public Sensors ResetTareSensors { get; set; }
+        [Description("")]
+        public SensorFilterPreset Torque { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ResetTareSensors register.
+        /// Gets or sets a value to write on payload member TorqueLoadCurrent.
+        /// </summary>
+        [Description("")]
+        public SensorFilterPreset TorqueLoadCurrent { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SensorFilters register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Sensors GetPayload()
+        public SensorFiltersPayload GetPayload()
         {
-            return ResetTareSensors;
+            SensorFiltersPayload value;
+            value.Torque = Torque;
+            value.TorqueLoadCurrent = TorqueLoadCurrent;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that removes the tare from the specified sensors.
+        /// Creates a message that filter applied to every conversion of [Torque, TorqueLoadCurrent]. While a filter is on, SensorData and every other report of that sensor carry the filter's latest output instead of the latest conversion, and tares use it too. Every filter first averages 16 conversions, and the Butterworth lowpasses (4th order) then run at that decimated rate, with cutoffs given as a fraction of it. Filters add delay, so SensorSkew no longer bounds a filtered sensor's age. The torque limit always checks raw conversions. Defaults to Off.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ResetTareSensors register.</returns>
+        /// <returns>A new message for the SensorFilters register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.ResetTareSensors.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.SensorFilters.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that removes the tare from the specified sensors.
+    /// that filter applied to every conversion of [Torque, TorqueLoadCurrent]. While a filter is on, SensorData and every other report of that sensor carry the filter's latest output instead of the latest conversion, and tares use it too. Every filter first averages 16 conversions, and the Butterworth lowpasses (4th order) then run at that decimated rate, with cutoffs given as a fraction of it. Filters add delay, so SensorSkew no longer bounds a filtered sensor's age. The torque limit always checks raw conversions. Defaults to Off.
     /// </summary>
-    [DisplayName("TimestampedResetTareSensorsPayload")]
-    [Description("Creates a timestamped message payload that removes the tare from the specified sensors.")]
-    public partial class CreateTimestampedResetTareSensorsPayload : CreateResetTareSensorsPayload
+    [DisplayName("TimestampedSensorFiltersPayload")]
+    [Description("Creates a timestamped message payload that filter applied to every conversion of [Torque, TorqueLoadCurrent]. While a filter is on, SensorData and every other report of that sensor carry the filter's latest output instead of the latest conversion, and tares use it too. Every filter first averages 16 conversions, and the Butterworth lowpasses (4th order) then run at that decimated rate, with cutoffs given as a fraction of it. Filters add delay, so SensorSkew no longer bounds a filtered sensor's age. The torque limit always checks raw conversions. Defaults to Off.")]
+    public partial class CreateTimestampedSensorFiltersPayload : CreateSensorFiltersPayload
     {
         /// <summary>
-        /// Creates a timestamped message that removes the tare from the specified sensors.
+        /// Creates a timestamped message that filter applied to every conversion of [Torque, TorqueLoadCurrent]. While a filter is on, SensorData and every other report of that sensor carry the filter's latest output instead of the latest conversion, and tares use it too. Every filter first averages 16 conversions, and the Butterworth lowpasses (4th order) then run at that decimated rate, with cutoffs given as a fraction of it. Filters add delay, so SensorSkew no longer bounds a filtered sensor's age. The torque limit always checks raw conversions. Defaults to Off.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ResetTareSensors register.</returns>
+        /// <returns>A new timestamped message for the SensorFilters register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.ResetTareSensors.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.SensorFilters.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+    /// that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.
     /// </summary>
-    [DisplayName("EnableTorqueLimitPayload")]
-    [Description("Creates a message payload that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.")]
-    public partial class CreateEnableTorqueLimitPayload
+    [DisplayName("SensorFilterCutoffPayload")]
+    [Description("Creates a message payload that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.")]
+    public partial class CreateSensorFilterCutoffPayload
     {
         /// <summary>
-        /// Gets or sets the value that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+        /// Gets or sets the value that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.
         /// </summary>
-        [Description("The value that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.")]
-        public EnableFlag EnableTorqueLimit { get; set; }
+        [Description("The value that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.")]
+        public uint[] SensorFilterCutoff { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableTorqueLimit register.
+        /// Creates a message payload for the SensorFilterCutoff register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
+        public uint[] GetPayload()
         {
-            return EnableTorqueLimit;
+            return SensorFilterCutoff;
         }
 
         /// <summary>
-        /// Creates a message that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+        /// Creates a message that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableTorqueLimit register.</returns>
+        /// <returns>A new message for the SensorFilterCutoff register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.EnableTorqueLimit.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.SensorFilterCutoff.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+    /// that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.
     /// </summary>
-    [DisplayName("TimestampedEnableTorqueLimitPayload")]
-    [Description("Creates a timestamped message payload that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.")]
-    public partial class CreateTimestampedEnableTorqueLimitPayload : CreateEnableTorqueLimitPayload
+    [DisplayName("TimestampedSensorFilterCutoffPayload")]
+    [Description("Creates a timestamped message payload that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.")]
+    public partial class CreateTimestampedSensorFilterCutoffPayload : CreateSensorFilterCutoffPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enables(1)/Disables(0) the brake if the maximum torque sensor value is detected. This register will be enabled by default.
+        /// Creates a timestamped message that -3 dB frequency (Hz) of each sensor filter [Torque, TorqueLoadCurrent], from the measured conversion rate. 0 if the filter is off.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableTorqueLimit register.</returns>
+        /// <returns>A new timestamped message for the SensorFilterCutoff register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.EnableTorqueLimit.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.SensorFilterCutoff.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.
+    /// that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
     /// </summary>
-    [DisplayName("TorqueLimitStatePayload")]
-    [Description("Creates a message payload that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.")]
-    public partial class CreateTorqueLimitStatePayload
+    [DisplayName("SensorFilterCyclesPayload")]
+    [Description("Creates a message payload that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class CreateSensorFilterCyclesPayload
     {
         /// <summary>
-        /// Gets or sets the value that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.
+        /// Gets or sets the value that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
         /// </summary>
-        [Description("The value that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.")]
-        public byte TorqueLimitState { get; set; }
+        [Description("The value that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+        public ushort[] SensorFilterCycles { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the TorqueLimitState register.
+        /// Creates a message payload for the SensorFilterCycles register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public ushort[] GetPayload()
         {
-            return TorqueLimitState;
+            return SensorFilterCycles;
         }
 
         /// <summary>
-        /// Creates a message that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.
+        /// Creates a message that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TorqueLimitState register.</returns>
+        /// <returns>A new message for the SensorFilterCycles register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.TorqueLimitState.FromPayload(messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.SensorFilterCycles.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.
+    /// that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
     /// </summary>
-    [DisplayName("TimestampedTorqueLimitStatePayload")]
-    [Description("Creates a timestamped message payload that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.")]
-    public partial class CreateTimestampedTorqueLimitStatePayload : CreateTorqueLimitStatePayload
+    [DisplayName("TimestampedSensorFilterCyclesPayload")]
+    [Description("Creates a timestamped message payload that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.")]
+    public partial class CreateTimestampedSensorFilterCyclesPayload : CreateSensorFilterCyclesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that a value greater than 1 indicates that the torque limit has been triggered and the brake setpoint will be cleared. Writing a value of 0 will clear the torque limit state and re-enable the brake.
+        /// Creates a timestamped message that cPU cycles that a sensor filter takes [per conversion on average, per biquad cascade output]. A micro-benchmark run once at boot on an idle core0, before the sample alarms, core1 and the ADC streams start, so it leaves out interrupt load and bus contention of the running device.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TorqueLimitState register.</returns>
+        /// <returns>A new timestamped message for the SensorFilterCycles register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return AllenNeuralDynamics.Treadmill.TorqueLimitState.FromPayload(timestamp, messageType, GetPayload());
+            return AllenNeuralDynamics.Treadmill.SensorFilterCycles.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
@@ -1878,6 +12533,249 @@ namespace AllenNeuralDynamics.Treadmill
         }
     }
 
+    /// <summary>
+    /// Represents the payload of the BrakeCurrentControlGains register.
+    /// </summary>
+    public struct BrakeCurrentControlGainsPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="BrakeCurrentControlGainsPayload"/> structure.
+        /// </summary>
+        /// <param name="kp"></param>
+        /// <param name="ki"></param>
+        public BrakeCurrentControlGainsPayload(
+            ushort kp,
+            ushort ki)
+        {
+            Kp = kp;
+            Ki = ki;
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public ushort Kp;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public ushort Ki;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the BrakeCurrentControlGains register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// BrakeCurrentControlGains register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "BrakeCurrentControlGainsPayload { " +
+                "Kp = " + Kp + ", " +
+                "Ki = " + Ki + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the BrakeCurrentControlState register.
+    /// </summary>
+    public struct BrakeCurrentControlStatePayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="BrakeCurrentControlStatePayload"/> structure.
+        /// </summary>
+        /// <param name="error"></param>
+        /// <param name="integrator"></param>
+        /// <param name="output"></param>
+        public BrakeCurrentControlStatePayload(
+            int error,
+            int integrator,
+            int output)
+        {
+            Error = error;
+            Integrator = integrator;
+            Output = output;
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int Error;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int Integrator;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int Output;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the BrakeCurrentControlState register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// BrakeCurrentControlState register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "BrakeCurrentControlStatePayload { " +
+                "Error = " + Error + ", " +
+                "Integrator = " + Integrator + ", " +
+                "Output = " + Output + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the SensorDataStats register.
+    /// </summary>
+    public struct SensorDataStatsPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="SensorDataStatsPayload"/> structure.
+        /// </summary>
+        /// <param name="encoder"></param>
+        /// <param name="sampleCount"></param>
+        /// <param name="torqueMin"></param>
+        /// <param name="torqueMax"></param>
+        /// <param name="torqueMean"></param>
+        /// <param name="torqueLoadCurrentMin"></param>
+        /// <param name="torqueLoadCurrentMax"></param>
+        /// <param name="torqueLoadCurrentMean"></param>
+        public SensorDataStatsPayload(
+            int encoder,
+            int sampleCount,
+            int torqueMin,
+            int torqueMax,
+            int torqueMean,
+            int torqueLoadCurrentMin,
+            int torqueLoadCurrentMax,
+            int torqueLoadCurrentMean)
+        {
+            Encoder = encoder;
+            SampleCount = sampleCount;
+            TorqueMin = torqueMin;
+            TorqueMax = torqueMax;
+            TorqueMean = torqueMean;
+            TorqueLoadCurrentMin = torqueLoadCurrentMin;
+            TorqueLoadCurrentMax = torqueLoadCurrentMax;
+            TorqueLoadCurrentMean = torqueLoadCurrentMean;
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int Encoder;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int SampleCount;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int TorqueMin;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int TorqueMax;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int TorqueMean;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int TorqueLoadCurrentMin;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int TorqueLoadCurrentMax;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int TorqueLoadCurrentMean;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the SensorDataStats register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// SensorDataStats register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "SensorDataStatsPayload { " +
+                "Encoder = " + Encoder + ", " +
+                "SampleCount = " + SampleCount + ", " +
+                "TorqueMin = " + TorqueMin + ", " +
+                "TorqueMax = " + TorqueMax + ", " +
+                "TorqueMean = " + TorqueMean + ", " +
+                "TorqueLoadCurrentMin = " + TorqueLoadCurrentMin + ", " +
+                "TorqueLoadCurrentMax = " + TorqueLoadCurrentMax + ", " +
+                "TorqueLoadCurrentMean = " + TorqueLoadCurrentMean + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the SensorFilters register.
+    /// </summary>
+    public struct SensorFiltersPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="SensorFiltersPayload"/> structure.
+        /// </summary>
+        /// <param name="torque"></param>
+        /// <param name="torqueLoadCurrent"></param>
+        public SensorFiltersPayload(
+            SensorFilterPreset torque,
+            SensorFilterPreset torqueLoadCurrent)
+        {
+            Torque = torque;
+            TorqueLoadCurrent = torqueLoadCurrent;
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public SensorFilterPreset Torque;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public SensorFilterPreset TorqueLoadCurrent;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the SensorFilters register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// SensorFilters register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "SensorFiltersPayload { " +
+                "Torque = " + Torque + ", " +
+                "TorqueLoadCurrent = " + TorqueLoadCurrent + " " +
+            "}";
+        }
+    }
+
     /// <summary>
     /// Available sensors.
     /// </summary>
@@ -1889,4 +12787,103 @@ namespace AllenNeuralDynamics.Treadmill
         Torque = 0x2,
         BrakeCurrent = 0x4
     }
+
+    /// <summary>
+    /// Optional SensorData fields.
+    /// </summary>
+    [Flags]
+    public enum SensorDataFields : byte
+    {
+        None = 0x0,
+        EncoderVelocity = 0x1,
+        EncoderAcceleration = 0x2
+    }
+
+    /// <summary>
+    /// Trajectory playback mode.
+    /// </summary>
+    public enum TrajectoryPlayback : byte
+    {
+        Stop = 0,
+        Once = 1,
+        Loop = 2
+    }
+
+    /// <summary>
+    /// Periodic sensor data event format.
+    /// </summary>
+    public enum SensorDataFormat : byte
+    {
+        Legacy = 0,
+        Packed = 1,
+        PackedDelta = 2,
+        Stats = 3
+    }
+
+    /// <summary>
+    /// Persistent configuration action.
+    /// </summary>
+    public enum PersistentConfigAction : byte
+    {
+        Save = 1,
+        Restore = 2,
+        Forget = 3,
+        Erase = 4
+    }
+
+    /// <summary>
+    /// Flight recorder action.
+    /// </summary>
+    public enum FlightRecorderAction : byte
+    {
+        Disarm = 0,
+        Arm = 1,
+        Trigger = 2
+    }
+
+    /// <summary>
+    /// Flight recorder state.
+    /// </summary>
+    public enum FlightRecorderState : byte
+    {
+        Idle = 0,
+        Armed = 1,
+        Triggered = 2,
+        Frozen = 3
+    }
+
+    /// <summary>
+    /// Brake step test action.
+    /// </summary>
+    public enum BrakeStepTestAction : byte
+    {
+        Stop = 0,
+        Start = 1
+    }
+
+    /// <summary>
+    /// Brake step test state.
+    /// </summary>
+    public enum BrakeStepTestState : byte
+    {
+        Idle = 0,
+        Running = 1,
+        Done = 2,
+        Aborted = 3
+    }
+
+    /// <summary>
+    /// Sensor filter preset. Cutoffs are fractions of the decimated rate.
+    /// </summary>
+    public enum SensorFilterPreset : byte
+    {
+        Off = 0,
+        MovingAverage = 1,
+        Lowpass20Percent = 2,
+        Lowpass10Percent = 3,
+        Lowpass5Percent = 4,
+        Lowpass2Percent = 5,
+        Lowpass1Percent = 6,
+        LowpassHalfPercent = 7
+    }
 }
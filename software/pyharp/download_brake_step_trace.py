@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+from pyharp.device import Device, DeviceMode
+from pyharp.messages import HarpMessage
+from struct import unpack_from
+import os
+
+# Open serial connection and save communication to a file
+if os.name == 'posix': # check for Linux.
+    device = Device("/dev/ttyACM0", "ibl.bin")
+else: # assume Windows.
+    device = Device("COM95", "ibl.bin")
+
+BRAKE_STEP_TEST = 94
+BRAKE_STEP_TEST_CONFIG = 95
+BRAKE_STEP_TEST_RESULTS = 96
+BRAKE_STEP_TRACE_READ_INDEX = 98
+BRAKE_STEP_TRACE = 99
+BRAKE_STEP_TRACE_INFO = 100
+RUNNING = 1
+DONE = 2
+
+# [low, high] raw DAC setpoints, hold time per step (ms), steps.
+CONFIG = [0, 2048, 20, 10]
+
+try:
+    device.send(HarpMessage.WriteU16(BRAKE_STEP_TEST_CONFIG, CONFIG).frame)
+    reply = device.send(HarpMessage.WriteU8(BRAKE_STEP_TEST, 1).frame)
+    if reply.message_type.name != "WRITE":
+        raise RuntimeError("Could not start the test. Is the brake idle?")
+    print(f"Stepping the brake {CONFIG[3]} times. Waiting for the test to end.")
+    state = RUNNING
+    while state == RUNNING:
+        event_response = device._read()
+        if event_response is not None \
+                and event_response.address == BRAKE_STEP_TEST:
+            state = event_response.payload[0]
+    if state != DONE:
+        raise RuntimeError(f"Test aborted (state: {state}).")
+    results = device.send(
+        HarpMessage.ReadU32(BRAKE_STEP_TEST_RESULTS).frame).payload
+    print(f"Steps analyzed: {results[0]}. Worst of each: "
+          f"command-to-DAC latency: {results[1]}[us], "
+          f"rise time: {results[2] / 1000}[us], "
+          f"settling time: {results[3] / 1000}[us], "
+          f"overshoot: {results[4] / 10}[%].")
+    info = device.send(HarpMessage.ReadU32(BRAKE_STEP_TRACE_INFO).frame)
+    num_samples, step_index, sample_period_ns = \
+        unpack_from("<LLL", info._raw_payload)
+    print(f"Downloading the last step's {num_samples} samples.")
+    device.send(HarpMessage.WriteU16(BRAKE_STEP_TRACE_READ_INDEX, 0).frame)
+    samples = []
+    while len(samples) < num_samples:
+        reply = device.send(HarpMessage.ReadU16(BRAKE_STEP_TRACE).frame)
+        if not reply._raw_payload:
+            break
+        samples.extend(reply.payload)
+    # Read by software/treadmill_stream's step_response_analyze.
+    with open("brake_step_trace.csv", "w") as f:
+        f.write(f"# sample_period_ns={sample_period_ns}, "
+                f"step_index={step_index}\n")
+        f.write("brake_current\n")
+        f.writelines(f"{sample}\n" for sample in samples)
+    print("Saved to brake_step_trace.csv.")
+except KeyboardInterrupt:
+    device.send(HarpMessage.WriteU8(BRAKE_STEP_TEST, 0).frame)
+finally:
+    # Close connection
+    device.disconnect()
@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+from pyharp.device import Device, DeviceMode
+from pyharp.messages import HarpMessage
+from struct import iter_unpack, unpack_from
+import os
+import csv
+
+# Open serial connection and save communication to a file
+if os.name == 'posix': # check for Linux.
+    device = Device("/dev/ttyACM0", "ibl.bin")
+else: # assume Windows.
+    device = Device("COM95", "ibl.bin")
+
+FLIGHT_RECORDER = 87
+FLIGHT_RECORDER_READ_INDEX = 89
+FLIGHT_RECORDER_DATA = 90
+FLIGHT_RECORDER_CAPTURE = 91
+FROZEN = 3
+
+# [time offset (us), encoder, torque, brake current, brake setpoint, flags]
+RECORD_FORMAT = "<llhhHH"
+
+state = device.send(HarpMessage.ReadU8(FLIGHT_RECORDER).frame).payload[0]
+if state != FROZEN:
+    print(f"No frozen capture (state: {state}). Waiting for a trip.")
+try:
+    while state != FROZEN:
+        event_response = device._read()
+        if event_response is not None \
+                and event_response.address == FLIGHT_RECORDER:
+            state = event_response.payload[0]
+    capture = device.send(HarpMessage.ReadU16(FLIGHT_RECORDER_CAPTURE).frame)
+    num_records, trigger_index = unpack_from("<HH", capture._raw_payload)
+    print(f"Downloading {num_records} records. "
+          f"Trigger at record {trigger_index}.")
+    device.send(HarpMessage.WriteU16(FLIGHT_RECORDER_READ_INDEX, 0).frame)
+    records = []
+    while len(records) < num_records:
+        reply = device.send(HarpMessage.ReadU8(FLIGHT_RECORDER_DATA).frame)
+        if not reply._raw_payload:
+            break
+        records.extend(iter_unpack(RECORD_FORMAT, reply._raw_payload))
+    with open("flight_recorder.csv", "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(["time_us", "encoder", "torque", "brake_current",
+                         "brake_setpoint", "flags"])
+        writer.writerows(records)
+    print("Saved to flight_recorder.csv. Rearming.")
+    device.send(HarpMessage.WriteU8(FLIGHT_RECORDER, 1).frame)
+except KeyboardInterrupt:
+    pass
+finally:
+    # Close connection
+    device.disconnect()
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+from pyharp.device import Device, DeviceMode
+from pyharp.messages import HarpMessage
+from struct import unpack_from
+import os
+
+# Open serial connection and save communication to a file
+if os.name == 'posix': # check for Linux.
+    device = Device("/dev/ttyACM0", "ibl.bin")
+else: # assume Windows.
+    device = Device("COM95", "ibl.bin")
+
+DISPATCH_RATE_HZ = 1000
+PACKED_DELTA_FORMAT = 2
+
+VERSION_MASK = 0x0F
+ENCODER_DELTA_FLAG = 1 << 4
+TORQUE_SIGNED_FLAG = 1 << 5
+BRAKE_CURRENT_SIGNED_FLAG = 1 << 6
+
+
+def to_s12(value):
+    return value - (1 << 12) if value & (1 << 11) else value
+
+
+def unpack_record(payload, encoder):
+    """Decode one packed record. Returns (encoder, torque, current)."""
+    header = payload[0]
+    assert header & VERSION_MASK == 1, "Unsupported packed format version."
+    if header & ENCODER_DELTA_FLAG:
+        encoder += unpack_from("<h", payload, 1)[0]
+        offset = 3
+    else:
+        encoder = unpack_from("<l", payload, 1)[0]
+        offset = 5
+    analog = int.from_bytes(payload[offset:offset + 3], "little")
+    torque = analog & 0xFFF
+    current = analog >> 12
+    if header & TORQUE_SIGNED_FLAG:
+        torque = to_s12(torque)
+    if header & BRAKE_CURRENT_SIGNED_FLAG:
+        current = to_s12(current)
+    return encoder, torque, current
+
+
+device.send(HarpMessage.WriteU8(74, PACKED_DELTA_FORMAT).frame)
+device.send(HarpMessage.WriteU16(36, DISPATCH_RATE_HZ).frame) # >0 = enable.
+encoder = 0
+try:
+    while True:
+        event_response = device._read()
+        if event_response is None or event_response.address != 73:
+            continue
+        encoder, torque, current = \
+            unpack_record(event_response._raw_payload, encoder)
+        print(f"{(encoder, torque, current)}")
+except KeyboardInterrupt:
+    print("Disabling sensor data events")
+    device.send(HarpMessage.WriteU16(36, 0).frame)
+    device.send(HarpMessage.WriteU8(74, 0).frame)
+finally:
+    # Close connection
+    device.disconnect()
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+from pyharp.device import Device, DeviceMode
+from pyharp.messages import HarpMessage
+from struct import iter_unpack
+import os
+
+# Open serial connection and save communication to a file
+if os.name == 'posix': # check for Linux.
+    device = Device("/dev/ttyACM0", "ibl.bin")
+else: # assume Windows.
+    device = Device("COM95", "ibl.bin")
+
+SAMPLE_RATE_HZ = 5000
+SAMPLES_PER_BATCH = 20
+
+# Each batched sample: [time_offset_us (U16), encoder (S32), torque (S16),
+#                       brake_current (S16)].
+SAMPLE_FORMAT = "<Hlhh"
+
+device.send(HarpMessage.WriteU8(44, SAMPLES_PER_BATCH).frame)
+device.send(HarpMessage.WriteU16(43, SAMPLE_RATE_HZ).frame) # >0 = enable.
+try:
+    while True:
+        event_response = device._read()
+        if event_response is None or event_response.address != 42:
+            continue
+        for offset_us, encoder, torque, current in \
+                iter_unpack(SAMPLE_FORMAT, event_response._raw_payload):
+            print(f"t+{offset_us:>5}[us]: {(encoder, torque, current)}")
+except KeyboardInterrupt:
+    print("Disabling batched events")
+    device.send(HarpMessage.WriteU16(43, 0).frame)
+finally:
+    # Close connection
+    device.disconnect()
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Upload a fitted torque-to-brake-setpoint curve to the treadmill."""
+# The curve is the power law fit from calibration_fit.ipynb, sampled on a
+# uniform torque grid that the firmware linearly interpolates.
+
+from struct import pack, unpack
+from argparse import ArgumentParser, ArgumentDefaultsHelpFormatter
+import os
+import sys
+import zlib
+
+BRAKE_CALIBRATION_WRITE_INDEX_REG = 78
+BRAKE_CALIBRATION_DATA_REG = 79
+BRAKE_CALIBRATION_CONFIG_REG = 80
+BRAKE_CALIBRATION_STORE_REG = 81
+BRAKE_CALIBRATION_CHECKSUM_REG = 82
+
+MAX_POINTS = 256
+MAX_POINTS_PER_WRITE = 120
+NM_PER_OZ_IN = 0.00706155183333
+
+
+def power_law_curve(x, a, k, b, c):
+    return a * pow((x - c), k) + b
+
+
+def make_table(popt, full_scale_oz_in: float, num_points: int):
+    """Sample the fit on the firmware's uniform torque grid.
+
+    Returns the points and the full-scale torque in Q16.16 N*m.
+    """
+    full_scale_q16 = round(full_scale_oz_in * NM_PER_OZ_IN * (1 << 16))
+    # Sample at the torques that the firmware will actually interpolate
+    # between, i.e: after the full-scale torque has been quantized.
+    full_scale_oz_in = full_scale_q16 / (1 << 16) / NM_PER_OZ_IN
+    points = []
+    for i in range(num_points):
+        torque_oz_in = full_scale_oz_in * i / (num_points - 1)
+        setpoint = round(power_law_curve(torque_oz_in, *popt))
+        points.append(min(max(setpoint, 0), 0xFFFF))
+    return points, full_scale_q16
+
+
+def table_checksum(points, full_scale_q16: int):
+    """CRC-32 of the table as computed by the firmware."""
+    return zlib.crc32(pack("<HHI", len(points), 0, full_scale_q16)
+                      + pack(f"<{len(points)}H", *points))
+
+
+def interpolate(points, full_scale_q16: int, torque_q16: int):
+    """Setpoint of the table at a Q16.16 N*m torque, exactly."""
+    if torque_q16 >= full_scale_q16:
+        return float(points[-1])
+    position = torque_q16 * (len(points) - 1) / full_scale_q16
+    index = int(position)
+    fraction = position - index
+    return points[index] + (points[index + 1] - points[index]) * fraction
+
+
+def export_table(path: str, popt, points, full_scale_q16: int):
+    """Write the table, its checksum and its setpoints at every Q16.16 torque
+    step up to a little past full scale, next to the fit's, as CSV.
+
+    brake_calibration_test loads the same table into the firmware's
+    BrakeCalibration and checks it against these.
+    """
+    with open(path, "w") as file:
+        file.write(f"{len(points)},{full_scale_q16},"
+                   f"{table_checksum(points, full_scale_q16)}\n")
+        file.write(",".join(str(point) for point in points) + "\n")
+        for torque_q16 in range(full_scale_q16 + 16):
+            torque_oz_in = (min(torque_q16, full_scale_q16) / (1 << 16)
+                            / NM_PER_OZ_IN)
+            fit = min(max(power_law_curve(torque_oz_in, *popt), 0), 0xFFFF)
+            file.write(f"{torque_q16},"
+                       f"{interpolate(points, full_scale_q16, torque_q16):.4f},"
+                       f"{fit:.4f}\n")
+
+
+if __name__ == "__main__":
+    parser = ArgumentParser(formatter_class=ArgumentDefaultsHelpFormatter)
+    parser.add_argument("--port", type=str, default="/dev/ttyACM0",
+                        help="Harp Treadmill Driver com port")
+    parser.add_argument("--fit", type=float, nargs=4,
+                        default=[1.19083818e+04, 4.69245631e-01,
+                                 -3.41036280e+03, -1.56531673e-01],
+                        metavar=("A", "K", "B", "C"),
+                        help="power law fit parameters (popt) from "
+                             "calibration_fit.ipynb.")
+    parser.add_argument("--full_scale_torque", type=float, default=6.0,
+                        help="largest torque in the table [oz.-in.].")
+    parser.add_argument("--num_points", type=int, default=MAX_POINTS,
+                        help=f"table size [2:{MAX_POINTS}].")
+    parser.add_argument("--store", action="store_true",
+                        help="store the table in flash so that it persists "
+                             "across power cycles.")
+    parser.add_argument("--export", type=str, metavar="CSV",
+                        help="write the table and its setpoints to a file "
+                             "instead of uploading it.")
+    args = parser.parse_args()
+
+    points, full_scale_q16 = make_table(args.fit, args.full_scale_torque,
+                                        args.num_points)
+    if args.export:
+        export_table(args.export, args.fit, points, full_scale_q16)
+        sys.exit(0)
+
+    from pyharp.device import Device
+    from pyharp.messages import HarpMessage
+    from serial import SerialException
+    try:
+        null_file = "NUL" if os.name == 'nt' else "/dev/null"
+        device = Device(args.port, null_file)
+    except SerialException:
+        print("Cannot connect to Harp Treadmill device! Is it plugged in and "
+              "powered on? Is the com port correct?")
+        sys.exit(1)
+
+    try:
+        device.send(HarpMessage.WriteU16(BRAKE_CALIBRATION_WRITE_INDEX_REG,
+                                         0).frame)
+        for start in range(0, len(points), MAX_POINTS_PER_WRITE):
+            chunk = points[start:start + MAX_POINTS_PER_WRITE]
+            device.send(HarpMessage.WriteU16(BRAKE_CALIBRATION_DATA_REG,
+                                             chunk).frame)
+        device.send(HarpMessage.WriteU32(BRAKE_CALIBRATION_CONFIG_REG,
+                                         [len(points), full_scale_q16]).frame)
+        reply = device.send(
+            HarpMessage.ReadU32(BRAKE_CALIBRATION_CHECKSUM_REG).frame)
+        device_checksum = unpack("<L", reply._raw_payload)[0]
+        expected_checksum = table_checksum(points, full_scale_q16)
+        if device_checksum != expected_checksum:
+            print(f"Checksum mismatch! Device: 0x{device_checksum:08X}. "
+                  f"Expected: 0x{expected_checksum:08X}.")
+            sys.exit(1)
+        print(f"Applied calibration table. Checksum: 0x{device_checksum:08X}.")
+        if args.store:
+            device.send(HarpMessage.WriteU8(BRAKE_CALIBRATION_STORE_REG,
+                                            1).frame)
+            print("Stored table in flash.")
+    finally:
+        device.disconnect()
@@ -0,0 +1,224 @@
+// Close the firmware's brake current loop around a simulated brake coil and
+// measure what one controller update costs.
+// The coil is a series RL load driven by the brake DAC through a voltage
+// amplifier. Its current is converted by a 12-bit ADC with noise, and the
+// firmware's own BrakeCurrentController runs at the control rate on the
+// mean of the conversions since its last update, as on the device.
+// Usage: brake_current_sim
+#include <brake_current_controller.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+// Same as the firmware.
+constexpr uint32_t CONTROL_FREQUENCY_HZ = 5000;
+constexpr uint16_t KP_Q8 = 16 << 8;
+constexpr uint16_t KI_Q8 = 1 << 8;
+constexpr double ADC_FULL_SCALE_COUNTS = 4096;
+constexpr double ADC_FULL_SCALE_A = 0.20625;
+
+// Brake coil and drive. The time constant is L/R = 5 [ms], and full-scale
+// DAC output drives 200 [mA], just inside the current sensor's range.
+constexpr double SUPPLY_V = 12.0;
+constexpr double COIL_R_OHM = 60.0;
+constexpr double COIL_L_H = 0.3;
+constexpr double ADC_RATE_HZ = 100'000;
+constexpr double ADC_NOISE_COUNTS = 2.0; // rms.
+
+constexpr uint32_t CONVERSIONS_PER_UPDATE = uint32_t(ADC_RATE_HZ)
+                                            / CONTROL_FREQUENCY_HZ;
+
+// Pass criteria for a step. The coil alone takes 4 time constants (20 [ms])
+// to settle to within 2%.
+constexpr double MAX_SETTLING_TIME_MS = 25; // to within 2% of the step.
+constexpr double MAX_OVERSHOOT_PERCENT = 10;
+constexpr double MAX_STEADY_STATE_ERROR_COUNTS = 0.25; // mean.
+
+double read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return double(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+/**
+ * \brief series RL coil behind a DAC and voltage amplifier, sampled by the
+ *  brake current ADC.
+ */
+class BrakeCoil
+{
+public:
+    BrakeCoil(): rng_(1), current_a_{0}, dac_code_{0} {}
+
+    void set_dac(uint16_t code) {dac_code_ = code;}
+
+/**
+ * \brief advance by one ADC conversion period.
+ * \returns the conversion in ADC counts.
+ */
+    int32_t step()
+    {
+        // Exact solution of L di/dt = V - R i over the period.
+        const double dt = 1 / ADC_RATE_HZ;
+        const double target_a = SUPPLY_V * dac_code_ / 65535.0 / COIL_R_OHM;
+        current_a_ = target_a + (current_a_ - target_a)
+                                * exp(-dt * COIL_R_OHM / COIL_L_H);
+        const double counts = current_a_ / ADC_FULL_SCALE_A
+                              * ADC_FULL_SCALE_COUNTS
+                              + ADC_NOISE_COUNTS * noise_(rng_);
+        return int32_t(fmin(fmax(lround(counts), 0), ADC_FULL_SCALE_COUNTS - 1));
+    }
+
+    double current_counts() const
+    {return current_a_ / ADC_FULL_SCALE_A * ADC_FULL_SCALE_COUNTS;}
+
+private:
+    std::mt19937 rng_;
+    std::normal_distribution<double> noise_;
+    double current_a_;
+    uint16_t dac_code_;
+};
+
+struct step_result_t
+{
+    double settling_time_ms;
+    double overshoot_percent;
+    double steady_state_error_counts;
+};
+
+/**
+ * \brief run the loop for duration_s at setpoint_counts.
+ * \param trace coil current (in counts) at every control update.
+ */
+void run(BrakeCurrentController& controller, BrakeCoil& coil,
+         int32_t setpoint_counts, double duration_s, std::vector<double>& trace)
+{
+    controller.set_setpoint(setpoint_counts);
+    const size_t num_updates = size_t(duration_s * CONTROL_FREQUENCY_HZ);
+    for (size_t n = 0; n < num_updates; ++n)
+    {
+        int32_t sum = 0;
+        for (uint32_t i = 0; i < CONVERSIONS_PER_UPDATE; ++i)
+            sum += coil.step();
+        coil.set_dac(controller.update(
+            (sum + int32_t(CONVERSIONS_PER_UPDATE / 2))
+            / int32_t(CONVERSIONS_PER_UPDATE)));
+        trace.push_back(coil.current_counts());
+    }
+}
+
+step_result_t analyze(const std::vector<double>& trace, double initial,
+                      double setpoint)
+{
+    const double step = setpoint - initial;
+    const double band = 0.02 * fabs(step);
+    size_t settled = 0;
+    double peak = 0;
+    for (size_t n = 0; n < trace.size(); ++n)
+    {
+        if (fabs(trace[n] - setpoint) > band)
+            settled = n + 1;
+        peak = fmax(peak, (trace[n] - initial) / step);
+    }
+    // Mean error over the last quarter.
+    double error = 0;
+    const size_t tail = trace.size() / 4;
+    for (size_t n = trace.size() - tail; n < trace.size(); ++n)
+        error += trace[n] - setpoint;
+    return {settled * 1000.0 / CONTROL_FREQUENCY_HZ, (peak - 1) * 100,
+            error / tail};
+}
+
+bool check_steps()
+{
+    bool ok = true;
+    for (const int32_t setpoint: {400, 1000, 2000, 3500})
+    {
+        BrakeCurrentController controller;
+        controller.set_gains(KP_Q8, KI_Q8);
+        BrakeCoil coil;
+        std::vector<double> trace;
+        run(controller, coil, setpoint, 0.1, trace);
+        const step_result_t result = analyze(trace, 0, setpoint);
+        const bool step_ok = result.settling_time_ms <= MAX_SETTLING_TIME_MS
+                             && result.overshoot_percent <= MAX_OVERSHOOT_PERCENT
+                             && fabs(result.steady_state_error_counts)
+                                <= MAX_STEADY_STATE_ERROR_COUNTS;
+        printf("Step to %d [counts]: settling %.2f [ms], overshoot %.1f%%, "
+               "steady-state error %.2f [counts]. %s\n", setpoint,
+               result.settling_time_ms, result.overshoot_percent,
+               result.steady_state_error_counts, step_ok ? "OK" : "FAILED");
+        ok &= step_ok;
+    }
+    return ok;
+}
+
+bool check_windup()
+{
+    // Ask for more current than the coil can carry, so the output saturates
+    // for a while, then step down. With conditional integration, recovery
+    // takes no longer than a step from rest.
+    BrakeCurrentController controller;
+    controller.set_gains(KP_Q8, KI_Q8);
+    BrakeCoil coil;
+    std::vector<double> trace;
+    run(controller, coil, 4095, 0.2, trace);
+    const bool saturated = controller.output() == BrakeCurrentController::OUTPUT_MAX;
+    const double initial = trace.back();
+    trace.clear();
+    run(controller, coil, 2000, 0.1, trace);
+    const step_result_t result = analyze(trace, initial, 2000);
+    const bool ok = saturated
+                    && result.settling_time_ms <= MAX_SETTLING_TIME_MS
+                    && fabs(result.steady_state_error_counts)
+                       <= MAX_STEADY_STATE_ERROR_COUNTS;
+    printf("Recovery from saturation: settling %.2f [ms]. %s\n",
+           result.settling_time_ms, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+void measure_update_cost()
+{
+    BrakeCurrentController controller;
+    controller.set_gains(KP_Q8, KI_Q8);
+    controller.set_setpoint(2000);
+    // Measurements that swing through and around the setpoint, so every
+    // saturation branch is taken.
+    std::vector<int32_t> measurements(1 << 16);
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int32_t> counts(0, 4095);
+    for (int32_t& measurement: measurements)
+        measurement = counts(rng);
+    constexpr size_t REPEATS = 64;
+    volatile uint32_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    const double start_cycles = read_cycles();
+    for (size_t r = 0; r < REPEATS; ++r)
+        for (const int32_t measurement: measurements)
+            sink = sink + controller.update(measurement);
+    const double cycles = read_cycles() - start_cycles;
+    const double ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count();
+    (void)sink;
+    const double num_updates = double(REPEATS * measurements.size());
+    printf("Controller update: %.2f [ns], %.1f [cycles] per update.\n",
+           ns / num_updates, cycles / num_updates);
+}
+}
+
+int main()
+{
+    bool ok = check_steps();
+    ok &= check_windup();
+    measure_update_cost();
+    return ok ? 0 : 1;
+}
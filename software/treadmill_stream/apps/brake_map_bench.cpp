@@ -0,0 +1,196 @@
+// Check the firmware's fixed-point BrakeMap lookup against a double-precision
+// reference, then measure what a lookup costs.
+// Maps are filled with random setpoints over the full 16-bit DAC range, so
+// interpolation sees the largest steps between points. Positions cover both
+// ends of the map and, with a wrap length, many laps in both directions.
+// The cost is measured along a belt moving at a steady speed, one lookup per
+// 5 kHz control update as on the device, and on random positions that defeat
+// the cache.
+// Usage: brake_map_bench
+#include <brake_map.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+// Same as the firmware.
+constexpr uint32_t CONTROL_FREQUENCY_HZ = 5000;
+
+constexpr size_t NUM_CHECKED_POSITIONS = 1'000'000;
+constexpr size_t NUM_TIMED_LOOKUPS = 10'000'000;
+
+double read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return double(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+struct map_config_t
+{
+    const char* name;
+    size_t length;
+    uint32_t spacing_log2;
+    uint32_t wrap_length_ticks;
+    bool interpolate;
+};
+
+const map_config_t CONFIGS[] =
+{
+    {"held", 1024, 6, 0, false},
+    {"interpolated", 1024, 6, 0, true},
+    {"interpolated, wrapped", 1000, 6, 1000 << 6, true},
+    {"interpolated, wrapped mid-span", 300, 10, (300 << 10) - 517, true},
+    {"max spacing, wrapped", 64, BrakeMap::MAX_SPACING_LOG2,
+     64u << BrakeMap::MAX_SPACING_LOG2, true},
+    {"single point", 1, 4, 0, true},
+};
+
+/**
+ * \brief what BrakeMap::evaluate() should return, in double precision.
+ */
+uint16_t reference(const std::vector<uint16_t>& points,
+                   const map_config_t& config, int64_t position)
+{
+    const int64_t wrap = config.wrap_length_ticks;
+    if (wrap > 0)
+        position = ((position % wrap) + wrap) % wrap;
+    else if (position < 0)
+        return points[0];
+    const double spacing = double(int64_t(1) << config.spacing_log2);
+    const int64_t index = position >> config.spacing_log2;
+    if (index >= int64_t(config.length))
+        return points[config.length - 1];
+    size_t next = size_t(index) + 1;
+    if (!config.interpolate || (next >= config.length && wrap == 0))
+        return points[index];
+    if (next >= config.length)
+        next = 0;
+    // Rounds toward -inf like an arithmetic shift.
+    const double fraction = double(position - (index << config.spacing_log2))
+                            / spacing;
+    return uint16_t(points[index]
+                    + floor((double(points[next]) - points[index]) * fraction));
+}
+
+std::vector<uint16_t> fill(BrakeMap& map, const map_config_t& config,
+                           std::mt19937& rng)
+{
+    std::uniform_int_distribution<uint32_t> setpoint(0, UINT16_MAX);
+    std::vector<uint16_t> points(config.length);
+    for (uint16_t& point: points)
+        point = uint16_t(setpoint(rng));
+    // Full-scale steps, the worst case for the fixed-point product.
+    if (config.length >= 2)
+    {
+        points[0] = UINT16_MAX;
+        points[1] = 0;
+    }
+    map.write(0, points.data(), points.size());
+    map.configure(config.length, config.spacing_log2, config.wrap_length_ticks,
+                  config.interpolate);
+    return points;
+}
+
+bool check_against_reference()
+{
+    std::mt19937 rng(12);
+    bool ok = true;
+    for (const map_config_t& config: CONFIGS)
+    {
+        BrakeMap map;
+        const std::vector<uint16_t> points = fill(map, config, rng);
+        const int64_t span = int64_t(config.length) << config.spacing_log2;
+        // Within a few map lengths of position 0, and near the ends of the
+        // position range.
+        std::uniform_int_distribution<int64_t> near(-3 * span, 4 * span);
+        std::uniform_int_distribution<int64_t> any(INT32_MIN, INT32_MAX);
+        size_t mismatches = 0;
+        for (size_t i = 0; i < NUM_CHECKED_POSITIONS; ++i)
+        {
+            const int64_t position = (i % 8 == 0) ? any(rng) : near(rng);
+            mismatches += map.evaluate(int32_t(position))
+                          != reference(points, config, position);
+        }
+        for (int64_t position: {int64_t(INT32_MIN), int64_t(-1), int64_t(0),
+                                span - 1, span, int64_t(INT32_MAX)})
+            mismatches += map.evaluate(int32_t(position))
+                          != reference(points, config, position);
+        printf("  %-32s %zu mismatches in %zu positions.\n", config.name,
+               mismatches, NUM_CHECKED_POSITIONS + 6);
+        ok &= mismatches == 0;
+    }
+    BrakeMap empty;
+    ok &= empty.evaluate(0) == 0 && empty.evaluate(-5) == 0;
+    // Rejected configurations leave the map unchanged.
+    ok &= !empty.configure(BrakeMap::MAX_POINTS + 1, 0, 0, false)
+          && !empty.configure(1, BrakeMap::MAX_SPACING_LOG2 + 1, 0, false)
+          && !empty.configure(1, 0, uint32_t(INT32_MAX) + 1, false)
+          && empty.length() == 0;
+    return check("Fixed-point lookup matches the reference", ok);
+}
+
+/**
+ * \brief time lookups at the given positions.
+ */
+void measure(const char* name, const BrakeMap& map,
+             const std::vector<int32_t>& positions)
+{
+    volatile uint32_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    const double start_cycles = read_cycles();
+    for (size_t i = 0; i < NUM_TIMED_LOOKUPS; ++i)
+        sink = sink + map.evaluate(positions[i % positions.size()]);
+    const double cycles = read_cycles() - start_cycles;
+    const double ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count();
+    (void)sink;
+    printf("  %-48s %.2f [ns], %.1f [cycles] per lookup.\n", name,
+           ns / NUM_TIMED_LOOKUPS, cycles / NUM_TIMED_LOOKUPS);
+}
+
+void measure_lookup_cost()
+{
+    printf("Lookup cost on this machine:\n");
+    std::mt19937 rng(34);
+    // A belt at 20000 [counts/s], sampled at the control rate.
+    std::vector<int32_t> belt(CONTROL_FREQUENCY_HZ);
+    for (size_t i = 0; i < belt.size(); ++i)
+        belt[i] = int32_t(i * 20'000 / CONTROL_FREQUENCY_HZ) - 1000;
+    std::uniform_int_distribution<int32_t> any(-(1 << 20), 1 << 20);
+    std::vector<int32_t> random_positions(1 << 16);
+    for (int32_t& position: random_positions)
+        position = any(rng);
+    for (const map_config_t& config: CONFIGS)
+    {
+        BrakeMap map;
+        fill(map, config, rng);
+        char name[96];
+        snprintf(name, sizeof(name), "%s, moving belt:", config.name);
+        measure(name, map, belt);
+        snprintf(name, sizeof(name), "%s, random:", config.name);
+        measure(name, map, random_positions);
+    }
+}
+}
+
+int main()
+{
+    const bool ok = check_against_reference();
+    measure_lookup_cost();
+    return ok ? 0 : 1;
+}
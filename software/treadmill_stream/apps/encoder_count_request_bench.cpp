@@ -0,0 +1,397 @@
+// Compare the cost of reading the additional encoders' counts with batched
+// requests (PIOEncoder::request_counts() then fetch_counts(), as the sample
+// alarm does) against one get_count() per encoder, and check that batching
+// returns each encoder's own count.
+// The cost cannot be measured on a host, so it is modelled cycle by cycle:
+// each state machine runs pio_encoder.pio instruction for instruction at
+// clk_sys on a quadrature signal of its own, while the CPU writes requests to
+// the TX FIFOs, polls FSTAT and reads the RX FIFOs at the Cortex-M0+ costs
+// below. State machines start at random points of their loop, as they do on
+// the device. The firmware measures the same comparison on the target at
+// startup into aux_encoder_read_cycles (register 93).
+// Then, on the simulated device of firmware_sim, the firmware's PIOEncoder
+// drives three more encoders, whose counts must come back in order from
+// fetch_counts() and match get_count(). Encoders asked for past the last
+// state machine, or on one that does not exist, are left out.
+// Usage: encoder_count_request_bench
+#include <pio_encoder.h>
+#include <firmware_sim.h>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr uint32_t CLK_SYS_HZ = 125'000'000;
+constexpr uint32_t MAX_AUX_ENCODERS = PIOEncoder::MAX_ENCODERS - 1;
+constexpr uint8_t AUX_ENCODER_PINS[MAX_AUX_ENCODERS] = {12, 14, 26};
+
+// Cortex-M0+ cycles, with PIO registers on the AHB-Lite bus.
+constexpr uint64_t REQUEST_CYCLES = 2; // Store to TXF.
+constexpr uint64_t POLL_CYCLES = 5; // Load FSTAT, test, taken branch.
+constexpr uint64_t READ_CYCLES = 4; // Load RXF, store the count.
+
+constexpr size_t NUM_TRIALS = 100'000;
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief a state machine running pio_encoder.pio, one instruction per clock.
+ */
+class EncoderStateMachine
+{
+public:
+    static constexpr size_t FIFO_DEPTH = 4;
+
+/**
+ * \param step_period_cycles clocks between steps of the encoder, which only
+ *  ever moves forward.
+ * \param start_cycle clock at which the state machine is enabled.
+ */
+    EncoderStateMachine(uint64_t step_period_cycles, uint64_t start_cycle)
+    :step_period_{step_period_cycles}, start_{start_cycle}, cycle_{0},
+     pc_{UPDATE}, x_{0}, y_{0}, isr_{0}, osr_{0}
+    {}
+
+/**
+ * \brief run up to, but not including, the specified clock.
+ */
+    void run_to(uint64_t cycle)
+    {
+        for (; cycle_ < cycle; ++cycle_)
+            if (cycle_ >= start_)
+                step();
+    }
+
+    void request() {tx_.push_back(1);}
+    bool rx_empty() const {return rx_.empty();}
+
+    uint32_t pop()
+    {
+        const uint32_t word = rx_.front();
+        rx_.erase(rx_.begin());
+        return word;
+    }
+
+/**
+ * \brief steps the encoder made before the specified clock.
+ */
+    uint32_t position(uint64_t cycle) const
+    {return uint32_t(cycle / step_period_);}
+
+/**
+ * \brief clock at which the last reply was pushed. It is in the RX FIFO
+ *  from the next one.
+ */
+    uint64_t last_push() const {return last_push_;}
+
+private:
+    // Program addresses, as assembled.
+    static constexpr uint32_t DECREMENT = 14;
+    static constexpr uint32_t UPDATE = 15; // .wrap_target
+    static constexpr uint32_t SAMPLE_PINS = 22;
+    static constexpr uint32_t INCREMENT = 26;
+    static constexpr uint32_t WRAP = 28;
+    // Jump table of addresses 0 to 13, indexed by the last and current pins.
+    static constexpr uint32_t TABLE[14] = {
+        UPDATE, DECREMENT, INCREMENT, UPDATE,
+        INCREMENT, UPDATE, UPDATE, DECREMENT,
+        DECREMENT, UPDATE, UPDATE, INCREMENT,
+        UPDATE, INCREMENT};
+
+/**
+ * \brief A and B inputs: 00, 10, 11, 01 counts up.
+ */
+    uint32_t pins() const
+    {
+        static constexpr uint32_t STATES[4] = {0b00, 0b10, 0b11, 0b01};
+        return STATES[position(cycle_) & 3];
+    }
+
+    void step()
+    {
+        uint32_t next = (pc_ == WRAP) ? UPDATE : pc_ + 1;
+        if (pc_ < DECREMENT)
+            next = TABLE[pc_];
+        switch (pc_)
+        {
+        case DECREMENT: // JMP Y--, update
+            --y_;
+            next = UPDATE;
+            break;
+        case UPDATE: // SET X, 0
+            x_ = 0;
+            break;
+        case UPDATE + 1: // PULL noblock
+            if (tx_.empty())
+                osr_ = x_;
+            else
+            {
+                osr_ = tx_.front();
+                tx_.erase(tx_.begin());
+            }
+            break;
+        case UPDATE + 2: // MOV X, OSR
+            x_ = osr_;
+            break;
+        case UPDATE + 3: // MOV OSR, ISR
+            osr_ = isr_;
+            break;
+        case UPDATE + 4: // JMP !X, sample_pins
+            if (x_ == 0)
+                next = SAMPLE_PINS;
+            break;
+        case UPDATE + 5: // MOV ISR, Y
+            isr_ = y_;
+            break;
+        case UPDATE + 6: // PUSH, stalling while the RX FIFO is full.
+            if (rx_.size() >= FIFO_DEPTH)
+                return;
+            rx_.push_back(isr_);
+            isr_ = 0;
+            last_push_ = cycle_;
+            break;
+        case SAMPLE_PINS: // MOV ISR, NULL
+            isr_ = 0;
+            break;
+        case SAMPLE_PINS + 1: // IN OSR, 2
+            isr_ = (isr_ << 2) | (osr_ & 3);
+            break;
+        case SAMPLE_PINS + 2: // IN PINS, 2
+            isr_ = (isr_ << 2) | pins();
+            break;
+        case SAMPLE_PINS + 3: // MOV PC, ISR
+            next = isr_;
+            break;
+        case INCREMENT: // MOV X, !Y
+            x_ = ~y_;
+            break;
+        case INCREMENT + 1: // JMP X--, increment_cont
+            --x_;
+            break;
+        case WRAP: // MOV Y, !X
+            y_ = ~x_;
+            break;
+        }
+        pc_ = next;
+    }
+
+    uint64_t step_period_;
+    uint64_t start_;
+    uint64_t cycle_;
+    uint32_t pc_;
+    uint32_t x_;
+    uint32_t y_;
+    uint32_t isr_;
+    uint32_t osr_;
+    uint64_t last_push_ = 0;
+    std::vector<uint32_t> tx_;
+    std::vector<uint32_t> rx_;
+};
+
+/**
+ * \brief the CPU side of a read, one FIFO access at a time.
+ */
+class Cpu
+{
+public:
+    Cpu(std::vector<EncoderStateMachine>& machines, uint64_t start_cycle)
+    :machines_(machines), cycle_{start_cycle}
+    {}
+
+    void request(size_t index)
+    {
+        machines_[index].run_to(cycle_);
+        machines_[index].request();
+        cycle_ += REQUEST_CYCLES;
+    }
+
+    uint32_t fetch(size_t index)
+    {
+        EncoderStateMachine& machine = machines_[index];
+        for (machine.run_to(cycle_); machine.rx_empty();
+             machine.run_to(cycle_))
+            cycle_ += POLL_CYCLES;
+        cycle_ += READ_CYCLES;
+        return machine.pop();
+    }
+
+    uint64_t cycle() const {return cycle_;}
+
+private:
+    std::vector<EncoderStateMachine>& machines_;
+    uint64_t cycle_;
+};
+
+struct cost_t
+{
+    double mean_cycles = 0;
+    uint64_t max_cycles = 0;
+    uint64_t min_latency = UINT64_MAX; // Request to reply in the RX FIFO.
+    uint64_t max_latency = 0;
+    size_t wrong_counts = 0;
+};
+
+/**
+ * \brief model reading num_encoders counts, batched or one at a time.
+ */
+cost_t model_reads(size_t num_encoders, bool batched)
+{
+    std::mt19937 rng(21);
+    // Start up to a few loops apart, and step every 40 to 400 clocks.
+    std::uniform_int_distribution<uint64_t> start(0, 64);
+    std::uniform_int_distribution<uint64_t> step_period(40, 400);
+    cost_t cost;
+    for (size_t trial = 0; trial < NUM_TRIALS; ++trial)
+    {
+        std::vector<EncoderStateMachine> machines;
+        for (size_t i = 0; i < num_encoders; ++i)
+            machines.emplace_back(step_period(rng), start(rng));
+        // Read once the last state machine is well into its loop.
+        Cpu cpu(machines, 100 + start(rng));
+        const uint64_t first_cycle = cpu.cycle();
+        uint32_t counts[MAX_AUX_ENCODERS];
+        uint64_t requested_at[MAX_AUX_ENCODERS];
+        if (batched)
+        {
+            for (size_t i = 0; i < num_encoders; ++i)
+            {
+                requested_at[i] = cpu.cycle();
+                cpu.request(i);
+            }
+            for (size_t i = 0; i < num_encoders; ++i)
+                counts[i] = cpu.fetch(i);
+        }
+        else
+        {
+            for (size_t i = 0; i < num_encoders; ++i)
+            {
+                requested_at[i] = cpu.cycle();
+                cpu.request(i);
+                counts[i] = cpu.fetch(i);
+            }
+        }
+        const uint64_t cycles = cpu.cycle() - first_cycle;
+        cost.mean_cycles += double(cycles) / NUM_TRIALS;
+        cost.max_cycles = (cycles > cost.max_cycles) ? cycles : cost.max_cycles;
+        for (size_t i = 0; i < num_encoders; ++i)
+        {
+            const EncoderStateMachine& machine = machines[i];
+            const uint64_t latency = machine.last_push() + 1 - requested_at[i];
+            cost.min_latency = (latency < cost.min_latency)
+                               ? latency : cost.min_latency;
+            cost.max_latency = (latency > cost.max_latency)
+                               ? latency : cost.max_latency;
+            // The count when the reply was pushed, give or take the step
+            // that the loop had not yet sampled.
+            const uint32_t position = machine.position(machine.last_push());
+            cost.wrong_counts += counts[i] != position
+                                 && counts[i] + 1 != position;
+        }
+    }
+    return cost;
+}
+
+bool check_modelled_cost()
+{
+    printf("Modelled cost of reading the additional encoders, at %u [MHz]:\n",
+           CLK_SYS_HZ / 1'000'000);
+    bool ok = true;
+    uint64_t min_latency = UINT64_MAX;
+    uint64_t max_latency = 0;
+    for (size_t n = 1; n <= MAX_AUX_ENCODERS; ++n)
+    {
+        const cost_t batched = model_reads(n, true);
+        const cost_t sequential = model_reads(n, false);
+        printf("  %zu encoder%s: batched %.1f [cycles] (max %llu), one at a "
+               "time %.1f [cycles] (max %llu), %.2fx.\n", n, n > 1 ? "s" : "",
+               batched.mean_cycles, (unsigned long long)batched.max_cycles,
+               sequential.mean_cycles, (unsigned long long)sequential.max_cycles,
+               sequential.mean_cycles / batched.mean_cycles);
+        ok &= batched.wrong_counts == 0 && sequential.wrong_counts == 0;
+        // Batching only pays off with more than one encoder to read.
+        ok &= (n == 1) ? batched.mean_cycles == sequential.mean_cycles
+                       : batched.mean_cycles < sequential.mean_cycles;
+        for (const cost_t* cost: {&batched, &sequential})
+        {
+            min_latency = (cost->min_latency < min_latency)
+                          ? cost->min_latency : min_latency;
+            max_latency = (cost->max_latency > max_latency)
+                          ? cost->max_latency : max_latency;
+        }
+    }
+    // pio_encoder.pio: "between 6 to 18 clocks afterwards".
+    printf("  Replies in the RX FIFO %llu to %llu [clocks] after their "
+           "request.\n",
+           (unsigned long long)min_latency, (unsigned long long)max_latency);
+    ok &= min_latency >= 6 && max_latency <= 18;
+    return check("Batched count requests cost less and return each count", ok);
+}
+
+/**
+ * \brief each encoder at its own count, far from the others.
+ */
+class Encoders: public SensorModel
+{
+public:
+    int32_t encoder_counts(uint32_t index, uint64_t time_us) override
+    {return int32_t(index * 1'000'000 + time_us % 1000);}
+
+    uint16_t torque_counts(uint64_t) override {return 2048;}
+    uint16_t brake_current_counts(uint64_t, uint16_t) override {return 10;}
+};
+
+bool check_simulated_encoders()
+{
+    Encoders encoders;
+    sim_boot(encoders);
+    sim_run_us(1000);
+    // The firmware's own encoder is on state machine 0.
+    PIOEncoder aux(pio1, 1, AUX_ENCODER_PINS, MAX_AUX_ENCODERS);
+    bool ok = aux.num_encoders() == MAX_AUX_ENCODERS;
+    size_t mismatches = 0;
+    for (size_t n = 0; n < 100; ++n)
+    {
+        sim_run_us(7);
+        const uint64_t time_us = sim_time_us();
+        uint32_t batched[MAX_AUX_ENCODERS];
+        uint32_t all[MAX_AUX_ENCODERS];
+        uint32_t rest[MAX_AUX_ENCODERS - 1];
+        aux.request_counts();
+        aux.fetch_counts(batched);
+        aux.get_counts(all);
+        aux.request_counts(1);
+        aux.fetch_counts(rest, 1);
+        for (uint32_t i = 0; i < MAX_AUX_ENCODERS; ++i)
+        {
+            const uint32_t expected = uint32_t(
+                encoders.encoder_counts(i + 1, time_us));
+            mismatches += batched[i] != expected || all[i] != expected
+                          || aux.get_count(i) != expected
+                          || (i > 0 && rest[i - 1] != expected);
+        }
+    }
+    printf("%zu mismatches in 100 reads of %u encoders.\n", mismatches,
+           MAX_AUX_ENCODERS);
+    // Neither initializes any state machine, so the above are untouched.
+    PIOEncoder past_end(pio1, PIOEncoder::MAX_ENCODERS,
+                        AUX_ENCODER_PINS, MAX_AUX_ENCODERS);
+    PIOEncoder far_past_end(pio1, PIOEncoder::MAX_ENCODERS + 3,
+                            AUX_ENCODER_PINS, 1);
+    ok &= past_end.num_encoders() == 0 && far_past_end.num_encoders() == 0;
+    return check("PIOEncoder returns each simulated encoder's count",
+                 ok && mismatches == 0);
+}
+}
+
+int main()
+{
+    bool ok = check_modelled_cost();
+    ok &= check_simulated_encoders();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,298 @@
+// Feed the firmware's M/T-method EncoderVelocityEstimator with synthetic
+// encoder edges and check its accuracy, then measure what an update costs.
+// A simulated belt moves the encoder. Channel-A edges are timestamped by an
+// edge timer at the firmware's tick rate into an 8-deep FIFO. The estimator
+// is updated on every 10 kHz sample latch with the latched count, as on the
+// device, and compared with the belt's true velocity and with counts per
+// sample period (the M-method alone).
+// Usage: encoder_velocity_bench
+#include <encoder_velocity_estimator.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+// Same as the firmware: a 125 [MHz] system clock, 2 clocks per edge timer
+// tick, a joined 8-deep RX FIFO and a 10 [kHz] sample latch.
+constexpr uint32_t EDGE_TICK_HZ = 125'000'000 / 2;
+constexpr uint32_t EDGE_FIFO_DEPTH = 8;
+constexpr uint32_t UPDATE_FREQUENCY_HZ = 10000;
+constexpr uint32_t UPDATE_INTERVAL_US = 1'000'000 / UPDATE_FREQUENCY_HZ;
+// The latched count is up to one DMA count request (1 [us]) old, and the
+// core1 loop drains the edge FIFO some time after the latch, so edges can
+// be seen an update before the count that goes with them.
+constexpr double COUNT_AGE_US = 1;
+constexpr double EDGE_DRAIN_DELAY_US = 8;
+// Start the edge timer close to wrapping so that every run crosses it.
+constexpr double EDGE_TICK_ORIGIN = 4'294'000'000.0;
+
+// Pass criteria.
+// At constant speed, while edge timestamps are kept.
+constexpr double MAX_CONSTANT_SPEED_ERROR_PERCENT = 0.05;
+// Mean acceleration over the middle of a ramp.
+constexpr double MAX_ACCELERATION_ERROR_PERCENT = 2;
+
+double read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return double(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+/**
+ * \brief belt position in quadrature counts over time in seconds.
+ */
+using Motion = std::function<double(double)>;
+
+struct update_t
+{
+    double time_s;
+    double true_velocity;      // [counts/s]
+    double velocity;           // [counts/s], estimated.
+    double acceleration;       // [counts/s^2], estimated.
+    double count_velocity;     // [counts/s], counts per sample period.
+    bool edges_lost;
+};
+
+/**
+ * \brief drive an estimator with the edges and counts of a moving belt.
+ * \returns one record per update.
+ */
+std::vector<update_t> run(const Motion& position, double duration_s)
+{
+    EncoderVelocityEstimator estimator(EDGE_TICK_HZ);
+    const double dt = 1e-6;
+    double sim_time_s = 0;
+    double x = position(0);
+    int32_t prev_count = int32_t(floor(x));
+    estimator.reset(prev_count, 0);
+    std::vector<update_t> updates;
+    const uint32_t num_updates = uint32_t(duration_s * UPDATE_FREQUENCY_HZ);
+    for (uint32_t n = 1; n <= num_updates; ++n)
+    {
+        const double time_s = double(n) / UPDATE_FREQUENCY_HZ;
+        // Advance the belt to when the core1 loop drains the edge FIFO.
+        uint32_t fifo_level = 0;
+        const double drain_time_s = time_s + EDGE_DRAIN_DELAY_US * 1e-6;
+        while (sim_time_s < drain_time_s - dt / 2)
+        {
+            const double next_x = position(sim_time_s + dt);
+            // Channel A changes level every 2 counts, i.e: whenever
+            // floor(x / 2) does. Interpolate the time of each change.
+            const int64_t from = int64_t(floor(x / 2));
+            const int64_t to = int64_t(floor(next_x / 2));
+            const int64_t step = (to > from) ? 1 : -1;
+            for (int64_t k = from; k != to; k += step)
+            {
+                const double edge = 2.0 * double((step > 0) ? k + 1 : k);
+                const double t_edge = sim_time_s + dt * (edge - x) / (next_x - x);
+                if (fifo_level == EDGE_FIFO_DEPTH)
+                    continue; // Dropped.
+                estimator.add_edge(uint32_t(uint64_t(llround(
+                    EDGE_TICK_ORIGIN + t_edge * EDGE_TICK_HZ))));
+                ++fifo_level;
+            }
+            x = next_x;
+            sim_time_s += dt;
+        }
+        // The firmware checks for a full FIFO before draining it.
+        const bool edges_lost = (fifo_level == EDGE_FIFO_DEPTH);
+        if (edges_lost)
+            estimator.mark_edges_lost();
+        const int32_t count = int32_t(floor(position(time_s
+                                                     - COUNT_AGE_US * 1e-6)));
+        estimator.update(count, uint64_t(n) * UPDATE_INTERVAL_US);
+        const double h = 1e-7;
+        updates.push_back({time_s,
+                           (position(time_s + h) - position(time_s - h)) / (2 * h),
+                           estimator.velocity_q8() / 256.0,
+                           estimator.acceleration_q8() / 256.0,
+                           double(count - prev_count) * UPDATE_FREQUENCY_HZ,
+                           edges_lost});
+        prev_count = count;
+    }
+    return updates;
+}
+
+bool check_constant_speeds()
+{
+    // From a slow walk to past what the edge FIFO can hold between updates
+    // (8 edges, i.e: 16 counts, per 100 [us]).
+    bool ok = true;
+    printf("Constant speed: max |error| of the estimate vs counts per sample "
+           "period.\n");
+    for (const double speed: {25.0, 300.0, 2'000.0, 15'000.0, 61'234.0,
+                              123'456.0, -123'456.0, -7'000.0, 251'000.0})
+    {
+        const std::vector<update_t> updates = run(
+            [speed](double t){return 0.3 + speed * t;}, 0.5);
+        double max_error = 0;
+        double max_count_error = 0;
+        bool any_lost = false;
+        // Skip until there is an interval between edges to measure. Until
+        // then, the estimate is counts per sample period.
+        const double settle_s = fmax(
+            3 * EncoderVelocityEstimator::COUNTS_PER_EDGE / fabs(speed),
+            10.0 / UPDATE_FREQUENCY_HZ);
+        for (const update_t& update: updates)
+        {
+            if (update.time_s < settle_s)
+                continue;
+            max_error = fmax(max_error, fabs(update.velocity - speed));
+            max_count_error = fmax(max_count_error,
+                                   fabs(update.count_velocity - speed));
+            any_lost |= update.edges_lost;
+        }
+        // Once edges are lost, the estimate can be no better than counts
+        // per sample period.
+        const bool speed_ok = any_lost
+            ? max_error <= UPDATE_FREQUENCY_HZ
+            : max_error <= fabs(speed) * MAX_CONSTANT_SPEED_ERROR_PERCENT / 100;
+        printf("  %9.0f [counts/s]: %10.3f vs %8.0f [counts/s]%s. %s\n", speed,
+               max_error, max_count_error,
+               any_lost ? " (edges lost)" : "", speed_ok ? "OK" : "FAILED");
+        ok &= speed_ok;
+    }
+    return ok;
+}
+
+bool check_ramp()
+{
+    // Accelerate from rest at 20'000 [counts/s^2] for a second.
+    const double rate = 20'000;
+    const std::vector<update_t> updates = run(
+        [rate](double t){return 0.5 * rate * t * t;}, 1.0);
+    double acceleration_sum = 0;
+    double max_velocity_error = 0;
+    size_t count = 0;
+    for (const update_t& update: updates)
+    {
+        if (update.time_s < 0.25 || update.time_s > 0.75)
+            continue;
+        acceleration_sum += update.acceleration;
+        // The estimate is the mean velocity between the last edges of
+        // successive updates, so it lags by up to about one and a half edge
+        // intervals and an update interval.
+        max_velocity_error = fmax(max_velocity_error,
+                                  fabs(update.velocity - update.true_velocity));
+        ++count;
+    }
+    const double mean_acceleration = acceleration_sum / count;
+    const double error_percent = 100 * (mean_acceleration - rate) / rate;
+    // Velocity is at least 5000 [counts/s] over the middle, i.e: an edge at
+    // least every 400 [us].
+    const double max_edge_interval_s = EncoderVelocityEstimator::COUNTS_PER_EDGE
+                                       / (rate * 0.25);
+    const double max_lag_error = rate * (1.5 * max_edge_interval_s
+                                         + 1.0 / UPDATE_FREQUENCY_HZ);
+    const bool ok = fabs(error_percent) <= MAX_ACCELERATION_ERROR_PERCENT
+                    && max_velocity_error <= max_lag_error;
+    printf("Ramp at %.0f [counts/s^2]: mean acceleration error %.2f%%, "
+           "max velocity error %.2f [counts/s]. %s\n", rate, error_percent,
+           max_velocity_error, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+bool check_stop()
+{
+    // Run at 1000 [counts/s], then stop dead. With no new edges, the estimate
+    // must fall at least as fast as one edge since the last edge.
+    const std::vector<update_t> updates = run(
+        [](double t){return 0.3 + 1000 * fmin(t, 0.2);}, 1.2);
+    bool ok = fabs(updates[1999].velocity - 1000) < 1;
+    for (const update_t& update: updates)
+    {
+        const double since_stop_s = update.time_s - 0.2;
+        if (since_stop_s > 0.002)
+            ok &= update.velocity <= EncoderVelocityEstimator::COUNTS_PER_EDGE
+                                     / (since_stop_s - 0.002) + 1;
+    }
+    ok &= updates.back().velocity <= 2.01;
+    printf("Stop from 1000 [counts/s]: %.2f [counts/s] 1 [s] later. %s\n",
+           updates.back().velocity, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+bool check_reversal()
+{
+    // Swing back and forth at up to 5000 [counts/s]. The estimate can only
+    // change sign on an edge, so its sign must follow the direction of
+    // travel once the belt has moved two edges from where it turned.
+    const Motion position = [](double t){return 500 * sin(2 * M_PI * 1.59 * t);};
+    const std::vector<update_t> updates = run(position, 2.0);
+    bool ok = true;
+    bool forward = true;
+    double turn_x = position(0);
+    for (const update_t& update: updates)
+    {
+        const double x = position(update.time_s);
+        if ((update.true_velocity > 0) != forward)
+        {
+            forward = !forward;
+            turn_x = x;
+        }
+        if (fabs(x - turn_x) > 2 * EncoderVelocityEstimator::COUNTS_PER_EDGE)
+            ok &= (update.velocity > 0) == forward;
+    }
+    printf("Direction reversals: %s\n", ok ? "OK" : "FAILED");
+    return ok;
+}
+
+void measure_update_cost()
+{
+    // A steady 50'000 [counts/s]: 2 or 3 edges per update.
+    constexpr uint32_t NUM_UPDATES = 1 << 20;
+    std::vector<uint32_t> edge_ticks;
+    std::vector<uint32_t> edges_per_update;
+    std::vector<int32_t> counts;
+    const double speed = 50'000;
+    double next_edge = 2;
+    for (uint32_t n = 1; n <= NUM_UPDATES; ++n)
+    {
+        const double x = speed * n / UPDATE_FREQUENCY_HZ;
+        uint32_t edges = 0;
+        for (; next_edge < x; next_edge += 2, ++edges)
+            edge_ticks.push_back(uint32_t(uint64_t(
+                llround(next_edge / speed * EDGE_TICK_HZ))));
+        edges_per_update.push_back(edges);
+        counts.push_back(int32_t(x));
+    }
+    EncoderVelocityEstimator estimator(EDGE_TICK_HZ);
+    estimator.reset(0, 0);
+    volatile int32_t sink = 0;
+    size_t edge = 0;
+    const auto start = std::chrono::steady_clock::now();
+    const double start_cycles = read_cycles();
+    for (uint32_t n = 0; n < NUM_UPDATES; ++n)
+    {
+        for (uint32_t i = 0; i < edges_per_update[n]; ++i)
+            estimator.add_edge(edge_ticks[edge++]);
+        estimator.update(counts[n], uint64_t(n + 1) * UPDATE_INTERVAL_US);
+        sink = sink + estimator.velocity_q8();
+    }
+    const double cycles = read_cycles() - start_cycles;
+    const double ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count();
+    (void)sink;
+    printf("Update with %.1f edges: %.2f [ns], %.1f [cycles] per update.\n",
+           double(edge) / NUM_UPDATES, ns / NUM_UPDATES, cycles / NUM_UPDATES);
+}
+}
+
+int main()
+{
+    bool ok = check_constant_speeds();
+    ok &= check_ramp();
+    ok &= check_stop();
+    ok &= check_reversal();
+    measure_update_cost();
+    return ok ? 0 : 1;
+}
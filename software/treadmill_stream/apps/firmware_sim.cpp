@@ -0,0 +1,210 @@
+// Run the whole firmware on the host against simulated sensors, and measure
+// what its loops cost.
+// main.cpp is built unchanged against stand-ins for the Pico SDK, the PIO
+// ADC and DAC libraries and harp.core (sim/inc), with a fake clock. The
+// treadmill belt turns at a constant speed, torque swings slowly around
+// mid-scale and the brake current follows the brake DAC. The host side reads
+// the device's USB output with TreadmillStream, as it would from a device.
+// Usage: firmware_sim [seconds]
+#include <firmware_sim.h>
+#include <treadmill_stream.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+// Same as the firmware.
+constexpr uint8_t BRAKE_CURRENT_SETPOINT_ADDRESS = 37;
+constexpr int32_t RAW_TORQUE_SENSOR_MAX = 3995;
+constexpr uint32_t TORQUE_MONITOR_INTERVAL_US = 25;
+constexpr uint32_t DEFAULT_TORQUE_LIMIT_WINDOW = 4;
+constexpr uint32_t SENSOR_ADC_PERIOD_US = 10; // sim_config_t default.
+
+constexpr uint32_t HARP_TICK_US = 32; // Harp timestamp resolution.
+
+/**
+ * \brief belt at a constant speed, torque swinging at 1 [Hz] around
+ *  mid-scale until an overload, and an ideal brake current driver.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    static constexpr double BELT_COUNTS_PER_S = 12'345;
+    static constexpr uint16_t BRAKE_CURRENT_OFFSET_COUNTS = 12;
+
+    Treadmill(): overload_from_us_{UINT64_MAX} {}
+
+    void overload_from(uint64_t time_us) {overload_from_us_ = time_us;}
+
+    int32_t encoder_counts(uint32_t index, uint64_t time_us) override
+    {
+        if (index > 0)
+            return int32_t(index);
+        return int32_t(floor(BELT_COUNTS_PER_S * time_us / 1e6));
+    }
+
+    uint16_t torque_counts(uint64_t time_us) override
+    {
+        if (time_us >= overload_from_us_)
+            return RAW_TORQUE_SENSOR_MAX + 50;
+        return uint16_t(lround(torque(time_us)));
+    }
+
+    uint16_t brake_current_counts(uint64_t, uint16_t brake_dac_code) override
+    {
+        return BRAKE_CURRENT_OFFSET_COUNTS + (brake_dac_code >> 4);
+    }
+
+    static double torque(uint64_t time_us)
+    {return 2048 + 100 * sin(2 * M_PI * time_us / 1e6);}
+
+private:
+    uint64_t overload_from_us_;
+};
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief cost of the calls made between two snapshots.
+ */
+void print_cost(const char* name, const sim_cost_t& before,
+                const sim_cost_t& after)
+{
+    const uint64_t calls = after.calls - before.calls;
+    printf("  %s: %.1f [ns], %.0f [cycles] per call over %llu calls.\n", name,
+           calls ? (after.total_ns - before.total_ns) / calls : 0.0,
+           calls ? (after.total_cycles - before.total_cycles) / calls : 0.0,
+           (unsigned long long)calls);
+}
+
+void write_u16(uint8_t address, uint16_t value)
+{
+    sim_write_register(address, HARP_U16, &value, sizeof(value));
+}
+
+bool check_sensor_dispatch(uint32_t seconds)
+{
+    // Idle first, to compare the cost of the loops with and without events.
+    sim_run_us(500'000);
+    sim_take_usb_output();
+    const sim_cost_t idle_start = sim_update_app_state_cost();
+    sim_run_us(500'000);
+    const sim_cost_t idle_end = sim_update_app_state_cost();
+    write_u16(SENSOR_DISPATCH_FREQUENCY_ADDRESS, 1000);
+    sim_run_us(100'000); // Let dispatch settle onto its grid.
+    TreadmillStream stream;
+    const std::vector<uint8_t> reply = sim_take_usb_output();
+    stream.feed(reply.data(), reply.size());
+    stream.sensor_data().clear();
+    const sim_cost_t core1_start = sim_core1_loop_cost();
+    const sim_cost_t dispatch_start = sim_update_app_state_cost();
+    sim_run_us(uint64_t(seconds) * 1'000'000);
+    const sim_cost_t dispatch_end = sim_update_app_state_cost();
+    const std::vector<uint8_t> output = sim_take_usb_output();
+    stream.feed(output.data(), output.size());
+
+    EventColumns& events = stream.sensor_data();
+    const size_t expected = size_t(seconds) * 1000;
+    bool ok = (events.size() + 1 >= expected) && (events.size() <= expected);
+    size_t bad_periods = 0;
+    size_t bad_values = 0;
+    const double counts_per_event = Treadmill::BELT_COUNTS_PER_S / 1000;
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const uint64_t time_us = events.harp_time_us(i);
+        // Sensors are latched together on the 10 [kHz] grid, and Harp time
+        // is in 32 [us] ticks.
+        const double torque = Treadmill::torque(time_us);
+        if (fabs(events.field(TreadmillStream::TORQUE, i) - torque) > 1.5
+            || events.field(TreadmillStream::BRAKE_CURRENT, i)
+               != Treadmill::BRAKE_CURRENT_OFFSET_COUNTS)
+            ++bad_values;
+        if (i == 0)
+            continue;
+        const int64_t period_us = int64_t(time_us - events.harp_time_us(i - 1));
+        const int32_t counts = events.field(TreadmillStream::ENCODER, i)
+                               - events.field(TreadmillStream::ENCODER, i - 1);
+        if (llabs(period_us - 1000) > HARP_TICK_US
+            || fabs(counts - counts_per_event) > 1)
+            ++bad_periods;
+    }
+    ok &= (bad_periods == 0) && (bad_values == 0)
+          && stream.parser().skipped_bytes() == 0;
+    printf("%zu SensorData events in %u [s] at 1 [kHz], %zu off the 1 [ms] "
+           "grid or belt speed, %zu with wrong sensor values.\n",
+           events.size(), seconds, bad_periods, bad_values);
+    print_cost("update_app_state() while idle", idle_start, idle_end);
+    print_cost("update_app_state() dispatching at 1 [kHz]", dispatch_start,
+               dispatch_end);
+    print_cost("core1 loop turn", core1_start, sim_core1_loop_cost());
+    return check("SensorData events at the dispatch rate with the simulated "
+                 "sensors", ok);
+}
+
+bool check_torque_limit(Treadmill& treadmill)
+{
+    write_u16(BRAKE_CURRENT_SETPOINT_ADDRESS, 40'000);
+    sim_run_us(10'000);
+    bool ok = sim_brake_dac_code() == 40'000;
+    sim_take_usb_output();
+    // Overload between two torque monitor checks, and watch for the brake to
+    // be killed.
+    const uint64_t overload_us = sim_time_us() + 1003;
+    treadmill.overload_from(overload_us);
+    while (sim_brake_dac_code() != 0 && sim_time_us() < overload_us + 10'000)
+        sim_run_us(1);
+    const uint64_t latency_us = sim_time_us() - overload_us;
+    sim_run_us(10'000);
+    TreadmillStream stream;
+    const std::vector<uint8_t> output = sim_take_usb_output();
+    stream.feed(output.data(), output.size());
+    EventColumns& trips = stream.torque_limit_events();
+    // The first out-of-range conversion is up to a conversion period late,
+    // the window takes the rest, and the monitor checks every interval.
+    const uint64_t max_latency_us = DEFAULT_TORQUE_LIMIT_WINDOW
+                                    * SENSOR_ADC_PERIOD_US
+                                    + TORQUE_MONITOR_INTERVAL_US;
+    ok &= sim_brake_dac_code() == 0 && latency_us <= max_latency_us
+          && trips.size() == 1 && trips.field(0, 0) == 1;
+    printf("Brake killed %llu [us] after the overload (at most %llu [us]), "
+           "%zu TorqueLimitState event(s).\n", (unsigned long long)latency_us,
+           (unsigned long long)max_latency_us, trips.size());
+    return check("Torque overload kills the brake and is reported", ok);
+}
+
+void print_alarm_costs()
+{
+    for (uint32_t alarm_num = 0; alarm_num < 4; ++alarm_num)
+    {
+        double period_us;
+        const sim_cost_t& cost = sim_alarm_cost(alarm_num, period_us);
+        if (cost.calls == 0)
+            continue;
+        printf("  Alarm %u IRQ (every %.0f [us]): %.1f [ns], %.0f [cycles] "
+               "per call, at most %.0f [ns], over %llu calls.\n", alarm_num,
+               period_us, cost.mean_ns(), cost.mean_cycles(), cost.max_ns,
+               (unsigned long long)cost.calls);
+    }
+    const sim_cost_t& update = sim_update_app_state_cost();
+    const sim_cost_t& core1 = sim_core1_loop_cost();
+    printf("  update_app_state(): at most %.0f [ns]. Core1 loop turn: at "
+           "most %.0f [ns].\n", update.max_ns, core1.max_ns);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    const uint32_t seconds = (argc > 1) ? uint32_t(atoi(argv[1])) : 2;
+    Treadmill treadmill;
+    sim_boot(treadmill);
+    printf("Host cost of the simulated firmware on this machine:\n");
+    bool ok = check_sensor_dispatch(seconds > 0 ? seconds : 1);
+    ok &= check_torque_limit(treadmill);
+    print_alarm_costs();
+    return ok ? 0 : 1;
+}
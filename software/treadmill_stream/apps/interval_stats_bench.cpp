@@ -0,0 +1,309 @@
+// Check the firmware's IntervalStats reduction against a reference, measure
+// what it costs, and check that SensorDataStats events catch brief torque
+// peaks on the simulated device.
+// As on the device, each 10 [kHz] core1 tick reduces every conversion that
+// DMA wrote to a torque or brake current SampleRing since the previous tick
+// into a tick, and core0 merges the tared ticks of a dispatch interval. Rings
+// are filled with random 12-bit conversions and read across their wrap. The
+// cost is measured per conversion for the ticks at the device's conversion
+// rate, and per tick for the merge. On the simulated device, a torque spike
+// a few conversions long must show up in the maximum of the 100 [Hz] event
+// that covers it.
+// Usage: interval_stats_bench
+#include <interval_stats.h>
+#include <sample_ring.h>
+#include <firmware_sim.h>
+#include <treadmill_stream.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+// Same as the firmware.
+constexpr size_t ADC_RING_SIZE = 1024;
+constexpr uint32_t ADC_RATE_HZ = 100'000; // Each channel.
+constexpr uint32_t TICK_RATE_HZ = 10'000;
+constexpr uint8_t SENSOR_DATA_FORMAT_ADDRESS = 74;
+constexpr uint8_t SENSOR_DATA_STATS_ADDRESS = 77;
+constexpr uint8_t SENSOR_DATA_FORMAT_STATS = 3;
+
+constexpr size_t CONVERSIONS_PER_TICK = ADC_RATE_HZ / TICK_RATE_HZ;
+constexpr size_t NUM_CHECKED_INTERVALS = 20'000;
+constexpr size_t NUM_TIMED_TICKS = 2'000'000;
+
+using Ring = SampleRing<uint16_t, ADC_RING_SIZE>;
+
+double read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return double(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief a ring that a simulated DMA channel keeps writing random 12-bit
+ *  conversions to.
+ */
+class DmaRing
+{
+public:
+    explicit DmaRing(uint32_t seed): rng_(seed), write_index_{0} {}
+
+/**
+ * \brief write count conversions and return them.
+ */
+    const std::vector<int16_t>& write(size_t count)
+    {
+        std::uniform_int_distribution<uint32_t> conversion(0, 4095);
+        written_.resize(count);
+        for (int16_t& value: written_)
+        {
+            value = int16_t(conversion(rng_));
+            ring_.buffer()[write_index_] = uint16_t(value);
+            write_index_ = (write_index_ + 1) & Ring::MASK;
+        }
+        return written_;
+    }
+
+    Ring& ring() {return ring_;}
+    uint32_t write_index() const {return write_index_;}
+
+private:
+    std::mt19937 rng_;
+    Ring ring_;
+    uint32_t write_index_;
+    std::vector<int16_t> written_;
+};
+
+/**
+ * \brief a core1 tick: reduce every conversion since the last one.
+ */
+IntervalStats::tick_t reduce(Ring& ring, uint32_t& read_index,
+                             uint32_t write_index)
+{
+    IntervalStats::tick_t tick = IntervalStats::EMPTY_TICK;
+    ring.consume_from(read_index, write_index, [&tick](uint16_t raw)
+    {IntervalStats::accumulate(tick, int16_t(raw));});
+    return tick;
+}
+
+struct reference_t
+{
+    int64_t sum = 0;
+    int16_t min = INT16_MAX;
+    int16_t max = INT16_MIN;
+    uint32_t count = 0;
+
+    void add(int16_t value)
+    {
+        sum += value;
+        min = std::min(min, value);
+        max = std::max(max, value);
+        ++count;
+    }
+
+    int16_t mean() const
+    {return count ? int16_t(lround(double(sum) / count)) : 0;}
+};
+
+bool check_against_reference()
+{
+    std::mt19937 rng(16);
+    // Ticks see up to twice the nominal number of conversions, and intervals
+    // are up to 200 ticks, e.g: 50 [Hz] dispatch, or empty.
+    std::uniform_int_distribution<size_t> conversions(0, 2 * CONVERSIONS_PER_TICK);
+    std::uniform_int_distribution<size_t> ticks(0, 200);
+    std::uniform_int_distribution<int32_t> offset(-300, 300);
+    DmaRing torque(1);
+    DmaRing current(2);
+    uint32_t torque_read_index = 0;
+    uint32_t current_read_index = 0;
+    IntervalStats stats;
+    size_t mismatches = 0;
+    size_t num_conversions = 0;
+    for (size_t interval = 0; interval < NUM_CHECKED_INTERVALS; ++interval)
+    {
+        const int16_t torque_offset = int16_t(offset(rng));
+        const int16_t current_offset = int16_t(offset(rng));
+        reference_t torque_reference;
+        reference_t current_reference;
+        stats.clear();
+        const size_t num_ticks = ticks(rng);
+        for (size_t tick = 0; tick < num_ticks; ++tick)
+        {
+            for (const int16_t value: torque.write(conversions(rng)))
+                torque_reference.add(int16_t(value - torque_offset));
+            for (const int16_t value: current.write(conversions(rng)))
+                current_reference.add(int16_t(value - current_offset));
+            stats.add(IntervalStats::TORQUE, IntervalStats::tared(
+                reduce(torque.ring(), torque_read_index, torque.write_index()),
+                torque_offset));
+            stats.add(IntervalStats::BRAKE_CURRENT, IntervalStats::tared(
+                reduce(current.ring(), current_read_index,
+                       current.write_index()),
+                current_offset));
+        }
+        num_conversions += torque_reference.count + current_reference.count;
+        const IntervalStats::channel_t channels[] = {IntervalStats::TORQUE,
+                                                     IntervalStats::BRAKE_CURRENT};
+        const reference_t* references[] = {&torque_reference, &current_reference};
+        for (size_t i = 0; i < 2; ++i)
+        {
+            const reference_t& reference = *references[i];
+            const bool empty = reference.count == 0;
+            mismatches += stats.num_samples(channels[i]) != reference.count
+                          || stats.min(channels[i]) != (empty ? 0 : reference.min)
+                          || stats.max(channels[i]) != (empty ? 0 : reference.max)
+                          || stats.mean(channels[i]) != reference.mean();
+        }
+    }
+    printf("  %zu mismatches in %zu channel intervals of %zu conversions.\n",
+           mismatches, 2 * NUM_CHECKED_INTERVALS, num_conversions);
+    return check("Tick reduction and merge match the reference",
+                 mismatches == 0);
+}
+
+void measure_reduction_cost()
+{
+    printf("Reduction cost on this machine:\n");
+    DmaRing torque(3);
+    DmaRing current(4);
+    // Rings full of conversions to read over and over, including the wrap.
+    torque.write(ADC_RING_SIZE);
+    current.write(ADC_RING_SIZE);
+    for (const size_t per_tick: {CONVERSIONS_PER_TICK, size_t(100)})
+    {
+        uint32_t torque_read_index = 0;
+        uint32_t current_read_index = 0;
+        uint32_t write_index = 0;
+        IntervalStats stats;
+        volatile int32_t sink = 0;
+        const size_t num_ticks = NUM_TIMED_TICKS * CONVERSIONS_PER_TICK
+                                 / per_tick;
+        const auto start = std::chrono::steady_clock::now();
+        const double start_cycles = read_cycles();
+        for (size_t n = 0; n < num_ticks; ++n)
+        {
+            write_index = (write_index + per_tick) & Ring::MASK;
+            const IntervalStats::tick_t torque_tick = reduce(
+                torque.ring(), torque_read_index, write_index);
+            const IntervalStats::tick_t current_tick = reduce(
+                current.ring(), current_read_index, write_index);
+            stats.add(IntervalStats::TORQUE, IntervalStats::tared(torque_tick, 7));
+            stats.add(IntervalStats::BRAKE_CURRENT,
+                      IntervalStats::tared(current_tick, -7));
+        }
+        sink = sink + stats.max(IntervalStats::TORQUE);
+        const double cycles = read_cycles() - start_cycles;
+        const double ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count();
+        (void)sink;
+        const double num_conversions = 2.0 * num_ticks * per_tick;
+        printf("  %3zu conversions per channel per tick: %.2f [ns], %.2f "
+               "[cycles] per conversion. %.1f [ns] per tick, both channels "
+               "reduced and merged.\n", per_tick, ns / num_conversions,
+               cycles / num_conversions, ns / num_ticks);
+    }
+}
+
+/**
+ * \brief belt at rest, torque at mid-scale with a spike a few conversions
+ *  long, and no brake current.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    static constexpr uint16_t TORQUE_COUNTS = 2048;
+    static constexpr uint16_t SPIKE_COUNTS = 3500; // Inside the torque limits.
+    static constexpr uint64_t SPIKE_US = 30;
+
+    Treadmill(): spike_from_us_{UINT64_MAX} {}
+
+    void spike_at(uint64_t time_us) {spike_from_us_ = time_us;}
+
+    int32_t encoder_counts(uint32_t, uint64_t) override {return 0;}
+
+    uint16_t torque_counts(uint64_t time_us) override
+    {
+        return (time_us >= spike_from_us_ && time_us < spike_from_us_ + SPIKE_US)
+               ? SPIKE_COUNTS : TORQUE_COUNTS;
+    }
+
+    uint16_t brake_current_counts(uint64_t, uint16_t) override {return 10;}
+
+private:
+    uint64_t spike_from_us_;
+};
+
+bool check_peak_capture()
+{
+    Treadmill treadmill;
+    sim_boot(treadmill);
+    sim_run_us(10'000);
+    const uint16_t rate_hz = 100;
+    sim_write_register(SENSOR_DISPATCH_FREQUENCY_ADDRESS, HARP_U16, &rate_hz,
+                       sizeof(rate_hz));
+    sim_write_register(SENSOR_DATA_FORMAT_ADDRESS, HARP_U8,
+                       &SENSOR_DATA_FORMAT_STATS, 1);
+    sim_run_us(100'000);
+    sim_take_usb_output();
+    // Shorter than the 100 [us] latch period.
+    const uint64_t spike_us = sim_time_us() + 45'043;
+    treadmill.spike_at(spike_us);
+    sim_run_us(200'000);
+    const std::vector<uint8_t> output = sim_take_usb_output();
+    size_t num_events = 0;
+    size_t num_spikes = 0;
+    size_t bad_events = 0;
+    HarpFrameParser parser;
+    parser.parse(output.data(), output.size(), [&](const harp_frame_t& frame)
+    {
+        if (frame.message_type != HARP_EVENT
+            || frame.address != SENSOR_DATA_STATS_ADDRESS)
+            return;
+        ++num_events;
+        const int32_t count = frame.element<int32_t>(1);
+        const int32_t torque_min = frame.element<int32_t>(2);
+        const int32_t torque_max = frame.element<int32_t>(3);
+        const int32_t torque_mean = frame.element<int32_t>(4);
+        const int32_t current_min = frame.element<int32_t>(5);
+        const int32_t current_max = frame.element<int32_t>(6);
+        // Every conversion of the 10 [ms] interval, give or take one.
+        bad_events += abs(count - int32_t(ADC_RATE_HZ / rate_hz)) > 1
+                      || torque_min != Treadmill::TORQUE_COUNTS
+                      || abs(torque_mean - Treadmill::TORQUE_COUNTS) > 5
+                      || current_min != 10 || current_max != 10;
+        num_spikes += torque_max == Treadmill::SPIKE_COUNTS;
+        bad_events += torque_max != Treadmill::SPIKE_COUNTS
+                      && torque_max != Treadmill::TORQUE_COUNTS;
+    });
+    printf("%zu SensorDataStats events at %u [Hz], %zu with the %llu [us] "
+           "torque spike as their maximum, %zu wrong.\n", num_events, rate_hz,
+           num_spikes, (unsigned long long)Treadmill::SPIKE_US, bad_events);
+    return check("SensorDataStats catches a torque spike shorter than a latch period",
+                 num_events >= 19 && num_spikes == 1 && bad_events == 0);
+}
+}
+
+int main()
+{
+    bool ok = check_against_reference();
+    measure_reduction_cost();
+    ok &= check_peak_capture();
+    return ok ? 0 : 1;
+}
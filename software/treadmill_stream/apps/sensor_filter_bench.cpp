@@ -0,0 +1,263 @@
+// Check the firmware's fixed-point sensor filters against a double-precision
+// reference and measure what they cost per conversion.
+// Every preset filters the same simulated torque stream (a slow signal plus
+// brake PWM ripple and noise, quantized to 12 bits) through the firmware's
+// own FilterPipeline and through the same pipeline in double precision with
+// unquantized coefficients. The preset table is also checked against a fresh
+// design, which --print-presets prints as source.
+// Usage: sensor_filter_bench [--print-presets]
+#include <fixed_point_filter.h>
+#include <sensor_filter_presets.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+constexpr uint32_t DECIMATION_LOG2 = 4; // Same as the firmware.
+constexpr size_t NUM_CONVERSIONS = 1 << 20;
+// Largest difference from the double-precision reference, in conversion
+// counts, before the output is rounded to whole counts.
+constexpr double MAX_ERROR_COUNTS = 0.01;
+
+using Filter = FilterPipeline<DECIMATION_LOG2, SENSOR_FILTER_SECTIONS>;
+
+struct biquad_t
+{
+    double b0, b1, b2, a1, a2;
+};
+
+/**
+ * \brief Butterworth lowpass sections with the bilinear transform,
+ *  prewarped at the cutoff.
+ * \param cutoff fraction of the sample rate.
+ */
+std::vector<biquad_t> design_butterworth(double cutoff)
+{
+    std::vector<biquad_t> sections;
+    const double w0 = 2 * M_PI * cutoff;
+    for (uint32_t k = 0; k < SENSOR_FILTER_SECTIONS; ++k)
+    {
+        const double q = 1 / (2 * cos(M_PI * (2 * k + 1)
+                                      / (4 * SENSOR_FILTER_SECTIONS)));
+        const double alpha = sin(w0) / (2 * q);
+        const double a0 = 1 + alpha;
+        const double b0 = (1 - cos(w0)) / 2 / a0;
+        sections.push_back({b0, 2 * b0, b0, -2 * cos(w0) / a0,
+                            (1 - alpha) / a0});
+    }
+    return sections;
+}
+
+/**
+ * \brief quantize a section to Q2.29 with a DC gain of exactly 1.
+ */
+biquad_coefficients_t quantize(const biquad_t& section)
+{
+    const double one = double(1u << BIQUAD_COEFFICIENT_FRAC_BITS);
+    biquad_coefficients_t c;
+    c.a1 = int32_t(lround(section.a1 * one));
+    c.a2 = int32_t(lround(section.a2 * one));
+    // b0 + b1 + b2 must equal 1 + a1 + a2.
+    const int64_t sum = int64_t(one) + c.a1 + c.a2;
+    c.b0 = int32_t(llround(sum / 4.0));
+    c.b2 = c.b0;
+    c.b1 = int32_t(sum - 2 * int64_t(c.b0));
+    return c;
+}
+
+void print_presets()
+{
+    for (uint32_t i = 0; i < NUM_SENSOR_FILTER_PRESETS; ++i)
+    {
+        const sensor_filter_preset_t& preset = SENSOR_FILTER_PRESETS[i];
+        if (preset.sections == nullptr)
+            continue;
+        printf("// %.1f%%\n", preset.cutoff_ppm * 1e-4);
+        printf("const biquad_coefficients_t BUTTERWORTH_%u_PPM"
+               "[SENSOR_FILTER_SECTIONS] =\n{\n", preset.cutoff_ppm);
+        const std::vector<biquad_t> sections =
+            design_butterworth(preset.cutoff_ppm * 1e-6);
+        for (size_t k = 0; k < sections.size(); ++k)
+        {
+            const biquad_coefficients_t c = quantize(sections[k]);
+            printf("    {%d, %d, %d, %d, %d}%s\n", c.b0, c.b1, c.b2, c.a1, c.a2,
+                   (k + 1 < sections.size()) ? "," : "");
+        }
+        printf("};\n\n");
+    }
+}
+
+bool check_preset_table()
+{
+    bool ok = true;
+    for (uint32_t i = 0; i < NUM_SENSOR_FILTER_PRESETS; ++i)
+    {
+        const sensor_filter_preset_t& preset = SENSOR_FILTER_PRESETS[i];
+        if (preset.sections == nullptr)
+            continue;
+        const std::vector<biquad_t> sections =
+            design_butterworth(preset.cutoff_ppm * 1e-6);
+        for (size_t k = 0; k < sections.size(); ++k)
+        {
+            const biquad_coefficients_t c = quantize(sections[k]);
+            ok &= memcmp(&preset.sections[k], &c, sizeof(c)) == 0;
+        }
+    }
+    printf("Preset table matches its design: %s\n", ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief the same pipeline as FilterPipeline, in double precision.
+ */
+class ReferenceFilter
+{
+public:
+    explicit ReferenceFilter(std::vector<biquad_t> sections)
+    : sections_(std::move(sections)), state_(sections_.size()) {}
+
+    bool add(uint16_t conversion)
+    {
+        sum_ += conversion;
+        if (++count_ < (1u << DECIMATION_LOG2))
+            return false;
+        double x = sum_ / double(1u << DECIMATION_LOG2);
+        sum_ = 0;
+        count_ = 0;
+        if (!primed_)
+        {
+            for (state_t& state: state_)
+                state = {x, x, x, x};
+            primed_ = true;
+        }
+        for (size_t i = 0; i < sections_.size(); ++i)
+        {
+            const biquad_t& c = sections_[i];
+            state_t& s = state_[i];
+            const double y = c.b0 * x + c.b1 * s.x1 + c.b2 * s.x2
+                             - c.a1 * s.y1 - c.a2 * s.y2;
+            s = {x, s.x1, y, s.y1};
+            x = y;
+        }
+        output_ = x;
+        return true;
+    }
+
+    double output() const {return output_;}
+
+private:
+    struct state_t
+    {
+        double x1, x2, y1, y2;
+    };
+
+    std::vector<biquad_t> sections_;
+    std::vector<state_t> state_;
+    uint64_t sum_ = 0;
+    uint32_t count_ = 0;
+    bool primed_ = false;
+    double output_ = 0;
+};
+
+/**
+ * \brief a torque-like stream: a slow signal across most of the ADC's range
+ *  with brake PWM ripple and noise on top.
+ */
+std::vector<uint16_t> make_conversions()
+{
+    std::mt19937 rng(1);
+    std::normal_distribution<double> noise;
+    std::vector<uint16_t> conversions(NUM_CONVERSIONS);
+    for (size_t n = 0; n < NUM_CONVERSIONS; ++n)
+    {
+        // Frequencies are fractions of the conversion rate.
+        const double signal = 2048 + 1500 * sin(2 * M_PI * 2e-5 * n)
+                              + 200 * sin(2 * M_PI * 7e-4 * n);
+        const double ripple = ((n / 25) % 2) ? 80 : -80;
+        const double value = signal + ripple + 10 * noise(rng);
+        conversions[n] = uint16_t(lround(fmin(fmax(value, 0), 4095)));
+    }
+    return conversions;
+}
+
+double read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return double(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+bool check_preset(uint32_t index, const std::vector<uint16_t>& conversions)
+{
+    const sensor_filter_preset_t& preset = SENSOR_FILTER_PRESETS[index];
+    Filter filter;
+    filter.set_sections(preset.sections);
+    ReferenceFilter reference(preset.sections
+                              ? design_butterworth(preset.cutoff_ppm * 1e-6)
+                              : std::vector<biquad_t>{});
+    const double one = double(1u << Filter::FRAC_BITS);
+    double max_error = 0;
+    double sum_squared_error = 0;
+    size_t num_outputs = 0;
+    for (uint16_t conversion: conversions)
+    {
+        const bool updated = filter.add(conversion);
+        if (reference.add(conversion) != updated)
+            return false;
+        if (!updated)
+            continue;
+        const double error = fabs(filter.output() / one - reference.output());
+        max_error = fmax(max_error, error);
+        sum_squared_error += error * error;
+        ++num_outputs;
+    }
+    // Time the fixed-point filter alone.
+    filter.set_sections(preset.sections);
+    volatile int32_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    const double start_cycles = read_cycles();
+    for (uint16_t conversion: conversions)
+        if (filter.add(conversion))
+            sink = filter.output();
+    const double cycles = read_cycles() - start_cycles;
+    const double ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count();
+    (void)sink;
+    const bool ok = max_error <= MAX_ERROR_COUNTS;
+    printf("Preset %u (cutoff %.1f%%): max error %.5f, rms error %.5f "
+           "[counts]. %.2f [ns], %.1f [cycles] per conversion. %s\n", index,
+           preset.cutoff_ppm * 1e-4, max_error,
+           sqrt(sum_squared_error / num_outputs), ns / conversions.size(),
+           cycles / conversions.size(), ok ? "OK" : "FAILED");
+    return ok;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && strcmp(argv[1], "--print-presets") == 0)
+    {
+        print_presets();
+        return 0;
+    }
+    if (argc > 1)
+    {
+        fprintf(stderr, "Usage: %s [--print-presets]\n", argv[0]);
+        return 1;
+    }
+    bool ok = check_preset_table();
+    const std::vector<uint16_t> conversions = make_conversions();
+    // Preset 0 is off.
+    for (uint32_t i = 1; i < NUM_SENSOR_FILTER_PRESETS; ++i)
+        ok &= check_preset(i, conversions);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+// Extract brake step response metrics on the host with the same code that
+// the firmware's brake step test runs.
+// Given a trace saved by download_brake_step_trace.py, prints its metrics.
+// With --simulate, runs first and second order step responses through it
+// instead and checks the metrics against their known values.
+// Usage: step_response_analyze <trace.csv> | --simulate
+#include <step_response.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t SETTLING_BAND_PERMILLE = 20; // Same as the firmware.
+
+struct trace_t
+{
+    std::vector<uint16_t> samples;
+    size_t step_index = 0;
+    uint32_t sample_period_ns = 0;
+};
+
+/**
+ * \brief read a trace. Comment lines hold "sample_period_ns=" and
+ *  "step_index=". Every other line that starts with a number is a sample.
+ */
+bool load_trace(const char* path, trace_t& trace)
+{
+    FILE* file = fopen(path, "r");
+    if (file == nullptr)
+        return false;
+    char line[256];
+    while (fgets(line, sizeof(line), file))
+    {
+        if (line[0] == '#')
+        {
+            if (const char* value = strstr(line, "sample_period_ns="))
+                trace.sample_period_ns = uint32_t(strtoul(value + 17,
+                                                          nullptr, 10));
+            if (const char* value = strstr(line, "step_index="))
+                trace.step_index = strtoul(value + 11, nullptr, 10);
+            continue;
+        }
+        char* end;
+        const unsigned long sample = strtoul(line, &end, 10);
+        if (end != line)
+            trace.samples.push_back(uint16_t(sample));
+    }
+    fclose(file);
+    return trace.sample_period_ns > 0;
+}
+
+void print_response(const step_response_t& response)
+{
+    printf("initial: %d, final: %d [counts]\n", response.initial,
+           response.final);
+    if (response.rise_time_ns == UINT32_MAX)
+        printf("rise time: never reached 90%%\n");
+    else
+        printf("rise time: %.1f [us]\n", response.rise_time_ns * 1e-3);
+    if (response.settling_time_ns == UINT32_MAX)
+        printf("settling time: did not settle\n");
+    else
+        printf("settling time: %.1f [us]\n", response.settling_time_ns * 1e-3);
+    printf("overshoot: %.1f [%%]\n", response.overshoot_permille * 0.1);
+}
+
+/**
+ * \brief unit step response of a second order system with natural
+ *  frequency wn [rad/s], or of a first order system with time constant 1/wn
+ *  if zeta is 0.
+ */
+double step_response(double t_s, double wn, double zeta)
+{
+    if (t_s < 0)
+        return 0;
+    if (zeta == 0)
+        return 1 - exp(-wn * t_s);
+    const double wd = wn * sqrt(1 - zeta * zeta);
+    return 1 - exp(-zeta * wn * t_s)
+               * (cos(wd * t_s) + zeta / sqrt(1 - zeta * zeta) * sin(wd * t_s));
+}
+
+struct expected_t
+{
+    double rise_start_s; // 10%.
+    double rise_end_s; // 90%.
+    double settling_time_s;
+    double overshoot;
+};
+
+/**
+ * \brief metrics of the noise-free continuous response, found on a grid
+ *  much finer than the ADC's.
+ */
+expected_t expected_metrics(double wn, double zeta, double duration_s)
+{
+    const double dt_s = duration_s * 1e-6;
+    const double band = SETTLING_BAND_PERMILLE * 1e-3;
+    double t10_s = -1, t90_s = -1, settled_s = 0, peak = 0;
+    for (double t_s = 0; t_s < duration_s; t_s += dt_s)
+    {
+        const double value = step_response(t_s, wn, zeta);
+        if (t10_s < 0 && value >= 0.1)
+            t10_s = t_s;
+        if (t90_s < 0 && value >= 0.9)
+            t90_s = t_s;
+        peak = (value > peak) ? value : peak;
+        if (fabs(value - 1) > band)
+            settled_s = t_s + dt_s;
+    }
+    return {t10_s, t90_s, settled_s, peak - 1};
+}
+
+/**
+ * \brief how far off a crossing at t_s can be, given the uncertainty of the
+ *  samples (noise and rounding) and how fast the response moves there.
+ */
+double crossing_tolerance_s(double t_s, double wn, double zeta,
+                            double step_counts, double uncertainty_counts,
+                            double period_s)
+{
+    const double slope = fabs(step_response(t_s + period_s, wn, zeta)
+                              - step_response(t_s - period_s, wn, zeta))
+                         * fabs(step_counts) / (2 * period_s);
+    return 2 * period_s + uncertainty_counts / slope;
+}
+
+/**
+ * \brief run one simulated step through the analyzer.
+ * \returns true if its metrics are within a couple of samples of the
+ *  expected ones, plus however far noise and rounding can move them.
+ */
+bool check_simulated(const char* name, double wn, double zeta,
+                     uint16_t low, uint16_t high, double noise_counts,
+                     std::mt19937& rng)
+{
+    constexpr uint32_t PERIOD_NS = 2000; // 500[kHz].
+    constexpr size_t PRE_SAMPLES = 256;
+    constexpr size_t NUM_SAMPLES = 8192;
+    const double period_s = PERIOD_NS * 1e-9;
+    std::normal_distribution<double> noise;
+    std::vector<uint16_t> samples(NUM_SAMPLES);
+    for (size_t i = 0; i < NUM_SAMPLES; ++i)
+    {
+        const double t_s = (double(i) - PRE_SAMPLES) * period_s;
+        const double value = low + (double(high) - low)
+                                   * step_response(t_s, wn, zeta)
+                             + noise_counts * noise(rng);
+        samples[i] = uint16_t(lround(value < 0 ? 0 : value));
+    }
+    step_response_t response;
+    if (!analyze_step_response(samples.data(), samples.size(), PRE_SAMPLES,
+                               PERIOD_NS, SETTLING_BAND_PERMILLE, response))
+    {
+        printf("%s: rejected. FAILED\n", name);
+        return false;
+    }
+    const expected_t expected = expected_metrics(
+        wn, zeta, (NUM_SAMPLES - PRE_SAMPLES) * period_s);
+    const double step_counts = double(high) - low;
+    const double uncertainty_counts = 4 * noise_counts + 0.5;
+    const double expected_rise_s = expected.rise_end_s - expected.rise_start_s;
+    const double rise_tolerance_s =
+        crossing_tolerance_s(expected.rise_start_s, wn, zeta, step_counts,
+                             uncertainty_counts, period_s)
+        + crossing_tolerance_s(expected.rise_end_s, wn, zeta, step_counts,
+                               uncertainty_counts, period_s);
+    const double settling_tolerance_s =
+        crossing_tolerance_s(expected.settling_time_s, wn, zeta, step_counts,
+                             uncertainty_counts, period_s);
+    const double rise_s = response.rise_time_ns * 1e-9;
+    const double settling_s = response.settling_time_ns * 1e-9;
+    const double overshoot = response.overshoot_permille * 1e-3;
+    const bool ok = fabs(rise_s - expected_rise_s) <= rise_tolerance_s
+                    && fabs(settling_s - expected.settling_time_s)
+                       <= settling_tolerance_s
+                    && fabs(overshoot - expected.overshoot)
+                       <= uncertainty_counts / fabs(step_counts) + 0.001;
+    printf("%s: rise %.1f (expected %.1f) [us], settling %.1f (%.1f) [us], "
+           "overshoot %.1f (%.1f) [%%]. %s\n", name, rise_s * 1e6,
+           expected_rise_s * 1e6, settling_s * 1e6,
+           expected.settling_time_s * 1e6, overshoot * 100,
+           expected.overshoot * 100, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+int simulate()
+{
+    std::mt19937 rng(1);
+    bool ok = true;
+    // Coil current through an RL circuit: first order, tau = 1[ms].
+    ok &= check_simulated("first order, rising", 1e3, 0, 100, 2100, 2, rng);
+    ok &= check_simulated("first order, falling", 1e3, 0, 2100, 100, 2, rng);
+    // A current loop with some ringing. Noise-free, since noise on a ring
+    // that peaks just inside the settling band can add a whole ring to the
+    // settling time.
+    ok &= check_simulated("second order, zeta 0.3", 2 * M_PI * 500, 0.3,
+                          100, 2100, 0, rng);
+    ok &= check_simulated("second order, zeta 0.7", 2 * M_PI * 500, 0.7,
+                          2100, 100, 2, rng);
+    // Steps lost in the noise are rejected rather than measured.
+    std::vector<uint16_t> flat(1024);
+    std::normal_distribution<double> noise(1000, 5);
+    for (uint16_t& sample: flat)
+        sample = uint16_t(lround(noise(rng)));
+    step_response_t response;
+    const bool rejected = !analyze_step_response(flat.data(), flat.size(), 256,
+                                                 2000, SETTLING_BAND_PERMILLE,
+                                                 response);
+    printf("no step: %s. %s\n", rejected ? "rejected" : "measured",
+           rejected ? "OK" : "FAILED");
+    ok &= rejected;
+    return ok ? 0 : 1;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <trace.csv> | --simulate\n", argv[0]);
+        return 1;
+    }
+    if (strcmp(argv[1], "--simulate") == 0)
+        return simulate();
+    trace_t trace;
+    if (!load_trace(argv[1], trace))
+    {
+        fprintf(stderr, "Could not read trace %s\n", argv[1]);
+        return 1;
+    }
+    step_response_t response;
+    if (!analyze_step_response(trace.samples.data(), trace.samples.size(),
+                               trace.step_index, trace.sample_period_ns,
+                               SETTLING_BAND_PERMILLE, response))
+    {
+        fprintf(stderr, "No step to measure in %zu samples.\n",
+                trace.samples.size());
+        return 1;
+    }
+    print_response(response);
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Stream SensorData events from a treadmill, recording the raw stream to a
+// file for later replay.
+// Usage: treadmill_record <port> <events per second> <recording>
+#include <treadmill_stream.h>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+
+namespace
+{
+volatile std::sig_atomic_t stop = 0;
+void handle_sigint(int) {stop = 1;}
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 4)
+    {
+        fprintf(stderr, "Usage: %s <port> <events per second> <recording>\n",
+                argv[0]);
+        return 1;
+    }
+    const uint16_t frequency_hz = uint16_t(atoi(argv[2]));
+    TreadmillDevice device;
+    if (!device.open(argv[1]))
+    {
+        perror("Could not open port");
+        return 1;
+    }
+    if (!device.record(argv[3]))
+    {
+        perror("Could not create recording");
+        return 1;
+    }
+    std::signal(SIGINT, handle_sigint);
+    device.set_sensor_dispatch_frequency_hz(frequency_hz);
+    EventColumns& sensor_data = device.stream().sensor_data();
+    auto last_report = std::chrono::steady_clock::now();
+    uint64_t num_events = 0;
+    while (!stop)
+    {
+        if (device.poll(100) < 0)
+        {
+            perror("Read failed");
+            break;
+        }
+        // Print once a second. Everything else is consumed unseen.
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_report < std::chrono::seconds(1))
+            continue;
+        last_report = now;
+        num_events = sensor_data.size();
+        if (num_events > 0)
+        {
+            const size_t last = num_events - 1;
+            printf("%llu events/s. Latest: t=%.6f[s] encoder=%d torque=%d "
+                   "current=%d\n", (unsigned long long)num_events,
+                   sensor_data.harp_time_us(last) * 1e-6,
+                   sensor_data.field(TreadmillStream::ENCODER, last),
+                   sensor_data.field(TreadmillStream::TORQUE, last),
+                   sensor_data.field(TreadmillStream::BRAKE_CURRENT, last));
+        }
+        for (size_t i = 0; i < device.stream().torque_limit_events().size(); ++i)
+            printf("Torque limit triggered at t=%.6f[s]\n",
+                   device.stream().torque_limit_events().harp_time_us(i) * 1e-6);
+        device.stream().torque_limit_events().discard(SIZE_MAX);
+        sensor_data.discard(num_events);
+    }
+    device.set_sensor_dispatch_frequency_hz(0);
+    device.close();
+    return 0;
+}
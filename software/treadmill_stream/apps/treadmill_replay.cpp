@@ -0,0 +1,36 @@
+// Decode a recording made with treadmill_record and print its SensorData
+// events as CSV.
+// Usage: treadmill_replay <recording>
+#include <treadmill_stream.h>
+#include <cstdio>
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <recording>\n", argv[0]);
+        return 1;
+    }
+    // Hold the whole recording, up to 2^24 events.
+    TreadmillStream stream(1 << 24);
+    if (!stream.replay(argv[1]))
+    {
+        fprintf(stderr, "Could not read recording %s\n", argv[1]);
+        return 1;
+    }
+    const EventColumns& sensor_data = stream.sensor_data();
+    printf("harp_time_s,encoder,torque,brake_current\n");
+    for (size_t i = 0; i < sensor_data.size(); ++i)
+        printf("%.6f,%d,%d,%d\n", sensor_data.harp_time_us(i) * 1e-6,
+               sensor_data.field(TreadmillStream::ENCODER, i),
+               sensor_data.field(TreadmillStream::TORQUE, i),
+               sensor_data.field(TreadmillStream::BRAKE_CURRENT, i));
+    fprintf(stderr, "%llu frames. %zu SensorData events (%llu overwritten). "
+            "%zu torque limit events. %llu bytes skipped.\n",
+            (unsigned long long)stream.parser().frame_count(),
+            sensor_data.size(),
+            (unsigned long long)sensor_data.overwritten(),
+            stream.torque_limit_events().size(),
+            (unsigned long long)stream.parser().skipped_bytes());
+    return 0;
+}
@@ -0,0 +1,191 @@
+// Throughput benchmark of the streaming reader against a stand-in device on
+// a pseudo-terminal, so that it runs without hardware.
+// The stand-in writes SensorData events (with a torque limit event and a
+// corrupted byte mixed in now and then) as fast as the pseudo-terminal takes
+// them. The reader decodes them, recording the stream, and checks that no
+// event was lost. The recording is then replayed and compared, which also
+// times decoding without the pseudo-terminal.
+// Usage: treadmill_stream_bench [seconds]
+#include <treadmill_stream.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+using clock_type = std::chrono::steady_clock;
+
+constexpr size_t EVENTS_PER_BLOCK = 1000;
+constexpr size_t TORQUE_LIMIT_EVENT_INTERVAL = 250;
+constexpr size_t CORRUPT_BYTE_INTERVAL = 100;
+constexpr const char* RECORDING_PATH = "treadmill_stream_bench.bin";
+
+/**
+ * \brief a block of the stand-in device's output. The encoder counts up by
+ *  one per SensorData event, starting at first_event.
+ */
+std::vector<uint8_t> make_block(uint32_t first_event)
+{
+    std::vector<uint8_t> block;
+    uint8_t frame[HARP_MAX_FRAME_BYTES];
+    for (uint32_t i = 0; i < EVENTS_PER_BLOCK; ++i)
+    {
+        const uint32_t event = first_event + i;
+        const int64_t harp_time_us = int64_t(event) * 1000; // 1[kHz].
+        const int32_t values[3] = {int32_t(event), int32_t(event % 4096) - 2048,
+                                   int32_t(event % 1000)};
+        size_t size = encode_harp_frame(frame, HARP_EVENT, SENSOR_DATA_ADDRESS,
+                                        HARP_S32, values, sizeof(values),
+                                        harp_time_us);
+        block.insert(block.end(), frame, frame + size);
+        if (event % TORQUE_LIMIT_EVENT_INTERVAL == 0)
+        {
+            const uint8_t triggered = 1;
+            size = encode_harp_frame(frame, HARP_EVENT,
+                                     TORQUE_LIMIT_TRIGGERED_ADDRESS, HARP_U8,
+                                     &triggered, 1, harp_time_us);
+            block.insert(block.end(), frame, frame + size);
+        }
+        if (event % CORRUPT_BYTE_INTERVAL == 0)
+            block.push_back(HARP_EVENT); // A plausible frame start.
+    }
+    return block;
+}
+
+int open_stand_in(std::string& port)
+{
+    const int fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0)
+        return -1;
+    port = ptsname(fd);
+    return fd;
+}
+
+/**
+ * \brief check that events count up by one with no gaps, then drop them.
+ * \returns the number of events checked.
+ */
+size_t consume(EventColumns& sensor_data, uint32_t& next_event, bool& ok)
+{
+    const size_t count = sensor_data.size();
+    size_t index = 0;
+    // In at most two contiguous runs.
+    while (index < count)
+    {
+        const size_t run = sensor_data.contiguous(index);
+        const int32_t* encoder = sensor_data.field_column(
+            TreadmillStream::ENCODER, index);
+        for (size_t i = 0; i < run; ++i)
+            ok &= (uint32_t(encoder[i]) == next_event++);
+        index += run;
+    }
+    sensor_data.discard(count);
+    return count;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    const double seconds = (argc > 1) ? atof(argv[1]) : 2.0;
+    std::string port;
+    const int stand_in_fd = open_stand_in(port);
+    if (stand_in_fd < 0)
+    {
+        perror("Could not open a pseudo-terminal");
+        return 1;
+    }
+    TreadmillDevice device;
+    if (!device.open(port) || !device.record(RECORDING_PATH))
+    {
+        perror("Could not open the stand-in device");
+        return 1;
+    }
+
+    // Stand-in device. Stops at a block boundary so every event is whole.
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> events_written{0};
+    std::thread stand_in([&]()
+    {
+        uint32_t first_event = 0;
+        while (!stop)
+        {
+            const std::vector<uint8_t> block = make_block(first_event);
+            size_t offset = 0;
+            while (offset < block.size())
+            {
+                const ssize_t written = write(stand_in_fd, &block[offset],
+                                              block.size() - offset);
+                if (written > 0)
+                    offset += size_t(written);
+            }
+            first_event += EVENTS_PER_BLOCK;
+            events_written = first_event;
+        }
+    });
+
+    // Reader.
+    uint32_t next_event = 0;
+    bool ok = true;
+    uint64_t events_read = 0;
+    const auto start = clock_type::now();
+    const auto end = start + std::chrono::duration<double>(seconds);
+    while (clock_type::now() < end)
+    {
+        device.poll(10);
+        events_read += consume(device.stream().sensor_data(), next_event, ok);
+    }
+    stop = true;
+    // Drain what the stand-in wrote before it stopped.
+    while (device.poll(100) > 0)
+        events_read += consume(device.stream().sensor_data(), next_event, ok);
+    const double elapsed_s = std::chrono::duration<double>(
+        clock_type::now() - start).count();
+    stand_in.join();
+    const uint64_t expected_events = events_written;
+    // They're never consumed, so count the ones overwritten too.
+    const uint64_t torque_limit_events =
+        device.stream().torque_limit_events().size()
+        + device.stream().torque_limit_events().overwritten();
+    const uint64_t skipped_bytes = device.stream().parser().skipped_bytes();
+    device.close();
+    close(stand_in_fd);
+    ok &= (events_read == expected_events);
+    ok &= (torque_limit_events
+           == (expected_events + TORQUE_LIMIT_EVENT_INTERVAL - 1)
+              / TORQUE_LIMIT_EVENT_INTERVAL);
+    printf("Pseudo-terminal: %llu events in %.2f[s]: %.0f events/s. "
+           "%llu torque limit events. %llu corrupt bytes skipped. %s\n",
+           (unsigned long long)events_read, elapsed_s,
+           events_read / elapsed_s, (unsigned long long)torque_limit_events,
+           (unsigned long long)skipped_bytes, ok ? "OK" : "FAILED");
+
+    // Replay the recording.
+    TreadmillStream replayed(1 << 24);
+    const auto replay_start = clock_type::now();
+    if (!replayed.replay(RECORDING_PATH))
+    {
+        fprintf(stderr, "Could not replay %s\n", RECORDING_PATH);
+        return 1;
+    }
+    const double replay_s = std::chrono::duration<double>(
+        clock_type::now() - replay_start).count();
+    uint32_t next_replayed = 0;
+    bool replay_ok = true;
+    const uint64_t events_replayed = consume(replayed.sensor_data(),
+                                             next_replayed, replay_ok);
+    replay_ok &= (events_replayed == events_read)
+                 && (replayed.torque_limit_events().size()
+                     + replayed.torque_limit_events().overwritten()
+                     == torque_limit_events)
+                 && (replayed.parser().skipped_bytes() == skipped_bytes);
+    printf("Replay: %llu events in %.3f[s]: %.0f events/s. %s\n",
+           (unsigned long long)events_replayed, replay_s,
+           events_replayed / replay_s, replay_ok ? "OK" : "FAILED");
+    unlink(RECORDING_PATH);
+    return (ok && replay_ok) ? 0 : 1;
+}
@@ -0,0 +1,434 @@
+// Emulate loads with the firmware's virtual load mode on a simulated
+// treadmill, check that the belt moves as if the load were physical, and
+// measure what a control tick costs.
+// The whole firmware runs on the simulated device of firmware_sim. The belt
+// is a mass pushed by a subject and resisted by its own bearing friction and
+// by a magnetic particle brake, whose force is proportional to the current in
+// its coil. The coil is a series RL load behind the brake DAC, as in
+// brake_current_sim. Emulated damping, Coulomb friction and added inertia,
+// set in VirtualLoadParams, are converted to the forces they stand for and
+// checked against the belt's steady speed and acceleration. The stability of
+// added inertia, which closes a loop through the acceleration estimate, is
+// swept up to many times the belt's own mass.
+// Usage: virtual_load_sim
+#include <firmware_sim.h>
+#include <harp_frame.h>
+#include <virtual_load.h>
+#include <brake_current_controller.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+// Same as the firmware.
+constexpr uint8_t BRAKE_CURRENT_CONTROL_ADDRESS = 47;
+constexpr uint8_t VIRTUAL_LOAD_PARAMS_ADDRESS = 71;
+constexpr uint8_t VIRTUAL_LOAD_ADDRESS = 72;
+constexpr double BRAKE_CURRENT_ADC_FULL_SCALE_COUNTS = 4096;
+constexpr double BRAKE_CURRENT_ADC_FULL_SCALE_A = 0.20625;
+constexpr uint32_t CONTROL_FREQUENCY_HZ = 5000;
+constexpr uint16_t KP_Q8 = 16 << 8;
+constexpr uint16_t KI_Q8 = 1 << 8;
+
+// Treadmill. An 8192 count/rev encoder on a 5 [cm] roller, and a brake that
+// resists with 200 [N] per [A] at the belt, i.e: 40 [N] at full scale.
+constexpr double BELT_MASS_KG = 20;
+constexpr double BEARING_DAMPING_N_PER_M_S = 0.5;
+constexpr double COUNTS_PER_M = 8192 / (2 * M_PI * 0.05);
+constexpr double BRAKE_N_PER_A = 200;
+constexpr double TORQUE_COUNTS_PER_N = 10;
+
+// Brake coil and drive, as in brake_current_sim.
+constexpr double SUPPLY_V = 12.0;
+constexpr double COIL_R_OHM = 60.0;
+constexpr double COIL_L_H = 0.3;
+
+// Belt force [N] per virtual load microamp.
+constexpr double N_PER_UA = BRAKE_N_PER_A * 1e-6;
+
+// Pass criteria.
+constexpr double MAX_STEADY_SPEED_ERROR_PERCENT = 3;
+constexpr double MAX_ACCELERATION_ERROR_PERCENT = 10;
+// Brake force while coasting after a push, from acceleration noise, as a
+// fraction of the push.
+constexpr double MAX_COASTING_FORCE_FRACTION = 0.05;
+// Peak-to-peak brake current while pushed steadily, beyond which added
+// inertia is unstable.
+constexpr double MAX_STABLE_RIPPLE_A = 0.01;
+
+double read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return double(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief belt pushed by a subject and held back by the brake, integrated
+ *  every [us] up to the time that the device samples it.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    Treadmill()
+    : time_us_{0}, position_m_{0}, velocity_m_s_{0}, coil_a_{0}, push_n_{0},
+      dac_code_{0}, coil_decay_{exp(-1e-6 * COIL_R_OHM / COIL_L_H)}
+    {}
+
+    void push(double force_n) {push_n_ = force_n;}
+
+/**
+ * \brief bring the belt to rest where it is, e.g: held by the subject.
+ */
+    void stop_belt() {velocity_m_s_ = 0;}
+
+    double velocity_m_s() const {return velocity_m_s_;}
+    double brake_current_a() const {return coil_a_;}
+    double brake_force_n() const {return BRAKE_N_PER_A * coil_a_;}
+
+    int32_t encoder_counts(uint32_t index, uint64_t time_us) override
+    {return int32_t(floor(encoder_position(index, time_us)));}
+
+    double encoder_position(uint32_t index, uint64_t time_us) override
+    {
+        advance(time_us);
+        return (index > 0) ? 0 : position_m_ * COUNTS_PER_M;
+    }
+
+    uint16_t torque_counts(uint64_t time_us) override
+    {
+        advance(time_us);
+        return uint16_t(2048 + lround(brake_force_n() * TORQUE_COUNTS_PER_N));
+    }
+
+    uint16_t brake_current_counts(uint64_t time_us,
+                                  uint16_t brake_dac_code) override
+    {
+        advance(time_us);
+        dac_code_ = brake_dac_code;
+        return uint16_t(fmin(fmax(lround(coil_a_
+                                         / BRAKE_CURRENT_ADC_FULL_SCALE_A
+                                         * BRAKE_CURRENT_ADC_FULL_SCALE_COUNTS),
+                                  0),
+                             BRAKE_CURRENT_ADC_FULL_SCALE_COUNTS - 1));
+    }
+
+private:
+    void advance(uint64_t time_us)
+    {
+        const double dt = 1e-6;
+        for (; time_us_ < time_us; ++time_us_)
+        {
+            const double target_a = SUPPLY_V * dac_code_ / 65535.0 / COIL_R_OHM;
+            coil_a_ = target_a + (coil_a_ - target_a) * coil_decay_;
+            const double brake_n = brake_force_n();
+            if (velocity_m_s_ == 0)
+            {
+                // The brake holds the belt until the push overcomes it.
+                if (fabs(push_n_) <= brake_n)
+                    continue;
+                const double net_n = push_n_ - copysign(brake_n, push_n_);
+                velocity_m_s_ = net_n / BELT_MASS_KG * dt;
+            }
+            else
+            {
+                const double net_n = push_n_
+                                     - copysign(brake_n, velocity_m_s_)
+                                     - BEARING_DAMPING_N_PER_M_S * velocity_m_s_;
+                const double velocity = velocity_m_s_
+                                        + net_n / BELT_MASS_KG * dt;
+                // Resistance stops the belt rather than reversing it.
+                velocity_m_s_ = (velocity * velocity_m_s_ < 0) ? 0 : velocity;
+            }
+            position_m_ += velocity_m_s_ * dt;
+        }
+    }
+
+    uint64_t time_us_;
+    double position_m_;
+    double velocity_m_s_;
+    double coil_a_;
+    double push_n_;
+    uint16_t dac_code_;
+    const double coil_decay_;
+};
+
+/**
+ * \brief virtual load parameters, as written to VirtualLoadParams.
+ */
+struct load_t
+{
+    uint32_t damping_q8;  // [uA / (counts/s)]
+    uint32_t friction_ua;
+    uint32_t inertia_q8;  // [uA / (counts/s^2)]
+    uint32_t deadband_cps;
+};
+
+/**
+ * \brief parameters that emulate the specified physical load on the belt.
+ */
+load_t emulate(double damping_n_per_m_s, double friction_n, double mass_kg,
+               double deadband_m_s)
+{
+    const double q8 = 1 << VirtualLoad::FRACTIONAL_BITS;
+    return {uint32_t(lround(damping_n_per_m_s / N_PER_UA / COUNTS_PER_M * q8)),
+            uint32_t(lround(friction_n / N_PER_UA)),
+            uint32_t(lround(mass_kg / N_PER_UA / COUNTS_PER_M * q8)),
+            uint32_t(lround(deadband_m_s * COUNTS_PER_M))};
+}
+
+void set_load(const load_t& load)
+{
+    sim_write_register(VIRTUAL_LOAD_PARAMS_ADDRESS, HARP_U32, &load,
+                       sizeof(load));
+    sim_run_us(1000);
+}
+
+struct belt_sample_t
+{
+    double time_s;
+    double velocity_m_s;
+    double brake_current_a;
+};
+
+/**
+ * \brief run the device, sampling the belt every [ms].
+ */
+std::vector<belt_sample_t> run(Treadmill& treadmill, double duration_s)
+{
+    std::vector<belt_sample_t> samples;
+    const size_t count = size_t(duration_s * 1000);
+    for (size_t i = 0; i < count; ++i)
+    {
+        sim_run_us(1000);
+        samples.push_back({sim_time_us() * 1e-6, treadmill.velocity_m_s(),
+                           treadmill.brake_current_a()});
+    }
+    return samples;
+}
+
+/**
+ * \brief mean of velocity over [from_s, to_s) since the first sample.
+ */
+double mean_velocity(const std::vector<belt_sample_t>& samples, double from_s,
+                     double to_s)
+{
+    const double origin_s = samples.front().time_s;
+    double sum = 0;
+    size_t count = 0;
+    for (const belt_sample_t& sample: samples)
+    {
+        const double t = sample.time_s - origin_s;
+        if (t < from_s || t >= to_s)
+            continue;
+        sum += sample.velocity_m_s;
+        ++count;
+    }
+    return count ? sum / count : 0;
+}
+
+/**
+ * \brief least-squares slope of velocity over [from_s, to_s).
+ */
+double acceleration(const std::vector<belt_sample_t>& samples, double from_s,
+                    double to_s)
+{
+    const double origin_s = samples.front().time_s;
+    double n = 0, st = 0, sv = 0, stt = 0, stv = 0;
+    for (const belt_sample_t& sample: samples)
+    {
+        const double t = sample.time_s - origin_s;
+        if (t < from_s || t >= to_s)
+            continue;
+        n += 1;
+        st += t;
+        sv += sample.velocity_m_s;
+        stt += t * t;
+        stv += t * sample.velocity_m_s;
+    }
+    return (n * stv - st * sv) / (n * stt - st * st);
+}
+
+double percent_error(double value, double expected)
+{
+    return 100 * fabs(value - expected) / fabs(expected);
+}
+
+bool check_damping(Treadmill& treadmill)
+{
+    // Settles with a 0.5 [s] time constant.
+    const double damping = 40;
+    const double push_n = 20;
+    set_load(emulate(damping, 0, 0, 0));
+    treadmill.push(push_n);
+    const std::vector<belt_sample_t> samples = run(treadmill, 4);
+    treadmill.push(0);
+    const double speed = mean_velocity(samples, 3.5, 4);
+    const double expected = push_n / (damping + BEARING_DAMPING_N_PER_M_S);
+    const double error = percent_error(speed, expected);
+    printf("Damping %.0f [N/(m/s)] pushed at %.0f [N]: %.4f vs %.4f [m/s] "
+           "(%.2f%%).\n", damping, push_n, speed, expected, error);
+    return check("Virtual damping sets the steady belt speed",
+                 error <= MAX_STEADY_SPEED_ERROR_PERCENT);
+}
+
+bool check_friction(Treadmill& treadmill)
+{
+    const double friction_n = 10;
+    const double deadband_m_s = 0.01;
+    set_load(emulate(0, friction_n, 0, deadband_m_s));
+    treadmill.stop_belt();
+    // Pushed more lightly than the friction, the belt only creeps around the
+    // deadband, where friction turns on and off.
+    treadmill.push(0.8 * friction_n);
+    const std::vector<belt_sample_t> held = run(treadmill, 1);
+    const double creep = mean_velocity(held, 0.5, 1);
+    // Pushed harder, it accelerates under the difference.
+    const double push_n = 25;
+    treadmill.push(push_n);
+    const std::vector<belt_sample_t> samples = run(treadmill, 1.2);
+    treadmill.push(0);
+    const double measured = acceleration(samples, 0.2, 1.2);
+    const double expected = (push_n - friction_n - BEARING_DAMPING_N_PER_M_S
+                             * mean_velocity(samples, 0.2, 1.2))
+                            / BELT_MASS_KG;
+    const double error = percent_error(measured, expected);
+    printf("Friction %.0f [N]: creeps at %.4f [m/s] pushed at %.0f [N]. "
+           "Pushed at %.0f [N]: %.3f vs %.3f [m/s^2] (%.2f%%).\n", friction_n,
+           creep, 0.8 * friction_n, push_n, measured, expected, error);
+    return check("Virtual Coulomb friction resists a push",
+                 creep <= 2 * deadband_m_s
+                 && error <= MAX_ACCELERATION_ERROR_PERCENT);
+}
+
+bool check_inertia(Treadmill& treadmill)
+{
+    const double added_kg = BELT_MASS_KG;
+    const double push_n = 20;
+    set_load(emulate(0, 0, added_kg, 0));
+    treadmill.stop_belt();
+    treadmill.push(push_n);
+    const std::vector<belt_sample_t> samples = run(treadmill, 1.2);
+    const double measured = acceleration(samples, 0.2, 1.2);
+    const double expected = (push_n - BEARING_DAMPING_N_PER_M_S
+                             * mean_velocity(samples, 0.2, 1.2))
+                            / (BELT_MASS_KG + added_kg);
+    const double error = percent_error(measured, expected);
+    // Released, the belt coasts: added inertia cannot drive it.
+    treadmill.push(0);
+    const std::vector<belt_sample_t> coasting = run(treadmill, 0.5);
+    double max_coasting_n = 0;
+    for (size_t i = 100; i < coasting.size(); ++i)
+        max_coasting_n = fmax(max_coasting_n,
+                              BRAKE_N_PER_A * coasting[i].brake_current_a);
+    printf("Added inertia %.0f [kg] on a %.0f [kg] belt pushed at %.0f [N]: "
+           "%.3f vs %.3f [m/s^2] (%.2f%%). Brake force while coasting: at "
+           "most %.2f [N].\n", added_kg, BELT_MASS_KG, push_n, measured,
+           expected, error, max_coasting_n);
+    return check("Virtual inertia slows acceleration, and only resists",
+                 error <= MAX_ACCELERATION_ERROR_PERCENT
+                 && max_coasting_n <= MAX_COASTING_FORCE_FRACTION * push_n);
+}
+
+bool check_inertia_stability(Treadmill& treadmill)
+{
+    printf("Added inertia stability, pushed at 10 [N]:\n");
+    bool nominal_stable = true;
+    for (const double ratio: {0.5, 1.0, 2.0, 4.0, 8.0, 16.0})
+    {
+        set_load(emulate(0, 0, ratio * BELT_MASS_KG, 0));
+        treadmill.stop_belt();
+        treadmill.push(10);
+        const std::vector<belt_sample_t> samples = run(treadmill, 1);
+        double low_a = INFINITY, high_a = 0;
+        for (size_t i = samples.size() / 2; i < samples.size(); ++i)
+        {
+            low_a = fmin(low_a, samples[i].brake_current_a);
+            high_a = fmax(high_a, samples[i].brake_current_a);
+        }
+        const double expected = 10 / ((1 + ratio) * BELT_MASS_KG);
+        const double measured = acceleration(samples, 0.5, 1);
+        const bool stable = high_a - low_a <= MAX_STABLE_RIPPLE_A;
+        printf("  %4.1f x belt mass: %.4f vs %.4f [m/s^2], brake current "
+               "ripple %.2f [mA] peak-to-peak. %s\n", ratio, measured,
+               expected, (high_a - low_a) * 1000,
+               stable ? "Stable" : "Unstable");
+        if (ratio <= 1)
+            nominal_stable &= stable;
+    }
+    treadmill.push(0);
+    return check("Added inertia up to the belt's own mass is stable",
+                 nominal_stable);
+}
+
+void measure_tick_cost()
+{
+    // What the core1 loop does for the virtual load each control tick, on
+    // this machine.
+    VirtualLoad load;
+    const load_t params = emulate(40, 10, BELT_MASS_KG, 0.01);
+    load.set_damping(params.damping_q8);
+    load.set_friction(params.friction_ua);
+    load.set_inertia(params.inertia_q8);
+    load.set_friction_deadband(params.deadband_cps);
+    load.set_max_output(206'250);
+    BrakeCurrentController controller;
+    controller.set_gains(KP_Q8, KI_Q8);
+    constexpr size_t NUM_TICKS = 10'000'000;
+    volatile uint32_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    const double start_cycles = read_cycles();
+    for (size_t n = 0; n < NUM_TICKS; ++n)
+    {
+        const int32_t velocity_q8 = int32_t((n & 0xFFFF) << 8) - (1 << 23);
+        const int32_t acceleration_q8 = int32_t((n * 7919) & 0xFFFFF) << 4;
+        controller.set_setpoint(int32_t(load.update(velocity_q8,
+                                                    acceleration_q8) >> 6));
+        sink = sink + controller.update(int32_t(n & 0xFFF));
+    }
+    const double cycles = read_cycles() - start_cycles;
+    const double ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count();
+    (void)sink;
+    printf("Virtual load and current control tick: %.2f [ns], %.1f [cycles] "
+           "on this machine.\n", ns / NUM_TICKS, cycles / NUM_TICKS);
+}
+}
+
+int main()
+{
+    Treadmill treadmill;
+    sim_boot(treadmill);
+    sim_run_us(10'000);
+    const uint8_t enable = 1;
+    sim_write_register(BRAKE_CURRENT_CONTROL_ADDRESS, HARP_U8, &enable, 1);
+    sim_run_us(1000);
+    sim_write_register(VIRTUAL_LOAD_ADDRESS, HARP_U8, &enable, 1);
+    sim_run_us(1000);
+    const sim_cost_t core1_start = sim_core1_loop_cost();
+    bool ok = check_damping(treadmill);
+    ok &= check_friction(treadmill);
+    ok &= check_inertia(treadmill);
+    ok &= check_inertia_stability(treadmill);
+    const sim_cost_t& core1_end = sim_core1_loop_cost();
+    printf("Simulated core1 loop turn with the virtual load: %.1f [ns] per "
+           "turn on this machine.\n", (core1_end.total_ns - core1_start.total_ns)
+                                      / double(core1_end.calls
+                                               - core1_start.calls));
+    measure_tick_cost();
+    sim_take_usb_output();
+    return ok ? 0 : 1;
+}
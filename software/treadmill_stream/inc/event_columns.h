@@ -0,0 +1,96 @@
+#ifndef EVENT_COLUMNS_H
+#define EVENT_COLUMNS_H
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+/**
+ * \brief Columnar ring buffer of timestamped events, e.g: sensor samples.
+ * \details Each field is stored in its own contiguous column so that a
+ *  consumer can hand whole columns to numeric code without unpacking
+ *  records. When full, the oldest events are overwritten and counted.
+ *  Events are indexed from the oldest one still held. contiguous() gives
+ *  the longest run starting at an index that doesn't wrap, so a consumer
+ *  can read everything in at most two runs.
+ * \note Not thread-safe. Fill and drain from one thread.
+ */
+class EventColumns
+{
+public:
+    static constexpr size_t MAX_FIELDS = 8;
+
+/**
+ * \param capacity rounded up to a power of two.
+ */
+    explicit EventColumns(size_t capacity);
+    ~EventColumns();
+
+    size_t capacity() const {return mask_ + 1;}
+    size_t size() const {return size_t(head_ - tail_);}
+    bool empty() const {return head_ == tail_;}
+
+/**
+ * \brief add one event, overwriting the oldest one if full.
+ * \param values num_fields fields. Fields beyond MAX_FIELDS are dropped;
+ *  missing ones are stored as 0.
+ */
+    inline void push(uint64_t harp_time_us, const int32_t* values,
+                     size_t num_fields)
+    {
+        if (size() == capacity())
+        {
+            ++tail_;
+            ++overwritten_;
+        }
+        const size_t slot = size_t(head_) & mask_;
+        time_us_[slot] = harp_time_us;
+        for (size_t f = 0; f < MAX_FIELDS; ++f)
+            fields_[f][slot] = (f < num_fields) ? values[f] : 0;
+        num_fields_ = num_fields < MAX_FIELDS ? num_fields : MAX_FIELDS;
+        ++head_;
+    }
+
+    uint64_t harp_time_us(size_t index) const
+    {return time_us_[slot(index)];}
+    int32_t field(size_t field, size_t index) const
+    {return fields_[field][slot(index)];}
+
+/**
+ * \brief number of fields in the most recent event.
+ */
+    size_t num_fields() const {return num_fields_;}
+
+/**
+ * \brief pointers to the column entries of the event at index, and the
+ *  number of events from there on that are contiguous in memory.
+ */
+    size_t contiguous(size_t index) const;
+    const uint64_t* harp_time_us_column(size_t index) const
+    {return &time_us_[slot(index)];}
+    const int32_t* field_column(size_t field, size_t index) const
+    {return &fields_[field][slot(index)];}
+
+/**
+ * \brief drop the oldest count events, e.g: once they've been consumed.
+ */
+    void discard(size_t count);
+
+    void clear();
+
+/**
+ * \brief events overwritten before they were discarded.
+ */
+    uint64_t overwritten() const {return overwritten_;}
+
+private:
+    size_t slot(size_t index) const {return size_t(tail_ + index) & mask_;}
+
+    size_t mask_;
+    uint64_t head_; // Events ever pushed.
+    uint64_t tail_; // Index (in pushes) of the oldest event held.
+    uint64_t overwritten_;
+    size_t num_fields_;
+    std::vector<uint64_t> time_us_;
+    std::vector<int32_t> fields_[MAX_FIELDS];
+};
+#endif // EVENT_COLUMNS_H
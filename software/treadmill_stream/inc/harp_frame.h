@@ -0,0 +1,217 @@
+#ifndef HARP_FRAME_H
+#define HARP_FRAME_H
+#include <stdint.h>
+#include <stddef.h>
+#include <cstring>
+
+// Harp message types.
+enum harp_msg_type_t : uint8_t
+{
+    HARP_READ = 1,
+    HARP_WRITE = 2,
+    HARP_EVENT = 3,
+    HARP_READ_ERROR = 9,
+    HARP_WRITE_ERROR = 10,
+};
+
+// Harp payload types. The low nibble is the element size in bytes.
+enum harp_payload_type_t : uint8_t
+{
+    HARP_U8 = 0x01,
+    HARP_S8 = 0x81,
+    HARP_U16 = 0x02,
+    HARP_S16 = 0x82,
+    HARP_U32 = 0x04,
+    HARP_S32 = 0x84,
+    HARP_U64 = 0x08,
+    HARP_S64 = 0x88,
+    HARP_FLOAT = 0x44,
+};
+
+static constexpr uint8_t HARP_TIMESTAMP_FLAG = 0x10; // in the payload type.
+// [type, length, address, port, payload type] [seconds (U32), 32[us] ticks
+// (U16)] payload [checksum]. Length counts everything after itself.
+static constexpr size_t HARP_HEADER_BYTES = 5;
+static constexpr size_t HARP_TIMESTAMP_BYTES = 6;
+static constexpr size_t HARP_MAX_FRAME_BYTES = 2 + 255;
+static constexpr uint8_t HARP_DEFAULT_PORT = 255;
+
+/**
+ * \brief A decoded Harp frame. The payload points into the buffer that the
+ *  frame was parsed from and is only valid until the parser is fed again.
+ */
+struct harp_frame_t
+{
+    uint8_t message_type; // harp_msg_type_t.
+    uint8_t address;
+    uint8_t port;
+    uint8_t payload_type; // harp_payload_type_t, without the timestamp flag.
+    bool has_timestamp;
+    uint64_t harp_time_us;
+    const uint8_t* payload;
+    uint8_t payload_length; // bytes.
+
+    size_t num_elements() const
+    {return payload_length / (payload_type & 0x0F);}
+
+/**
+ * \brief payload element at index. Harp is little-endian, as are the hosts
+ *  that this builds for.
+ */
+    template <typename T>
+    T element(size_t index) const
+    {
+        T value;
+        memcpy(&value, payload + index * sizeof(T), sizeof(T));
+        return value;
+    }
+};
+
+/**
+ * \brief encode a Harp frame into out.
+ * \param harp_time_us timestamp to include. Pass a negative value for none,
+ *  e.g: for messages to the device.
+ * \returns the frame size in bytes, or 0 if the payload is too long.
+ */
+size_t encode_harp_frame(uint8_t* out, uint8_t message_type, uint8_t address,
+                         uint8_t payload_type, const void* payload,
+                         uint8_t payload_length, int64_t harp_time_us = -1);
+
+/**
+ * \brief Incremental Harp frame parser for a byte stream, e.g: a serial port.
+ * \details Frames that are wholly inside a buffer passed to parse() are
+ *  decoded in place. Only a frame that straddles two buffers is copied, into
+ *  a small internal buffer, so that throughput doesn't depend on how the
+ *  stream is chunked. Bytes that don't start a frame with a valid checksum
+ *  are skipped one at a time until the parser is back in sync.
+ */
+class HarpFrameParser
+{
+public:
+    HarpFrameParser();
+    ~HarpFrameParser();
+
+/**
+ * \brief discard any partial frame and clear statistics.
+ */
+    void reset();
+
+/**
+ * \brief parse the next num_bytes bytes of the stream.
+ * \param on_frame called with each complete frame, as
+ *  on_frame(const harp_frame_t&).
+ */
+    template <typename F>
+    void parse(const uint8_t* data, size_t num_bytes, F&& on_frame)
+    {
+        size_t i = finish_partial(data, num_bytes, on_frame);
+        harp_frame_t frame;
+        while (i < num_bytes)
+        {
+            const size_t remaining = num_bytes - i;
+            if (!is_frame_start(&data[i], remaining))
+            {
+                skip(1);
+                ++i;
+                continue;
+            }
+            if (remaining < 2 || remaining < frame_size(data[i + 1]))
+            {
+                // Finish it on the next call.
+                memcpy(partial_, &data[i], remaining);
+                partial_size_ = remaining;
+                return;
+            }
+            const size_t size = frame_size(data[i + 1]);
+            if (!decode(&data[i], size, frame))
+            {
+                skip(1);
+                ++i;
+                continue;
+            }
+            ++frame_count_;
+            on_frame(frame);
+            i += size;
+        }
+    }
+
+    uint64_t frame_count() const {return frame_count_;}
+    uint64_t skipped_bytes() const {return skipped_bytes_;}
+
+/**
+ * \brief validate and decode one whole frame.
+ * \returns false if the frame is malformed or its checksum is wrong.
+ */
+    static bool decode(const uint8_t* bytes, size_t size, harp_frame_t& frame);
+
+private:
+    static size_t frame_size(uint8_t length) {return size_t(length) + 2;}
+
+    static bool is_frame_start(const uint8_t* bytes, size_t available)
+    {
+        const uint8_t type = bytes[0] & ~0x08; // Error types set bit 3.
+        if (type < HARP_READ || type > HARP_EVENT)
+            return false;
+        // Address, port, payload type, and checksum at minimum.
+        return available < 2 || bytes[1] >= 4;
+    }
+
+    void skip(size_t num_bytes) {skipped_bytes_ += num_bytes;}
+
+/**
+ * \brief complete a frame that straddles the previous buffer, and any
+ *  frames left behind in the partial buffer while resyncing.
+ * \returns the number of bytes of data consumed.
+ */
+    template <typename F>
+    size_t finish_partial(const uint8_t* data, size_t num_bytes, F& on_frame)
+    {
+        size_t i = 0;
+        harp_frame_t frame;
+        while (partial_size_ > 0)
+        {
+            if (!is_frame_start(partial_, partial_size_))
+            {
+                drop_partial_byte();
+                continue;
+            }
+            const size_t size = (partial_size_ < 2) ? 2
+                                                    : frame_size(partial_[1]);
+            if (partial_size_ < size)
+            {
+                if (i == num_bytes)
+                    break;
+                size_t take = size - partial_size_;
+                if (take > num_bytes - i)
+                    take = num_bytes - i;
+                memcpy(&partial_[partial_size_], &data[i], take);
+                partial_size_ += take;
+                i += take;
+                continue;
+            }
+            if (!decode(partial_, size, frame))
+            {
+                drop_partial_byte();
+                continue;
+            }
+            ++frame_count_;
+            on_frame(frame);
+            partial_size_ -= size;
+            memmove(partial_, &partial_[size], partial_size_);
+        }
+        return i;
+    }
+
+    void drop_partial_byte()
+    {
+        skip(1);
+        --partial_size_;
+        memmove(partial_, &partial_[1], partial_size_);
+    }
+
+    uint8_t partial_[HARP_MAX_FRAME_BYTES];
+    size_t partial_size_;
+    uint64_t frame_count_;
+    uint64_t skipped_bytes_;
+};
+#endif // HARP_FRAME_H
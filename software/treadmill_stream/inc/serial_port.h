@@ -0,0 +1,44 @@
+#ifndef SERIAL_PORT_H
+#define SERIAL_PORT_H
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+/**
+ * \brief Raw (non-canonical, 8N1) POSIX serial port, e.g: the device's USB
+ *  CDC port or a pseudo-terminal.
+ * \details The baud rate is irrelevant for USB CDC, so it isn't set.
+ */
+class SerialPort
+{
+public:
+    SerialPort();
+    ~SerialPort();
+
+    SerialPort(const SerialPort&) = delete;
+    SerialPort& operator=(const SerialPort&) = delete;
+
+/**
+ * \returns false (with errno set) if the port could not be opened.
+ */
+    bool open(const std::string& path);
+    void close();
+    bool is_open() const {return fd_ >= 0;}
+
+/**
+ * \brief read whatever is available, waiting up to timeout_ms for the
+ *  first byte.
+ * \returns the number of bytes read. 0 on timeout. -1 on error.
+ */
+    long read(uint8_t* dest, size_t max_bytes, int timeout_ms);
+
+/**
+ * \brief write all bytes.
+ * \returns false on error.
+ */
+    bool write(const uint8_t* data, size_t num_bytes);
+
+private:
+    int fd_;
+};
+#endif // SERIAL_PORT_H
@@ -0,0 +1,80 @@
+#ifndef STREAM_RECORDING_H
+#define STREAM_RECORDING_H
+#include <stdint.h>
+#include <stddef.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Binary recording of the raw byte stream from a device.
+ * \details Bytes are recorded exactly as they were read, so replaying a
+ *  recording through the parser reproduces every frame (and every framing
+ *  error) of the live session.
+ *  Little-endian file layout:
+ *  header: magic "TMSTREAM" (8 bytes), version (U32), reserved (U32).
+ *  chunks: host time since the recording started in ns (U64), length (U32),
+ *  then that many stream bytes.
+ */
+struct stream_recording_t
+{
+    static constexpr char MAGIC[8] = {'T', 'M', 'S', 'T', 'R', 'E', 'A', 'M'};
+    static constexpr uint32_t VERSION = 1;
+};
+
+class StreamRecorder
+{
+public:
+    StreamRecorder();
+    ~StreamRecorder();
+
+    StreamRecorder(const StreamRecorder&) = delete;
+    StreamRecorder& operator=(const StreamRecorder&) = delete;
+
+/**
+ * \brief create (or truncate) a recording and write its header.
+ * \returns false if the file could not be written.
+ */
+    bool open(const std::string& path);
+    void close();
+    bool is_open() const {return file_ != nullptr;}
+
+/**
+ * \brief append one chunk of stream bytes read at host_time_ns.
+ * \returns false if the chunk could not be written.
+ */
+    bool write(uint64_t host_time_ns, const uint8_t* data, size_t num_bytes);
+
+    uint64_t bytes_recorded() const {return bytes_recorded_;}
+
+private:
+    FILE* file_;
+    uint64_t bytes_recorded_;
+};
+
+class StreamReplay
+{
+public:
+    StreamReplay();
+    ~StreamReplay();
+
+    StreamReplay(const StreamReplay&) = delete;
+    StreamReplay& operator=(const StreamReplay&) = delete;
+
+/**
+ * \returns false if the file could not be read or is not a recording.
+ */
+    bool open(const std::string& path);
+    void close();
+
+/**
+ * \brief read the next chunk. data stays valid until the next call.
+ * \returns false at the end of the recording (or if it is truncated).
+ */
+    bool next(uint64_t& host_time_ns, const uint8_t*& data, size_t& num_bytes);
+
+private:
+    FILE* file_;
+    std::vector<uint8_t> chunk_;
+};
+#endif // STREAM_RECORDING_H
@@ -0,0 +1,120 @@
+#ifndef TREADMILL_STREAM_H
+#define TREADMILL_STREAM_H
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <harp_frame.h>
+#include <event_columns.h>
+#include <serial_port.h>
+#include <stream_recording.h>
+
+// Treadmill register addresses. See device.yml.
+static constexpr uint8_t SENSOR_DATA_ADDRESS = 35;
+static constexpr uint8_t SENSOR_DISPATCH_FREQUENCY_ADDRESS = 36;
+static constexpr uint8_t TORQUE_LIMIT_TRIGGERED_ADDRESS = 41;
+
+/**
+ * \brief Decodes a treadmill's Harp byte stream into columnar buffers.
+ * \details SensorData events land in sensor_data() with fields [encoder,
+ *  torque, brake current] followed by any optional fields the device
+ *  appends. TorqueLimitTriggered events land in torque_limit_events() with
+ *  one field: the register value. Both are timestamped with Harp time. All
+ *  other frames are counted and dropped.
+ *  The stream can come from a device (TreadmillDevice) or a recording.
+ */
+class TreadmillStream
+{
+public:
+    enum sensor_field_t: uint8_t
+    {
+        ENCODER = 0,
+        TORQUE = 1,
+        BRAKE_CURRENT = 2,
+        OPTIONAL_FIELDS = 3, // First field enabled in SensorDataFields.
+    };
+
+/**
+ * \param capacity sensor samples to buffer. Rounded up to a power of two.
+ */
+    explicit TreadmillStream(size_t capacity = 1 << 16);
+    ~TreadmillStream();
+
+/**
+ * \brief parse and decode the next bytes of the stream.
+ */
+    void feed(const uint8_t* data, size_t num_bytes);
+
+/**
+ * \brief decode every chunk of a recording.
+ * \returns false if the recording could not be opened.
+ */
+    bool replay(const std::string& path);
+
+    EventColumns& sensor_data() {return sensor_data_;}
+    EventColumns& torque_limit_events() {return torque_limit_events_;}
+
+    const HarpFrameParser& parser() const {return parser_;}
+    uint64_t other_frames() const {return other_frames_;}
+
+/**
+ * \brief discard buffered events, any partial frame, and statistics.
+ */
+    void clear();
+
+private:
+    void decode(const harp_frame_t& frame);
+
+    HarpFrameParser parser_;
+    EventColumns sensor_data_;
+    EventColumns torque_limit_events_;
+    uint64_t other_frames_;
+};
+
+/**
+ * \brief A treadmill on a serial port, decoded as it streams and optionally
+ *  recorded.
+ */
+class TreadmillDevice
+{
+public:
+    explicit TreadmillDevice(size_t capacity = 1 << 16);
+    ~TreadmillDevice();
+
+/**
+ * \returns false (with errno set) if the port could not be opened.
+ */
+    bool open(const std::string& port);
+    void close();
+
+/**
+ * \brief record everything read from here on. An empty path stops.
+ * \returns false if the recording could not be created.
+ */
+    bool record(const std::string& path);
+
+/**
+ * \brief set the rate of SensorData events. 0 stops them.
+ * \returns false if the write could not be sent. The device's reply
+ *  arrives in the stream like any other frame.
+ */
+    bool set_sensor_dispatch_frequency_hz(uint16_t frequency_hz);
+
+/**
+ * \brief read and decode whatever has arrived, waiting up to timeout_ms for
+ *  it. Bytes are parsed straight out of the read buffer.
+ * \returns the number of bytes read. 0 on timeout. -1 on error.
+ */
+    long poll(int timeout_ms);
+
+    TreadmillStream& stream() {return stream_;}
+
+private:
+    static constexpr size_t READ_BUFFER_BYTES = 1 << 16;
+
+    SerialPort port_;
+    TreadmillStream stream_;
+    StreamRecorder recorder_;
+    uint64_t recording_start_ns_;
+    uint8_t read_buffer_[READ_BUFFER_BYTES];
+};
+#endif // TREADMILL_STREAM_H
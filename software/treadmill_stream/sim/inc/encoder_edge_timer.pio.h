@@ -0,0 +1,25 @@
+#ifndef SIM_ENCODER_EDGE_TIMER_PIO_H
+#define SIM_ENCODER_EDGE_TIMER_PIO_H
+// Host simulation stand-in for the header that pioasm generates from
+// encoder_edge_timer.pio. The state machine pushes a timestamp for every
+// edge of its encoder's A channel in the sensor model.
+#include <pico/stdlib.h>
+
+extern const pio_program_t encoder_edge_timer_program;
+
+// Timestamps advance once every 2 state machine clocks.
+#define ENCODER_EDGE_TIMER_CYCLES_PER_TICK (2)
+
+static inline void encoder_edge_timer_program_init(PIO pio, uint sm, uint,
+                                                   uint pin_a)
+{
+    // Only RX is used, so double its depth.
+    sim_pio_sm_load(pio, sm, SIM_PIO_ENCODER_EDGE_TIMER, pin_a, 8);
+}
+
+static inline uint32_t encoder_edge_timer_tick_hz()
+{
+    return clock_get_hz(clk_sys) / ENCODER_EDGE_TIMER_CYCLES_PER_TICK;
+}
+
+#endif // SIM_ENCODER_EDGE_TIMER_PIO_H
@@ -0,0 +1,136 @@
+#ifndef FIRMWARE_SIM_H
+#define FIRMWARE_SIM_H
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+/**
+ * \brief Host simulation of the whole treadmill firmware, i.e: main.cpp
+ *  built unchanged against stand-ins for the Pico SDK, the PIO and SPI ADC
+ *  libraries and harp.core (sim/inc).
+ * \details Time is a fake clock in [us] that only moves in sim_run_us().
+ *  Core0 and core1 are coroutines on the calling thread. Core0 runs one
+ *  HarpCApp::run() iteration per core0 loop period, and core1 runs until its
+ *  loop runs out of latched samples. Alarm callbacks run between the two, as
+ *  interrupts on core1. Neither core is preempted, so a run is deterministic,
+ *  but races between the cores and with their interrupts are not exercised.
+ *  Sensors come from a SensorModel through the PIO FIFOs, the on-chip ADC
+ *  and DMA, which streams into the firmware's rings as on the device.
+ */
+
+/**
+ * \brief What the firmware's sensors see. Each is sampled at the time of a
+ *  conversion or encoder count request.
+ */
+class SensorModel
+{
+public:
+    virtual ~SensorModel() = default;
+
+/**
+ * \brief quadrature count of encoder index. Encoder 0 is the treadmill.
+ */
+    virtual int32_t encoder_counts(uint32_t index, uint64_t time_us) = 0;
+/**
+ * \brief position of encoder index in fractional counts, so that edges can
+ *  be timed between [us] as finely as the device's edge timer does. Must
+ *  floor to encoder_counts().
+ */
+    virtual double encoder_position(uint32_t index, uint64_t time_us)
+    {return encoder_counts(index, time_us);}
+/**
+ * \brief raw 12-bit reaction torque conversion.
+ */
+    virtual uint16_t torque_counts(uint64_t time_us) = 0;
+/**
+ * \brief raw 12-bit brake current conversion.
+ * \param brake_dac_code last value written to the brake setpoint DAC.
+ */
+    virtual uint16_t brake_current_counts(uint64_t time_us,
+                                          uint16_t brake_dac_code) = 0;
+/**
+ * \brief raw 12-bit conversion of an on-chip ADC input.
+ */
+    virtual uint16_t aux_analog_counts(uint32_t input, uint64_t time_us)
+    {(void)input; (void)time_us; return 0;}
+};
+
+struct sim_config_t
+{
+    uint32_t sensor_adc_rate_hz = 100'000; // Torque and brake current each.
+    uint32_t core0_loop_period_us = 10; // Including USB servicing.
+    uint32_t usb_tx_available_bytes = 1024; // Never fills.
+    // Harp time less the system time at boot, and how far the system clock
+    // drifts from Harp time. HarpSynchronizer re-aligns the two once a
+    // second, so Harp time steps by the drift at each whole second.
+    int64_t harp_offset_us = 0;
+    int32_t harp_drift_ppm = 0;
+};
+
+/**
+ * \brief host time spent running one kind of simulated firmware code.
+ */
+struct sim_cost_t
+{
+    uint64_t calls = 0;
+    double total_ns = 0;
+    double max_ns = 0;
+    double total_cycles = 0;
+
+    double mean_ns() const {return calls ? total_ns / calls : 0;}
+    double mean_cycles() const {return calls ? total_cycles / calls : 0;}
+    void add(double ns, double cycles);
+};
+
+/**
+ * \brief run the firmware's main() until core0 first enters its loop.
+ * \details Flash starts erased, so there is no saved calibration or
+ *  configuration. Call once per process: the firmware's globals are only
+ *  constructed once.
+ */
+void sim_boot(SensorModel& model, const sim_config_t& config = sim_config_t());
+
+/**
+ * \brief advance the clock by duration_us, running everything that falls
+ *  due on the way.
+ */
+void sim_run_us(uint64_t duration_us);
+
+uint64_t sim_time_us();
+
+/**
+ * \brief queue a register write from the host. Handled in core0's next loop
+ *  iteration, and replied to in the USB output.
+ */
+void sim_write_register(uint8_t address, uint8_t payload_type,
+                        const void* payload, uint8_t num_bytes);
+void sim_read_register(uint8_t address);
+
+void sim_set_muted(bool muted);
+
+/**
+ * \brief Harp frames sent by the device since the last call.
+ */
+std::vector<uint8_t> sim_take_usb_output();
+
+/**
+ * \brief last value written to the brake setpoint DAC.
+ */
+uint16_t sim_brake_dac_code();
+
+/**
+ * \brief cost of each core0 update_app_state() call.
+ */
+const sim_cost_t& sim_update_app_state_cost();
+/**
+ * \brief cost of each turn of core1's loop, i.e: everything it does with
+ *  the samples latched since its last turn.
+ */
+const sim_cost_t& sim_core1_loop_cost();
+/**
+ * \brief cost of each callback of a hardware alarm.
+ * \param period_us mean interval between callbacks.
+ */
+const sim_cost_t& sim_alarm_cost(uint32_t alarm_num, double& period_us);
+
+#endif // FIRMWARE_SIM_H
@@ -0,0 +1,43 @@
+#ifndef SIM_HARDWARE_ADC_H
+#define SIM_HARDWARE_ADC_H
+// Host simulation stand-in for the Pico SDK's hardware/adc.h. While running,
+// the ADC converts its round-robin inputs in turn at the rate its clock
+// divider sets, taking values from the sensor model.
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#define ADC_CS_READY_BITS (1u << 8)
+
+/**
+ * \brief the ADC's result FIFO register. Reading it pops the FIFO, as on
+ *  hardware.
+ */
+struct adc_fifo_reg_t
+{
+    operator uint32_t();
+
+    uint16_t words[4];
+    uint32_t head;
+    uint32_t level;
+};
+
+struct adc_hw_t
+{
+    volatile uint32_t cs;
+    adc_fifo_reg_t fifo;
+};
+
+extern adc_hw_t* adc_hw;
+
+void adc_init();
+inline void adc_gpio_init(uint) {}
+void adc_select_input(uint input);
+void adc_set_round_robin(uint input_mask);
+inline void adc_set_temp_sensor_enabled(bool) {}
+inline void adc_fifo_setup(bool, bool, uint16_t, bool, bool) {}
+void adc_set_clkdiv(float clkdiv);
+void adc_run(bool run);
+void adc_fifo_drain();
+
+#endif // SIM_HARDWARE_ADC_H
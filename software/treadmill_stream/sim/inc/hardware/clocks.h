@@ -0,0 +1,9 @@
+#ifndef SIM_HARDWARE_CLOCKS_H
+#define SIM_HARDWARE_CLOCKS_H
+// Host simulation stand-in for the Pico SDK's hardware/clocks.h.
+#include <stdint.h>
+
+enum clock_index {clk_sys};
+inline uint32_t clock_get_hz(clock_index) {return 125'000'000;}
+
+#endif // SIM_HARDWARE_CLOCKS_H
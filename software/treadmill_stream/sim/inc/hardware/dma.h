@@ -0,0 +1,93 @@
+#ifndef SIM_HARDWARE_DMA_H
+#define SIM_HARDWARE_DMA_H
+// Host simulation stand-in for the Pico SDK's hardware/dma.h. Channels
+// transfer whenever their DREQ allows: a DMA timer's pace, a PIO RX FIFO
+// holding data, or an ADC conversion. Transfer counts count down, but
+// channels never complete, so every started channel streams indefinitely, as
+// the firmware's self-retriggering chains do.
+#include <stdint.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+#define NUM_DMA_CHANNELS (12)
+#define NUM_DMA_TIMERS (4)
+
+#define DREQ_ADC (36)
+#define DREQ_DMA_TIMER0 (59)
+#define DREQ_FORCE (63)
+
+struct dma_channel_hw_t
+{
+    volatile uintptr_t read_addr; // Host addresses are 64 bits wide.
+    volatile uintptr_t write_addr;
+    volatile uint32_t transfer_count;
+    volatile uint32_t ctrl_trig;
+    volatile uint32_t al1_transfer_count_trig;
+};
+
+struct dma_hw_t
+{
+    dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+};
+
+extern dma_hw_t* dma_hw;
+
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+struct dma_channel_config
+{
+    dma_channel_transfer_size data_size;
+    bool read_increment;
+    bool write_increment;
+    bool ring_on_write;
+    uint ring_size_bits; // 0 --> no ring.
+    uint dreq;
+    uint chain_to;
+};
+
+inline dma_channel_config dma_channel_get_default_config(uint channel)
+{return {DMA_SIZE_32, true, false, false, 0, DREQ_FORCE, channel};}
+inline void channel_config_set_transfer_data_size(
+    dma_channel_config* c, dma_channel_transfer_size size)
+{c->data_size = size;}
+inline void channel_config_set_read_increment(dma_channel_config* c,
+                                              bool increment)
+{c->read_increment = increment;}
+inline void channel_config_set_write_increment(dma_channel_config* c,
+                                               bool increment)
+{c->write_increment = increment;}
+inline void channel_config_set_ring(dma_channel_config* c, bool write,
+                                    uint size_bits)
+{c->ring_on_write = write; c->ring_size_bits = size_bits;}
+inline void channel_config_set_dreq(dma_channel_config* c, uint dreq)
+{c->dreq = dreq;}
+inline void channel_config_set_chain_to(dma_channel_config* c, uint channel)
+{c->chain_to = channel;}
+
+int dma_claim_unused_channel(bool required);
+void dma_channel_unclaim(uint channel);
+bool dma_channel_is_claimed(uint channel);
+void dma_channel_configure(uint channel, const dma_channel_config* config,
+                           volatile void* write_addr,
+                           const volatile void* read_addr,
+                           uint transfer_count, bool trigger);
+void dma_channel_start(uint channel);
+void dma_channel_abort(uint channel);
+void dma_channel_set_write_addr(uint channel, volatile void* write_addr,
+                                bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t transfer_count,
+                                 bool trigger);
+
+int dma_claim_unused_timer(bool required);
+void dma_timer_unclaim(uint timer);
+void dma_timer_set_fraction(uint timer, uint16_t numerator,
+                            uint16_t denominator);
+inline uint dma_get_timer_dreq(uint timer) {return DREQ_DMA_TIMER0 + timer;}
+
+#endif // SIM_HARDWARE_DMA_H
@@ -0,0 +1,20 @@
+#ifndef SIM_HARDWARE_FLASH_H
+#define SIM_HARDWARE_FLASH_H
+// Host simulation stand-in for the Pico SDK's hardware/flash.h. Flash is a
+// RAM array that reads through XIP_BASE as on the device. Erasing sets bits
+// and programming can only clear them, as with NOR flash.
+#include <stdint.h>
+#include <stddef.h>
+
+#define FLASH_SECTOR_SIZE (1u << 12)
+#define FLASH_PAGE_SIZE (1u << 8)
+#define PICO_FLASH_SIZE_BYTES (2u * 1024 * 1024)
+
+extern uint8_t sim_flash[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE (uintptr_t(sim_flash))
+
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t* data,
+                         size_t count);
+
+#endif // SIM_HARDWARE_FLASH_H
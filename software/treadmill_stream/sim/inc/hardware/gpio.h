@@ -0,0 +1,13 @@
+#ifndef SIM_HARDWARE_GPIO_H
+#define SIM_HARDWARE_GPIO_H
+// Host simulation stand-in for the Pico SDK's hardware/gpio.h. Pins are not
+// modelled.
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+inline void gpio_init(uint) {}
+inline void gpio_set_dir(uint, bool) {}
+inline void gpio_put(uint, bool) {}
+
+#endif // SIM_HARDWARE_GPIO_H
@@ -0,0 +1,92 @@
+#ifndef SIM_HARDWARE_PIO_H
+#define SIM_HARDWARE_PIO_H
+// Host simulation stand-in for the Pico SDK's hardware/pio.h. Programs are
+// not interpreted. Instead, each program's init function tells the
+// simulation what its state machine does (sim_pio_sm_load()), and the
+// simulation pushes to and pops from the FIFOs on its behalf.
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#define NUM_PIO_STATE_MACHINES (4)
+
+/**
+ * \brief an RX FIFO register. Reading it pops the FIFO, as on hardware.
+ */
+struct pio_rx_fifo_reg_t
+{
+    operator uint32_t();
+
+    uint32_t words[8];
+    uint32_t head;
+    uint32_t level;
+    uint32_t depth; // 4, or 8 with the TX FIFO joined to it.
+};
+
+/**
+ * \brief a TX FIFO register. Writing it hands the word to the state
+ *  machine, which holds it while its RX FIFO is full.
+ */
+struct pio_tx_fifo_reg_t
+{
+    pio_tx_fifo_reg_t& operator=(uint32_t word);
+
+    uint32_t pending;
+};
+
+struct pio_hw_t
+{
+    pio_tx_fifo_reg_t txf[NUM_PIO_STATE_MACHINES];
+    pio_rx_fifo_reg_t rxf[NUM_PIO_STATE_MACHINES];
+};
+
+typedef pio_hw_t* PIO;
+extern PIO pio0;
+extern PIO pio1;
+
+struct pio_program_t
+{
+    const uint16_t* instructions;
+    uint8_t length;
+    int8_t origin;
+};
+
+/**
+ * \brief what a state machine does once enabled.
+ */
+enum sim_pio_program_t
+{
+    SIM_PIO_IDLE,
+    SIM_PIO_QUADRATURE_ENCODER, // Replies to TX words with its count.
+    SIM_PIO_ENCODER_EDGE_TIMER, // Pushes a timestamp per A channel edge.
+    SIM_PIO_ADS7049, // Pushes conversions at the sensor ADC rate.
+    SIM_PIO_LTC264X, // Brake setpoint DAC.
+};
+
+/**
+ * \brief load and enable program on a state machine.
+ * \param pin the pin that identifies what the program is connected to,
+ *  e.g: an encoder's A input or an ADC's CS pin.
+ * \param rx_fifo_depth 8 if the FIFOs are joined for RX, otherwise 4.
+ */
+void sim_pio_sm_load(PIO pio, uint sm, sim_pio_program_t program, uint pin,
+                     uint rx_fifo_depth = 4);
+
+int pio_claim_unused_sm(PIO pio, bool required);
+void pio_sm_unclaim(PIO pio, uint sm);
+uint pio_add_program(PIO pio, const pio_program_t* program);
+void pio_add_program_at_offset(PIO pio, const pio_program_t* program,
+                               uint offset);
+void pio_remove_program(PIO pio, const pio_program_t* program, uint offset);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_sm_clear_fifos(PIO pio, uint sm);
+
+inline bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm)
+{return pio->rxf[sm].level == 0;}
+inline uint pio_sm_get_rx_fifo_level(PIO pio, uint sm)
+{return pio->rxf[sm].level;}
+inline uint pio_get_index(PIO pio) {return pio == pio0 ? 0 : 1;}
+inline uint pio_get_dreq(PIO pio, uint sm, bool is_tx)
+{return pio_get_index(pio) * 8 + (is_tx ? 0 : 4) + sm;}
+
+#endif // SIM_HARDWARE_PIO_H
@@ -0,0 +1,17 @@
+#ifndef SIM_HARDWARE_STRUCTS_SYSTICK_H
+#define SIM_HARDWARE_STRUCTS_SYSTICK_H
+// Host simulation stand-in for the Pico SDK's SysTick registers. The counter
+// does not run, so cycle counts measured with it read as 0.
+#include <stdint.h>
+
+struct systick_hw_t
+{
+    volatile uint32_t csr;
+    volatile uint32_t rvr;
+    volatile uint32_t cvr;
+    volatile uint32_t calib;
+};
+
+extern systick_hw_t* systick_hw;
+
+#endif // SIM_HARDWARE_STRUCTS_SYSTICK_H
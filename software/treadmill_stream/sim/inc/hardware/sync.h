@@ -0,0 +1,11 @@
+#ifndef SIM_HARDWARE_SYNC_H
+#define SIM_HARDWARE_SYNC_H
+// Host simulation stand-in for the Pico SDK's hardware/sync.h. Interrupts
+// only fire while both cores are yielded to the scheduler, so there is
+// nothing to disable.
+#include <stdint.h>
+
+inline uint32_t save_and_disable_interrupts() {return 0;}
+inline void restore_interrupts(uint32_t) {}
+
+#endif // SIM_HARDWARE_SYNC_H
@@ -0,0 +1,24 @@
+#ifndef SIM_HARDWARE_TIMER_H
+#define SIM_HARDWARE_TIMER_H
+// Host simulation stand-in for the Pico SDK's hardware alarms. An alarm's
+// callback runs as an interrupt on the core that set it, once the
+// simulation's clock reaches its target.
+#include <stdint.h>
+
+typedef unsigned int uint;
+typedef void (*hardware_alarm_callback_t)(uint alarm_num);
+
+#define NUM_TIMERS (4)
+
+int hardware_alarm_claim_unused(bool required);
+void hardware_alarm_unclaim(uint alarm_num);
+void hardware_alarm_set_callback(uint alarm_num,
+                                 hardware_alarm_callback_t callback);
+/**
+ * \returns true if the target has already passed, in which case the alarm
+ *  is left disarmed.
+ */
+bool hardware_alarm_set_target(uint alarm_num, uint64_t target_us);
+void hardware_alarm_cancel(uint alarm_num);
+
+#endif // SIM_HARDWARE_TIMER_H
@@ -0,0 +1,30 @@
+#ifndef SIM_HARP_C_APP_H
+#define SIM_HARP_C_APP_H
+// Host simulation stand-in for harp.core's HarpCApp. Each run() handles the
+// register reads and writes queued by the simulation (sim_write_register(),
+// sim_read_register()), calls the app's update function once and then
+// yields to the simulation until core0's next loop iteration.
+#include <harp_core.h>
+
+class HarpSynchronizer;
+
+class HarpCApp: public HarpCore
+{
+public:
+    static HarpCApp& init(uint16_t who_am_i,
+                          uint8_t hw_version_major, uint8_t hw_version_minor,
+                          uint8_t assembly_version,
+                          uint8_t harp_version_major,
+                          uint8_t harp_version_minor,
+                          uint16_t fw_version_major, uint8_t fw_version_minor,
+                          uint16_t serial_number, const char name[],
+                          const uint8_t tag[],
+                          void* app_reg_values, RegSpecs* app_reg_specs,
+                          RegFnPair* app_reg_fns, size_t app_reg_count,
+                          void (*update_fn)(), void (*reset_fn)());
+
+    void set_synchronizer(HarpSynchronizer*) {}
+    void run();
+};
+
+#endif // SIM_HARP_C_APP_H
@@ -0,0 +1,57 @@
+#ifndef SIM_HARP_CORE_H
+#define SIM_HARP_CORE_H
+// Host simulation stand-in for harp.core's HarpCore. Replies are encoded as
+// Harp frames into the simulated USB output (sim_take_usb_output()).
+// Harp time is the simulation's clock, offset and drifting as configured
+// (sim_config_t).
+#include <pico/stdlib.h>
+#include <harp_message.h>
+
+#define APP_REG_START_ADDRESS (32)
+
+struct RegSpecs
+{
+    uint8_t* base_ptr;
+    uint8_t num_bytes;
+    reg_type_t payload_type;
+};
+
+typedef void (*read_reg_fn)(uint8_t reg_name);
+typedef void (*write_reg_fn)(msg_t& msg);
+
+struct RegFnPair
+{
+    read_reg_fn read_fn_ptr;
+    write_reg_fn write_fn_ptr;
+};
+
+class HarpCore
+{
+public:
+/**
+ * \brief reply with the register's contents, timestamped now.
+ */
+    static void send_harp_reply(msg_type_t reply_type, uint8_t reg_name);
+    static void send_harp_reply(msg_type_t reply_type, uint8_t reg_name,
+                                uint64_t harp_time_us);
+    static void send_harp_reply(msg_type_t reply_type, uint8_t reg_name,
+                                const volatile uint8_t* data,
+                                uint8_t num_bytes, reg_type_t payload_type);
+    static void send_harp_reply(msg_type_t reply_type, uint8_t reg_name,
+                                const volatile uint8_t* data,
+                                uint8_t num_bytes, reg_type_t payload_type,
+                                uint64_t harp_time_us);
+
+    static bool is_muted();
+
+    static void copy_msg_payload_to_register(msg_t& msg);
+    static void read_reg_generic(uint8_t reg_name);
+    static void write_reg_generic(msg_t& msg);
+    static void write_to_read_only_reg_error(msg_t& msg);
+
+    static uint64_t harp_time_us_64();
+    static uint64_t system_to_harp_us_64(uint64_t system_time_us);
+    static uint64_t harp_to_system_us_64(uint64_t harp_time_us);
+};
+
+#endif // SIM_HARP_CORE_H
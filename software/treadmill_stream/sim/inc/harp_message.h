@@ -0,0 +1,47 @@
+#ifndef SIM_HARP_MESSAGE_H
+#define SIM_HARP_MESSAGE_H
+// Host simulation stand-in for harp.core's harp_message.h.
+#include <stdint.h>
+
+enum msg_type_t: uint8_t
+{
+    READ = 1,
+    WRITE = 2,
+    EVENT = 3,
+    READ_ERROR = 9,
+    WRITE_ERROR = 10
+};
+
+enum reg_type_t: uint8_t
+{
+    U8 = 0x01,
+    S8 = 0x81,
+    U16 = 0x02,
+    S16 = 0x82,
+    U32 = 0x04,
+    S32 = 0x84,
+    U64 = 0x08,
+    S64 = 0x88,
+    Float = 0x44
+};
+
+struct msg_header_t
+{
+    msg_type_t type;
+    uint8_t raw_length;
+    uint8_t address;
+    uint8_t port;
+    reg_type_t payload_type;
+
+    // Messages to the device carry no timestamp.
+    uint8_t payload_length() const {return raw_length - 4;}
+};
+
+struct msg_t
+{
+    msg_header_t header;
+    void* payload;
+    uint8_t checksum;
+};
+
+#endif // SIM_HARP_MESSAGE_H
@@ -0,0 +1,18 @@
+#ifndef SIM_HARP_SYNCHRONIZER_H
+#define SIM_HARP_SYNCHRONIZER_H
+// Host simulation stand-in for harp.core's HarpSynchronizer. The simulation
+// is never synchronized to an external clock.
+#include <pico/stdlib.h>
+
+class HarpSynchronizer
+{
+public:
+    static HarpSynchronizer& init(uart_inst_t*, uint) {return instance();}
+    static HarpSynchronizer& instance()
+    {
+        static HarpSynchronizer synchronizer;
+        return synchronizer;
+    }
+};
+
+#endif // SIM_HARP_SYNCHRONIZER_H
@@ -0,0 +1,13 @@
+#ifndef SIM_PICO_MULTICORE_H
+#define SIM_PICO_MULTICORE_H
+// Host simulation stand-in for the Pico SDK's pico/multicore.h. Core1 runs as
+// a coroutine alongside core0, so it never runs while core0 writes flash and
+// lockout has nothing to do.
+#include <pico/stdlib.h>
+
+void multicore_launch_core1(void (*entry)());
+inline void multicore_lockout_victim_init() {}
+inline void multicore_lockout_start_blocking() {}
+inline void multicore_lockout_end_blocking() {}
+
+#endif // SIM_PICO_MULTICORE_H
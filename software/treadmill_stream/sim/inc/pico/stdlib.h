@@ -0,0 +1,44 @@
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+// Host simulation stand-in for the Pico SDK's pico/stdlib.h, covering only
+// what the firmware uses. Time is the simulation's clock. See firmware_sim.h.
+#include <stdint.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+#define __not_in_flash(group)
+#define __not_in_flash_func(func_name) func_name
+
+#ifndef count_of
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+#endif
+
+typedef uint64_t absolute_time_t;
+inline absolute_time_t from_us_since_boot(uint64_t us) {return us;}
+
+uint64_t time_us_64();
+inline uint32_t time_us_32() {return uint32_t(time_us_64());}
+
+/**
+ * \brief hand the simulation back to its scheduler until this core's next
+ *  turn. A no-op in interrupt context.
+ */
+void tight_loop_contents();
+
+// pico/divider.h's hardware divide.
+inline uint32_t div_u32u32(uint32_t a, uint32_t b) {return b ? a / b : 0xFFFFFFFF;}
+
+struct uart_inst_t;
+extern uart_inst_t* uart0;
+extern uart_inst_t* uart1;
+inline void stdio_uart_init_full(uart_inst_t*, uint, int, int) {}
+
+#include <hardware/clocks.h>
+#include <hardware/gpio.h>
+#include <hardware/pio.h>
+#include <hardware/dma.h>
+#include <hardware/timer.h>
+#include <hardware/sync.h>
+
+#endif // SIM_PICO_STDLIB_H
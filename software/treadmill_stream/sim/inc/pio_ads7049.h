@@ -0,0 +1,30 @@
+#ifndef SIM_PIO_ADS7049_H
+#define SIM_PIO_ADS7049_H
+// Host simulation stand-in for the pio-ads7049 library. Once started, the
+// state machine pushes a conversion at the sensor ADC rate, taking the value
+// of the channel wired to its CS pin from the sensor model.
+#include <pico/stdlib.h>
+
+class PIO_ADS7049
+{
+public:
+    PIO_ADS7049(PIO pio, uint cs_pin, uint sck_pin, uint poci_pin,
+                int program_offset = -1);
+
+    uint get_program_address() const {return program_offset_;}
+
+/**
+ * \brief stream every conversion into a ring of sample_count samples.
+ */
+    void setup_dma_stream_to_memory(uint16_t* address, size_t sample_count);
+
+    void start();
+
+private:
+    PIO pio_;
+    uint sm_;
+    uint cs_pin_;
+    uint program_offset_;
+};
+
+#endif // SIM_PIO_ADS7049_H
@@ -0,0 +1,35 @@
+#ifndef SIM_PIO_ENCODER_PIO_H
+#define SIM_PIO_ENCODER_PIO_H
+// Host simulation stand-in for the header that pioasm generates from
+// pio_encoder.pio. The state machine replies to each count request with its
+// encoder's count from the sensor model.
+#include <pico/stdlib.h>
+
+extern const pio_program_t quadrature_encoder_program;
+
+static inline void quadrature_encoder_program_init(PIO pio, uint sm, uint,
+                                                   uint pin, int)
+{
+    sim_pio_sm_load(pio, sm, SIM_PIO_QUADRATURE_ENCODER, pin);
+}
+
+// Helpers as in pio_encoder.pio.
+static inline void quadrature_encoder_request_count(PIO pio, uint sm)
+{
+    pio->txf[sm] = 1;
+}
+
+static inline int32_t quadrature_encoder_fetch_count(PIO pio, uint sm)
+{
+    while (pio_sm_is_rx_fifo_empty(pio, sm))
+        tight_loop_contents();
+    return pio->rxf[sm];
+}
+
+static inline int32_t quadrature_encoder_get_count(PIO pio, uint sm)
+{
+    quadrature_encoder_request_count(pio, sm);
+    return quadrature_encoder_fetch_count(pio, sm);
+}
+
+#endif // SIM_PIO_ENCODER_PIO_H
@@ -0,0 +1,21 @@
+#ifndef SIM_PIO_LTC264X_H
+#define SIM_PIO_LTC264X_H
+// Host simulation stand-in for the pio-ltc264x library. The last value
+// written is the brake DAC code that the sensor model sees.
+#include <pico/stdlib.h>
+
+class PIO_LTC264x
+{
+public:
+    PIO_LTC264x(PIO pio, uint sck_pin, uint pico_pin,
+                int program_offset = -1);
+
+    void write_value(uint16_t value);
+    void start();
+
+private:
+    PIO pio_;
+    uint sm_;
+};
+
+#endif // SIM_PIO_LTC264X_H
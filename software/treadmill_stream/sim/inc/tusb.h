@@ -0,0 +1,9 @@
+#ifndef SIM_TUSB_H
+#define SIM_TUSB_H
+// Host simulation stand-in for TinyUSB's CDC TX buffer space. See
+// sim_config_t::usb_tx_available_bytes.
+#include <stdint.h>
+
+uint32_t tud_cdc_write_available();
+
+#endif // SIM_TUSB_H
@@ -0,0 +1,224 @@
+// The simulation's harp.core: register dispatch for the host's reads and
+// writes, and Harp frames out over simulated USB.
+#include <sim_internal.h>
+#include <harp_c_app.h>
+#include <harp_frame.h>
+#include <tusb.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+
+namespace
+{
+struct app_t
+{
+    RegSpecs* reg_specs;
+    RegFnPair* reg_fns;
+    size_t reg_count;
+    void (*update_fn)();
+    void (*reset_fn)();
+};
+// Set while the firmware's globals are constructed, so plain data only.
+app_t app = {};
+HarpCApp app_instance;
+bool muted = false;
+
+struct host_msg_t
+{
+    msg_type_t type;
+    uint8_t address;
+    reg_type_t payload_type;
+    std::vector<uint8_t> payload;
+};
+
+std::deque<host_msg_t>& host_msgs()
+{
+    static std::deque<host_msg_t> msgs;
+    return msgs;
+}
+
+std::vector<uint8_t>& usb_output()
+{
+    static std::vector<uint8_t> output;
+    return output;
+}
+
+sim_cost_t update_app_state_cost;
+
+bool is_app_reg(uint8_t address)
+{
+    return address >= APP_REG_START_ADDRESS
+           && address < APP_REG_START_ADDRESS + app.reg_count;
+}
+
+void handle_host_msg(host_msg_t& host_msg)
+{
+    if (!is_app_reg(host_msg.address))
+    {
+        // Core registers are not simulated.
+        HarpCore::send_harp_reply(
+            (host_msg.type == READ) ? READ_ERROR : WRITE_ERROR,
+            host_msg.address, nullptr, 0, host_msg.payload_type);
+        return;
+    }
+    const RegFnPair& fns = app.reg_fns[host_msg.address - APP_REG_START_ADDRESS];
+    if (host_msg.type == READ)
+    {
+        fns.read_fn_ptr(host_msg.address);
+        return;
+    }
+    msg_t msg;
+    msg.header.type = host_msg.type;
+    msg.header.raw_length = uint8_t(host_msg.payload.size() + 4);
+    msg.header.address = host_msg.address;
+    msg.header.port = HARP_DEFAULT_PORT;
+    msg.header.payload_type = host_msg.payload_type;
+    msg.payload = host_msg.payload.data();
+    msg.checksum = 0;
+    fns.write_fn_ptr(msg);
+}
+}
+
+HarpCApp& HarpCApp::init(uint16_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t,
+                         uint16_t, uint8_t, uint16_t, const char[],
+                         const uint8_t[], void*, RegSpecs* app_reg_specs,
+                         RegFnPair* app_reg_fns, size_t app_reg_count,
+                         void (*update_fn)(), void (*reset_fn)())
+{
+    app = {app_reg_specs, app_reg_fns, app_reg_count, update_fn, reset_fn};
+    return app_instance;
+}
+
+void HarpCApp::run()
+{
+    while (!host_msgs().empty())
+    {
+        host_msg_t host_msg = std::move(host_msgs().front());
+        host_msgs().pop_front();
+        handle_host_msg(host_msg);
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const double start_cycles = sim_read_cycles();
+    app.update_fn();
+    const double cycles = sim_read_cycles() - start_cycles;
+    update_app_state_cost.add(std::chrono::duration<double, std::nano>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count(),
+                              cycles);
+    tight_loop_contents();
+}
+
+void HarpCore::send_harp_reply(msg_type_t reply_type, uint8_t reg_name)
+{
+    send_harp_reply(reply_type, reg_name, harp_time_us_64());
+}
+
+void HarpCore::send_harp_reply(msg_type_t reply_type, uint8_t reg_name,
+                               uint64_t harp_time_us)
+{
+    if (!is_app_reg(reg_name))
+        return;
+    const RegSpecs& specs = app.reg_specs[reg_name - APP_REG_START_ADDRESS];
+    send_harp_reply(reply_type, reg_name, specs.base_ptr, specs.num_bytes,
+                    specs.payload_type, harp_time_us);
+}
+
+void HarpCore::send_harp_reply(msg_type_t reply_type, uint8_t reg_name,
+                               const volatile uint8_t* data,
+                               uint8_t num_bytes, reg_type_t payload_type)
+{
+    send_harp_reply(reply_type, reg_name, data, num_bytes, payload_type,
+                    harp_time_us_64());
+}
+
+void HarpCore::send_harp_reply(msg_type_t reply_type, uint8_t reg_name,
+                               const volatile uint8_t* data,
+                               uint8_t num_bytes, reg_type_t payload_type,
+                               uint64_t harp_time_us)
+{
+    uint8_t payload[255] = {};
+    for (uint8_t i = 0; i < num_bytes; ++i)
+        payload[i] = data[i];
+    uint8_t frame[HARP_MAX_FRAME_BYTES];
+    const size_t frame_bytes = encode_harp_frame(frame, reply_type, reg_name,
+                                                 payload_type, payload,
+                                                 num_bytes,
+                                                 int64_t(harp_time_us));
+    usb_output().insert(usb_output().end(), frame, frame + frame_bytes);
+}
+
+bool HarpCore::is_muted() {return muted;}
+
+void HarpCore::copy_msg_payload_to_register(msg_t& msg)
+{
+    const RegSpecs& specs = app.reg_specs[msg.header.address
+                                          - APP_REG_START_ADDRESS];
+    memcpy(specs.base_ptr, msg.payload,
+           std::min<size_t>(msg.header.payload_length(), specs.num_bytes));
+}
+
+void HarpCore::read_reg_generic(uint8_t reg_name)
+{
+    send_harp_reply(READ, reg_name);
+}
+
+void HarpCore::write_reg_generic(msg_t& msg)
+{
+    copy_msg_payload_to_register(msg);
+    send_harp_reply(WRITE, msg.header.address);
+}
+
+void HarpCore::write_to_read_only_reg_error(msg_t& msg)
+{
+    send_harp_reply(WRITE_ERROR, msg.header.address);
+}
+
+uint64_t HarpCore::harp_time_us_64()
+{
+    return system_to_harp_us_64(time_us_64());
+}
+
+uint64_t HarpCore::system_to_harp_us_64(uint64_t system_time_us)
+{
+    const int64_t seconds = int64_t(system_time_us / 1'000'000);
+    return uint64_t(int64_t(system_time_us) + sim_config.harp_offset_us
+                    + seconds * sim_config.harp_drift_ppm);
+}
+
+uint64_t HarpCore::harp_to_system_us_64(uint64_t harp_time_us)
+{
+    // Exact except within a drift step of each whole second.
+    const int64_t system_us = int64_t(harp_time_us) - sim_config.harp_offset_us;
+    return uint64_t(system_us - system_us / 1'000'000
+                                * sim_config.harp_drift_ppm);
+}
+
+uint32_t tud_cdc_write_available()
+{
+    return sim_config.usb_tx_available_bytes;
+}
+
+void sim_write_register(uint8_t address, uint8_t payload_type,
+                        const void* payload, uint8_t num_bytes)
+{
+    const uint8_t* bytes = (const uint8_t*)payload;
+    host_msgs().push_back({WRITE, address, reg_type_t(payload_type),
+                           std::vector<uint8_t>(bytes, bytes + num_bytes)});
+}
+
+void sim_read_register(uint8_t address)
+{
+    host_msgs().push_back({READ, address, U8, {}});
+}
+
+void sim_set_muted(bool is_muted) {muted = is_muted;}
+
+std::vector<uint8_t> sim_take_usb_output()
+{
+    std::vector<uint8_t> output;
+    output.swap(usb_output());
+    return output;
+}
+
+const sim_cost_t& sim_update_app_state_cost() {return update_app_state_cost;}
@@ -0,0 +1,615 @@
+// The simulation's PIO state machines, on-chip ADC and DMA, and the PIO
+// libraries built on them. Every sensor value comes from the SensorModel.
+#include <sim_internal.h>
+#include <pico/stdlib.h>
+#include <hardware/adc.h>
+#include <pio_encoder.pio.h>
+#include <encoder_edge_timer.pio.h>
+#include <pio_ads7049.h>
+#include <pio_ltc264x.h>
+#include <config.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// The programs are simulated by sim_pio_sm_load(), not run.
+const pio_program_t quadrature_encoder_program = {nullptr, 0, -1};
+const pio_program_t encoder_edge_timer_program = {nullptr, 0, -1};
+
+namespace
+{
+constexpr uint NUM_PIOS = 2;
+constexpr uint32_t ADC_CLOCK_HZ = 48'000'000;
+constexpr uint32_t ADC_FIFO_DEPTH = 4;
+constexpr uint NUM_ADC_INPUTS = 5;
+
+pio_hw_t pio_blocks[NUM_PIOS];
+
+struct state_machine_t
+{
+    bool claimed;
+    bool enabled;
+    sim_pio_program_t program;
+    uint pin;
+    uint32_t encoder_index; // Quadrature encoders, in the order loaded.
+    int32_t edge_encoder_index; // Edge timers: the encoder on their pin.
+    double position; // Edge timers: last position of the encoder.
+    uint64_t next_conversion_ns; // ADS7049s.
+};
+state_machine_t state_machines[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+uint32_t num_quadrature_encoders = 0;
+
+struct dma_channel_t
+{
+    bool claimed;
+    bool busy;
+    dma_channel_config config;
+    uint64_t paced_start_us; // For DMA timer DREQs.
+    uint64_t paced_transfers;
+};
+dma_hw_t dma_registers;
+dma_channel_t dma_channels[NUM_DMA_CHANNELS];
+
+struct dma_timer_t
+{
+    bool claimed;
+    uint16_t numerator;
+    uint16_t denominator;
+};
+dma_timer_t dma_timers[NUM_DMA_TIMERS];
+
+adc_hw_t adc_registers = {ADC_CS_READY_BITS, {}};
+struct adc_state_t
+{
+    bool running;
+    uint input;
+    uint round_robin_mask;
+    uint64_t period_ns;
+    uint64_t next_conversion_ns;
+};
+adc_state_t adc = {false, 0, 0, 1'000'000'000 / ADC_CLOCK_HZ, 0};
+
+uint16_t brake_dac_code = 0;
+
+// Peripherals have run up to and including this. Also the time of the [us]
+// being run, so that DMA reading a FIFO sees the sensors as of then.
+uint64_t advanced_us = 0;
+
+state_machine_t& state_machine(PIO pio, uint sm)
+{
+    return state_machines[pio_get_index(pio)][sm];
+}
+
+/**
+ * \brief push a word to a state machine's RX FIFO.
+ * \returns false if the FIFO was full, in which case the word is lost.
+ */
+bool push_rx(PIO pio, uint sm, uint32_t word)
+{
+    pio_rx_fifo_reg_t& fifo = pio->rxf[sm];
+    if (fifo.level >= fifo.depth)
+        return false;
+    fifo.words[(fifo.head + fifo.level) % fifo.depth] = word;
+    ++fifo.level;
+    return true;
+}
+
+/**
+ * \brief reply to the count requests that fit in the RX FIFO.
+ */
+void reply_to_count_requests(PIO pio, uint sm)
+{
+    const state_machine_t& machine = state_machine(pio, sm);
+    if (machine.program != SIM_PIO_QUADRATURE_ENCODER || !machine.enabled)
+        return;
+    pio_tx_fifo_reg_t& requests = pio->txf[sm];
+    while (requests.pending > 0 && pio->rxf[sm].level < pio->rxf[sm].depth)
+    {
+        push_rx(pio, sm, uint32_t(sim_model->encoder_counts(
+                             machine.encoder_index, advanced_us)));
+        --requests.pending;
+    }
+}
+
+/**
+ * \brief find the PIO and state machine that a FIFO register belongs to.
+ */
+template <typename REG>
+bool find_fifo(const REG* reg, REG (pio_hw_t::*fifos)[NUM_PIO_STATE_MACHINES],
+               PIO& pio, uint& sm)
+{
+    for (pio_hw_t& block: pio_blocks)
+    {
+        const REG* first = &(block.*fifos)[0];
+        if (reg >= first && reg < first + NUM_PIO_STATE_MACHINES)
+        {
+            pio = &block;
+            sm = uint(reg - first);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * \brief read from an address as DMA does, popping FIFO registers.
+ */
+uint32_t bus_read(uintptr_t address, uint32_t num_bytes)
+{
+    PIO pio;
+    uint sm;
+    if (find_fifo((const pio_rx_fifo_reg_t*)address, &pio_hw_t::rxf, pio, sm))
+        return pio->rxf[sm];
+    if (address == uintptr_t(&adc_registers.fifo))
+        return adc_registers.fifo;
+    uint32_t value = 0;
+    memcpy(&value, (const void*)address, num_bytes);
+    return value;
+}
+
+/**
+ * \brief write to an address as DMA does, pushing FIFO registers.
+ */
+void bus_write(uintptr_t address, uint32_t value, uint32_t num_bytes)
+{
+    PIO pio;
+    uint sm;
+    if (find_fifo((const pio_tx_fifo_reg_t*)address, &pio_hw_t::txf, pio, sm))
+    {
+        pio->txf[sm] = value;
+        return;
+    }
+    memcpy((void*)address, &value, num_bytes);
+}
+
+/**
+ * \brief transfers that a channel's DREQ allows right now.
+ */
+uint64_t dma_transfers_allowed(const dma_channel_t& channel, uint64_t now_us)
+{
+    const uint dreq = channel.config.dreq;
+    if (dreq >= DREQ_DMA_TIMER0 && dreq < DREQ_DMA_TIMER0 + NUM_DMA_TIMERS)
+    {
+        const dma_timer_t& timer = dma_timers[dreq - DREQ_DMA_TIMER0];
+        if (timer.denominator == 0)
+            return 0;
+        // Timers pace at clk_sys * numerator / denominator.
+        const uint64_t due = (now_us - channel.paced_start_us)
+                             * (clock_get_hz(clk_sys) / 1'000'000)
+                             * timer.numerator / timer.denominator;
+        return due - channel.paced_transfers;
+    }
+    if (dreq < NUM_PIOS * 8)
+    {
+        const PIO pio = &pio_blocks[dreq / 8];
+        const uint sm = dreq % 4;
+        return (dreq % 8 >= 4) ? pio->rxf[sm].level : UINT64_MAX;
+    }
+    if (dreq == DREQ_ADC)
+        return adc_registers.fifo.level;
+    return UINT64_MAX; // Unpaced.
+}
+
+void dma_transfer(uint chan)
+{
+    dma_channel_t& channel = dma_channels[chan];
+    dma_channel_hw_t& registers = dma_registers.ch[chan];
+    const uint32_t num_bytes = 1u << channel.config.data_size;
+    bus_write(registers.write_addr, bus_read(registers.read_addr, num_bytes),
+              num_bytes);
+    if (channel.config.read_increment)
+        registers.read_addr = registers.read_addr + num_bytes;
+    if (channel.config.write_increment)
+    {
+        uintptr_t write_addr = registers.write_addr + num_bytes;
+        if (channel.config.ring_on_write && channel.config.ring_size_bits > 0)
+        {
+            const uintptr_t mask = (uintptr_t(1) << channel.config.ring_size_bits)
+                                   - 1;
+            write_addr = (registers.write_addr & ~mask) | (write_addr & mask);
+        }
+        registers.write_addr = write_addr;
+    }
+    registers.transfer_count = registers.transfer_count - 1;
+    ++channel.paced_transfers;
+}
+
+/**
+ * \brief run every busy channel until none can make progress.
+ */
+void run_dma(uint64_t now_us)
+{
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        for (uint chan = 0; chan < NUM_DMA_CHANNELS; ++chan)
+        {
+            if (!dma_channels[chan].busy)
+                continue;
+            uint64_t allowed = dma_transfers_allowed(dma_channels[chan], now_us);
+            if (allowed == UINT64_MAX)
+            {
+                fprintf(stderr, "DMA channel %u has no simulated DREQ.\n", chan);
+                abort();
+            }
+            for (; allowed > 0; --allowed)
+            {
+                dma_transfer(chan);
+                progress = true;
+            }
+        }
+    }
+}
+
+uint16_t ads7049_conversion(uint cs_pin, uint64_t time_us)
+{
+    if (cs_pin == TORQUE_TRANSDUCER_CS_PIN)
+        return sim_model->torque_counts(time_us);
+    return sim_model->brake_current_counts(time_us, brake_dac_code);
+}
+
+void advance_state_machines(uint64_t time_us)
+{
+    const uint64_t conversion_period_ns = 1'000'000'000ull
+                                          / sim_config.sensor_adc_rate_hz;
+    const uint32_t tick_hz = clock_get_hz(clk_sys)
+                             / 2; // As encoder_edge_timer_tick_hz().
+    for (uint p = 0; p < NUM_PIOS; ++p)
+    {
+        for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm)
+        {
+            state_machine_t& machine = state_machines[p][sm];
+            if (!machine.enabled)
+                continue;
+            if (machine.program == SIM_PIO_ADS7049)
+            {
+                while (machine.next_conversion_ns <= time_us * 1000)
+                {
+                    push_rx(&pio_blocks[p], sm,
+                            ads7049_conversion(machine.pin, time_us));
+                    machine.next_conversion_ns += conversion_period_ns;
+                }
+            }
+            else if (machine.program == SIM_PIO_ENCODER_EDGE_TIMER
+                     && machine.edge_encoder_index >= 0)
+            {
+                // A changes every other count. Time the change within the
+                // last [us], assuming the belt moved steadily over it.
+                const double position = sim_model->encoder_position(
+                    uint32_t(machine.edge_encoder_index), time_us);
+                const int64_t from = int64_t(floor(machine.position / 2));
+                const int64_t to = int64_t(floor(position / 2));
+                if (from != to)
+                {
+                    const double edge = 2.0 * double((to > from) ? to : from);
+                    const double fraction = (edge - machine.position)
+                                            / (position - machine.position);
+                    push_rx(&pio_blocks[p], sm, uint32_t(uint64_t(llround(
+                        (double(time_us) - 1 + fraction) * tick_hz / 1e6))));
+                }
+                machine.position = position;
+            }
+        }
+    }
+}
+
+void advance_adc(uint64_t time_us)
+{
+    if (!adc.running)
+        return;
+    while (adc.next_conversion_ns <= time_us * 1000)
+    {
+        adc_fifo_reg_t& fifo = adc_registers.fifo;
+        if (fifo.level < ADC_FIFO_DEPTH)
+        {
+            fifo.words[(fifo.head + fifo.level) % ADC_FIFO_DEPTH] =
+                sim_model->aux_analog_counts(adc.input, time_us) & 0xFFF;
+            ++fifo.level;
+        }
+        adc.next_conversion_ns += adc.period_ns;
+        // Round robin to the next selected input.
+        for (uint i = 1; i <= NUM_ADC_INPUTS && adc.round_robin_mask; ++i)
+        {
+            const uint input = (adc.input + i) % NUM_ADC_INPUTS;
+            if (adc.round_robin_mask & (1u << input))
+            {
+                adc.input = input;
+                break;
+            }
+        }
+    }
+}
+}
+
+PIO pio0 = &pio_blocks[0];
+PIO pio1 = &pio_blocks[1];
+dma_hw_t* dma_hw = &dma_registers;
+adc_hw_t* adc_hw = &adc_registers;
+
+pio_rx_fifo_reg_t::operator uint32_t()
+{
+    if (level == 0)
+        return 0;
+    const uint32_t word = words[head];
+    head = (head + 1) % depth;
+    --level;
+    PIO pio;
+    uint sm;
+    if (find_fifo(this, &pio_hw_t::rxf, pio, sm))
+        reply_to_count_requests(pio, sm);
+    return word;
+}
+
+pio_tx_fifo_reg_t& pio_tx_fifo_reg_t::operator=(uint32_t)
+{
+    ++pending;
+    PIO pio;
+    uint sm;
+    if (find_fifo(this, &pio_hw_t::txf, pio, sm))
+        reply_to_count_requests(pio, sm);
+    return *this;
+}
+
+void sim_pio_sm_load(PIO pio, uint sm, sim_pio_program_t program, uint pin,
+                     uint rx_fifo_depth)
+{
+    state_machine_t& machine = state_machine(pio, sm);
+    machine.claimed = true;
+    machine.program = program;
+    machine.pin = pin;
+    pio->rxf[sm] = pio_rx_fifo_reg_t();
+    pio->rxf[sm].depth = rx_fifo_depth;
+    pio->txf[sm].pending = 0;
+    if (program == SIM_PIO_QUADRATURE_ENCODER)
+        machine.encoder_index = num_quadrature_encoders++;
+    machine.edge_encoder_index = -1;
+    if (program == SIM_PIO_ENCODER_EDGE_TIMER)
+    {
+        // Share the A input of a quadrature encoder.
+        for (const auto& block: state_machines)
+            for (const state_machine_t& other: block)
+                if (other.program == SIM_PIO_QUADRATURE_ENCODER
+                    && other.pin == pin)
+                    machine.edge_encoder_index = int32_t(other.encoder_index);
+        machine.position = 0;
+    }
+    machine.next_conversion_ns = time_us_64() * 1000
+                                 + 1'000'000'000ull
+                                   / sim_config.sensor_adc_rate_hz;
+    machine.enabled = true;
+}
+
+int pio_claim_unused_sm(PIO pio, bool required)
+{
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm)
+    {
+        state_machine_t& machine = state_machine(pio, sm);
+        if (machine.claimed)
+            continue;
+        machine.claimed = true;
+        return int(sm);
+    }
+    if (required)
+    {
+        fprintf(stderr, "No free state machine on PIO%u.\n", pio_get_index(pio));
+        abort();
+    }
+    return -1;
+}
+
+void pio_sm_unclaim(PIO pio, uint sm)
+{
+    state_machine(pio, sm) = state_machine_t();
+}
+
+uint pio_add_program(PIO, const pio_program_t*) {return 0;}
+void pio_add_program_at_offset(PIO, const pio_program_t*, uint) {}
+void pio_remove_program(PIO, const pio_program_t*, uint) {}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+    state_machine(pio, sm).enabled = enabled;
+}
+
+void pio_sm_clear_fifos(PIO pio, uint sm)
+{
+    pio->rxf[sm].level = 0;
+    pio->txf[sm].pending = 0;
+}
+
+int dma_claim_unused_channel(bool required)
+{
+    for (uint chan = 0; chan < NUM_DMA_CHANNELS; ++chan)
+    {
+        if (dma_channels[chan].claimed)
+            continue;
+        dma_channels[chan].claimed = true;
+        return int(chan);
+    }
+    if (required)
+    {
+        fprintf(stderr, "No free DMA channel.\n");
+        abort();
+    }
+    return -1;
+}
+
+void dma_channel_unclaim(uint channel)
+{
+    dma_channels[channel] = dma_channel_t();
+}
+
+bool dma_channel_is_claimed(uint channel)
+{
+    return dma_channels[channel].claimed;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config* config,
+                           volatile void* write_addr,
+                           const volatile void* read_addr,
+                           uint transfer_count, bool trigger)
+{
+    dma_channels[channel].config = *config;
+    dma_registers.ch[channel].write_addr = uintptr_t(write_addr);
+    dma_registers.ch[channel].read_addr = uintptr_t(read_addr);
+    dma_registers.ch[channel].transfer_count = transfer_count;
+    if (trigger)
+        dma_channel_start(channel);
+}
+
+void dma_channel_start(uint channel)
+{
+    dma_channels[channel].busy = true;
+    dma_channels[channel].paced_start_us = time_us_64();
+    dma_channels[channel].paced_transfers = 0;
+}
+
+void dma_channel_abort(uint channel)
+{
+    dma_channels[channel].busy = false;
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void* write_addr,
+                                bool trigger)
+{
+    dma_registers.ch[channel].write_addr = uintptr_t(write_addr);
+    if (trigger)
+        dma_channel_start(channel);
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t transfer_count,
+                                 bool trigger)
+{
+    dma_registers.ch[channel].transfer_count = transfer_count;
+    if (trigger)
+        dma_channel_start(channel);
+}
+
+int dma_claim_unused_timer(bool required)
+{
+    for (uint timer = 0; timer < NUM_DMA_TIMERS; ++timer)
+    {
+        if (dma_timers[timer].claimed)
+            continue;
+        dma_timers[timer].claimed = true;
+        return int(timer);
+    }
+    if (required)
+    {
+        fprintf(stderr, "No free DMA timer.\n");
+        abort();
+    }
+    return -1;
+}
+
+void dma_timer_unclaim(uint timer)
+{
+    dma_timers[timer] = dma_timer_t();
+}
+
+void dma_timer_set_fraction(uint timer, uint16_t numerator,
+                            uint16_t denominator)
+{
+    dma_timers[timer].numerator = numerator;
+    dma_timers[timer].denominator = denominator;
+}
+
+adc_fifo_reg_t::operator uint32_t()
+{
+    if (level == 0)
+        return 0;
+    const uint16_t word = words[head];
+    head = (head + 1) % ADC_FIFO_DEPTH;
+    --level;
+    return word;
+}
+
+void adc_init()
+{
+    adc_registers.cs = ADC_CS_READY_BITS;
+}
+
+void adc_select_input(uint input)
+{
+    adc.input = input;
+}
+
+void adc_set_round_robin(uint input_mask)
+{
+    adc.round_robin_mask = input_mask;
+}
+
+void adc_set_clkdiv(float clkdiv)
+{
+    // One conversion every (1 + clkdiv) ADC clock cycles.
+    adc.period_ns = uint64_t((1.0 + clkdiv) * 1e9 / ADC_CLOCK_HZ + 0.5);
+}
+
+void adc_run(bool run)
+{
+    if (run && !adc.running)
+        adc.next_conversion_ns = time_us_64() * 1000 + adc.period_ns;
+    adc.running = run;
+}
+
+void adc_fifo_drain()
+{
+    adc_registers.fifo.level = 0;
+}
+
+PIO_ADS7049::PIO_ADS7049(PIO pio, uint cs_pin, uint, uint,
+                         int program_offset)
+:pio_{pio}, sm_{uint(pio_claim_unused_sm(pio, true))}, cs_pin_{cs_pin},
+ program_offset_{uint(program_offset < 0 ? 0 : program_offset)}
+{}
+
+void PIO_ADS7049::setup_dma_stream_to_memory(uint16_t* address,
+                                             size_t sample_count)
+{
+    const uint chan = uint(dma_claim_unused_channel(true));
+    uint ring_size_bits = 0;
+    while ((size_t(1) << ring_size_bits) < sample_count * sizeof(uint16_t))
+        ++ring_size_bits;
+    dma_channel_config c = dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ring_size_bits);
+    channel_config_set_dreq(&c, pio_get_dreq(pio_, sm_, false));
+    dma_channel_configure(chan, &c, address, &pio_->rxf[sm_], 0xFFFFFFFF,
+                          true);
+}
+
+void PIO_ADS7049::start()
+{
+    sim_pio_sm_load(pio_, sm_, SIM_PIO_ADS7049, cs_pin_);
+}
+
+PIO_LTC264x::PIO_LTC264x(PIO pio, uint, uint, int)
+:pio_{pio}, sm_{uint(pio_claim_unused_sm(pio, true))}
+{}
+
+void PIO_LTC264x::write_value(uint16_t value)
+{
+    brake_dac_code = value;
+}
+
+void PIO_LTC264x::start()
+{
+    sim_pio_sm_load(pio_, sm_, SIM_PIO_LTC264X, 0);
+}
+
+void sim_advance_peripherals(uint64_t now_us)
+{
+    while (advanced_us < now_us)
+    {
+        const uint64_t time_us = ++advanced_us;
+        advance_state_machines(time_us);
+        advance_adc(time_us);
+        run_dma(time_us);
+    }
+}
+
+uint16_t sim_brake_dac_code() {return brake_dac_code;}
@@ -0,0 +1,279 @@
+// The simulation's clock, cores, alarms and flash, and its scheduler.
+#include <sim_internal.h>
+#include <pico/stdlib.h>
+#include <pico/multicore.h>
+#include <hardware/flash.h>
+#include <hardware/structs/systick.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ucontext.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// The firmware's main(), renamed when built for the simulation.
+int firmware_main();
+
+SensorModel* sim_model = nullptr;
+sim_config_t sim_config;
+
+uint8_t sim_flash[PICO_FLASH_SIZE_BYTES];
+
+uart_inst_t* uart0 = nullptr;
+uart_inst_t* uart1 = nullptr;
+
+namespace
+{
+constexpr size_t CORE_STACK_BYTES = 1 << 20;
+enum core_t
+{
+    CORE0 = 0,
+    CORE1 = 1,
+    NUM_CORES = 2,
+    SCHEDULER = -1
+};
+
+uint64_t now_us = 0;
+uint64_t next_core0_loop_us = 0;
+
+ucontext_t scheduler_context;
+ucontext_t core_contexts[NUM_CORES];
+char core_stacks[NUM_CORES][CORE_STACK_BYTES];
+bool core_launched[NUM_CORES];
+int current_core = SCHEDULER;
+bool in_interrupt = false;
+void (*core1_entry)() = nullptr;
+bool core1_start_pending = false;
+
+struct alarm_t
+{
+    bool claimed;
+    bool armed;
+    int core; // That set the callback, i.e: that the IRQ fires on.
+    uint64_t target_us;
+    hardware_alarm_callback_t callback;
+    uint64_t first_fire_us;
+    uint64_t last_fire_us;
+    sim_cost_t cost;
+};
+alarm_t alarms[NUM_TIMERS];
+
+sim_cost_t core1_loop_cost;
+
+systick_hw_t systick;
+
+void run_core0() {firmware_main();}
+void run_core1() {core1_entry();}
+
+void make_core(core_t core, void (*entry)())
+{
+    getcontext(&core_contexts[core]);
+    core_contexts[core].uc_stack.ss_sp = core_stacks[core];
+    core_contexts[core].uc_stack.ss_size = CORE_STACK_BYTES;
+    core_contexts[core].uc_link = &scheduler_context;
+    makecontext(&core_contexts[core], entry, 0);
+    core_launched[core] = true;
+}
+
+/**
+ * \brief run a core until it next yields.
+ */
+void resume(core_t core)
+{
+    current_core = core;
+    swapcontext(&scheduler_context, &core_contexts[core]);
+    current_core = SCHEDULER;
+}
+
+/**
+ * \brief run the callbacks of every alarm whose target has passed, in
+ *  target order.
+ * \returns true if any of them fired on core1.
+ */
+bool fire_due_alarms()
+{
+    bool core1_interrupted = false;
+    while (true)
+    {
+        alarm_t* due = nullptr;
+        for (alarm_t& alarm: alarms)
+            if (alarm.armed && alarm.target_us <= now_us
+                && (due == nullptr || alarm.target_us < due->target_us))
+                due = &alarm;
+        if (due == nullptr)
+            return core1_interrupted;
+        due->armed = false;
+        if (due->cost.calls == 0)
+            due->first_fire_us = now_us;
+        due->last_fire_us = now_us;
+        in_interrupt = true;
+        const auto start = std::chrono::steady_clock::now();
+        const double start_cycles = sim_read_cycles();
+        due->callback(uint(due - alarms));
+        const double cycles = sim_read_cycles() - start_cycles;
+        due->cost.add(std::chrono::duration<double, std::nano>(
+                          std::chrono::steady_clock::now() - start).count(),
+                      cycles);
+        in_interrupt = false;
+        core1_interrupted |= (due->core == CORE1);
+    }
+}
+
+uint64_t next_alarm_target_us()
+{
+    uint64_t target_us = UINT64_MAX;
+    for (const alarm_t& alarm: alarms)
+        if (alarm.armed && alarm.target_us < target_us)
+            target_us = alarm.target_us;
+    return target_us;
+}
+}
+
+systick_hw_t* systick_hw = &systick;
+
+void sim_cost_t::add(double ns, double cycles)
+{
+    ++calls;
+    total_ns += ns;
+    total_cycles += cycles;
+    if (ns > max_ns)
+        max_ns = ns;
+}
+
+double sim_read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return double(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+uint64_t time_us_64() {return now_us;}
+
+void tight_loop_contents()
+{
+    if (in_interrupt || current_core == SCHEDULER)
+        return;
+    swapcontext(&core_contexts[current_core], &scheduler_context);
+}
+
+void multicore_launch_core1(void (*entry)())
+{
+    core1_entry = entry;
+    make_core(CORE1, run_core1);
+    core1_start_pending = true;
+}
+
+int hardware_alarm_claim_unused(bool required)
+{
+    for (uint alarm_num = 0; alarm_num < NUM_TIMERS; ++alarm_num)
+    {
+        if (alarms[alarm_num].claimed)
+            continue;
+        alarms[alarm_num].claimed = true;
+        return int(alarm_num);
+    }
+    if (required)
+    {
+        fprintf(stderr, "No free hardware alarm.\n");
+        abort();
+    }
+    return -1;
+}
+
+void hardware_alarm_unclaim(uint alarm_num)
+{
+    alarms[alarm_num] = alarm_t();
+}
+
+void hardware_alarm_set_callback(uint alarm_num,
+                                 hardware_alarm_callback_t callback)
+{
+    alarms[alarm_num].callback = callback;
+    alarms[alarm_num].core = (current_core == CORE1) ? CORE1 : CORE0;
+}
+
+bool hardware_alarm_set_target(uint alarm_num, uint64_t target_us)
+{
+    alarm_t& alarm = alarms[alarm_num];
+    alarm.armed = (target_us > now_us);
+    alarm.target_us = target_us;
+    return !alarm.armed;
+}
+
+void hardware_alarm_cancel(uint alarm_num)
+{
+    alarms[alarm_num].armed = false;
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count)
+{
+    memset(&sim_flash[flash_offs], 0xFF, count);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t* data,
+                         size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        sim_flash[flash_offs + i] &= data[i];
+}
+
+void sim_boot(SensorModel& model, const sim_config_t& config)
+{
+    sim_model = &model;
+    sim_config = config;
+    memset(sim_flash, 0xFF, sizeof(sim_flash));
+    make_core(CORE0, run_core0);
+    resume(CORE0);
+    next_core0_loop_us = now_us + sim_config.core0_loop_period_us;
+}
+
+void sim_run_us(uint64_t duration_us)
+{
+    const uint64_t end_us = now_us + duration_us;
+    while (true)
+    {
+        sim_advance_peripherals(now_us);
+        const bool core1_due = fire_due_alarms() || core1_start_pending;
+        core1_start_pending = false;
+        if (core1_due && core_launched[CORE1])
+        {
+            const auto start = std::chrono::steady_clock::now();
+            const double start_cycles = sim_read_cycles();
+            resume(CORE1);
+            const double cycles = sim_read_cycles() - start_cycles;
+            core1_loop_cost.add(std::chrono::duration<double, std::nano>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count(),
+                                cycles);
+        }
+        if (now_us >= next_core0_loop_us)
+        {
+            resume(CORE0);
+            next_core0_loop_us += sim_config.core0_loop_period_us;
+        }
+        if (now_us >= end_us)
+            return;
+        uint64_t next_us = next_alarm_target_us();
+        if (next_core0_loop_us < next_us)
+            next_us = next_core0_loop_us;
+        now_us = (next_us < end_us) ? next_us : end_us;
+    }
+}
+
+uint64_t sim_time_us() {return now_us;}
+
+const sim_cost_t& sim_core1_loop_cost() {return core1_loop_cost;}
+
+const sim_cost_t& sim_alarm_cost(uint32_t alarm_num, double& period_us)
+{
+    const alarm_t& alarm = alarms[alarm_num];
+    period_us = (alarm.cost.calls > 1)
+                ? double(alarm.last_fire_us - alarm.first_fire_us)
+                  / double(alarm.cost.calls - 1)
+                : 0;
+    return alarm.cost;
+}
@@ -0,0 +1,18 @@
+#ifndef SIM_INTERNAL_H
+#define SIM_INTERNAL_H
+// Shared between the simulation's stand-ins. Not for the firmware or for
+// simulation drivers, which use firmware_sim.h.
+#include <firmware_sim.h>
+
+extern SensorModel* sim_model;
+extern sim_config_t sim_config;
+
+/**
+ * \brief run the PIO state machines, the on-chip ADC and DMA up to and
+ *  including now_us, one [us] at a time.
+ */
+void sim_advance_peripherals(uint64_t now_us);
+
+double sim_read_cycles();
+
+#endif // SIM_INTERNAL_H
@@ -0,0 +1,38 @@
+#include <event_columns.h>
+
+EventColumns::EventColumns(size_t capacity)
+{
+    size_t rounded = 1;
+    while (rounded < capacity)
+        rounded <<= 1;
+    mask_ = rounded - 1;
+    time_us_.resize(rounded);
+    for (auto& column: fields_)
+        column.resize(rounded);
+    clear();
+}
+
+EventColumns::~EventColumns()
+{}
+
+size_t EventColumns::contiguous(size_t index) const
+{
+    if (index >= size())
+        return 0;
+    const size_t to_end = capacity() - slot(index);
+    const size_t remaining = size() - index;
+    return (remaining < to_end) ? remaining : to_end;
+}
+
+void EventColumns::discard(size_t count)
+{
+    tail_ += (count < size()) ? count : size();
+}
+
+void EventColumns::clear()
+{
+    head_ = 0;
+    tail_ = 0;
+    overwritten_ = 0;
+    num_fields_ = 0;
+}
@@ -0,0 +1,81 @@
+#include <harp_frame.h>
+
+size_t encode_harp_frame(uint8_t* out, uint8_t message_type, uint8_t address,
+                         uint8_t payload_type, const void* payload,
+                         uint8_t payload_length, int64_t harp_time_us)
+{
+    const bool has_timestamp = (harp_time_us >= 0);
+    const size_t header_bytes = HARP_HEADER_BYTES
+                                + (has_timestamp ? HARP_TIMESTAMP_BYTES : 0);
+    const size_t size = header_bytes + payload_length + 1;
+    if (size > HARP_MAX_FRAME_BYTES)
+        return 0;
+    out[0] = message_type;
+    out[1] = uint8_t(size - 2);
+    out[2] = address;
+    out[3] = HARP_DEFAULT_PORT;
+    out[4] = payload_type | (has_timestamp ? HARP_TIMESTAMP_FLAG : 0);
+    if (has_timestamp)
+    {
+        const uint32_t seconds = uint32_t(harp_time_us / 1'000'000);
+        const uint16_t ticks = uint16_t((harp_time_us % 1'000'000) / 32);
+        memcpy(&out[5], &seconds, sizeof(seconds));
+        memcpy(&out[9], &ticks, sizeof(ticks));
+    }
+    memcpy(&out[header_bytes], payload, payload_length);
+    uint8_t checksum = 0;
+    for (size_t i = 0; i < size - 1; ++i)
+        checksum += out[i];
+    out[size - 1] = checksum;
+    return size;
+}
+
+HarpFrameParser::HarpFrameParser()
+{
+    reset();
+}
+
+HarpFrameParser::~HarpFrameParser()
+{}
+
+void HarpFrameParser::reset()
+{
+    partial_size_ = 0;
+    frame_count_ = 0;
+    skipped_bytes_ = 0;
+}
+
+bool HarpFrameParser::decode(const uint8_t* bytes, size_t size,
+                             harp_frame_t& frame)
+{
+    if (size < HARP_HEADER_BYTES + 1 || size != frame_size(bytes[1]))
+        return false;
+    uint8_t checksum = 0;
+    for (size_t i = 0; i < size - 1; ++i)
+        checksum += bytes[i];
+    if (checksum != bytes[size - 1])
+        return false;
+    frame.message_type = bytes[0];
+    frame.address = bytes[2];
+    frame.port = bytes[3];
+    frame.has_timestamp = bytes[4] & HARP_TIMESTAMP_FLAG;
+    frame.payload_type = bytes[4] & ~HARP_TIMESTAMP_FLAG;
+    size_t header_bytes = HARP_HEADER_BYTES;
+    frame.harp_time_us = 0;
+    if (frame.has_timestamp)
+    {
+        header_bytes += HARP_TIMESTAMP_BYTES;
+        if (size < header_bytes + 1)
+            return false;
+        uint32_t seconds;
+        uint16_t ticks;
+        memcpy(&seconds, &bytes[5], sizeof(seconds));
+        memcpy(&ticks, &bytes[9], sizeof(ticks));
+        frame.harp_time_us = uint64_t(seconds) * 1'000'000
+                             + uint64_t(ticks) * 32;
+    }
+    const uint8_t element_size = frame.payload_type & 0x0F;
+    frame.payload = &bytes[header_bytes];
+    frame.payload_length = uint8_t(size - header_bytes - 1);
+    return element_size != 0 && frame.payload_length % element_size == 0;
+}
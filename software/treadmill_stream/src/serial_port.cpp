@@ -0,0 +1,81 @@
+#include <serial_port.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+SerialPort::SerialPort()
+:fd_{-1}
+{}
+
+SerialPort::~SerialPort()
+{
+    close();
+}
+
+bool SerialPort::open(const std::string& path)
+{
+    close();
+    fd_ = ::open(path.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd_ < 0)
+        return false;
+    termios tty;
+    if (tcgetattr(fd_, &tty) != 0)
+    {
+        close();
+        return false;
+    }
+    cfmakeraw(&tty);
+    tty.c_cflag |= CLOCAL | CREAD;
+    if (tcsetattr(fd_, TCSANOW, &tty) != 0)
+    {
+        close();
+        return false;
+    }
+    tcflush(fd_, TCIOFLUSH);
+    return true;
+}
+
+void SerialPort::close()
+{
+    if (fd_ < 0)
+        return;
+    ::close(fd_);
+    fd_ = -1;
+}
+
+long SerialPort::read(uint8_t* dest, size_t max_bytes, int timeout_ms)
+{
+    pollfd pfd{fd_, POLLIN, 0};
+    const int ready = poll(&pfd, 1, timeout_ms);
+    if (ready < 0)
+        return (errno == EINTR) ? 0 : -1;
+    if (ready == 0)
+        return 0;
+    const ssize_t num_bytes = ::read(fd_, dest, max_bytes);
+    if (num_bytes < 0)
+        return (errno == EAGAIN || errno == EINTR) ? 0 : -1;
+    return long(num_bytes);
+}
+
+bool SerialPort::write(const uint8_t* data, size_t num_bytes)
+{
+    while (num_bytes > 0)
+    {
+        const ssize_t written = ::write(fd_, data, num_bytes);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno != EAGAIN)
+                return false;
+            pollfd pfd{fd_, POLLOUT, 0};
+            poll(&pfd, 1, 100);
+            continue;
+        }
+        data += written;
+        num_bytes -= size_t(written);
+    }
+    return true;
+}
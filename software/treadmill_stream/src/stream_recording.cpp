@@ -0,0 +1,107 @@
+#include <stream_recording.h>
+#include <cstring>
+
+constexpr char stream_recording_t::MAGIC[8];
+
+StreamRecorder::StreamRecorder()
+:file_{nullptr}, bytes_recorded_{0}
+{}
+
+StreamRecorder::~StreamRecorder()
+{
+    close();
+}
+
+bool StreamRecorder::open(const std::string& path)
+{
+    close();
+    file_ = fopen(path.c_str(), "wb");
+    if (file_ == nullptr)
+        return false;
+    const uint32_t version = stream_recording_t::VERSION;
+    const uint32_t reserved = 0;
+    if (fwrite(stream_recording_t::MAGIC, sizeof(stream_recording_t::MAGIC),
+               1, file_) != 1
+        || fwrite(&version, sizeof(version), 1, file_) != 1
+        || fwrite(&reserved, sizeof(reserved), 1, file_) != 1)
+    {
+        close();
+        return false;
+    }
+    bytes_recorded_ = 0;
+    return true;
+}
+
+void StreamRecorder::close()
+{
+    if (file_ == nullptr)
+        return;
+    fclose(file_);
+    file_ = nullptr;
+}
+
+bool StreamRecorder::write(uint64_t host_time_ns, const uint8_t* data,
+                           size_t num_bytes)
+{
+    const uint32_t length = uint32_t(num_bytes);
+    if (fwrite(&host_time_ns, sizeof(host_time_ns), 1, file_) != 1
+        || fwrite(&length, sizeof(length), 1, file_) != 1
+        || fwrite(data, 1, num_bytes, file_) != num_bytes)
+        return false;
+    bytes_recorded_ += num_bytes;
+    return true;
+}
+
+StreamReplay::StreamReplay()
+:file_{nullptr}
+{}
+
+StreamReplay::~StreamReplay()
+{
+    close();
+}
+
+bool StreamReplay::open(const std::string& path)
+{
+    close();
+    file_ = fopen(path.c_str(), "rb");
+    if (file_ == nullptr)
+        return false;
+    char magic[sizeof(stream_recording_t::MAGIC)];
+    uint32_t version;
+    uint32_t reserved;
+    if (fread(magic, sizeof(magic), 1, file_) != 1
+        || fread(&version, sizeof(version), 1, file_) != 1
+        || fread(&reserved, sizeof(reserved), 1, file_) != 1
+        || memcmp(magic, stream_recording_t::MAGIC, sizeof(magic)) != 0
+        || version != stream_recording_t::VERSION)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void StreamReplay::close()
+{
+    if (file_ == nullptr)
+        return;
+    fclose(file_);
+    file_ = nullptr;
+}
+
+bool StreamReplay::next(uint64_t& host_time_ns, const uint8_t*& data,
+                        size_t& num_bytes)
+{
+    uint32_t length;
+    if (file_ == nullptr
+        || fread(&host_time_ns, sizeof(host_time_ns), 1, file_) != 1
+        || fread(&length, sizeof(length), 1, file_) != 1)
+        return false;
+    chunk_.resize(length);
+    if (fread(chunk_.data(), 1, length, file_) != length)
+        return false;
+    data = chunk_.data();
+    num_bytes = length;
+    return true;
+}
@@ -0,0 +1,122 @@
+#include <treadmill_stream.h>
+#include <chrono>
+
+namespace
+{
+uint64_t host_time_ns()
+{
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+}
+
+TreadmillStream::TreadmillStream(size_t capacity)
+:sensor_data_{capacity}, torque_limit_events_{256}, other_frames_{0}
+{}
+
+TreadmillStream::~TreadmillStream()
+{}
+
+void TreadmillStream::feed(const uint8_t* data, size_t num_bytes)
+{
+    parser_.parse(data, num_bytes,
+                  [this](const harp_frame_t& frame){decode(frame);});
+}
+
+bool TreadmillStream::replay(const std::string& path)
+{
+    StreamReplay recording;
+    if (!recording.open(path))
+        return false;
+    uint64_t time_ns;
+    const uint8_t* data;
+    size_t num_bytes;
+    while (recording.next(time_ns, data, num_bytes))
+        feed(data, num_bytes);
+    return true;
+}
+
+void TreadmillStream::clear()
+{
+    parser_.reset();
+    sensor_data_.clear();
+    torque_limit_events_.clear();
+    other_frames_ = 0;
+}
+
+void TreadmillStream::decode(const harp_frame_t& frame)
+{
+    if (frame.message_type == HARP_EVENT
+        && frame.address == SENSOR_DATA_ADDRESS
+        && frame.payload_type == HARP_S32)
+    {
+        int32_t values[EventColumns::MAX_FIELDS];
+        size_t num_fields = frame.num_elements();
+        if (num_fields > EventColumns::MAX_FIELDS)
+            num_fields = EventColumns::MAX_FIELDS;
+        for (size_t i = 0; i < num_fields; ++i)
+            values[i] = frame.element<int32_t>(i);
+        sensor_data_.push(frame.harp_time_us, values, num_fields);
+        return;
+    }
+    if (frame.message_type == HARP_EVENT
+        && frame.address == TORQUE_LIMIT_TRIGGERED_ADDRESS
+        && frame.payload_type == HARP_U8 && frame.payload_length > 0)
+    {
+        const int32_t value = frame.payload[0];
+        torque_limit_events_.push(frame.harp_time_us, &value, 1);
+        return;
+    }
+    ++other_frames_;
+}
+
+TreadmillDevice::TreadmillDevice(size_t capacity)
+:stream_{capacity}, recording_start_ns_{0}
+{}
+
+TreadmillDevice::~TreadmillDevice()
+{}
+
+bool TreadmillDevice::open(const std::string& port)
+{
+    stream_.clear();
+    return port_.open(port);
+}
+
+void TreadmillDevice::close()
+{
+    port_.close();
+    recorder_.close();
+}
+
+bool TreadmillDevice::record(const std::string& path)
+{
+    recorder_.close();
+    if (path.empty())
+        return true;
+    recording_start_ns_ = host_time_ns();
+    return recorder_.open(path);
+}
+
+bool TreadmillDevice::set_sensor_dispatch_frequency_hz(uint16_t frequency_hz)
+{
+    uint8_t frame[HARP_MAX_FRAME_BYTES];
+    const size_t size = encode_harp_frame(frame, HARP_WRITE,
+                                          SENSOR_DISPATCH_FREQUENCY_ADDRESS,
+                                          HARP_U16, &frequency_hz,
+                                          sizeof(frequency_hz));
+    return port_.write(frame, size);
+}
+
+long TreadmillDevice::poll(int timeout_ms)
+{
+    const long num_bytes = port_.read(read_buffer_, sizeof(read_buffer_),
+                                      timeout_ms);
+    if (num_bytes <= 0)
+        return num_bytes;
+    if (recorder_.is_open())
+        recorder_.write(host_time_ns() - recording_start_ns_, read_buffer_,
+                        size_t(num_bytes));
+    stream_.feed(read_buffer_, size_t(num_bytes));
+    return num_bytes;
+}
@@ -0,0 +1,204 @@
+// Check the firmware's ADCDecimator against a reference average, then check
+// the AuxAnalog events that it produces on the simulated device of
+// firmware_sim.
+// Interleaved streams of random conversions, for every number of inputs, are
+// fed in starting partway through a round, and every value must be the
+// rounded mean of whole rounds. Sums must not overflow at the largest
+// decimation and conversion. On the simulated device, the auxiliary analog
+// input ramps by one count every 100 [us], so each event's value must be the
+// ramp halfway through the event's averaging window, which ends when the
+// event is stamped.
+// Usage: adc_decimator_test
+#include <adc_decimator.h>
+#include <firmware_sim.h>
+#include <treadmill_stream.h>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr uint32_t AUX_ADC_CONVERSION_RATE_HZ = 100'000;
+constexpr uint8_t AUX_ANALOG_DISPATCH_RATE_ADDRESS = 101;
+constexpr uint8_t AUX_ANALOG_ADDRESS = 102;
+constexpr uint8_t AUX_ANALOG_SAMPLING_ADDRESS = 103;
+
+constexpr size_t NUM_CHECKED_VALUES = 2000; // Per configuration.
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+bool check_configuration()
+{
+    ADCDecimator decimator;
+    bool ok = decimator.num_inputs() == 1 && decimator.decimation() == 1;
+    ok &= decimator.configure(3, 7);
+    // Rejected configurations leave it unchanged.
+    ok &= !decimator.configure(0, 1)
+          && !decimator.configure(ADCDecimator::MAX_INPUTS + 1, 1)
+          && !decimator.configure(2, 0)
+          && !decimator.configure(2, ADCDecimator::MAX_DECIMATION + 1);
+    ok &= decimator.num_inputs() == 3 && decimator.decimation() == 7;
+    // Halves round up: 1 and 2 average to 2.
+    ok &= decimator.configure(1, 2) && !decimator.add(0, 1)
+          && decimator.add(0, 2) && decimator.values()[0] == 2;
+    // A reset mid-period discards the partial sums, and waits for input 0.
+    ok &= decimator.configure(2, 2);
+    decimator.add(0, 4000);
+    decimator.add(1, 4000);
+    decimator.add(0, 4000);
+    decimator.reset();
+    ok &= !decimator.add(1, 4000) && !decimator.add(0, 10)
+          && !decimator.add(1, 20) && !decimator.add(0, 30)
+          && decimator.add(1, 40) && decimator.values()[0] == 20
+          && decimator.values()[1] == 30;
+    return check("Configurations are checked, and values rounded", ok);
+}
+
+bool check_against_reference()
+{
+    std::mt19937 rng(24);
+    std::uniform_int_distribution<uint32_t> conversion(0, 4095);
+    std::uniform_int_distribution<uint32_t> decimation(1, 64);
+    size_t mismatches = 0;
+    size_t num_values = 0;
+    for (uint32_t num_inputs = 1; num_inputs <= ADCDecimator::MAX_INPUTS;
+         ++num_inputs)
+    {
+        ADCDecimator decimator;
+        const uint32_t rounds = decimation(rng);
+        bool ok = decimator.configure(num_inputs, rounds);
+        // Start on the last input, which must be dropped.
+        uint32_t input = num_inputs - 1;
+        std::vector<uint64_t> sums(num_inputs, 0);
+        bool synced = false;
+        size_t completed = 0;
+        uint32_t rounds_done = 0;
+        while (completed < NUM_CHECKED_VALUES)
+        {
+            const uint16_t value = uint16_t(conversion(rng));
+            synced |= input == 0;
+            if (synced)
+                sums[input] += value;
+            const bool updated = decimator.add(input, value);
+            const bool end_of_round = synced && input == num_inputs - 1;
+            const bool expected = end_of_round && ++rounds_done == rounds;
+            ok &= updated == expected;
+            if (expected)
+            {
+                for (uint32_t i = 0; i < num_inputs; ++i)
+                {
+                    const uint16_t mean = uint16_t(std::floor(
+                        double(sums[i]) / rounds + 0.5));
+                    mismatches += decimator.values()[i] != mean;
+                    sums[i] = 0;
+                }
+                rounds_done = 0;
+                ++completed;
+            }
+            input = (input + 1) % num_inputs;
+        }
+        mismatches += !ok;
+        num_values += completed * num_inputs;
+    }
+    printf("%zu mismatches in %zu values of 1 to %u inputs.\n", mismatches,
+           num_values, ADCDecimator::MAX_INPUTS);
+    return check("Values are the rounded means of whole rounds",
+                 mismatches == 0);
+}
+
+bool check_largest_sums()
+{
+    ADCDecimator decimator;
+    bool ok = decimator.configure(ADCDecimator::MAX_INPUTS,
+                                  ADCDecimator::MAX_DECIMATION);
+    size_t updates = 0;
+    for (uint32_t round = 0; round < ADCDecimator::MAX_DECIMATION; ++round)
+        for (uint32_t i = 0; i < ADCDecimator::MAX_INPUTS; ++i)
+            updates += decimator.add(i, UINT16_MAX);
+    ok &= updates == 1;
+    for (uint32_t i = 0; i < ADCDecimator::MAX_INPUTS; ++i)
+        ok &= decimator.values()[i] == UINT16_MAX;
+    return check("Sums of the largest decimation do not overflow", ok);
+}
+
+/**
+ * \brief the auxiliary analog input ramps up one count every RAMP_US.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    static constexpr uint64_t RAMP_US = 100;
+    static constexpr uint16_t RAMP_BASE = 500;
+
+    int32_t encoder_counts(uint32_t, uint64_t) override {return 0;}
+    uint16_t torque_counts(uint64_t) override {return 2048;}
+    uint16_t brake_current_counts(uint64_t, uint16_t) override {return 10;}
+
+    uint16_t aux_analog_counts(uint32_t, uint64_t time_us) override
+    {return uint16_t(RAMP_BASE + time_us / RAMP_US);}
+};
+
+bool check_device()
+{
+    Treadmill treadmill;
+    sim_boot(treadmill);
+    sim_run_us(10'000);
+    const uint16_t rate_hz = 100;
+    sim_write_register(AUX_ANALOG_DISPATCH_RATE_ADDRESS, HARP_U16, &rate_hz,
+                       sizeof(rate_hz));
+    sim_run_us(1000);
+    sim_read_register(AUX_ANALOG_SAMPLING_ADDRESS);
+    sim_run_us(200'000);
+    const std::vector<uint8_t> output = sim_take_usb_output();
+    uint32_t sampling[2] = {0, 0};
+    size_t num_events = 0;
+    size_t wrong_values = 0;
+    int64_t max_error = 0;
+    HarpFrameParser parser;
+    parser.parse(output.data(), output.size(), [&](const harp_frame_t& frame)
+    {
+        if (frame.message_type == HARP_READ
+            && frame.address == AUX_ANALOG_SAMPLING_ADDRESS)
+        {
+            sampling[0] = frame.element<uint32_t>(0);
+            sampling[1] = frame.element<uint32_t>(1);
+            return;
+        }
+        if (frame.message_type != HARP_EVENT
+            || frame.address != AUX_ANALOG_ADDRESS)
+            return;
+        ++num_events;
+        // The window ends within a Harp tick and a core0 loop of the stamp.
+        const uint64_t window_us = 1'000'000 / rate_hz;
+        const int64_t expected = Treadmill::RAMP_BASE
+                                 + int64_t(frame.harp_time_us - window_us / 2)
+                                   / int64_t(Treadmill::RAMP_US);
+        const int64_t error = llabs(frame.element<uint16_t>(0) - expected);
+        max_error = (error > max_error) ? error : max_error;
+        wrong_values += error > 1;
+    });
+    printf("AuxAnalogSampling at %u [Hz]: [%u, %u]. %zu AuxAnalog events, up "
+           "to %lld [counts] from the middle of their window.\n", rate_hz,
+           sampling[0], sampling[1], num_events, (long long)max_error);
+    bool ok = sampling[0] == AUX_ADC_CONVERSION_RATE_HZ / rate_hz
+              && sampling[1] == AUX_ADC_CONVERSION_RATE_HZ;
+    ok &= num_events + 1 >= 200'000 * rate_hz / 1'000'000
+          && wrong_values == 0;
+    return check("AuxAnalog events average their whole window", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_configuration();
+    ok &= check_against_reference();
+    ok &= check_largest_sums();
+    ok &= check_device();
+    return ok ? 0 : 1;
+}
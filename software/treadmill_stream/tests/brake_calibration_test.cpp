@@ -0,0 +1,179 @@
+// Check that the firmware's BrakeCalibration gives the setpoints that the
+// Python fit it was uploaded from asks for.
+// Tables are exported by software/scripts/brake_calibration/
+// upload_calibration.py --export, which samples the notebook's power-law fit
+// on the firmware's grid exactly as it does before an upload, and writes the
+// table's checksum and its setpoints, interpolated in Python, at every Q16.16
+// torque step up to a little past full scale, next to the fit's. The same
+// table is loaded into BrakeCalibration, which must match the checksum and
+// the Python setpoints to within its fixed-point rounding. A table that
+// follows the fit to within a 12-bit DAC step must still do so on the device.
+// Without tables, only the table handling is checked.
+// Usage: brake_calibration_test [table.csv ...]
+#include <brake_calibration.h>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+// Setpoints are 16-bit codes for a 12-bit DAC.
+constexpr double DAC_STEP_CODES = 16;
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+struct setpoint_t
+{
+    uint32_t torque_q16;
+    double interpolated; // By Python, from the table.
+    double fit; // By Python, from the fit the table samples.
+};
+
+struct table_t
+{
+    std::vector<uint16_t> points;
+    uint32_t full_scale_torque_q16;
+    uint32_t checksum;
+    std::vector<setpoint_t> setpoints;
+};
+
+/**
+ * \brief how far evaluate() may round away from the exact interpolation:
+ *  the Q16.16 position on the table and its Q15 fraction are rounded down,
+ *  each by less than 2^-15 of the step between points, and so is the result.
+ */
+double max_rounding(const table_t& table, uint32_t torque_q16)
+{
+    const size_t last = table.points.size() - 1;
+    if (torque_q16 >= table.full_scale_torque_q16)
+        return 0;
+    const size_t index = size_t(uint64_t(torque_q16) * last
+                                / table.full_scale_torque_q16);
+    const double step = (index < last)
+                        ? fabs(double(table.points[index + 1])
+                               - table.points[index])
+                        : 0;
+    return 1 + 2 * step / 32768;
+}
+
+bool read_table(const char* path, table_t& table)
+{
+    FILE* file = fopen(path, "r");
+    if (file == nullptr)
+        return false;
+    unsigned num_points = 0;
+    bool ok = fscanf(file, "%u,%u,%u", &num_points,
+                     &table.full_scale_torque_q16, &table.checksum) == 3
+              && num_points <= BrakeCalibration::MAX_POINTS;
+    table.points.resize(ok ? num_points : 0);
+    for (uint16_t& point: table.points)
+    {
+        unsigned value = 0;
+        ok &= fscanf(file, " %u,", &value) == 1;
+        point = uint16_t(value);
+    }
+    setpoint_t setpoint;
+    while (ok && fscanf(file, " %u,%lf,%lf", &setpoint.torque_q16,
+                        &setpoint.interpolated, &setpoint.fit) == 3)
+        table.setpoints.push_back(setpoint);
+    fclose(file);
+    return ok && !table.setpoints.empty();
+}
+
+bool check_table_handling()
+{
+    BrakeCalibration calibration;
+    bool ok = !calibration.is_valid() && calibration.evaluate(1 << 16) == 0
+              && calibration.checksum() == 0;
+    // Rejected configurations leave the table unchanged.
+    const uint16_t points[] = {100, 200, 400};
+    ok &= calibration.write(0, points, 3) == 3;
+    ok &= !calibration.configure(1, 1 << 16)
+          && !calibration.configure(BrakeCalibration::MAX_POINTS + 1, 1 << 16)
+          && !calibration.configure(3, 0) && !calibration.is_valid();
+    ok &= calibration.write(BrakeCalibration::MAX_POINTS - 1, points, 3) == 1;
+    ok &= calibration.configure(3, 2 << 16);
+    ok &= calibration.evaluate(0) == 100 && calibration.evaluate(1 << 15) == 150
+          && calibration.evaluate(1 << 16) == 200
+          && calibration.evaluate(3 << 15) == 300
+          && calibration.evaluate(2 << 16) == 400
+          && calibration.evaluate(UINT32_MAX) == 400;
+    // A saved record loads back, and a corrupted one is refused.
+    BrakeCalibration::record_t record;
+    calibration.save(record);
+    BrakeCalibration loaded;
+    ok &= loaded.load(record) && loaded.checksum() == calibration.checksum()
+          && loaded.evaluate(3 << 15) == 300;
+    record.points[1] ^= 1;
+    ok &= !loaded.load(record) && loaded.evaluate(3 << 15) == 300;
+    record.points[1] ^= 1;
+    record.magic = 0xFFFFFFFF;
+    ok &= !loaded.load(record);
+    BrakeCalibration copied;
+    copied.copy(calibration);
+    ok &= copied.checksum() == calibration.checksum();
+    copied.copy(BrakeCalibration());
+    ok &= !copied.is_valid();
+    return check("Tables are configured, saved and loaded", ok);
+}
+
+bool check_exported_table(const char* path)
+{
+    table_t table;
+    if (!read_table(path, table))
+    {
+        printf("Could not read %s.\n", path);
+        return false;
+    }
+    BrakeCalibration calibration;
+    calibration.write(0, table.points.data(), table.points.size());
+    bool ok = calibration.configure(table.points.size(),
+                                    table.full_scale_torque_q16);
+    ok &= calibration.checksum() == table.checksum;
+    double max_table_error = 0;
+    double max_fit_error = 0;
+    double max_table_fit_error = 0;
+    size_t mismatches = 0;
+    for (const setpoint_t& setpoint: table.setpoints)
+    {
+        const double value = calibration.evaluate(setpoint.torque_q16);
+        const double table_error = fabs(value - setpoint.interpolated);
+        const double fit_error = fabs(value - setpoint.fit);
+        const double table_fit_error = fabs(setpoint.interpolated - setpoint.fit);
+        max_table_error = fmax(max_table_error, table_error);
+        max_fit_error = fmax(max_fit_error, fit_error);
+        max_table_fit_error = fmax(max_table_fit_error, table_fit_error);
+        mismatches += table_error > max_rounding(table, setpoint.torque_q16);
+    }
+    // What the device stores in flash loads back to the same table.
+    BrakeCalibration::record_t record;
+    calibration.save(record);
+    BrakeCalibration loaded;
+    ok &= loaded.load(record) && loaded.checksum() == table.checksum;
+    printf("%s: %zu points up to %.4f [N*m], checksum 0x%08X. %zu mismatches "
+           "in %zu torques, within %.2f [codes] of the Python table. %.2f "
+           "[codes] from the fit, the table itself %.2f [codes] (%.1f DAC "
+           "steps).\n", path, table.points.size(),
+           table.full_scale_torque_q16 / 65536.0, calibration.checksum(),
+           mismatches, table.setpoints.size(), max_table_error, max_fit_error,
+           max_table_fit_error, max_table_fit_error / DAC_STEP_CODES);
+    // A table that follows the fit to within a DAC step still does on the
+    // device.
+    ok &= max_table_fit_error >= DAC_STEP_CODES
+          || max_fit_error < DAC_STEP_CODES;
+    return check("BrakeCalibration matches the Python fit",
+                 ok && mismatches == 0);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    bool ok = check_table_handling();
+    for (int i = 1; i < argc; ++i)
+        ok &= check_exported_table(argv[i]);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,381 @@
+// Check BrakeTrajectory's table handling and playback, then play trajectories
+// through the whole firmware on the simulated device (see firmware_sim).
+// On the device, points must reach the brake DAC exactly one sample period
+// apart, one-shot playback must end with an event and hold the last point,
+// looping must wrap seamlessly, and a table uploaded during playback must only
+// be swapped in when playback is next started. A torque limit trip aborts
+// playback.
+#include <brake_trajectory.h>
+#include <firmware_sim.h>
+#include <harp_frame.h>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr uint8_t BRAKE_TRAJECTORY_WRITE_INDEX_ADDRESS = 62;
+constexpr uint8_t BRAKE_TRAJECTORY_DATA_ADDRESS = 63;
+constexpr uint8_t BRAKE_TRAJECTORY_LENGTH_ADDRESS = 64;
+constexpr uint8_t BRAKE_TRAJECTORY_SAMPLE_RATE_ADDRESS = 65;
+constexpr uint8_t BRAKE_TRAJECTORY_PLAYBACK_ADDRESS = 66;
+constexpr size_t MAX_TRAJECTORY_POINTS_PER_WRITE = 120;
+constexpr uint16_t RAW_TORQUE_SENSOR_MAX = 3995;
+
+// Time for a register write to reach core1: a core0 loop turn, then core1
+// applies commands once per 100 [us] tick.
+constexpr uint64_t MAX_COMMAND_LATENCY_US = 120;
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief treadmill at rest with mid-scale torque until an overload.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    Treadmill(): overload_from_us_{UINT64_MAX} {}
+
+    void overload_from(uint64_t time_us) {overload_from_us_ = time_us;}
+
+    int32_t encoder_counts(uint32_t, uint64_t) override {return 0;}
+
+    uint16_t torque_counts(uint64_t time_us) override
+    {return (time_us >= overload_from_us_) ? RAW_TORQUE_SENSOR_MAX + 50 : 2048;}
+
+    uint16_t brake_current_counts(uint64_t, uint16_t brake_dac_code) override
+    {return brake_dac_code >> 4;}
+
+private:
+    uint64_t overload_from_us_;
+};
+
+std::vector<uint16_t> ramp(uint16_t first, size_t count)
+{
+    std::vector<uint16_t> points(count);
+    for (size_t i = 0; i < count; ++i)
+        points[i] = uint16_t(first + 16 * i);
+    return points;
+}
+
+bool check_table_handling()
+{
+    BrakeTrajectory trajectory;
+    bool ok = !trajectory.start(false); // Empty.
+    const std::vector<uint16_t> points = ramp(100, 8);
+    // Points past the end are dropped.
+    ok &= trajectory.write(BrakeTrajectory::MAX_POINTS - 3, points.data(),
+                           points.size()) == 3
+          && trajectory.point(BrakeTrajectory::MAX_POINTS - 1) == points[2]
+          && trajectory.write(BrakeTrajectory::MAX_POINTS, points.data(), 1)
+             == 0;
+    ok &= trajectory.write(0, points.data(), points.size()) == points.size();
+    ok &= !trajectory.set_length(BrakeTrajectory::MAX_POINTS + 1)
+          && trajectory.length() == 0
+          && trajectory.set_length(BrakeTrajectory::MAX_POINTS)
+          && trajectory.set_length(points.size());
+    // A copy takes the points and length but not the playback state.
+    BrakeTrajectory copy;
+    ok &= trajectory.start(false);
+    copy.copy_table(trajectory);
+    ok &= !copy.is_playing() && copy.length() == points.size()
+          && copy.point(BrakeTrajectory::MAX_POINTS - 1) == points[2];
+    for (size_t i = 0; i < points.size(); ++i)
+        ok &= copy.point(i) == points[i];
+    return check("Trajectory table writes, length and copies", ok);
+}
+
+bool check_one_shot_and_loop()
+{
+    BrakeTrajectory trajectory;
+    const std::vector<uint16_t> points = ramp(100, 5);
+    trajectory.write(0, points.data(), points.size());
+    trajectory.set_length(points.size());
+    // Once: every point in order, then done.
+    bool ok = trajectory.start(false);
+    uint16_t value;
+    for (size_t i = 0; i < points.size(); ++i)
+        ok &= trajectory.position() == i && trajectory.next(value)
+              && value == points[i];
+    ok &= !trajectory.next(value) && !trajectory.is_playing()
+          && !trajectory.next(value);
+    // Loop: wraps back to the first point, and stops on request.
+    ok &= trajectory.start(true);
+    for (size_t i = 0; i < 3 * points.size(); ++i)
+        ok &= trajectory.next(value) && value == points[i % points.size()];
+    trajectory.stop();
+    ok &= !trajectory.is_playing() && !trajectory.next(value);
+    // Restarting from the middle of playback starts from the first point.
+    ok &= trajectory.start(false) && trajectory.next(value)
+          && trajectory.next(value) && trajectory.start(false)
+          && trajectory.next(value) && value == points[0];
+    return check("Trajectory one-shot and looping playback", ok);
+}
+
+/**
+ * \brief a brake DAC write seen on the simulated device.
+ */
+struct dac_write_t
+{
+    uint64_t time_us;
+    uint16_t code;
+};
+
+/**
+ * \brief run the device, recording each change of the brake DAC code.
+ */
+std::vector<dac_write_t> watch_brake_dac(uint64_t duration_us)
+{
+    std::vector<dac_write_t> writes;
+    uint16_t code = sim_brake_dac_code();
+    const uint64_t end_us = sim_time_us() + duration_us;
+    while (sim_time_us() < end_us)
+    {
+        sim_run_us(1);
+        if (sim_brake_dac_code() == code)
+            continue;
+        code = sim_brake_dac_code();
+        writes.push_back({sim_time_us(), code});
+    }
+    return writes;
+}
+
+/**
+ * \brief a reply or event from the device for a trajectory register.
+ */
+struct reply_t
+{
+    uint8_t message_type;
+    uint8_t address;
+    uint32_t value; // First payload element.
+};
+
+std::vector<reply_t> take_replies()
+{
+    std::vector<reply_t> replies;
+    const std::vector<uint8_t> output = sim_take_usb_output();
+    HarpFrameParser parser;
+    parser.parse(output.data(), output.size(),
+        [&replies](const harp_frame_t& frame)
+        {
+            if (frame.address < BRAKE_TRAJECTORY_WRITE_INDEX_ADDRESS
+                || frame.address > BRAKE_TRAJECTORY_PLAYBACK_ADDRESS)
+                return;
+            uint32_t value = 0;
+            if (frame.payload_length > 0)
+                value = (frame.payload_type == HARP_U8)
+                        ? frame.element<uint8_t>(0)
+                        : frame.element<uint16_t>(0);
+            replies.push_back({frame.message_type, frame.address, value});
+        });
+    return replies;
+}
+
+size_t count_replies(const std::vector<reply_t>& replies, uint8_t message_type,
+                     uint8_t address)
+{
+    size_t count = 0;
+    for (const reply_t& reply: replies)
+        count += (reply.message_type == message_type)
+                 && (reply.address == address);
+    return count;
+}
+
+void write_u16(uint8_t address, uint16_t value)
+{
+    sim_write_register(address, HARP_U16, &value, sizeof(value));
+}
+
+void write_u8(uint8_t address, uint8_t value)
+{
+    sim_write_register(address, HARP_U8, &value, sizeof(value));
+}
+
+/**
+ * \brief write points into the back table from index, in as few writes as
+ *  fit a Harp message.
+ */
+void upload(uint16_t index, const std::vector<uint16_t>& points)
+{
+    write_u16(BRAKE_TRAJECTORY_WRITE_INDEX_ADDRESS, index);
+    for (size_t i = 0; i < points.size(); i += MAX_TRAJECTORY_POINTS_PER_WRITE)
+    {
+        const size_t count = std::min(points.size() - i,
+                                      MAX_TRAJECTORY_POINTS_PER_WRITE);
+        sim_write_register(BRAKE_TRAJECTORY_DATA_ADDRESS, HARP_U16,
+                           &points[i], uint8_t(count * sizeof(uint16_t)));
+    }
+}
+
+/**
+ * \brief true if writes plays points (from the first one) exactly
+ *  period_us apart.
+ */
+bool plays(const std::vector<dac_write_t>& writes, size_t first,
+           const std::vector<uint16_t>& points, size_t count,
+           uint64_t period_us)
+{
+    if (writes.size() < first + count)
+        return false;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const dac_write_t& write = writes[first + i];
+        if (write.code != points[i % points.size()]
+            || (i > 0 && write.time_us - writes[first + i - 1].time_us
+                         != period_us))
+            return false;
+    }
+    return true;
+}
+
+bool check_device_one_shot()
+{
+    const std::vector<uint16_t> points = ramp(1000, 300);
+    upload(0, points);
+    write_u16(BRAKE_TRAJECTORY_LENGTH_ADDRESS, uint16_t(points.size()));
+    write_u16(BRAKE_TRAJECTORY_SAMPLE_RATE_ADDRESS, 1000);
+    sim_run_us(1000);
+    bool ok = count_replies(take_replies(), HARP_WRITE_ERROR,
+                            BRAKE_TRAJECTORY_DATA_ADDRESS) == 0;
+    const uint64_t start_us = sim_time_us();
+    write_u8(BRAKE_TRAJECTORY_PLAYBACK_ADDRESS, 1);
+    const std::vector<dac_write_t> writes = watch_brake_dac(400'000);
+    const std::vector<reply_t> replies = take_replies();
+    // Playback starts one sample period after the write.
+    ok &= writes.size() == points.size()
+          && plays(writes, 0, points, points.size(), 1000)
+          && writes[0].time_us >= start_us + 1000
+          && writes[0].time_us <= start_us + 1000 + MAX_COMMAND_LATENCY_US;
+    // The last point holds, and the end is reported.
+    ok &= sim_brake_dac_code() == points.back()
+          && count_replies(replies, HARP_EVENT,
+                           BRAKE_TRAJECTORY_PLAYBACK_ADDRESS) == 1;
+    printf("Played %zu of %zu points at 1 [kHz], the first %llu [us] after "
+           "the write.\n", writes.size(), points.size(),
+           writes.empty() ? 0ull
+                          : (unsigned long long)(writes[0].time_us - start_us));
+    return check("Device plays a trajectory once at its sample rate", ok);
+}
+
+bool check_device_loop()
+{
+    const std::vector<uint16_t> points = ramp(2000, 10);
+    upload(0, points);
+    write_u16(BRAKE_TRAJECTORY_LENGTH_ADDRESS, uint16_t(points.size()));
+    write_u16(BRAKE_TRAJECTORY_SAMPLE_RATE_ADDRESS, 10'000);
+    write_u8(BRAKE_TRAJECTORY_PLAYBACK_ADDRESS, 2);
+    const std::vector<dac_write_t> writes = watch_brake_dac(10'000);
+    // Stopping holds the last point played.
+    write_u8(BRAKE_TRAJECTORY_PLAYBACK_ADDRESS, 0);
+    sim_run_us(1000);
+    const uint16_t held = sim_brake_dac_code();
+    const std::vector<dac_write_t> after_stop = watch_brake_dac(10'000);
+    const std::vector<reply_t> replies = take_replies();
+    bool ok = writes.size() >= 95
+              && plays(writes, 0, points, writes.size(), 100)
+              && after_stop.empty() && held != 0
+              && count_replies(replies, HARP_EVENT,
+                               BRAKE_TRAJECTORY_PLAYBACK_ADDRESS) == 0;
+    return check("Device loops a trajectory seamlessly until stopped", ok);
+}
+
+bool check_device_double_buffer()
+{
+    const std::vector<uint16_t> front = ramp(3000, 40);
+    upload(0, front);
+    write_u16(BRAKE_TRAJECTORY_LENGTH_ADDRESS, uint16_t(front.size()));
+    write_u16(BRAKE_TRAJECTORY_SAMPLE_RATE_ADDRESS, 1000);
+    write_u8(BRAKE_TRAJECTORY_PLAYBACK_ADDRESS, 2);
+    sim_run_us(5000);
+    take_replies();
+    // Uploading during playback doesn't disturb it.
+    const std::vector<uint16_t> back = ramp(20'000, 25);
+    upload(0, back);
+    write_u16(BRAKE_TRAJECTORY_LENGTH_ADDRESS, uint16_t(back.size()));
+    std::vector<dac_write_t> writes = watch_brake_dac(60'000);
+    std::vector<reply_t> replies = take_replies();
+    bool ok = count_replies(replies, HARP_WRITE_ERROR,
+                            BRAKE_TRAJECTORY_DATA_ADDRESS) == 0
+              && count_replies(replies, HARP_WRITE_ERROR,
+                               BRAKE_TRAJECTORY_LENGTH_ADDRESS) == 0
+              && writes.size() >= 59;
+    size_t offset = 0;
+    while (offset < front.size() && !writes.empty()
+           && front[offset] != writes[0].code)
+        ++offset;
+    std::vector<uint16_t> rotated(front.begin() + offset, front.end());
+    rotated.insert(rotated.end(), front.begin(), front.begin() + offset);
+    ok &= plays(writes, 0, rotated, writes.size(), 1000);
+    // Starting again swaps the back table in, from its first point, one
+    // sample period later. The front table may play one more point before
+    // core1 gets the command.
+    const uint64_t swap_us = sim_time_us();
+    write_u8(BRAKE_TRAJECTORY_PLAYBACK_ADDRESS, 1);
+    writes = watch_brake_dac(40'000);
+    replies = take_replies();
+    const size_t first = (!writes.empty() && writes[0].code != back[0]) ? 1 : 0;
+    ok &= writes.size() == first + back.size()
+          && plays(writes, first, back, back.size(), 1000)
+          && writes[first].time_us - swap_us <= 1000 + MAX_COMMAND_LATENCY_US
+          && count_replies(replies, HARP_EVENT,
+                           BRAKE_TRAJECTORY_PLAYBACK_ADDRESS) == 1;
+    // Without a new upload, playing again replays the same table.
+    write_u8(BRAKE_TRAJECTORY_PLAYBACK_ADDRESS, 1);
+    writes = watch_brake_dac(40'000);
+    ok &= writes.size() == back.size()
+          && plays(writes, 0, back, back.size(), 1000);
+    // Edits after a swap build on the table last played.
+    std::vector<uint16_t> edited = back;
+    edited[5] = 60'000;
+    upload(5, {edited[5]});
+    write_u8(BRAKE_TRAJECTORY_PLAYBACK_ADDRESS, 1);
+    writes = watch_brake_dac(40'000);
+    ok &= writes.size() == edited.size()
+          && plays(writes, 0, edited, edited.size(), 1000);
+    take_replies();
+    return check("Device swaps in a trajectory uploaded during playback only "
+                 "when playback restarts", ok);
+}
+
+bool check_device_torque_limit_abort(Treadmill& treadmill)
+{
+    const std::vector<uint16_t> points = ramp(4000, 50);
+    upload(0, points);
+    write_u16(BRAKE_TRAJECTORY_LENGTH_ADDRESS, uint16_t(points.size()));
+    write_u8(BRAKE_TRAJECTORY_PLAYBACK_ADDRESS, 2);
+    sim_run_us(10'000);
+    take_replies();
+    treadmill.overload_from(sim_time_us() + 500);
+    const std::vector<dac_write_t> writes = watch_brake_dac(20'000);
+    const std::vector<reply_t> replies = take_replies();
+    bool ok = !writes.empty() && writes.back().code == 0
+              && sim_brake_dac_code() == 0;
+    bool reported_stop = false;
+    for (const reply_t& reply: replies)
+        reported_stop |= reply.message_type == HARP_EVENT
+                         && reply.address == BRAKE_TRAJECTORY_PLAYBACK_ADDRESS
+                         && reply.value == 0;
+    ok &= reported_stop;
+    return check("Torque limit trip aborts playback", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_table_handling();
+    ok &= check_one_shot_and_loop();
+    Treadmill treadmill;
+    sim_boot(treadmill);
+    sim_run_us(10'000);
+    sim_take_usb_output();
+    ok &= check_device_one_shot();
+    ok &= check_device_loop();
+    ok &= check_device_double_buffer();
+    ok &= check_device_torque_limit_abort(treadmill);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,304 @@
+// Replay SensorData traces through the firmware's ChangeTrigger, as it gates
+// change-driven dispatch, and check which samples it reports.
+// Traces are modelled on 1 [kHz] dispatch: a stationary intertrial period
+// with ADC noise, walking bouts, a one-sample torque transient, and a belt
+// crossing the int32 encoder wrap. Recordings made with treadmill_record can
+// also be replayed. In every trace, a sample must be reported if and only if
+// it moved past a threshold from the last reported sample or the heartbeat
+// expired, so holding the last reported sample never strays past a deadband.
+// Usage: change_trigger_test [recording ...]
+#include <change_trigger.h>
+#include <treadmill_stream.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr uint32_t DEFAULT_HEARTBEAT_US = 1000 * 1000;
+
+constexpr uint32_t DISPATCH_RATE_HZ = 1000;
+constexpr uint64_t DISPATCH_INTERVAL_US = 1'000'000 / DISPATCH_RATE_HZ;
+constexpr int32_t MID_SCALE = 2048;
+
+struct sample_t
+{
+    uint64_t time_us;
+    int32_t encoder_ticks;
+    int16_t reaction_torque;
+    int16_t brake_current;
+};
+
+using Trace = std::vector<sample_t>;
+
+struct thresholds_t
+{
+    uint32_t encoder_ticks;
+    uint32_t torque_deadband;
+    uint32_t brake_current_deadband;
+    uint32_t heartbeat_us;
+};
+
+// Deadbands a little above the ADC noise, and a few counts of belt travel.
+constexpr thresholds_t INTERTRIAL = {4, 12, 8, DEFAULT_HEARTBEAT_US};
+
+struct replay_result_t
+{
+    std::vector<size_t> reported; // Indices of the samples reported.
+    size_t wrong; // Samples reported (or not) against the rules.
+    uint64_t longest_gap_us;
+};
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+uint32_t distance(int32_t a, int32_t b)
+{
+    const int32_t delta = int32_t(uint32_t(a) - uint32_t(b));
+    return (delta < 0) ? -uint32_t(delta) : uint32_t(delta);
+}
+
+/**
+ * \brief whether a sample should be reported, straight from the rules.
+ */
+bool should_report(const sample_t& sample, const sample_t* reference,
+                   const thresholds_t& thresholds)
+{
+    if (!thresholds.encoder_ticks && !thresholds.torque_deadband
+        && !thresholds.brake_current_deadband)
+        return true;
+    if (reference == nullptr)
+        return true;
+    if (thresholds.heartbeat_us
+        && sample.time_us - reference->time_us >= thresholds.heartbeat_us)
+        return true;
+    return (thresholds.encoder_ticks
+            && distance(sample.encoder_ticks, reference->encoder_ticks)
+               >= thresholds.encoder_ticks)
+           || (thresholds.torque_deadband
+               && distance(sample.reaction_torque, reference->reaction_torque)
+                  > thresholds.torque_deadband)
+           || (thresholds.brake_current_deadband
+               && distance(sample.brake_current, reference->brake_current)
+                  > thresholds.brake_current_deadband);
+}
+
+replay_result_t replay(const Trace& trace, const thresholds_t& thresholds)
+{
+    ChangeTrigger trigger;
+    trigger.set_thresholds(thresholds.encoder_ticks, thresholds.torque_deadband,
+                           thresholds.brake_current_deadband);
+    trigger.set_heartbeat_us(thresholds.heartbeat_us);
+    replay_result_t result{{}, 0, 0};
+    const sample_t* reference = nullptr;
+    for (size_t i = 0; i < trace.size(); ++i)
+    {
+        const sample_t& sample = trace[i];
+        const bool reported = trigger.update(sample.time_us,
+                                             sample.encoder_ticks,
+                                             sample.reaction_torque,
+                                             sample.brake_current);
+        result.wrong += reported != should_report(sample, reference,
+                                                  thresholds);
+        if (!reported)
+            continue;
+        if (reference != nullptr && sample.time_us - reference->time_us
+                                    > result.longest_gap_us)
+            result.longest_gap_us = sample.time_us - reference->time_us;
+        result.reported.push_back(i);
+        reference = &sample;
+    }
+    return result;
+}
+
+/**
+ * \brief builds a dispatch-rate trace from belt and analog profiles plus ADC
+ *  noise.
+ */
+class TraceBuilder
+{
+public:
+    explicit TraceBuilder(uint32_t seed, double noise_counts = 1)
+    : rng_(seed), noise_(0, noise_counts), time_us_{0}, encoder_ticks_{0} {}
+
+    void start_at(int32_t encoder_ticks) {encoder_ticks_ = encoder_ticks;}
+
+/**
+ * \brief append duration_s of the belt at speed(t) [counts/s] with the
+ *  specified torque(t) and brake current(t), t from 0 over the segment.
+ */
+    template <typename Speed, typename Torque, typename Current>
+    void add(double duration_s, Speed speed, Torque torque, Current current)
+    {
+        const size_t count = size_t(lround(duration_s * DISPATCH_RATE_HZ));
+        double position = encoder_ticks_;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const double t = i / double(DISPATCH_RATE_HZ);
+            position += speed(t) / DISPATCH_RATE_HZ;
+            encoder_ticks_ = int32_t(uint32_t(int64_t(floor(position))));
+            trace_.push_back({time_us_, encoder_ticks_,
+                              int16_t(lround(torque(t) + noise_(rng_))),
+                              int16_t(lround(current(t) + noise_(rng_)))});
+            time_us_ += DISPATCH_INTERVAL_US;
+        }
+    }
+
+/**
+ * \brief replace the torque of one sample.
+ */
+    void spike(size_t index, int16_t reaction_torque)
+    {trace_[index].reaction_torque = reaction_torque;}
+
+    const Trace& trace() const {return trace_;}
+
+private:
+    std::mt19937 rng_;
+    std::normal_distribution<double> noise_;
+    uint64_t time_us_;
+    int32_t encoder_ticks_;
+    Trace trace_;
+};
+
+double stopped(double) {return 0;}
+double mid_scale(double) {return MID_SCALE;}
+double brake_off(double) {return 100;}
+
+/**
+ * \brief walking at about 0.5 [m/s], in counts/s, with a stride rhythm.
+ */
+double walking_speed(double t)
+{return 13'000 * (1 + 0.2 * sin(2 * M_PI * 1.25 * t));}
+
+/**
+ * \brief stepping impacts every 400 [ms] on the torque sensor.
+ */
+double walking_torque(double t)
+{
+    const double phase = fmod(t, 0.4);
+    return MID_SCALE + ((phase < 0.08) ? 1500 * sin(M_PI * phase / 0.08) : 0);
+}
+
+bool check_disabled()
+{
+    TraceBuilder builder(1);
+    builder.add(2, stopped, mid_scale, brake_off);
+    const replay_result_t result = replay(builder.trace(), {0, 0, 0,
+                                                            DEFAULT_HEARTBEAT_US});
+    return check("No thresholds reports every sample",
+                 result.wrong == 0
+                 && result.reported.size() == builder.trace().size());
+}
+
+bool check_stationary()
+{
+    // 60 [s] of intertrial: only the first sample and the heartbeats.
+    TraceBuilder builder(2);
+    builder.add(60, stopped, mid_scale, brake_off);
+    const replay_result_t result = replay(builder.trace(), INTERTRIAL);
+    const size_t expected = 60;
+    bool ok = result.wrong == 0 && result.reported.size() == expected
+              && result.longest_gap_us == DEFAULT_HEARTBEAT_US;
+    printf("Stationary for 60 [s] at %u [Hz]: %zu of %zu samples reported, "
+           "at most %llu [ms] apart.\n", DISPATCH_RATE_HZ,
+           result.reported.size(), builder.trace().size(),
+           (unsigned long long)(result.longest_gap_us / 1000));
+    // Without a heartbeat, nothing after the first.
+    thresholds_t no_heartbeat = INTERTRIAL;
+    no_heartbeat.heartbeat_us = 0;
+    const replay_result_t silent = replay(builder.trace(), no_heartbeat);
+    ok &= silent.wrong == 0 && silent.reported.size() == 1;
+    return check("A stationary treadmill only sends heartbeats", ok);
+}
+
+bool check_walking()
+{
+    // Intertrial, a walking bout, then intertrial again.
+    TraceBuilder builder(3);
+    builder.add(5, stopped, mid_scale, brake_off);
+    builder.add(10, walking_speed, walking_torque, brake_off);
+    builder.add(5, stopped, mid_scale, brake_off);
+    const Trace& trace = builder.trace();
+    const replay_result_t result = replay(trace, INTERTRIAL);
+    // While walking, the belt moves more than the threshold every sample.
+    size_t walking_reported = 0;
+    for (const size_t index: result.reported)
+        walking_reported += index >= 5000 && index < 15000;
+    printf("Intertrial, 10 [s] walking, intertrial: %zu of %zu samples "
+           "reported, %zu of them while walking.\n", result.reported.size(),
+           trace.size(), walking_reported);
+    return check("Walking is reported at the dispatch rate, intertrial is not",
+                 result.wrong == 0 && walking_reported == 10'000
+                 && result.reported.size() < 10'000 + 20);
+}
+
+bool check_transient()
+{
+    // A one-sample torque transient while stationary is reported, and so is
+    // the return to rest. The heartbeat still runs from the first sample.
+    TraceBuilder builder(4, 0);
+    builder.add(2, stopped, mid_scale, brake_off);
+    const size_t spike = 1234;
+    builder.spike(spike, MID_SCALE + 300);
+    const replay_result_t result = replay(builder.trace(), INTERTRIAL);
+    const std::vector<size_t> expected = {0, 1000, spike, spike + 1};
+    return check("A one-sample torque transient is reported",
+                 result.wrong == 0 && result.reported == expected);
+}
+
+bool check_encoder_wrap()
+{
+    // Backing slowly across the int32 wrap reads as small moves.
+    TraceBuilder builder(5, 0);
+    builder.start_at(INT32_MIN + 50);
+    builder.add(1, [](double){return -100.0;}, mid_scale, brake_off);
+    const replay_result_t result = replay(builder.trace(), INTERTRIAL);
+    // 99 [counts] past the first sample at 4 [counts] per report.
+    const Trace& trace = builder.trace();
+    return check("The encoder threshold holds across the int32 wrap",
+                 result.wrong == 0 && result.reported.size() == 1 + 99 / 4
+                 && trace.front().encoder_ticks < 0
+                 && trace.back().encoder_ticks > 0);
+}
+
+bool check_recording(const char* path)
+{
+    TreadmillStream stream(1 << 24);
+    if (!stream.replay(path))
+    {
+        printf("Could not open %s.\n", path);
+        return false;
+    }
+    EventColumns& events = stream.sensor_data();
+    Trace trace;
+    trace.reserve(events.size());
+    for (size_t i = 0; i < events.size(); ++i)
+        trace.push_back({events.harp_time_us(i),
+                         events.field(TreadmillStream::ENCODER, i),
+                         int16_t(events.field(TreadmillStream::TORQUE, i)),
+                         int16_t(events.field(TreadmillStream::BRAKE_CURRENT,
+                                              i))});
+    const replay_result_t result = replay(trace, INTERTRIAL);
+    printf("%s: %zu of %zu SensorData events reported.\n", path,
+           result.reported.size(), trace.size());
+    return check("Recording replays through the trigger", result.wrong == 0);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    bool ok = check_disabled();
+    ok &= check_stationary();
+    ok &= check_walking();
+    ok &= check_transient();
+    ok &= check_encoder_wrap();
+    for (int i = 1; i < argc; ++i)
+        ok &= check_recording(argv[i]);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,387 @@
+// Check the firmware's FlightRecorder ring and its freeze, then capture a
+// torque limit trip on the simulated device of firmware_sim and download it
+// through the FlightRecorder registers, as
+// software/pyharp/download_flight_recorder.py does.
+// Records are numbered in the order they were added, so a capture shows
+// exactly which samples it kept. Captures are triggered after the ring has
+// wrapped many times and soon after arming, with the default, lopsided and
+// extreme pre/post windows. A frozen capture must hold the pre window, the
+// trigger sample and the post window in order, and must not change until it
+// is rearmed. On the simulated device, the encoder counts [us], so each
+// record shows when it was latched.
+// Usage: flight_recorder_test
+#include <flight_recorder.h>
+#include <firmware_sim.h>
+#include <treadmill_stream.h>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr uint32_t DEFAULT_PRE_SAMPLES = 1024;
+constexpr uint32_t DEFAULT_POST_SAMPLES = 1024;
+constexpr uint32_t LATCH_INTERVAL_US = 100;
+constexpr uint16_t TORQUE_LIMIT_TRIGGERED_FLAG = 1u << 0;
+constexpr size_t MAX_RECORDS_PER_READ = 15;
+constexpr uint8_t FLIGHT_RECORDER_ADDRESS = 87;
+constexpr uint8_t FLIGHT_RECORDER_WINDOW_ADDRESS = 88;
+constexpr uint8_t FLIGHT_RECORDER_READ_INDEX_ADDRESS = 89;
+constexpr uint8_t FLIGHT_RECORDER_DATA_ADDRESS = 90;
+constexpr uint8_t FLIGHT_RECORDER_CAPTURE_ADDRESS = 91;
+constexpr uint16_t TORQUE_OVERLOAD_COUNTS = 4050; // Past the upper limit.
+
+constexpr uint32_t CAPACITY = FlightRecorder::CAPACITY;
+
+using Record = FlightRecorder::record_t;
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+Record numbered(uint32_t number)
+{
+    Record record{};
+    record.time_us = number;
+    record.encoder_ticks = int32_t(number);
+    return record;
+}
+
+/**
+ * \brief add records numbered [first, first + count).
+ * \returns how many of them froze the capture.
+ */
+size_t add(FlightRecorder& recorder, uint32_t first, uint32_t count)
+{
+    size_t freezes = 0;
+    for (uint32_t i = 0; i < count; ++i)
+        freezes += recorder.add(numbered(first + i));
+    return freezes;
+}
+
+/**
+ * \brief read a frozen capture in register-sized chunks.
+ */
+std::vector<Record> download(const FlightRecorder& recorder)
+{
+    std::vector<Record> records(recorder.num_records());
+    size_t index = 0;
+    while (index < records.size())
+    {
+        const size_t count = recorder.read(index, &records[index],
+                                           MAX_RECORDS_PER_READ);
+        if (count == 0)
+            break;
+        index += count;
+    }
+    records.resize(index);
+    return records;
+}
+
+/**
+ * \brief whether a capture holds records numbered [first, first + count).
+ */
+bool holds(const std::vector<Record>& records, uint32_t first, uint32_t count)
+{
+    if (records.size() != count)
+        return false;
+    for (uint32_t i = 0; i < count; ++i)
+        if (records[i].time_us != first + i)
+            return false;
+    return true;
+}
+
+struct window_t
+{
+    uint32_t pre;
+    uint32_t post;
+};
+
+const window_t WINDOWS[] =
+{
+    {DEFAULT_PRE_SAMPLES, DEFAULT_POST_SAMPLES},
+    {2000, 48},
+    {0, CAPACITY},
+    {CAPACITY - 1, 1},
+    {10, 10},
+};
+
+bool check_wrapped_captures()
+{
+    bool ok = true;
+    for (const window_t& window: WINDOWS)
+    {
+        static FlightRecorder recorder;
+        ok &= recorder.set_window(window.pre, window.post);
+        recorder.arm();
+        // Many laps of the ring, ending partway through one.
+        const uint32_t before = 5 * CAPACITY + 333;
+        ok &= add(recorder, 0, before) == 0
+              && recorder.state() == FlightRecorder::ARMED
+              && recorder.num_records() == 0;
+        ok &= recorder.trigger() && !recorder.trigger()
+              && recorder.state() == FlightRecorder::TRIGGERED;
+        // Only the last sample of the post window freezes the capture.
+        ok &= add(recorder, before, window.post - 1) == 0
+              && add(recorder, before + window.post - 1, 1) == 1
+              && recorder.state() == FlightRecorder::FROZEN;
+        const std::vector<Record> capture = download(recorder);
+        ok &= recorder.trigger_index() == window.pre
+              && holds(capture, before - window.pre, window.pre + window.post);
+        // Frozen: later samples and triggers change nothing.
+        ok &= add(recorder, before + window.post, 3 * CAPACITY) == 0
+              && !recorder.trigger() && holds(download(recorder),
+                                              before - window.pre,
+                                              window.pre + window.post);
+        printf("  [%u, %u] window: %zu records, trigger at %u.\n", window.pre,
+               window.post, capture.size(), recorder.trigger_index());
+    }
+    return check("Captures hold the window around the trigger after the ring "
+                 "wraps", ok);
+}
+
+bool check_early_trigger_and_rearm()
+{
+    static FlightRecorder recorder;
+    bool ok = recorder.state() == FlightRecorder::IDLE;
+    // Disarmed: nothing is recorded and nothing triggers.
+    ok &= add(recorder, 0, 10) == 0 && !recorder.trigger()
+          && recorder.num_records() == 0;
+    // Triggered soon after arming, only what was recorded since.
+    recorder.arm();
+    ok &= add(recorder, 100, 10) == 0 && recorder.trigger();
+    ok &= add(recorder, 110, DEFAULT_POST_SAMPLES) == 1;
+    ok &= recorder.trigger_index() == 10
+          && holds(download(recorder), 100, 10 + DEFAULT_POST_SAMPLES);
+    // Triggered before any sample: the trigger sample comes first.
+    recorder.arm();
+    ok &= recorder.num_records() == 0 && recorder.read(0, nullptr, 1) == 0;
+    ok &= recorder.trigger() && add(recorder, 5000, DEFAULT_POST_SAMPLES) == 1
+          && recorder.trigger_index() == 0
+          && holds(download(recorder), 5000, DEFAULT_POST_SAMPLES);
+    // Rearming discards the capture and forgets what came before it.
+    recorder.arm();
+    ok &= add(recorder, 9000, CAPACITY - 1) == 0 && recorder.trigger()
+          && add(recorder, 9000 + CAPACITY - 1, DEFAULT_POST_SAMPLES) == 1
+          && recorder.trigger_index() == DEFAULT_PRE_SAMPLES
+          && holds(download(recorder),
+                   9000 + CAPACITY - 1 - DEFAULT_PRE_SAMPLES,
+                   DEFAULT_PRE_SAMPLES + DEFAULT_POST_SAMPLES);
+    // A window set while triggered waits for the next trigger.
+    recorder.arm();
+    add(recorder, 0, 100);
+    ok &= recorder.trigger() && recorder.set_window(20, 5);
+    ok &= add(recorder, 100, DEFAULT_POST_SAMPLES) == 1
+          && recorder.num_records() == 100 + DEFAULT_POST_SAMPLES;
+    recorder.arm();
+    add(recorder, 0, 100);
+    ok &= recorder.trigger() && add(recorder, 100, 5) == 1
+          && holds(download(recorder), 80, 25);
+    // Windows that do not fit are refused.
+    ok &= !recorder.set_window(0, 0) && !recorder.set_window(CAPACITY, 1)
+          && !recorder.set_window(1, CAPACITY) && recorder.pre_samples() == 20
+          && recorder.post_samples() == 5;
+    // Reads past the end are clipped.
+    Record records[MAX_RECORDS_PER_READ];
+    ok &= recorder.read(20, records, MAX_RECORDS_PER_READ) == 5
+          && records[4].time_us == 104 && recorder.read(25, records, 1) == 0;
+    recorder.disarm();
+    ok &= recorder.state() == FlightRecorder::IDLE
+          && recorder.num_records() == 0;
+    return check("Early triggers, rearming and windows", ok);
+}
+
+/**
+ * \brief belt counting [us], torque at mid-scale until an overload.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    Treadmill(): overload_from_us_{UINT64_MAX}, overload_to_us_{0} {}
+
+    void overload(uint64_t from_us, uint64_t to_us)
+    {
+        overload_from_us_ = from_us;
+        overload_to_us_ = to_us;
+    }
+
+    int32_t encoder_counts(uint32_t index, uint64_t time_us) override
+    {return (index > 0) ? 0 : int32_t(time_us);}
+
+    uint16_t torque_counts(uint64_t time_us) override
+    {
+        return (time_us >= overload_from_us_ && time_us < overload_to_us_)
+               ? TORQUE_OVERLOAD_COUNTS : 2048;
+    }
+
+    uint16_t brake_current_counts(uint64_t, uint16_t) override {return 10;}
+
+private:
+    uint64_t overload_from_us_;
+    uint64_t overload_to_us_;
+};
+
+/**
+ * \brief replies and events from the device since the last call.
+ */
+struct device_output_t
+{
+    std::vector<uint8_t> states; // FlightRecorder events.
+    uint16_t capture[2] = {0, 0};
+    std::vector<Record> records;
+    size_t read_errors = 0;
+    size_t write_errors = 0;
+};
+
+device_output_t take_output()
+{
+    device_output_t output;
+    const std::vector<uint8_t> bytes = sim_take_usb_output();
+    HarpFrameParser parser;
+    parser.parse(bytes.data(), bytes.size(), [&](const harp_frame_t& frame)
+    {
+        output.read_errors += frame.message_type == HARP_READ_ERROR;
+        output.write_errors += frame.message_type == HARP_WRITE_ERROR;
+        if (frame.message_type == HARP_EVENT
+            && frame.address == FLIGHT_RECORDER_ADDRESS)
+            output.states.push_back(frame.element<uint8_t>(0));
+        if (frame.message_type != HARP_READ)
+            return;
+        if (frame.address == FLIGHT_RECORDER_CAPTURE_ADDRESS)
+        {
+            output.capture[0] = frame.element<uint16_t>(0);
+            output.capture[1] = frame.element<uint16_t>(1);
+        }
+        if (frame.address == FLIGHT_RECORDER_DATA_ADDRESS)
+            for (size_t i = 0; i < frame.payload_length / sizeof(Record); ++i)
+                output.records.push_back(frame.element<Record>(i));
+    });
+    return output;
+}
+
+/**
+ * \brief read the capture and every record, as the download script does.
+ */
+device_output_t download_from_device()
+{
+    sim_read_register(FLIGHT_RECORDER_CAPTURE_ADDRESS);
+    const uint16_t start = 0;
+    sim_write_register(FLIGHT_RECORDER_READ_INDEX_ADDRESS, HARP_U16, &start,
+                       sizeof(start));
+    for (size_t i = 0; i < CAPACITY / MAX_RECORDS_PER_READ + 2; ++i)
+    {
+        sim_read_register(FLIGHT_RECORDER_DATA_ADDRESS);
+        sim_run_us(20);
+    }
+    sim_run_us(100);
+    return take_output();
+}
+
+/**
+ * \brief whether records are consecutive latches, timed relative to the one
+ *  at trigger_index.
+ */
+bool consecutive(const std::vector<Record>& records, size_t trigger_index)
+{
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const int64_t time_us = int32_t(records[i].time_us);
+        if (time_us != (int64_t(i) - int64_t(trigger_index)) * LATCH_INTERVAL_US)
+            return false;
+        if (i > 0 && records[i].encoder_ticks - records[i - 1].encoder_ticks
+                     != int32_t(LATCH_INTERVAL_US))
+            return false;
+    }
+    return true;
+}
+
+bool check_device_trip()
+{
+    Treadmill treadmill;
+    sim_boot(treadmill);
+    // Armed at power-up. The ring laps several times before the trip.
+    sim_run_us(1'000'000);
+    take_output();
+    const uint64_t overload_us = sim_time_us() + 12'345;
+    treadmill.overload(overload_us, overload_us + 50'000);
+    sim_run_us(50'000);
+    const device_output_t triggered = take_output();
+    sim_run_us(100'000);
+    const device_output_t frozen = take_output();
+    bool ok = triggered.states == std::vector<uint8_t>{FlightRecorder::TRIGGERED}
+              && frozen.states == std::vector<uint8_t>{FlightRecorder::FROZEN};
+    // Well after the freeze, the capture is unchanged.
+    sim_run_us(300'000);
+    take_output();
+    const device_output_t capture = download_from_device();
+    const std::vector<Record>& records = capture.records;
+    const size_t trigger_index = capture.capture[1];
+    ok &= capture.capture[0] == DEFAULT_PRE_SAMPLES + DEFAULT_POST_SAMPLES
+          && trigger_index == DEFAULT_PRE_SAMPLES
+          && records.size() == capture.capture[0] && capture.read_errors == 0
+          && consecutive(records, trigger_index);
+    // The trip flag comes on at the trigger sample, a few conversions into
+    // the overload, and the torque before the overload is in the pre window.
+    size_t first_flagged = records.size();
+    size_t first_overloaded = records.size();
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        if (first_flagged == records.size()
+            && (records[i].flags & TORQUE_LIMIT_TRIGGERED_FLAG))
+            first_flagged = i;
+        if (first_overloaded == records.size()
+            && records[i].reaction_torque == TORQUE_OVERLOAD_COUNTS)
+            first_overloaded = i;
+    }
+    const int64_t trigger_latch_us = records.empty()
+                                     ? 0
+                                     : records[trigger_index].encoder_ticks;
+    printf("Torque limit trip %lld [us] into the overload: %zu records, "
+           "trigger at %zu, first overloaded record %zu, first flagged "
+           "record %zu.\n", (long long)(trigger_latch_us - int64_t(overload_us)),
+           records.size(), trigger_index, first_overloaded, first_flagged);
+    ok &= first_flagged == trigger_index && first_overloaded <= trigger_index
+          && first_overloaded + 2 >= trigger_index
+          && trigger_latch_us > int64_t(overload_us)
+          && trigger_latch_us - int64_t(overload_us) < 2 * LATCH_INTERVAL_US;
+    // Rearming discards the capture, and a manual trigger soon after keeps
+    // only what was recorded since, with the window in effect.
+    const uint8_t arm = 1;
+    const uint8_t trigger = 2;
+    const uint16_t window[2] = {1500, 50};
+    sim_write_register(FLIGHT_RECORDER_WINDOW_ADDRESS, HARP_U16, window,
+                       sizeof(window));
+    sim_write_register(FLIGHT_RECORDER_ADDRESS, HARP_U8, &arm, 1);
+    sim_run_us(100);
+    sim_read_register(FLIGHT_RECORDER_DATA_ADDRESS);
+    sim_read_register(FLIGHT_RECORDER_CAPTURE_ADDRESS);
+    sim_run_us(100);
+    const device_output_t rearmed = take_output();
+    ok &= rearmed.read_errors == 1 && rearmed.capture[0] == 0
+          && rearmed.capture[1] == 0 && rearmed.write_errors == 0;
+    sim_run_us(20'000);
+    sim_write_register(FLIGHT_RECORDER_ADDRESS, HARP_U8, &trigger, 1);
+    sim_run_us(20'000);
+    const device_output_t manual = download_from_device();
+    const size_t manual_trigger = manual.capture[1];
+    printf("Rearmed and triggered by hand 20 [ms] later: %u records, trigger "
+           "at %zu.\n", manual.capture[0], manual_trigger);
+    ok &= manual.states == std::vector<uint8_t>({FlightRecorder::TRIGGERED,
+                                                 FlightRecorder::FROZEN})
+          && manual_trigger >= 195 && manual_trigger <= 205
+          && manual.capture[0] == manual_trigger + window[1]
+          && manual.records.size() == manual.capture[0]
+          && consecutive(manual.records, manual_trigger);
+    return check("A torque limit trip freezes a capture on the device", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_wrapped_captures();
+    ok &= check_early_trigger_and_rearm();
+    ok &= check_device_trip();
+    return ok ? 0 : 1;
+}
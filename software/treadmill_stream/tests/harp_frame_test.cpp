@@ -0,0 +1,325 @@
+// Encode Harp frames and parse them back as a serial port delivers them:
+// split at every byte, corrupted, truncated, and with noise in between. Then
+// record a stream with StreamRecorder and replay it with StreamReplay.
+// Every frame that arrives whole and intact must be decoded exactly once and
+// in order, and bad bytes skipped. While skipping, the parser may find a
+// frame start inside the bad bytes whose length runs over the next frames,
+// and very rarely one whose checksum is right by chance, so it must be back
+// in sync within the two frames after a bad one. A replay must return each
+// chunk as it was recorded, and stop at a chunk cut short.
+// Usage: harp_frame_test
+#include <harp_frame.h>
+#include <stream_recording.h>
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+constexpr size_t NUM_FRAMES = 20;
+// Frames after a bad one that may be lost while resyncing.
+constexpr uint32_t MAX_RESYNC_FRAMES = 2;
+constexpr const char* RECORDING_PATH = "harp_frame_test.bin";
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief frame n of a stream: events with payloads of 1 to 8 elements,
+ *  and every third a reply without a timestamp. The first element is
+ *  n * 100.
+ */
+std::vector<uint8_t> make_frame(uint32_t n)
+{
+    int32_t values[8];
+    for (uint32_t i = 0; i < 8; ++i)
+        values[i] = int32_t(n * 100 + i);
+    uint8_t frame[HARP_MAX_FRAME_BYTES];
+    const size_t size = (n % 3 == 2)
+        ? encode_harp_frame(frame, HARP_WRITE, uint8_t(32 + n % 64), HARP_U32,
+                            values, 4)
+        : encode_harp_frame(frame, HARP_EVENT, uint8_t(32 + n % 64), HARP_S32,
+                            values, uint8_t(4 * (1 + n % 8)),
+                            int64_t(n) * 1'000'037);
+    return std::vector<uint8_t>(frame, frame + size);
+}
+
+/**
+ * \brief which frame of make_frame() a decoded frame is, or -1 if it is
+ *  none of them.
+ */
+int64_t frame_number(const harp_frame_t& frame)
+{
+    if (frame.payload_length < 4)
+        return -1;
+    const int32_t n = frame.element<int32_t>(0) / 100;
+    if (n < 0 || uint32_t(n) >= 2 * NUM_FRAMES)
+        return -1;
+    const std::vector<uint8_t> bytes = make_frame(uint32_t(n));
+    harp_frame_t expected;
+    HarpFrameParser::decode(bytes.data(), bytes.size(), expected);
+    const bool same = frame.message_type == expected.message_type
+                      && frame.address == expected.address
+                      && frame.port == expected.port
+                      && frame.payload_type == expected.payload_type
+                      && frame.has_timestamp == expected.has_timestamp
+                      && frame.harp_time_us == expected.harp_time_us
+                      && frame.payload_length == expected.payload_length
+                      && std::equal(frame.payload,
+                                    frame.payload + frame.payload_length,
+                                    expected.payload);
+    return same ? n : -1;
+}
+
+/**
+ * \brief parse a stream in chunks of the given sizes, cycled.
+ * \returns the number of each frame decoded, in order.
+ */
+std::vector<int64_t> parse(HarpFrameParser& parser,
+                           const std::vector<uint8_t>& stream,
+                           const std::vector<size_t>& chunk_sizes)
+{
+    std::vector<int64_t> numbers;
+    size_t i = 0;
+    for (size_t chunk = 0; i < stream.size(); ++chunk)
+    {
+        size_t size = chunk_sizes[chunk % chunk_sizes.size()];
+        if (size > stream.size() - i)
+            size = stream.size() - i;
+        parser.parse(&stream[i], size, [&](const harp_frame_t& frame)
+        {
+            numbers.push_back(frame_number(frame));
+        });
+        i += size;
+    }
+    return numbers;
+}
+
+std::vector<int64_t> sequence(int64_t first, int64_t end)
+{
+    std::vector<int64_t> numbers;
+    for (int64_t n = first; n < end; ++n)
+        numbers.push_back(n);
+    return numbers;
+}
+
+bool check_round_trip()
+{
+    bool ok = true;
+    for (uint32_t n = 0; n < NUM_FRAMES; ++n)
+    {
+        const std::vector<uint8_t> bytes = make_frame(n);
+        harp_frame_t frame;
+        ok &= HarpFrameParser::decode(bytes.data(), bytes.size(), frame);
+        const bool is_event = n % 3 != 2;
+        ok &= frame.message_type == (is_event ? HARP_EVENT : HARP_WRITE)
+              && frame.address == 32 + n % 64
+              && frame.port == HARP_DEFAULT_PORT
+              && frame.has_timestamp == is_event
+              && frame.element<int32_t>(0) == int32_t(n * 100);
+        // Timestamps are whole 32 [us] ticks.
+        if (is_event)
+            ok &= frame.payload_type == HARP_S32
+                  && frame.num_elements() == 1 + n % 8
+                  && frame.harp_time_us == n * 1'000'037ull
+                                           - (n * 1'000'037ull % 1'000'000) % 32;
+    }
+    // Payloads too long for the length byte are refused.
+    uint8_t frame[HARP_MAX_FRAME_BYTES];
+    const uint8_t payload[255] = {};
+    ok &= encode_harp_frame(frame, HARP_EVENT, 32, HARP_U8, payload, 255, 0) == 0;
+    return check("Frames decode to what was encoded", ok);
+}
+
+bool check_malformed()
+{
+    bool ok = true;
+    harp_frame_t frame;
+    std::vector<uint8_t> bytes = make_frame(1);
+    // A wrong checksum, and sizes that disagree with the length byte.
+    bytes.back() ^= 0x01;
+    ok &= !HarpFrameParser::decode(bytes.data(), bytes.size(), frame);
+    bytes.back() ^= 0x01;
+    ok &= !HarpFrameParser::decode(bytes.data(), bytes.size() - 1, frame)
+          && !HarpFrameParser::decode(bytes.data(), 4, frame);
+    // A payload that is not a whole number of elements, or of no element size.
+    const uint8_t payload[3] = {1, 2, 3};
+    uint8_t raw[HARP_MAX_FRAME_BYTES];
+    size_t size = encode_harp_frame(raw, HARP_EVENT, 32, HARP_U16, payload, 3);
+    ok &= !HarpFrameParser::decode(raw, size, frame);
+    size = encode_harp_frame(raw, HARP_EVENT, 32, 0x00, payload, 3);
+    ok &= !HarpFrameParser::decode(raw, size, frame);
+    // A timestamp flag with no room for the timestamp.
+    size = encode_harp_frame(raw, HARP_EVENT, 32, HARP_U8 | HARP_TIMESTAMP_FLAG,
+                             payload, 3);
+    ok &= !HarpFrameParser::decode(raw, size, frame);
+    return check("Malformed frames are rejected", ok);
+}
+
+bool check_splits()
+{
+    std::vector<uint8_t> stream;
+    for (uint32_t n = 0; n < NUM_FRAMES; ++n)
+    {
+        const std::vector<uint8_t> frame = make_frame(n);
+        stream.insert(stream.end(), frame.begin(), frame.end());
+    }
+    const std::vector<int64_t> expected = sequence(0, NUM_FRAMES);
+    size_t failures = 0;
+    // Two chunks split at every byte, then chunks of every size.
+    for (size_t split = 0; split <= stream.size(); ++split)
+    {
+        HarpFrameParser parser;
+        failures += parse(parser, stream, {split, stream.size()}) != expected
+                    || parser.skipped_bytes() != 0;
+    }
+    for (size_t size = 1; size <= 64; ++size)
+    {
+        HarpFrameParser parser;
+        failures += parse(parser, stream, {size}) != expected
+                    || parser.frame_count() != NUM_FRAMES
+                    || parser.skipped_bytes() != 0;
+    }
+    printf("%zu of %zu ways of chunking %zu bytes lost or garbled frames.\n",
+           failures, stream.size() + 1 + 64, stream.size());
+    return check("Frames split across reads are decoded whole", failures == 0);
+}
+
+bool check_resync()
+{
+    std::mt19937 rng(22);
+    size_t failures = 0;
+    size_t trials = 0;
+    size_t resyncs_losing_frames = 0;
+    for (uint32_t bad = 0; bad < NUM_FRAMES; ++bad)
+    {
+        const size_t bad_size = make_frame(bad).size();
+        // Corrupt each byte of one frame in turn; cut it short after each
+        // byte; and put noise before it. Intact frames follow, so that a
+        // frame start found while skipping cannot wait on more bytes.
+        for (size_t at = 0; at < 3 * bad_size; ++at)
+        {
+            std::vector<uint8_t> stream;
+            for (uint32_t n = 0; n < 2 * NUM_FRAMES; ++n)
+            {
+                std::vector<uint8_t> frame = make_frame(n);
+                if (n == bad && at < bad_size)
+                    frame[at] ^= 0x5A;
+                else if (n == bad && at < 2 * bad_size)
+                    frame.resize(at - bad_size);
+                else if (n == bad)
+                    frame.insert(frame.begin(), at - 2 * bad_size + 1, 0xFF);
+                stream.insert(stream.end(), frame.begin(), frame.end());
+            }
+            const bool noise_only = at >= 2 * bad_size;
+            const size_t split = std::uniform_int_distribution<size_t>(
+                1, stream.size())(rng);
+            for (const std::vector<size_t>& chunks: {
+                     std::vector<size_t>{stream.size()},
+                     std::vector<size_t>{split, stream.size()},
+                     std::vector<size_t>{1}})
+            {
+                HarpFrameParser parser;
+                std::vector<int64_t> numbers = parse(parser, stream, chunks);
+                // Frames found while skipping are none of the stream's.
+                numbers.erase(std::remove(numbers.begin(), numbers.end(), -1),
+                              numbers.end());
+                bool ok = std::is_sorted(numbers.begin(), numbers.end())
+                          && std::adjacent_find(numbers.begin(),
+                                                numbers.end()) == numbers.end();
+                size_t lost_after_bad = 0;
+                for (uint32_t n = 0; n < 2 * NUM_FRAMES; ++n)
+                {
+                    const bool found = std::find(numbers.begin(), numbers.end(),
+                                                 n) != numbers.end();
+                    if (found || (n == bad && !noise_only))
+                        continue;
+                    ++lost_after_bad;
+                    ok &= !noise_only && n > bad
+                          && n <= bad + MAX_RESYNC_FRAMES;
+                }
+                resyncs_losing_frames += lost_after_bad > 0;
+                failures += !ok;
+                ++trials;
+            }
+        }
+    }
+    printf("%zu of %zu corrupted, truncated or noisy streams did not resync. "
+           "%zu lost frames after the bad one.\n", failures, trials,
+           resyncs_losing_frames);
+    return check("The parser resyncs after corrupt, truncated and noisy frames",
+                 failures == 0);
+}
+
+bool check_recording()
+{
+    std::mt19937 rng(7);
+    std::vector<std::vector<uint8_t>> chunks;
+    std::vector<uint64_t> times;
+    StreamRecorder recorder;
+    bool ok = recorder.open(RECORDING_PATH);
+    uint64_t bytes = 0;
+    for (uint32_t n = 0; n < NUM_FRAMES; ++n)
+    {
+        std::vector<uint8_t> chunk(std::uniform_int_distribution<size_t>(
+                                       0, 300)(rng));
+        for (uint8_t& byte: chunk)
+            byte = uint8_t(rng());
+        times.push_back(uint64_t(n) * 1'000'003);
+        ok &= recorder.write(times.back(), chunk.data(), chunk.size());
+        bytes += chunk.size();
+        chunks.push_back(chunk);
+    }
+    ok &= recorder.bytes_recorded() == bytes;
+    recorder.close();
+    // Replay it, then again with the last chunk cut short.
+    for (size_t cut = 0; cut < 2; ++cut)
+    {
+        if (cut)
+        {
+            FILE* file = fopen(RECORDING_PATH, "r+b");
+            fseek(file, 0, SEEK_END);
+            const long size = ftell(file);
+            fclose(file);
+            ok &= truncate(RECORDING_PATH, size - 1) == 0;
+        }
+        StreamReplay replay;
+        ok &= replay.open(RECORDING_PATH);
+        size_t replayed = 0;
+        uint64_t time_ns;
+        const uint8_t* data;
+        size_t num_bytes;
+        while (replay.next(time_ns, data, num_bytes))
+        {
+            const std::vector<uint8_t>& chunk = chunks[replayed];
+            ok &= time_ns == times[replayed] && num_bytes == chunk.size()
+                  && std::equal(data, data + num_bytes, chunk.begin());
+            ++replayed;
+        }
+        ok &= replayed == NUM_FRAMES - cut;
+    }
+    // Anything else is not a recording.
+    FILE* file = fopen(RECORDING_PATH, "wb");
+    fputs("TMSTREAX", file);
+    fclose(file);
+    StreamReplay replay;
+    ok &= !replay.open(RECORDING_PATH) && !replay.open("no_such_recording.bin");
+    remove(RECORDING_PATH);
+    return check("Recordings replay chunk for chunk", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_round_trip();
+    ok &= check_malformed();
+    ok &= check_splits();
+    ok &= check_resync();
+    ok &= check_recording();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,309 @@
+// Check that PackedSensorData records decode to what was encoded, and compare
+// the USB bandwidth of the packed SensorDataPacked events with the legacy
+// S32x3 SensorData events.
+// Round trips cover random records with and without encoder deltas, jumps too
+// large for a delta, the int32 wrap, tared (signed) and raw analog fields and
+// their saturation. Bandwidth is measured on the simulated device of
+// firmware_sim, dispatching at the highest rate in each format, and the packed
+// events are decoded and checked against the simulated sensors.
+// Usage: packed_sensor_data_test
+#include <packed_sensor_data.h>
+#include <firmware_sim.h>
+#include <treadmill_stream.h>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr uint8_t SENSOR_DATA_PACKED_ADDRESS = 73;
+constexpr uint8_t SENSOR_DATA_FORMAT_ADDRESS = 74;
+constexpr uint16_t MAX_EVENT_FREQUENCY_HZ = 1000;
+
+constexpr size_t NUM_RECORDS = 1'000'000;
+constexpr size_t USB_PACKET_BYTES = 64; // Full-speed bulk endpoint.
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+struct record_t
+{
+    int32_t encoder_ticks;
+    int16_t reaction_torque;
+    bool torque_signed;
+    int16_t brake_current;
+    bool brake_current_signed;
+};
+
+/**
+ * \brief what an analog field should decode to: saturated to 12 bits.
+ */
+int16_t expected_analog(int16_t value, bool is_signed)
+{
+    const int16_t min = is_signed ? -2048 : 0;
+    const int16_t max = is_signed ? 2047 : 4095;
+    return (value < min) ? min : ((value > max) ? max : value);
+}
+
+/**
+ * \brief a walk of the encoder with occasional jumps, across the int32 wrap,
+ *  and analog fields that are mostly in range.
+ */
+std::vector<record_t> make_records(std::mt19937& rng)
+{
+    std::uniform_int_distribution<int32_t> step(-3000, 3000);
+    std::uniform_int_distribution<int32_t> jump(INT32_MIN, INT32_MAX);
+    std::uniform_int_distribution<int32_t> raw(-200, 4300);
+    std::uniform_int_distribution<int32_t> tared(-2300, 2300);
+    std::uniform_int_distribution<uint32_t> pick(0, 99);
+    std::vector<record_t> records(NUM_RECORDS);
+    int32_t encoder_ticks = INT32_MAX - 1'000'000;
+    for (record_t& record: records)
+    {
+        const uint32_t choice = pick(rng);
+        if (choice == 0)
+            encoder_ticks = jump(rng);
+        else if (choice == 1)
+            encoder_ticks = int32_t(uint32_t(encoder_ticks) + 40'000);
+        else
+            encoder_ticks = int32_t(uint32_t(encoder_ticks) + uint32_t(step(rng)));
+        record.encoder_ticks = encoder_ticks;
+        record.torque_signed = pick(rng) < 50;
+        record.brake_current_signed = pick(rng) < 50;
+        record.reaction_torque = int16_t(record.torque_signed ? tared(rng)
+                                                              : raw(rng));
+        record.brake_current = int16_t(record.brake_current_signed ? tared(rng)
+                                                                   : raw(rng));
+    }
+    return records;
+}
+
+/**
+ * \brief encode every record into one buffer and decode it back.
+ * \returns the number of records that did not decode to the expected values.
+ */
+size_t round_trip(const std::vector<record_t>& records, bool use_deltas,
+                  size_t& num_bytes, size_t& num_deltas)
+{
+    PackedSensorData packer;
+    packer.set_use_deltas(use_deltas);
+    std::vector<uint8_t> buffer(records.size()
+                                * PackedSensorData::MAX_SIZE_BYTES);
+    num_bytes = 0;
+    for (const record_t& record: records)
+        num_bytes += packer.pack(&buffer[num_bytes], record.encoder_ticks,
+                                 record.reaction_torque, record.torque_signed,
+                                 record.brake_current,
+                                 record.brake_current_signed);
+    size_t mismatches = 0;
+    size_t offset = 0;
+    num_deltas = 0;
+    int32_t encoder_ticks = 0;
+    for (const record_t& record: records)
+    {
+        int16_t torque = 0;
+        int16_t current = 0;
+        num_deltas += (buffer[offset] & PackedSensorData::ENCODER_DELTA_FLAG)
+                      != 0;
+        const size_t size = PackedSensorData::unpack(&buffer[offset],
+                                                     num_bytes - offset,
+                                                     encoder_ticks, torque,
+                                                     current);
+        if (size == 0)
+            return mismatches + 1;
+        offset += size;
+        mismatches += encoder_ticks != record.encoder_ticks
+                      || torque != expected_analog(record.reaction_torque,
+                                                   record.torque_signed)
+                      || current != expected_analog(record.brake_current,
+                                                    record.brake_current_signed);
+    }
+    return mismatches + (offset != num_bytes);
+}
+
+bool check_round_trip()
+{
+    std::mt19937 rng(14);
+    const std::vector<record_t> records = make_records(rng);
+    bool ok = true;
+    for (const bool use_deltas: {false, true})
+    {
+        size_t num_bytes;
+        size_t num_deltas;
+        const size_t mismatches = round_trip(records, use_deltas, num_bytes,
+                                             num_deltas);
+        printf("  %-16s %zu mismatches in %zu records, %zu deltas, %.2f "
+               "[bytes] per record.\n",
+               use_deltas ? "Encoder deltas:" : "Absolute:", mismatches,
+               records.size(), num_deltas, double(num_bytes) / records.size());
+        ok &= mismatches == 0;
+        ok &= use_deltas ? (num_deltas > 0 && num_deltas < records.size())
+                         : num_deltas == 0;
+    }
+    // The first record after a reset is absolute, and deltas follow on.
+    PackedSensorData packer;
+    packer.set_use_deltas(true);
+    uint8_t record[PackedSensorData::MAX_SIZE_BYTES];
+    ok &= packer.pack(record, 5, 0, false, 0, false) == 8;
+    ok &= packer.pack(record, -5, 0, false, 0, false) == 6;
+    packer.reset();
+    ok &= packer.pack(record, -4, 0, false, 0, false) == 8;
+    // Other versions and truncated records are rejected.
+    int32_t encoder_ticks = 0;
+    int16_t torque = 0;
+    int16_t current = 0;
+    ok &= packer.pack(record, 7, 100, false, -100, true) == 6;
+    ok &= PackedSensorData::unpack(record, 5, encoder_ticks, torque, current)
+          == 0;
+    record[0] = uint8_t((record[0] & ~PackedSensorData::VERSION_MASK)
+                        | (PackedSensorData::VERSION + 1));
+    ok &= PackedSensorData::unpack(record, sizeof(record), encoder_ticks,
+                                   torque, current) == 0;
+    return check("Packed records decode to what was encoded", ok);
+}
+
+/**
+ * \brief belt at a constant speed, and torque and brake current that sweep
+ *  most of the 12-bit range. Torque stays within the torque limits.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    static constexpr double BELT_COUNTS_PER_S = -23'456;
+
+    int32_t encoder_counts(uint32_t index, uint64_t time_us) override
+    {
+        if (index > 0)
+            return 0;
+        return int32_t(floor(BELT_COUNTS_PER_S * time_us / 1e6));
+    }
+
+    uint16_t torque_counts(uint64_t time_us) override
+    {return uint16_t(lround(torque(time_us)));}
+
+    uint16_t brake_current_counts(uint64_t time_us, uint16_t) override
+    {return uint16_t(lround(current(time_us)));}
+
+    static double torque(uint64_t time_us)
+    {return 2048 + 1800 * sin(2 * M_PI * time_us / 1e6);}
+
+    static double current(uint64_t time_us)
+    {return 2048 - 2000 * cos(2 * M_PI * 3 * time_us / 1e6);}
+};
+
+struct format_t
+{
+    const char* name;
+    uint8_t format;
+    uint8_t address;
+};
+
+const format_t FORMATS[] =
+{
+    {"SensorData, S32x3", 0, SENSOR_DATA_ADDRESS},
+    {"SensorDataPacked", 1, SENSOR_DATA_PACKED_ADDRESS},
+    {"SensorDataPacked, deltas", 2, SENSOR_DATA_PACKED_ADDRESS},
+};
+
+bool check_bandwidth()
+{
+    Treadmill treadmill;
+    sim_boot(treadmill);
+    sim_run_us(10'000);
+    const uint16_t rate_hz = MAX_EVENT_FREQUENCY_HZ;
+    sim_write_register(SENSOR_DISPATCH_FREQUENCY_ADDRESS, HARP_U16, &rate_hz,
+                       sizeof(rate_hz));
+    printf("USB bandwidth of sensor events at %u [Hz]:\n", rate_hz);
+    bool ok = true;
+    double legacy_bytes_per_s = 0;
+    for (const format_t& format: FORMATS)
+    {
+        sim_write_register(SENSOR_DATA_FORMAT_ADDRESS, HARP_U8, &format.format,
+                           1);
+        sim_run_us(100'000);
+        // Decode from the format change on, since deltas build on every
+        // event before them.
+        size_t num_events = 0;
+        size_t bad_values = 0;
+        size_t other_frames = 0;
+        int32_t encoder_ticks = 0;
+        HarpFrameParser parser;
+        auto decode = [&](const harp_frame_t& frame)
+        {
+            if (frame.message_type != HARP_EVENT
+                || frame.address != format.address)
+            {
+                ++other_frames;
+                return;
+            }
+            ++num_events;
+            int16_t torque = 0;
+            int16_t current = 0;
+            if (format.address == SENSOR_DATA_ADDRESS)
+            {
+                encoder_ticks = frame.element<int32_t>(0);
+                torque = int16_t(frame.element<int32_t>(1));
+                current = int16_t(frame.element<int32_t>(2));
+            }
+            else if (PackedSensorData::unpack(frame.payload,
+                                              frame.payload_length,
+                                              encoder_ticks, torque, current)
+                     == 0)
+            {
+                ++bad_values;
+                return;
+            }
+            // Harp time is in 32 [us] ticks, and sensors are latched on the
+            // 10 [kHz] grid.
+            const double expected_ticks = Treadmill::BELT_COUNTS_PER_S
+                                          * frame.harp_time_us / 1e6;
+            if (fabs(encoder_ticks - expected_ticks) > 2
+                || fabs(torque - Treadmill::torque(frame.harp_time_us)) > 3
+                || fabs(current - Treadmill::current(frame.harp_time_us)) > 3)
+                ++bad_values;
+        };
+        const std::vector<uint8_t> settling = sim_take_usb_output();
+        parser.parse(settling.data(), settling.size(), decode);
+        num_events = 0;
+        other_frames = 0;
+        const uint64_t start_us = sim_time_us();
+        sim_run_us(1'000'000);
+        const double seconds = (sim_time_us() - start_us) * 1e-6;
+        const std::vector<uint8_t> output = sim_take_usb_output();
+        parser.parse(output.data(), output.size(), decode);
+        const double bytes_per_s = output.size() / seconds;
+        const double bytes_per_event = num_events ? double(output.size())
+                                                    / num_events
+                                                  : 0;
+        if (format.format == 0)
+            legacy_bytes_per_s = bytes_per_s;
+        printf("  %-26s %zu events, %zu wrong, %.0f [bytes/s], %.1f [bytes] "
+               "per event, %zu events per %zu [byte] USB packet, %.0f%% of "
+               "S32x3.\n", format.name, num_events, bad_values, bytes_per_s,
+               bytes_per_event,
+               bytes_per_event ? size_t(USB_PACKET_BYTES / bytes_per_event) : 0,
+               USB_PACKET_BYTES,
+               100 * bytes_per_s / legacy_bytes_per_s);
+        ok &= num_events + 1 >= rate_hz && bad_values == 0
+              && other_frames == 0 && parser.skipped_bytes() == 0;
+        // Frames carry 12 bytes of header, timestamp and checksum around the
+        // 12, 8 or 6 byte payloads.
+        if (format.format > 0)
+            ok &= bytes_per_s < legacy_bytes_per_s * ((format.format == 1)
+                                                      ? 20.5 / 24 : 18.5 / 24);
+    }
+    return check("Packed events decode to the sensors with fewer bytes", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_round_trip();
+    ok &= check_bandwidth();
+    return ok ? 0 : 1;
+}
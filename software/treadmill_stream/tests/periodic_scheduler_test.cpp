@@ -0,0 +1,140 @@
+// Drive the firmware's PeriodicScheduler with a fake clock, as a hardware
+// alarm would: each deadline is serviced some lateness after it passes.
+// Deadlines must stay on the start + n * period grid however late servicing
+// is, and deadlines that pass before servicing catches up must be skipped
+// and counted as missed.
+#include <periodic_scheduler.h>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+bool check_drift_free()
+{
+    // Jittery but never a whole period late, e.g: a 100 [us] period that is
+    // serviced up to 80 [us] late.
+    PeriodicScheduler scheduler;
+    const uint64_t start_us = 5'000'000'017;
+    const uint32_t period_us = 100;
+    uint64_t deadline_us = scheduler.start(start_us, period_us);
+    bool ok = deadline_us == start_us + period_us && scheduler.is_running();
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<uint32_t> lateness(0, 80);
+    uint32_t max_lateness_us = 0;
+    constexpr uint32_t NUM_DEADLINES = 1'000'000;
+    for (uint32_t n = 1; n <= NUM_DEADLINES; ++n)
+    {
+        ok &= deadline_us == start_us + uint64_t(n) * period_us;
+        const uint32_t late_us = lateness(rng);
+        max_lateness_us = (late_us > max_lateness_us) ? late_us
+                                                      : max_lateness_us;
+        const uint64_t now_us = deadline_us + late_us;
+        ok &= scheduler.is_due(now_us) && !scheduler.is_due(deadline_us - 1);
+        deadline_us = scheduler.service(now_us);
+        ok &= scheduler.last_lateness_us() == late_us;
+    }
+    // After a million periods, the grid has not moved.
+    ok &= deadline_us == start_us + uint64_t(NUM_DEADLINES + 1) * period_us;
+    ok &= scheduler.serviced_count() == NUM_DEADLINES
+          && scheduler.missed_count() == 0
+          && scheduler.max_lateness_us() == max_lateness_us;
+    return check("Late servicing does not shift the deadline grid", ok);
+}
+
+bool check_catch_up()
+{
+    PeriodicScheduler scheduler;
+    const uint32_t period_us = 1000;
+    uint64_t deadline_us = scheduler.start(0, period_us);
+    // Service the first deadline 3.5 periods late: the next three deadlines
+    // have already passed, so they are skipped and the next one is at 5000.
+    deadline_us = scheduler.service(deadline_us + 3500);
+    bool ok = deadline_us == 5000 && scheduler.missed_count() == 3
+              && scheduler.serviced_count() == 1
+              && scheduler.last_lateness_us() == 3500;
+    // Exactly on a later deadline: that deadline counts as missed too, since
+    // the returned deadline must be in the future.
+    deadline_us = scheduler.service(deadline_us + 2 * period_us);
+    ok &= deadline_us == 8000 && scheduler.missed_count() == 5;
+    // An alarm that could not be armed because its deadline already passed:
+    // 8000 and 9000 are skipped.
+    deadline_us = scheduler.skip_to(9500);
+    ok &= deadline_us == 10'000 && scheduler.missed_count() == 7
+          && scheduler.serviced_count() == 2;
+    // Skipping to before the deadline changes nothing.
+    ok &= scheduler.skip_to(9999) == 10'000 && scheduler.missed_count() == 7;
+    // Back on time.
+    deadline_us = scheduler.service(deadline_us);
+    ok &= deadline_us == 11'000 && scheduler.last_lateness_us() == 0
+          && scheduler.max_lateness_us() == 3500;
+    return check("Missed deadlines are skipped and counted", ok);
+}
+
+bool check_early_service()
+{
+    // An alarm that fires a little early (e.g: timer rounding) must not
+    // double-service: the deadline still advances by exactly one period.
+    PeriodicScheduler scheduler;
+    uint64_t deadline_us = scheduler.start(1000, 250);
+    deadline_us = scheduler.service(deadline_us - 3);
+    bool ok = deadline_us == 1500 && scheduler.last_lateness_us() == 0
+              && scheduler.missed_count() == 0;
+    return check("Early servicing advances one period", ok);
+}
+
+bool check_stop_and_stats()
+{
+    PeriodicScheduler scheduler;
+    bool ok = !scheduler.is_running() && !scheduler.is_due(UINT64_MAX);
+    scheduler.start(0, 10);
+    scheduler.service(45);
+    scheduler.stop();
+    ok &= !scheduler.is_running() && !scheduler.is_due(1000);
+    ok &= scheduler.serviced_count() == 1 && scheduler.missed_count() == 3;
+    scheduler.clear_stats();
+    ok &= scheduler.serviced_count() == 0 && scheduler.missed_count() == 0
+          && scheduler.max_lateness_us() == 0
+          && scheduler.last_lateness_us() == 0;
+    // Restarting moves the grid to the new start time.
+    ok &= scheduler.start(1'000'003, 7) == 1'000'010 && scheduler.is_running();
+    return check("Stop, restart and clear_stats()", ok);
+}
+
+bool check_polled()
+{
+    // Polled use, as for batched sampling: a 3 [ms] period driven by the
+    // timestamps of 100 [us] samples picks exactly one sample per period.
+    PeriodicScheduler scheduler;
+    scheduler.start(0, 3000);
+    uint32_t picked = 0;
+    bool ok = true;
+    uint64_t last_pick_us = 0;
+    for (uint64_t now_us = 0; now_us <= 3'000'000; now_us += 100)
+    {
+        if (!scheduler.is_due(now_us))
+            continue;
+        scheduler.service(now_us);
+        ok &= (picked == 0) || (now_us - last_pick_us == 3000);
+        last_pick_us = now_us;
+        ++picked;
+    }
+    ok &= picked == 1000 && scheduler.missed_count() == 0;
+    return check("Polled on sample timestamps", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_drift_free();
+    ok &= check_catch_up();
+    ok &= check_early_service();
+    ok &= check_stop_and_stats();
+    ok &= check_polled();
+    return ok ? 0 : 1;
+}
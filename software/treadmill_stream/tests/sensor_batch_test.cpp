@@ -0,0 +1,214 @@
+// Round-trip the firmware's batched sensor samples (SensorDataBatch) through
+// a Harp frame and back, built from the firmware's own sensor_batch.cpp.
+// Samples are latched on a simulated 10 kHz core1 tick and picked by the
+// firmware's PeriodicScheduler at each batch rate, as on the device.
+#include <harp_frame.h>
+#include <periodic_scheduler.h>
+#include <sensor_batch.h>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+constexpr uint8_t SENSOR_BATCH_ADDRESS = 42;
+constexpr uint32_t CORE1_TICK_FREQUENCY_HZ = 10000; // Same as the firmware.
+constexpr uint32_t CORE1_TICK_INTERVAL_US = 1'000'000 / CORE1_TICK_FREQUENCY_HZ;
+constexpr uint64_t HARP_TICK_US = 32;
+
+struct sample_t
+{
+    uint64_t time_us;
+    int32_t encoder_ticks;
+    int16_t reaction_torque;
+    int16_t brake_current;
+};
+
+sample_t make_sample(uint64_t time_us)
+{
+    return {time_us, int32_t(time_us * 7) - 1'000'000,
+            int16_t(time_us % 4096), int16_t(-int32_t(time_us % 2048))};
+}
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief send a batch as the firmware does and decode it as a host would.
+ * \returns the decoded samples with absolute times, or none if the frame
+ *  did not parse.
+ */
+std::vector<sample_t> round_trip(const SensorBatch& batch)
+{
+    uint8_t frame[HARP_MAX_FRAME_BYTES];
+    const size_t frame_size = encode_harp_frame(
+        frame, HARP_EVENT, SENSOR_BATCH_ADDRESS, HARP_U8, batch.data(),
+        batch.size_bytes(), int64_t(batch.start_time_us()));
+    std::vector<sample_t> samples;
+    HarpFrameParser parser;
+    parser.parse(frame, frame_size, [&](const harp_frame_t& msg)
+    {
+        if (msg.address != SENSOR_BATCH_ADDRESS || msg.payload_type != HARP_U8)
+            return;
+        batch_sample_t decoded[SensorBatch::MAX_SAMPLES];
+        const uint8_t count = SensorBatch::decode(msg.payload,
+                                                  msg.payload_length, decoded,
+                                                  SensorBatch::MAX_SAMPLES);
+        for (uint8_t i = 0; i < count; ++i)
+            samples.push_back({msg.harp_time_us + decoded[i].time_offset_us,
+                               decoded[i].encoder_ticks,
+                               decoded[i].reaction_torque,
+                               decoded[i].brake_current});
+    });
+    return samples;
+}
+
+/**
+ * \brief whether a decoded sample matches the sample that was sent.
+ * \details Harp timestamps have a resolution of 32 [us], so a decoded time
+ *  can be early by up to that much. Offsets within a batch are exact.
+ */
+bool same(const sample_t& received, const sample_t& sent)
+{
+    return received.time_us <= sent.time_us
+           && sent.time_us - received.time_us < HARP_TICK_US
+           && received.encoder_ticks == sent.encoder_ticks
+           && received.reaction_torque == sent.reaction_torque
+           && received.brake_current == sent.brake_current;
+}
+
+/**
+ * \brief acquire num_batches full batches at frequency_hz from samples
+ *  latched every core1 tick, and round-trip each one.
+ * \returns false if any sample did not survive the round trip or if the
+ *  samples were not evenly spaced at the requested rate.
+ */
+bool check_rate(uint32_t frequency_hz, uint8_t batch_size, size_t num_batches)
+{
+    SensorBatch batch;
+    batch.set_batch_size(batch_size);
+    PeriodicScheduler scheduler;
+    const uint64_t start_us = 123'456'700; // On the tick grid.
+    scheduler.start(start_us, 1'000'000 / frequency_hz);
+    std::vector<sample_t> sent;
+    std::vector<sample_t> received;
+    for (uint64_t now_us = start_us; received.size() < num_batches * batch_size;
+         now_us += CORE1_TICK_INTERVAL_US)
+    {
+        if (!scheduler.is_due(now_us))
+            continue;
+        scheduler.service(now_us);
+        const sample_t sample = make_sample(now_us);
+        sent.push_back(sample);
+        if (!batch.add_sample(sample.time_us, sample.encoder_ticks,
+                              sample.reaction_torque, sample.brake_current))
+            return false;
+        if (!batch.is_full())
+            continue;
+        const std::vector<sample_t> samples = round_trip(batch);
+        received.insert(received.end(), samples.begin(), samples.end());
+        batch.clear();
+    }
+    if (received.size() != sent.size())
+        return false;
+    const uint64_t period_us = 1'000'000 / frequency_hz;
+    for (size_t i = 0; i < received.size(); ++i)
+    {
+        if (!same(received[i], sent[i]))
+            return false;
+        if (i > 0 && sent[i].time_us - sent[i - 1].time_us != period_us)
+            return false;
+        // Within a batch, every sample shares the event timestamp's error.
+        if ((i % batch_size) != 0
+            && received[i].time_us - received[i - 1].time_us
+               != sent[i].time_us - sent[i - 1].time_us)
+            return false;
+    }
+    return true;
+}
+
+bool check_divisor_rates()
+{
+    bool ok = true;
+    for (uint32_t frequency_hz = 1; frequency_hz <= CORE1_TICK_FREQUENCY_HZ;
+         ++frequency_hz)
+    {
+        if (CORE1_TICK_FREQUENCY_HZ % frequency_hz != 0)
+            continue;
+        // Keep each batch's offsets within 16 bits.
+        const uint32_t max_size = 65535 * frequency_hz / 1'000'000 + 1;
+        const uint8_t batch_size = uint8_t(
+            (max_size < SensorBatch::MAX_SAMPLES) ? max_size
+                                                  : SensorBatch::MAX_SAMPLES);
+        if (!check_rate(frequency_hz, batch_size, 3))
+        {
+            printf("  %u [Hz] did not round-trip evenly.\n", frequency_hz);
+            ok = false;
+        }
+    }
+    return check("Every rate that divides the tick rate round-trips evenly",
+                 ok);
+}
+
+bool check_aliased_rate()
+{
+    // 3 kHz lands on the 100 [us] tick grid at 400, 300, 300 [us] spacing,
+    // which is why the firmware rejects it.
+    return check("A rate that does not divide the tick rate aliases",
+                 !check_rate(3000, SensorBatch::MAX_SAMPLES, 1));
+}
+
+bool check_partial_batch()
+{
+    SensorBatch batch;
+    std::vector<sample_t> sent;
+    for (uint64_t i = 0; i < 5; ++i)
+    {
+        sent.push_back(make_sample(1000 + 100 * i));
+        batch.add_sample(sent.back().time_us, sent.back().encoder_ticks,
+                         sent.back().reaction_torque, sent.back().brake_current);
+    }
+    const std::vector<sample_t> received = round_trip(batch);
+    bool ok = batch.size_bytes() == 5 * sizeof(batch_sample_t)
+              && received.size() == sent.size();
+    for (size_t i = 0; ok && i < sent.size(); ++i)
+        ok = same(received[i], sent[i]);
+    return check("A partial batch sends only its samples", ok);
+}
+
+bool check_limits()
+{
+    SensorBatch batch;
+    bool ok = sizeof(batch_sample_t) == 10
+              && SensorBatch::MAX_SIZE_BYTES + HARP_HEADER_BYTES
+                 + HARP_TIMESTAMP_BYTES + 1 <= HARP_MAX_FRAME_BYTES;
+    ok &= !batch.set_batch_size(0) && batch.batch_size() == 1;
+    ok &= !batch.set_batch_size(SensorBatch::MAX_SAMPLES + 1)
+          && batch.batch_size() == SensorBatch::MAX_SAMPLES;
+    ok &= batch.set_batch_size(3) && batch.batch_size() == 3;
+    // The last time offset that fits in 16 bits.
+    ok &= batch.add_sample(0, 1, 2, 3) && batch.add_sample(UINT16_MAX, 4, 5, 6);
+    ok &= !batch.add_sample(UINT16_MAX + 1, 7, 8, 9);
+    ok &= batch.add_sample(UINT16_MAX, 7, 8, 9) && batch.is_full();
+    ok &= !batch.add_sample(UINT16_MAX, 10, 11, 12);
+    // Decoding stops at max_samples and at the last whole sample.
+    batch_sample_t decoded[SensorBatch::MAX_SAMPLES];
+    ok &= SensorBatch::decode(batch.data(), batch.size_bytes(), decoded, 2) == 2;
+    ok &= SensorBatch::decode(batch.data(), batch.size_bytes() - 1, decoded,
+                              SensorBatch::MAX_SAMPLES) == 2;
+    ok &= decoded[1].time_offset_us == UINT16_MAX
+          && decoded[1].encoder_ticks == 4;
+    return check("Batch size, time offset and decode limits", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_divisor_rates();
+    ok &= check_aliased_rate();
+    ok &= check_partial_batch();
+    ok &= check_limits();
+    return ok ? 0 : 1;
+}
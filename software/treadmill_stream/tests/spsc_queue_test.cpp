@@ -0,0 +1,130 @@
+// Stress the firmware's SPSCQueue with a producer and a consumer thread, as
+// core1 and core0 use it. Every item carries redundant copies of its
+// sequence number, so a torn or reordered item is caught as well as a lost
+// or duplicated one.
+#include <spsc_queue.h>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+// About the size of a core1 event.
+struct item_t
+{
+    uint64_t sequence;
+    uint32_t words[8];
+};
+
+item_t make_item(uint64_t sequence)
+{
+    item_t item;
+    item.sequence = sequence;
+    for (uint32_t i = 0; i < 8; ++i)
+        item.words[i] = uint32_t(sequence * 2654435761u) ^ i;
+    return item;
+}
+
+bool is_intact(const item_t& item, uint64_t expected_sequence)
+{
+    if (item.sequence != expected_sequence)
+        return false;
+    for (uint32_t i = 0; i < 8; ++i)
+        if (item.words[i] != (uint32_t(expected_sequence * 2654435761u) ^ i))
+            return false;
+    return true;
+}
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+bool check_single_thread()
+{
+    SPSCQueue<item_t, 16> queue;
+    item_t item;
+    bool ok = queue.empty() && !queue.pop(item);
+    // Holds exactly SIZE items.
+    for (uint64_t n = 0; n < 16; ++n)
+        ok &= queue.push(make_item(n));
+    ok &= !queue.push(make_item(16)) && queue.size() == 16;
+    // Wrap the indices around the buffer many times, half full.
+    uint64_t next_push = 16;
+    uint64_t next_pop = 0;
+    for (uint32_t round = 0; round < 1000; ++round)
+    {
+        for (uint32_t i = 0; i < 8; ++i)
+            ok &= queue.pop(item) && is_intact(item, next_pop++);
+        for (uint32_t i = 0; i < 8; ++i)
+            ok &= queue.push(make_item(next_push++));
+        ok &= queue.size() == 16;
+    }
+    while (queue.pop(item))
+        ok &= is_intact(item, next_pop++);
+    ok &= (next_pop == next_push) && queue.empty();
+    return check("A full queue rejects pushes and wraps in order", ok);
+}
+
+/**
+ * \brief run a producer and a consumer thread over a queue of SIZE items.
+ * \param burst items the consumer pops before it yields, so that the queue
+ *  runs both nearly full and nearly empty.
+ */
+template <size_t SIZE>
+bool check_threads(uint32_t burst, uint64_t num_items)
+{
+    SPSCQueue<item_t, SIZE> queue;
+    uint64_t full_count = 0;
+    std::thread producer([&]()
+    {
+        for (uint64_t n = 0; n < num_items; ++n)
+        {
+            const item_t item = make_item(n);
+            while (!queue.push(item))
+            {
+                ++full_count;
+                std::this_thread::yield();
+            }
+        }
+    });
+    bool ok = true;
+    uint64_t expected = 0;
+    uint64_t empty_count = 0;
+    while (expected < num_items)
+    {
+        item_t item;
+        uint32_t popped = 0;
+        while (popped < burst && queue.pop(item))
+        {
+            ok &= is_intact(item, expected++);
+            ++popped;
+        }
+        if (popped == 0)
+            ++empty_count;
+        std::this_thread::yield();
+    }
+    producer.join();
+    item_t item;
+    ok &= !queue.pop(item);
+    printf("  %zu-item queue, bursts of %u: %llu full and %llu empty waits.\n",
+           SIZE, burst, (unsigned long long)full_count,
+           (unsigned long long)empty_count);
+    return ok;
+}
+
+bool check_concurrent()
+{
+    bool ok = check_threads<2>(1, 1 << 18);
+    ok &= check_threads<32>(4, 1 << 20);
+    ok &= check_threads<256>(256, 1 << 22);
+    return check("Two threads pass every item once, intact and in order", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_single_thread();
+    ok &= check_concurrent();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,343 @@
+// Drive the firmware's StreamPeriodEstimator with a fake clock, then check
+// the acquisition timestamps of sensor events and the SensorSkew register on
+// the simulated device of firmware_sim.
+// Streams are observed every 100 [us], as the sample latch observes the ADC
+// rings' write indices, at conversion periods from that of the on-chip ADC
+// to a slow external ADC, with and without jitter, through a stall and
+// across many wraps of the ring index. Without jitter, the period must bound
+// the age of the latest conversion at every observation. The age bounds must
+// hold at every observation, and narrow to a fraction of the period for a
+// stream out of step with the observations.
+// On the simulated device, every sensor encodes the time it was sampled at,
+// so each SensorData event shows when its values were acquired, and Harp
+// time is offset from the device's clock and drifts from it. Each event's
+// Harp timestamp must be within SensorSkew of when each of its values was
+// acquired, in Harp time, even though a busy core0 sends it later.
+// Usage: stream_period_estimator_test
+#include <stream_period_estimator.h>
+#include <firmware_sim.h>
+#include <treadmill_stream.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr uint32_t ADC_RING_SIZE = 1024;
+constexpr uint32_t SENSOR_SKEW_WINDOW_US = 100'000;
+constexpr uint64_t LATCH_INTERVAL_US = 100;
+constexpr uint8_t SENSOR_SKEW_ADDRESS = 86;
+constexpr uint16_t MAX_EVENT_FREQUENCY_HZ = 1000;
+
+constexpr uint64_t HARP_TICK_US = 32; // Timestamp resolution.
+// Not the default, and out of step with the latch, so that the age of the
+// latched conversions sweeps a whole period.
+constexpr uint32_t SIM_ADC_RATE_HZ = 96'000;
+constexpr uint32_t SIM_CORE0_LOOP_PERIOD_US = 23;
+// Not a whole number of Harp ticks, and a drift step in the recording.
+constexpr int64_t SIM_HARP_OFFSET_US = 1'234'567'891;
+constexpr int32_t SIM_HARP_DRIFT_PPM = 150;
+constexpr uint64_t RECORDING_START_US = 800'000;
+constexpr uint64_t RECORDING_US = 500'000;
+constexpr uint32_t MAX_SENSOR_SKEW_NS = 10'000; // Required for alignment.
+constexpr uint32_t NUM_WINDOWS = 5;
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/**
+ * \brief a free-running stream of conversions that DMA writes into a ring,
+ *  out of phase with the observations and optionally with jitter on each
+ *  conversion time.
+ */
+class Stream
+{
+public:
+    Stream(double period_ns, double jitter_ns, uint32_t seed)
+    : rng_(seed), jitter_(-jitter_ns, jitter_ns), period_ns_{period_ns},
+      phase_ns_{0.37 * period_ns}, count_{0}, last_ns_{0}, next_ns_{next(0)}
+    {}
+
+/**
+ * \brief run the stream up to time_us.
+ * \returns the ring's write index.
+ */
+    uint32_t write_index(uint64_t time_us)
+    {
+        while (next_ns_ <= time_us * 1000.0)
+        {
+            last_ns_ = next_ns_;
+            next_ns_ = next(++count_);
+            ++written_;
+        }
+        return written_ & (ADC_RING_SIZE - 1);
+    }
+
+/**
+ * \brief age of the latest conversion at time_us [ns].
+ */
+    double age_ns(uint64_t time_us) const {return time_us * 1000.0 - last_ns_;}
+
+    void stall() {next_ns_ = INFINITY;}
+
+private:
+    double next(uint64_t count)
+    {return phase_ns_ + count * period_ns_ + jitter_(rng_);}
+
+    std::mt19937 rng_;
+    std::uniform_real_distribution<double> jitter_;
+    const double period_ns_;
+    const double phase_ns_;
+    uint64_t count_;
+    uint32_t written_ = 0;
+    double last_ns_;
+    double next_ns_;
+};
+
+struct stream_config_t
+{
+    const char* name;
+    double period_ns;
+    double jitter_ns;
+    bool in_step; // A whole number of periods between observations.
+};
+
+const stream_config_t STREAMS[] =
+{
+    {"on-chip ADC, 800 [ns]", 800, 0, true},
+    {"on-chip ADC, 800 [ns], jittered", 800, 300, true},
+    {"ADS7049 at 100 [kHz]", 10'000, 0, true},
+    {"ADS7049 at 80 [kHz], jittered", 12'500, 2'000, true},
+    {"ADS7049 at 30 [kHz]", 33'333.3, 0, true},
+    {"ADS7049 at 96 [kHz]", 10'416.7, 0, false},
+};
+
+bool check_estimates()
+{
+    bool ok = true;
+    for (const stream_config_t& config: STREAMS)
+    {
+        // Conversions land anywhere in twice the jitter from the grid.
+        StreamPeriodEstimator estimator(ADC_RING_SIZE - 1, SENSOR_SKEW_WINDOW_US,
+                                        uint32_t(2 * config.jitter_ns));
+        Stream stream(config.period_ns, config.jitter_ns, 19);
+        estimator.reset(0, stream.write_index(0));
+        bool zero_before_window = true;
+        double max_error_ns = 0;
+        double max_age_ns = 0;
+        size_t estimates = 0;
+        size_t ages_out_of_bounds = 0;
+        double total_bounds_ns = 0;
+        size_t num_bounds = 0;
+        const uint64_t end_us = NUM_WINDOWS * SENSOR_SKEW_WINDOW_US;
+        for (uint64_t time_us = LATCH_INTERVAL_US; time_us <= end_us;
+             time_us += LATCH_INTERVAL_US)
+        {
+            estimator.update(time_us, stream.write_index(time_us));
+            const double age_ns = stream.age_ns(time_us);
+            max_age_ns = fmax(max_age_ns, age_ns);
+            if (time_us < SENSOR_SKEW_WINDOW_US)
+            {
+                zero_before_window &= estimator.period_ns() == 0
+                                      && estimator.max_age_ns() == 0;
+                continue;
+            }
+            // Bounds are rounded outwards to the [ns].
+            ages_out_of_bounds += age_ns + 1 < estimator.min_age_ns()
+                                  || age_ns > estimator.max_age_ns() + 1.0;
+            if (time_us > SENSOR_SKEW_WINDOW_US)
+            {
+                total_bounds_ns += estimator.max_age_ns()
+                                   - estimator.min_age_ns();
+                ++num_bounds;
+            }
+            if (time_us % SENSOR_SKEW_WINDOW_US)
+                continue;
+            ++estimates;
+            max_error_ns = fmax(max_error_ns, fabs(estimator.period_ns()
+                                                   - config.period_ns));
+        }
+        // One conversion more or less in a window, and rounding.
+        const double tolerance_ns = config.period_ns * config.period_ns
+                                    / (SENSOR_SKEW_WINDOW_US * 1000.0) + 1;
+        // Without jitter, the latest conversion is never older than one period.
+        const bool bounds_age = config.jitter_ns > 0
+                                || max_age_ns <= estimator.period_ns() + 1;
+        const double mean_bounds_ns = total_bounds_ns / num_bounds;
+        printf("  %-32s %u [ns], off by at most %.1f [ns] in %zu windows. "
+               "Oldest latched conversion %.0f [ns]. Its age bounded to "
+               "%.0f [ns] on average, %zu times wrongly.\n", config.name,
+               estimator.period_ns(), max_error_ns, estimates, max_age_ns,
+               mean_bounds_ns, ages_out_of_bounds);
+        ok &= zero_before_window && estimates == NUM_WINDOWS
+              && max_error_ns <= tolerance_ns && bounds_age
+              && ages_out_of_bounds == 0
+              && (config.in_step || mean_bounds_ns <= config.period_ns / 4);
+    }
+    return check("Stream periods are estimated per window, and latest "
+                 "samples' ages bounded", ok);
+}
+
+bool check_stall_and_reset()
+{
+    StreamPeriodEstimator estimator(ADC_RING_SIZE - 1, SENSOR_SKEW_WINDOW_US, 0);
+    Stream stream(10'000, 0, 1);
+    estimator.reset(0, stream.write_index(0));
+    uint64_t time_us = 0;
+    for (; time_us < SENSOR_SKEW_WINDOW_US; time_us += LATCH_INTERVAL_US)
+        estimator.update(time_us + LATCH_INTERVAL_US,
+                         stream.write_index(time_us + LATCH_INTERVAL_US));
+    bool ok = estimator.period_ns() == 10'000;
+    // A stalled stream reports the window length, a lower bound on its age.
+    stream.stall();
+    for (; time_us < 2 * SENSOR_SKEW_WINDOW_US; time_us += LATCH_INTERVAL_US)
+        estimator.update(time_us + LATCH_INTERVAL_US,
+                         stream.write_index(time_us + LATCH_INTERVAL_US));
+    ok &= estimator.period_ns() == SENSOR_SKEW_WINDOW_US * 1000;
+    // Late observations still count their whole interval.
+    estimator.reset(time_us, stream.write_index(time_us));
+    ok &= estimator.period_ns() == 0;
+    estimator.update(time_us + 3 * SENSOR_SKEW_WINDOW_US / 2,
+                     stream.write_index(time_us));
+    ok &= estimator.period_ns() == 3 * SENSOR_SKEW_WINDOW_US / 2 * 1000;
+    return check("A stalled stream reads as at least a window old", ok);
+}
+
+/**
+ * \brief sensors that encode when they were sampled: the encoder counts
+ *  [us] and the analog channels are saw teeth of one count per [us], within
+ *  the torque limits.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    static constexpr int32_t TORQUE_BASE = 200;
+    static constexpr int32_t TORQUE_SPAN = 3600;
+    static constexpr int32_t CURRENT_BASE = 100;
+    static constexpr int32_t CURRENT_SPAN = 3000;
+
+    int32_t encoder_counts(uint32_t index, uint64_t time_us) override
+    {return (index > 0) ? 0 : int32_t(time_us);}
+
+    uint16_t torque_counts(uint64_t time_us) override
+    {return uint16_t(TORQUE_BASE + time_us % TORQUE_SPAN);}
+
+    uint16_t brake_current_counts(uint64_t time_us, uint16_t) override
+    {return uint16_t(CURRENT_BASE + time_us % CURRENT_SPAN);}
+};
+
+/**
+ * \brief how long before time_us a saw tooth value was sampled.
+ */
+int64_t age_us(int64_t time_us, int32_t value, int32_t base, int32_t span)
+{
+    const int64_t phase = value - base;
+    return (((time_us - phase) % span) + span) % span;
+}
+
+int64_t harp_tick_us(int64_t time_us)
+{return time_us - time_us % int64_t(HARP_TICK_US);}
+
+/**
+ * \brief Harp time of a device time, as HarpSynchronizer corrects it: one
+ *  offset per second, re-aligned to the drifting Harp clock at each.
+ */
+int64_t harp_time_us(int64_t system_time_us)
+{
+    return system_time_us + SIM_HARP_OFFSET_US
+           + system_time_us / 1'000'000 * SIM_HARP_DRIFT_PPM;
+}
+
+bool check_device()
+{
+    Treadmill treadmill;
+    sim_config_t config;
+    config.sensor_adc_rate_hz = SIM_ADC_RATE_HZ;
+    // A busy core0, out of step with the latch, so that events are sent
+    // well after their sample was latched.
+    config.core0_loop_period_us = SIM_CORE0_LOOP_PERIOD_US;
+    config.harp_offset_us = SIM_HARP_OFFSET_US;
+    config.harp_drift_ppm = SIM_HARP_DRIFT_PPM;
+    sim_boot(treadmill, config);
+    sim_run_us(10'000);
+    const uint16_t rate_hz = MAX_EVENT_FREQUENCY_HZ;
+    sim_write_register(SENSOR_DISPATCH_FREQUENCY_ADDRESS, HARP_U16, &rate_hz,
+                       sizeof(rate_hz));
+    sim_run_us(RECORDING_START_US - sim_time_us());
+    sim_take_usb_output();
+    sim_run_us(RECORDING_US);
+    sim_read_register(SENSOR_SKEW_ADDRESS);
+    sim_run_us(1000);
+    const std::vector<uint8_t> output = sim_take_usb_output();
+    uint32_t skew_ns[3] = {0, 0, 0};
+    std::vector<std::array<int64_t, 4>> events; // Stamp, then acquisitions.
+    HarpFrameParser parser;
+    parser.parse(output.data(), output.size(), [&](const harp_frame_t& frame)
+    {
+        if (frame.message_type == HARP_READ
+            && frame.address == SENSOR_SKEW_ADDRESS)
+        {
+            for (size_t i = 0; i < 3; ++i)
+                skew_ns[i] = frame.element<uint32_t>(i);
+            return;
+        }
+        if (frame.message_type != HARP_EVENT
+            || frame.address != SENSOR_DATA_ADDRESS)
+            return;
+        const int64_t encoder_us = frame.element<int32_t>(0);
+        events.push_back({int64_t(frame.harp_time_us), encoder_us,
+                          encoder_us - age_us(encoder_us,
+                                              frame.element<int32_t>(1),
+                                              Treadmill::TORQUE_BASE,
+                                              Treadmill::TORQUE_SPAN),
+                          encoder_us - age_us(encoder_us,
+                                              frame.element<int32_t>(2),
+                                              Treadmill::CURRENT_BASE,
+                                              Treadmill::CURRENT_SPAN)});
+    });
+    // Each value is within its skew of the stamp, less the [us] that
+    // sensors are sampled to here and the stamp is rounded to. The stamp is
+    // then rounded down to a Harp tick.
+    size_t misplaced[3] = {0, 0, 0};
+    size_t drift_steps = 0;
+    for (const std::array<int64_t, 4>& event: events)
+    {
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const int64_t skew_us = (skew_ns[i] + 999) / 1000 + 1;
+            misplaced[i] += event[0] < harp_tick_us(
+                                           harp_time_us(event[i + 1] - skew_us))
+                            || event[0] > harp_time_us(event[i + 1] + skew_us);
+        }
+        drift_steps += event[1] / 1'000'000 != events.front()[1] / 1'000'000;
+    }
+    printf("SensorSkew on a device converting at %u [Hz]: [%u, %u, %u] "
+           "[ns].\n", SIM_ADC_RATE_HZ, skew_ns[0], skew_ns[1], skew_ns[2]);
+    printf("%zu SensorData events, %zu after a Harp drift step. Stamped "
+           "further from their encoder, torque and load current acquisition "
+           "than SensorSkew: %zu, %zu, %zu.\n", events.size(), drift_steps,
+           misplaced[0], misplaced[1], misplaced[2]);
+    bool ok = events.size() + 1 >= RECORDING_US * rate_hz / 1'000'000
+              && drift_steps > 0;
+    for (size_t i = 0; i < 3; ++i)
+        ok &= skew_ns[i] > 0 && skew_ns[i] <= MAX_SENSOR_SKEW_NS
+              && misplaced[i] == 0;
+    return check("Events are stamped at acquisition in Harp time, within "
+                 "SensorSkew", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_estimates();
+    ok &= check_stall_and_reset();
+    ok &= check_device();
+    return ok ? 0 : 1;
+}
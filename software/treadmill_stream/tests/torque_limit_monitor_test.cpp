@@ -0,0 +1,370 @@
+// Replay torque traces through the firmware's TorqueLimitMonitor with the
+// device's default limits, window and hysteresis.
+// Traces are modelled on the conversion stream that the monitor sees:
+// walking with stepping impacts, slow overloads, single-conversion glitches,
+// a sensor stuck on either rail, and torque that hovers near a limit after a
+// trip. Flight recorder captures (flight_recorder.csv, as saved by
+// software/pyharp/download_flight_recorder.py) can also be replayed; the
+// monitor must trip where the device flagged the trip.
+// Usage: torque_limit_monitor_test [flight_recorder.csv ...]
+#include <torque_limit_monitor.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr int32_t RAW_TORQUE_SENSOR_MIN = 100;
+constexpr int32_t RAW_TORQUE_SENSOR_MAX = 3995;
+constexpr int32_t RAW_TORQUE_SENSOR_FULL_SCALE = 4095;
+constexpr uint32_t DEFAULT_TORQUE_LIMIT_WINDOW = 4;
+constexpr int32_t DEFAULT_TORQUE_LIMIT_HYSTERESIS = 50;
+constexpr uint16_t FLIGHT_RECORD_TORQUE_LIMIT_TRIGGERED = 1u << 0;
+
+constexpr uint32_t CONVERSION_RATE_HZ = 100'000;
+constexpr double CONVERSION_INTERVAL_US = 1e6 / CONVERSION_RATE_HZ;
+constexpr int32_t MID_SCALE = 2048;
+
+struct trace_sample_t
+{
+    uint32_t time_us;
+    int32_t raw;
+};
+
+using Trace = std::vector<trace_sample_t>;
+
+struct replay_result_t
+{
+    size_t trips;
+    size_t index; // Of the first sample that tripped, if any.
+
+    bool tripped() const {return trips > 0;}
+};
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+void configure_defaults(TorqueLimitMonitor& monitor)
+{
+    monitor.set_limits(RAW_TORQUE_SENSOR_MIN, RAW_TORQUE_SENSOR_MAX);
+    monitor.set_window(DEFAULT_TORQUE_LIMIT_WINDOW);
+    monitor.set_hysteresis(DEFAULT_TORQUE_LIMIT_HYSTERESIS);
+    monitor.set_enabled(true);
+    monitor.reset();
+}
+
+/**
+ * \brief feed trace[begin, end) to the monitor, as the firmware feeds it
+ *  every conversion whether or not it has tripped.
+ */
+replay_result_t replay(TorqueLimitMonitor& monitor, const Trace& trace,
+                       size_t begin = 0, size_t end = SIZE_MAX)
+{
+    end = (end < trace.size()) ? end : trace.size();
+    replay_result_t result{0, end};
+    for (size_t i = begin; i < end; ++i)
+    {
+        if (!monitor.add_sample(trace[i].raw, trace[i].time_us))
+            continue;
+        if (result.trips++ == 0)
+            result.index = i;
+    }
+    return result;
+}
+
+bool is_raw_in_range(int32_t raw)
+{return raw > RAW_TORQUE_SENSOR_MIN && raw < RAW_TORQUE_SENSOR_MAX;}
+
+/**
+ * \brief builds a conversion-rate trace from a torque profile plus sensor
+ *  noise, clamped to the ADC's range.
+ */
+class TraceBuilder
+{
+public:
+    explicit TraceBuilder(uint32_t seed, double noise_counts = 6)
+    : rng_(seed), noise_(0, noise_counts), time_us_{4'294'000'000} {}
+
+/**
+ * \brief append duration_s of profile(t), with t from 0 over the segment.
+ */
+    template <typename Profile>
+    void add(double duration_s, Profile profile)
+    {
+        const size_t count = size_t(lround(duration_s * CONVERSION_RATE_HZ));
+        for (size_t i = 0; i < count; ++i)
+        {
+            const double t = i / double(CONVERSION_RATE_HZ);
+            const long raw = lround(profile(t) + noise_(rng_));
+            trace_.push_back({uint32_t(llround(time_us_)),
+                              int32_t(std::min(std::max(raw, 0L),
+                                               long(RAW_TORQUE_SENSOR_FULL_SCALE)))});
+            time_us_ += CONVERSION_INTERVAL_US;
+        }
+    }
+
+/**
+ * \brief replace one conversion with a glitch, without noise.
+ */
+    void glitch(size_t index, int32_t raw) {trace_[index].raw = raw;}
+
+    const Trace& trace() const {return trace_;}
+
+private:
+    std::mt19937 rng_;
+    std::normal_distribution<double> noise_;
+    double time_us_; // Deliberately wraps the 32-bit microsecond counter.
+    Trace trace_;
+};
+
+/**
+ * \brief walking: stepping impacts of up to +/-1500 counts about every
+ *  400 [ms], i.e: well inside the limits.
+ */
+double walking(double t)
+{
+    const double phase = fmod(t, 0.4);
+    const double impact = (phase < 0.08) ? sin(M_PI * phase / 0.08) : 0;
+    const double sign = (fmod(t, 0.8) < 0.4) ? 1 : -1;
+    return MID_SCALE + sign * 1500 * impact + 150 * sin(2 * M_PI * 1.3 * t);
+}
+
+bool check_walking()
+{
+    TraceBuilder builder(1);
+    builder.add(20, walking);
+    TorqueLimitMonitor monitor;
+    configure_defaults(monitor);
+    const replay_result_t result = replay(monitor, builder.trace());
+    return check("Walking does not trip", !result.tripped());
+}
+
+bool check_overload()
+{
+    // Overload from walking: torque ramps up past the high limit over
+    // 20 [ms], and, separately, down past the low limit.
+    bool ok = true;
+    for (const double target: {double(RAW_TORQUE_SENSOR_FULL_SCALE), 0.0})
+    {
+        TraceBuilder builder(2);
+        builder.add(1, walking);
+        const double start = walking(1);
+        builder.add(0.02, [&](double t){return start + (target - start) * t / 0.02;});
+        builder.add(0.05, [&](double){return target;});
+        const Trace& trace = builder.trace();
+        TorqueLimitMonitor monitor;
+        configure_defaults(monitor);
+        const replay_result_t result = replay(monitor, trace);
+        // The first raw sample of the excursion that tripped.
+        size_t first = result.index;
+        while (first > 0 && !is_raw_in_range(trace[first - 1].raw))
+            --first;
+        // Latched: the monitor reports the trip once.
+        ok &= result.trips == 1 && monitor.tripped()
+              && monitor.trip_sample_time_us() == trace[first].time_us
+              && result.index - first < DEFAULT_TORQUE_LIMIT_WINDOW;
+    }
+    return check("Overload trips within the window of the excursion", ok);
+}
+
+bool check_window()
+{
+    // Single-conversion glitches to either rail, e.g: a bit error on the
+    // ADC's serial link, are averaged out by the default window but trip a
+    // window of one.
+    TraceBuilder builder(3);
+    builder.add(1, walking);
+    for (size_t i = 10'000; i < builder.trace().size(); i += 9'973)
+        builder.glitch(i, ((i / 9'973) % 2) ? RAW_TORQUE_SENSOR_FULL_SCALE : 0);
+    TorqueLimitMonitor monitor;
+    configure_defaults(monitor);
+    bool ok = !replay(monitor, builder.trace()).tripped();
+    // A window full of them is not.
+    for (size_t i = 0; i < DEFAULT_TORQUE_LIMIT_WINDOW; ++i)
+        builder.glitch(50'001 + i, RAW_TORQUE_SENSOR_FULL_SCALE);
+    configure_defaults(monitor);
+    replay_result_t result = replay(monitor, builder.trace());
+    ok &= result.tripped()
+          && result.index == 50'000 + DEFAULT_TORQUE_LIMIT_WINDOW
+          && monitor.trip_sample_time_us() == builder.trace()[50'001].time_us;
+    TorqueLimitMonitor unfiltered;
+    configure_defaults(unfiltered);
+    ok &= unfiltered.set_window(1) && unfiltered.window() == 1;
+    result = replay(unfiltered, builder.trace());
+    ok &= result.tripped() && result.index == 10'000;
+    // Invalid windows are rejected and leave the window unchanged.
+    ok &= !unfiltered.set_window(3) && !unfiltered.set_window(64)
+          && !unfiltered.set_window(0) && unfiltered.window() == 1;
+    return check("The window rejects single-conversion glitches", ok);
+}
+
+bool check_rail_faults()
+{
+    // A sensor that fails to either rail (e.g: a broken wire or a shorted
+    // bridge) trips within the window, and the trip cannot be cleared
+    // until the sensor is back.
+    bool ok = true;
+    for (const int32_t rail: {RAW_TORQUE_SENSOR_FULL_SCALE, 0})
+    {
+        TraceBuilder builder(4, 0);
+        builder.add(0.1, [](double){return double(MID_SCALE);});
+        const size_t fault = builder.trace().size();
+        builder.add(0.5, [&](double){return double(rail);});
+        const size_t recovery = builder.trace().size();
+        builder.add(0.1, [](double){return double(MID_SCALE);});
+        const Trace& trace = builder.trace();
+        TorqueLimitMonitor monitor;
+        configure_defaults(monitor);
+        // Trips once the whole window is on the rail.
+        const replay_result_t result = replay(monitor, trace, 0, recovery);
+        ok &= result.trips == 1
+              && result.index == fault + DEFAULT_TORQUE_LIMIT_WINDOW - 1
+              && monitor.trip_sample_time_us() == trace[fault].time_us;
+        ok &= !monitor.clear() && monitor.tripped();
+        // A single in-range conversion brings the mean far enough inside.
+        replay(monitor, trace, recovery, recovery + 1);
+        ok &= monitor.clear() && !monitor.tripped();
+        ok &= !replay(monitor, trace, recovery + 1).tripped();
+    }
+    return check("A sensor stuck on a rail trips and holds the trip", ok);
+}
+
+bool check_hysteresis()
+{
+    // After an overload, torque hovers just inside the high limit. It may
+    // only be cleared once it is inside by the hysteresis.
+    TraceBuilder builder(5, 3);
+    builder.add(0.1, [](double){return double(MID_SCALE);});
+    builder.add(0.01, [](double){return double(RAW_TORQUE_SENSOR_FULL_SCALE);});
+    const size_t near = builder.trace().size();
+    builder.add(0.1, [](double)
+    {return double(RAW_TORQUE_SENSOR_MAX - DEFAULT_TORQUE_LIMIT_HYSTERESIS / 2);});
+    const size_t inside = builder.trace().size();
+    builder.add(0.1, [](double)
+    {return double(RAW_TORQUE_SENSOR_MAX - 2 * DEFAULT_TORQUE_LIMIT_HYSTERESIS);});
+    const Trace& trace = builder.trace();
+    TorqueLimitMonitor monitor;
+    configure_defaults(monitor);
+    bool ok = replay(monitor, trace, 0, near).tripped();
+    replay(monitor, trace, near, inside);
+    ok &= monitor.filtered() < RAW_TORQUE_SENSOR_MAX && !monitor.clear();
+    replay(monitor, trace, inside, inside + 100);
+    ok &= monitor.clear();
+    ok &= !replay(monitor, trace, inside + 100).tripped();
+    // Without hysteresis, the same trace clears while still near the limit.
+    TorqueLimitMonitor no_hysteresis;
+    configure_defaults(no_hysteresis);
+    no_hysteresis.set_hysteresis(0);
+    replay(no_hysteresis, trace, 0, inside);
+    ok &= no_hysteresis.clear();
+    return check("A trip only clears inside the hysteresis", ok);
+}
+
+bool check_enable()
+{
+    // Disabled, a rail fault does not trip but is still filtered, so that
+    // enabling on the rail trips on the next sample. The excursion predates
+    // enabling, so the trip is timed from the sample that tripped.
+    TraceBuilder builder(6, 0);
+    builder.add(0.01, [](double){return double(MID_SCALE);});
+    builder.add(0.01, [](double){return double(RAW_TORQUE_SENSOR_FULL_SCALE);});
+    const Trace& trace = builder.trace();
+    TorqueLimitMonitor monitor;
+    configure_defaults(monitor);
+    monitor.set_enabled(false);
+    bool ok = !replay(monitor, trace, 0, trace.size() - 10).tripped()
+              && monitor.filtered() == RAW_TORQUE_SENSOR_FULL_SCALE;
+    monitor.set_enabled(true);
+    const replay_result_t result = replay(monitor, trace, trace.size() - 10);
+    ok &= result.tripped() && result.index == trace.size() - 10
+          && monitor.trip_sample_time_us() == trace[result.index].time_us;
+    // reset() clears the trip and the history.
+    monitor.reset();
+    ok &= !monitor.tripped()
+          && !replay(monitor, {{0, MID_SCALE}, {10, MID_SCALE}}).tripped()
+          && monitor.filtered() == MID_SCALE;
+    return check("Enabling on an out-of-range signal trips at once", ok);
+}
+
+/**
+ * \brief load the torque column of a flight recorder capture.
+ * \param trigger_index first record flagged as tripped, or SIZE_MAX.
+ * \returns false if the file could not be read.
+ */
+bool load_capture(const char* path, Trace& trace, size_t& trigger_index)
+{
+    std::ifstream file(path);
+    std::string line;
+    if (!std::getline(file, line)
+        || line.rfind("time_us,encoder,torque", 0) != 0)
+        return false;
+    trigger_index = SIZE_MAX;
+    while (std::getline(file, line))
+    {
+        std::istringstream row(line);
+        std::string field;
+        long fields[6];
+        size_t count = 0;
+        while (count < 6 && std::getline(row, field, ','))
+            fields[count++] = std::stol(field);
+        if (count != 6)
+            return false;
+        if ((fields[5] & FLIGHT_RECORD_TORQUE_LIMIT_TRIGGERED)
+            && trigger_index == SIZE_MAX)
+            trigger_index = trace.size();
+        trace.push_back({uint32_t(fields[0]), int32_t(int16_t(fields[2]))});
+    }
+    return !trace.empty();
+}
+
+bool check_capture(const char* path)
+{
+    // Records are latched at 10 [kHz], a fraction of the conversions that
+    // the device checked, so the replay is allowed to trip up to a window
+    // of records later than the device flagged the trip.
+    Trace trace;
+    size_t trigger_index = SIZE_MAX;
+    if (!load_capture(path, trace, trigger_index))
+    {
+        printf("Could not read %s.\n", path);
+        return false;
+    }
+    TorqueLimitMonitor monitor;
+    configure_defaults(monitor);
+    const replay_result_t result = replay(monitor, trace);
+    bool ok;
+    if (trigger_index == SIZE_MAX)
+        ok = !result.tripped();
+    else
+        ok = result.tripped() && result.index <= trigger_index
+                                               + DEFAULT_TORQUE_LIMIT_WINDOW;
+    printf("%s: %zu records, device trip at %s, replay trip at %s.\n", path,
+           trace.size(),
+           (trigger_index == SIZE_MAX) ? "none"
+                                       : std::to_string(trigger_index).c_str(),
+           result.tripped() ? std::to_string(result.index).c_str() : "none");
+    return check("Capture replay matches the device", ok);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    bool ok = check_walking();
+    ok &= check_overload();
+    ok &= check_window();
+    ok &= check_rail_faults();
+    ok &= check_hysteresis();
+    ok &= check_enable();
+    for (int i = 1; i < argc; ++i)
+        ok &= check_capture(argv[i]);
+    return ok ? 0 : 1;
+}
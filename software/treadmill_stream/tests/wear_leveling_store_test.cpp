@@ -0,0 +1,392 @@
+// Drive the firmware's WearLevelingStore with a RAM stand-in for the
+// persistent config flash region, as sized on the device.
+// Programming can only clear bits and erasing sets a whole sector, as with
+// NOR flash, and programming can be cut short to stand in for a power loss.
+// The store is re-initialized from the same flash to stand in for a power
+// cycle.
+// Checks cover saves that are torn or do not read back, a sequence number
+// that wraps, and the log rolling over from sector to sector for many laps of
+// the region without ever losing the current record.
+// Then, on the simulated device of firmware_sim, PersistentConfig must only
+// write flash when the host asks: saves are accepted while events stream,
+// a full sector is never erased behind the host's back, and the pending
+// erase is reported until the host writes Erase.
+// Usage: wear_leveling_store_test
+#include <wear_leveling_store.h>
+#include <crc32.h>
+#include <firmware_sim.h>
+#include <treadmill_stream.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+// Same as the firmware.
+constexpr size_t NUM_SECTORS = 4;
+constexpr uint16_t VERSION = 1;
+constexpr uint8_t BRAKE_CURRENT_SETPOINT_ADDRESS = 37;
+constexpr uint8_t PERSISTENT_CONFIG_ADDRESS = 85;
+constexpr uint8_t PERSISTENT_CONFIG_SAVE = 1;
+constexpr uint8_t PERSISTENT_CONFIG_ERASE = 4;
+constexpr uint8_t PERSISTENT_CONFIG_SAVED = 1u << 0;
+constexpr uint8_t PERSISTENT_CONFIG_ERASE_PENDING = 1u << 1;
+
+constexpr size_t REGION_SIZE = NUM_SECTORS * WearLevelingStore::SECTOR_SIZE;
+constexpr size_t NUM_SLOTS = NUM_SECTORS * WearLevelingStore::SLOTS_PER_SECTOR;
+constexpr size_t NUM_LAPS = 10;
+
+uint8_t flash[REGION_SIZE];
+size_t erase_counts[NUM_SECTORS];
+size_t bad_writes; // Unaligned, or outside the region.
+size_t program_limit = SIZE_MAX; // Bytes programmed before a power loss.
+size_t corrupt_offset = SIZE_MAX; // Byte of a page that programs wrong.
+
+void erase_sector(uint32_t offset)
+{
+    if (offset % WearLevelingStore::SECTOR_SIZE || offset >= REGION_SIZE)
+    {
+        ++bad_writes;
+        return;
+    }
+    memset(flash + offset, 0xFF, WearLevelingStore::SECTOR_SIZE);
+    ++erase_counts[offset / WearLevelingStore::SECTOR_SIZE];
+}
+
+void program_page(uint32_t offset, const uint8_t* data, size_t num_bytes)
+{
+    if (offset % WearLevelingStore::SLOT_SIZE
+        || offset + num_bytes > REGION_SIZE)
+    {
+        ++bad_writes;
+        return;
+    }
+    num_bytes = (num_bytes < program_limit) ? num_bytes : program_limit;
+    for (size_t i = 0; i < num_bytes; ++i)
+        flash[offset + i] &= data[i] ^ ((i == corrupt_offset) ? 0x01 : 0x00);
+}
+
+void erase_all()
+{
+    memset(flash, 0xFF, sizeof(flash));
+    memset(erase_counts, 0, sizeof(erase_counts));
+    bad_writes = 0;
+    program_limit = SIZE_MAX;
+    corrupt_offset = SIZE_MAX;
+}
+
+bool check(const char* name, bool ok)
+{
+    printf("%s: %s\n", name, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+struct payload_t
+{
+    uint32_t value;
+    uint8_t padding[60]; // About the size of the firmware's config.
+};
+
+bool save(WearLevelingStore& store, uint32_t value)
+{
+    payload_t payload;
+    payload.value = value;
+    memset(payload.padding, uint8_t(value), sizeof(payload.padding));
+    return store.save(VERSION, &payload, sizeof(payload));
+}
+
+/**
+ * \brief whether the current record is the payload saved with value.
+ */
+bool holds(const WearLevelingStore& store, uint32_t value)
+{
+    uint16_t version = 0;
+    uint16_t num_bytes = 0;
+    const uint8_t* data = store.latest(version, num_bytes);
+    if (data == nullptr || version != VERSION || num_bytes != sizeof(payload_t))
+        return false;
+    payload_t payload;
+    memcpy(&payload, data, sizeof(payload));
+    return payload.value == value && payload.padding[0] == uint8_t(value);
+}
+
+/**
+ * \brief slot index of the current record.
+ */
+size_t latest_slot(const WearLevelingStore& store)
+{
+    uint16_t version;
+    uint16_t num_bytes;
+    const uint8_t* data = store.latest(version, num_bytes);
+    return size_t(data - WearLevelingStore::HEADER_SIZE - flash)
+           / WearLevelingStore::SLOT_SIZE;
+}
+
+/**
+ * \brief program a record with the specified sequence number into a slot,
+ *  as an earlier save would have.
+ */
+void program_record(size_t slot, uint32_t sequence, uint32_t value)
+{
+    uint8_t buffer[WearLevelingStore::SLOT_SIZE];
+    memset(buffer, 0xFF, sizeof(buffer));
+    const uint32_t magic = WearLevelingStore::MAGIC;
+    const uint16_t version = VERSION;
+    const uint16_t length = sizeof(payload_t);
+    memcpy(buffer, &magic, 4);
+    memcpy(buffer + 4, &sequence, 4);
+    memcpy(buffer + 8, &version, 2);
+    memcpy(buffer + 10, &length, 2);
+    payload_t payload;
+    payload.value = value;
+    memset(payload.padding, uint8_t(value), sizeof(payload.padding));
+    memcpy(buffer + WearLevelingStore::HEADER_SIZE, &payload, sizeof(payload));
+    const uint32_t crc = crc32(buffer, WearLevelingStore::HEADER_SIZE
+                                       + sizeof(payload));
+    memcpy(buffer + sizeof(buffer) - sizeof(crc), &crc, sizeof(crc));
+    program_page(uint32_t(slot * WearLevelingStore::SLOT_SIZE), buffer,
+                 sizeof(buffer));
+}
+
+/**
+ * \brief the store as the firmware sets it up at power-up.
+ */
+WearLevelingStore make_store()
+{
+    WearLevelingStore store(flash, NUM_SECTORS, erase_sector, program_page);
+    store.init();
+    return store;
+}
+
+bool check_blank_and_power_cycle()
+{
+    erase_all();
+    WearLevelingStore store = make_store();
+    uint16_t version;
+    uint16_t num_bytes;
+    bool ok = store.latest(version, num_bytes) == nullptr
+              && store.sequence() == 0 && !store.erase_pending();
+    ok &= save(store, 1) && save(store, 2) && holds(store, 2)
+          && store.sequence() == 2;
+    // Too big for a slot.
+    uint8_t big[WearLevelingStore::MAX_PAYLOAD_SIZE + 1] = {};
+    ok &= !store.save(VERSION, big, sizeof(big)) && holds(store, 2);
+    // Forget, as the firmware does it: an empty record.
+    ok &= store.save(VERSION, nullptr, 0) && store.latest(version, num_bytes)
+          && num_bytes == 0;
+    ok &= save(store, 3);
+    const WearLevelingStore restarted = make_store();
+    ok &= holds(restarted, 3) && restarted.sequence() == 4
+          && latest_slot(restarted) == 3 && bad_writes == 0;
+    return check("Records survive a power cycle", ok);
+}
+
+bool check_torn_slots()
+{
+    erase_all();
+    WearLevelingStore store = make_store();
+    bool ok = save(store, 1) && save(store, 2);
+    // Power lost partway through programming the third: header but no CRC.
+    program_limit = 40;
+    ok &= !save(store, 3) && holds(store, 2);
+    program_limit = SIZE_MAX;
+    WearLevelingStore restarted = make_store();
+    ok &= holds(restarted, 2) && latest_slot(restarted) == 1;
+    // The torn slot is never reused: the next save goes after it.
+    ok &= save(restarted, 4) && holds(restarted, 4)
+          && latest_slot(restarted) == 3;
+    // A save that does not read back is refused, and its slot skipped too.
+    corrupt_offset = 20;
+    ok &= !save(restarted, 5) && holds(restarted, 4);
+    corrupt_offset = SIZE_MAX;
+    ok &= save(restarted, 6) && latest_slot(restarted) == 5;
+    // Same, but the bad byte is outside the CRC, so the refused record still
+    // looks valid after a reset. The save after it must still win.
+    corrupt_offset = WearLevelingStore::SLOT_SIZE / 2;
+    ok &= !save(restarted, 7) && holds(restarted, 6);
+    corrupt_offset = SIZE_MAX;
+    ok &= save(restarted, 8) && latest_slot(restarted) == 7;
+    restarted.init();
+    ok &= holds(restarted, 8) && latest_slot(restarted) == 7
+          && bad_writes == 0;
+    return check("Torn and corrupted slots are skipped", ok);
+}
+
+bool check_sequence_wrap()
+{
+    erase_all();
+    // Records that an old device left just short of the wrap, one of them
+    // in another sector.
+    program_record(0, UINT32_MAX - 3, 100);
+    program_record(1, UINT32_MAX - 2, 101);
+    program_record(WearLevelingStore::SLOTS_PER_SECTOR + 3, UINT32_MAX - 4, 99);
+    WearLevelingStore store = make_store();
+    bool ok = holds(store, 101) && store.sequence() == UINT32_MAX - 2;
+    for (uint32_t value = 102; value < 108; ++value)
+        ok &= save(store, value);
+    // Sequence numbers 0xFFFFFFFE, 0xFFFFFFFF, 0, 1, 2, 3.
+    ok &= store.sequence() == 3 && holds(store, 107);
+    const WearLevelingStore restarted = make_store();
+    ok &= holds(restarted, 107) && restarted.sequence() == 3
+          && latest_slot(restarted) == 7;
+    return check("The newest record wins across the sequence wrap", ok);
+}
+
+bool check_sector_rollover()
+{
+    erase_all();
+    WearLevelingStore store = make_store();
+    uint32_t last_saved = 0;
+    size_t num_saves = 0;
+    size_t refused_while_pending = 0;
+    size_t erases_done = 0;
+    bool ok = true;
+    for (uint32_t value = 1; num_saves < NUM_LAPS * NUM_SLOTS; ++value)
+    {
+        if (store.erase_pending())
+        {
+            // Saves wait for the erase, and erasing the next sector never
+            // takes the current record with it.
+            refused_while_pending += !save(store, value);
+            ok &= holds(store, last_saved);
+            store.service_erase();
+            ++erases_done;
+            ok &= !store.erase_pending() && holds(store, last_saved);
+            continue;
+        }
+        if (!save(store, value))
+        {
+            ok = false;
+            break;
+        }
+        ++num_saves;
+        last_saved = value;
+        // A power cycle now and then, sometimes with an erase pending. init()
+        // finds everything again from flash.
+        if (value % 13 == 0)
+        {
+            store.init();
+            ok &= holds(store, last_saved);
+        }
+    }
+    size_t min_erases = SIZE_MAX;
+    size_t max_erases = 0;
+    for (const size_t count: erase_counts)
+    {
+        min_erases = (count < min_erases) ? count : min_erases;
+        max_erases = (count > max_erases) ? count : max_erases;
+    }
+    printf("%zu saves over %zu laps of %zu sectors: %zu erases, %zu to %zu "
+           "per sector, %zu saves refused while an erase was pending.\n",
+           num_saves, NUM_LAPS, NUM_SECTORS, erases_done, min_erases,
+           max_erases, refused_while_pending);
+    // Every sector is erased once per lap, except on the first one when
+    // the region starts out blank.
+    ok &= erases_done == (NUM_LAPS - 1) * NUM_SECTORS
+          && min_erases == NUM_LAPS - 1 && max_erases == NUM_LAPS - 1
+          && refused_while_pending == erases_done
+          && store.sequence() == num_saves && bad_writes == 0;
+    return check("The log rolls over sectors and wears them evenly", ok);
+}
+
+/**
+ * \brief belt at rest, and mid-scale torque.
+ */
+class Treadmill: public SensorModel
+{
+public:
+    int32_t encoder_counts(uint32_t, uint64_t) override {return 0;}
+    uint16_t torque_counts(uint64_t) override {return 2048;}
+    uint16_t brake_current_counts(uint64_t, uint16_t) override {return 10;}
+};
+
+struct device_output_t
+{
+    uint8_t config_reply = 0; // Message type of the last PersistentConfig reply.
+    uint8_t config = 0; // Last PersistentConfig value read.
+    size_t num_events = 0; // SensorData.
+};
+
+device_output_t run_device(uint64_t duration_us)
+{
+    sim_run_us(duration_us);
+    const std::vector<uint8_t> output = sim_take_usb_output();
+    device_output_t result;
+    HarpFrameParser parser;
+    parser.parse(output.data(), output.size(), [&result](const harp_frame_t& frame)
+    {
+        result.num_events += frame.message_type == HARP_EVENT
+                             && frame.address == SENSOR_DATA_ADDRESS;
+        if (frame.address != PERSISTENT_CONFIG_ADDRESS)
+            return;
+        result.config_reply = frame.message_type;
+        if (frame.message_type == HARP_READ)
+            result.config = frame.element<uint8_t>(0);
+    });
+    return result;
+}
+
+uint8_t write_config(uint8_t action)
+{
+    sim_write_register(PERSISTENT_CONFIG_ADDRESS, HARP_U8, &action, 1);
+    return run_device(1000).config_reply;
+}
+
+uint8_t read_config()
+{
+    sim_read_register(PERSISTENT_CONFIG_ADDRESS);
+    return run_device(1000).config;
+}
+
+bool check_device()
+{
+    Treadmill treadmill;
+    sim_boot(treadmill);
+    sim_run_us(10'000);
+    const uint16_t rate_hz = 1000;
+    sim_write_register(SENSOR_DISPATCH_FREQUENCY_ADDRESS, HARP_U16, &rate_hz,
+                       sizeof(rate_hz));
+    run_device(10'000);
+    // The region starts out blank, so one lap of saves fills it and the
+    // next one needs the first sector erased.
+    size_t saves = 0;
+    while (saves < NUM_SLOTS
+           && write_config(PERSISTENT_CONFIG_SAVE) == HARP_WRITE)
+        ++saves;
+    bool ok = saves == NUM_SLOTS;
+    const uint8_t full = read_config();
+    ok &= full == (PERSISTENT_CONFIG_SAVED | PERSISTENT_CONFIG_ERASE_PENDING);
+    // Nothing erases while the host does not ask, and events keep flowing.
+    const device_output_t idle = run_device(500'000);
+    const uint8_t still_full = read_config();
+    ok &= still_full == full && idle.num_events + 1 >= 500;
+    ok &= write_config(PERSISTENT_CONFIG_SAVE) == HARP_WRITE_ERROR;
+    // Not while the brake is in use.
+    const uint16_t setpoint = 1000;
+    sim_write_register(BRAKE_CURRENT_SETPOINT_ADDRESS, HARP_U16, &setpoint,
+                       sizeof(setpoint));
+    ok &= write_config(PERSISTENT_CONFIG_ERASE) == HARP_WRITE_ERROR
+          && read_config() == full;
+    const uint16_t no_setpoint = 0;
+    sim_write_register(BRAKE_CURRENT_SETPOINT_ADDRESS, HARP_U16, &no_setpoint,
+                       sizeof(no_setpoint));
+    ok &= write_config(PERSISTENT_CONFIG_ERASE) == HARP_WRITE
+          && read_config() == PERSISTENT_CONFIG_SAVED;
+    ok &= write_config(PERSISTENT_CONFIG_SAVE) == HARP_WRITE
+          && read_config() == PERSISTENT_CONFIG_SAVED;
+    printf("%zu saves while dispatching at %u [Hz], then PersistentConfig "
+           "read 0x%02X, and 0x%02X after %zu events in 500 [ms].\n", saves,
+           rate_hz, full, still_full, idle.num_events);
+    return check("PersistentConfig only erases when the host asks", ok);
+}
+}
+
+int main()
+{
+    bool ok = check_blank_and_power_cycle();
+    ok &= check_torn_slots();
+    ok &= check_sequence_wrap();
+    ok &= check_sector_rollover();
+    ok &= check_device();
+    return ok ? 0 : 1;
+}